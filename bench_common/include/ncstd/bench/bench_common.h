@@ -0,0 +1,27 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+/**
+ * @brief Returns current time in seconds, suitable for measuring intervals
+*/
+double nc_bench_now();
+
+/**
+ * @brief Prevents the compiler from optimizing away computation of @p value
+*/
+void nc_bench_do_not_optimize(const void* value);
+
+/**
+ * @brief Prints benchmark result as a single tab-separated line:
+ * @p name, @p param, elapsed seconds and throughput in @p unit per second
+ *
+ * @param name benchmark name
+ * @param param benchmark parameter (e.g. input size or thread count)
+ * @param seconds elapsed time
+ * @param amount amount of processed work, measured in @p unit
+ * @param unit unit of work (e.g. "ops", "bytes")
+*/
+void nc_bench_report(const char* name, size_t param, double seconds, double amount, const char* unit);
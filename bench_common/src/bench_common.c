@@ -0,0 +1,23 @@
+#include "ncstd/bench/bench_common.h"
+
+#include <stdio.h>
+#include <time.h>
+
+
+static const void* volatile bench_sink;
+
+
+double nc_bench_now() {
+    struct timespec time;
+    timespec_get(&time, TIME_UTC);
+
+    return (double)time.tv_sec + (double)time.tv_nsec * 1e-9;
+}
+
+void nc_bench_do_not_optimize(const void* value) {
+    bench_sink = value;
+}
+
+void nc_bench_report(const char* name, size_t param, double seconds, double amount, const char* unit) {
+    printf("%s\t%zu\t%.6f s\t%.3e %s/s\n", name, param, seconds, amount / seconds, unit);
+}
@@ -0,0 +1,104 @@
+#include "ncstd/bench/bench_common.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "ncstd/containers/bit_set.h"
+
+
+// Random membership tests, intersection and popcount of NC_BitSet compared to byte-per-flag arrays,
+// that use 8x the memory. Configure with -mavx2 (or -march=native) to enable 256-bit bulk operations.
+//
+// Usage: ncstd_core_bench_bit_set [max_size] [total_operations]
+
+static uint32_t xorshift(uint32_t* state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+
+    return *state;
+}
+
+static void bench_bytes(size_t size, size_t operations) {
+    uint8_t* const a = calloc(size, 1);
+    uint8_t* const b = calloc(size, 1);
+    uint32_t state = 2463534242u;
+    for (size_t i = 0; i < size / 4; ++i) {
+        a[xorshift(&state) % size] = 1;
+        b[xorshift(&state) % size] = 1;
+    }
+
+    size_t hits = 0;
+    double start = nc_bench_now();
+    for (size_t i = 0; i < operations; ++i)
+        hits += a[xorshift(&state) % size];
+    nc_bench_report("bytes_test", size, nc_bench_now() - start, (double)operations, "ops");
+
+    const size_t rounds = operations / size + 1;
+    start = nc_bench_now();
+    for (size_t round = 0; round < rounds; ++round) {
+        for (size_t i = 0; i < size; ++i)
+            a[i] &= b[i];
+        nc_bench_do_not_optimize(a);
+    }
+    nc_bench_report("bytes_and", size, nc_bench_now() - start, (double)(rounds * size), "bits");
+
+    start = nc_bench_now();
+    for (size_t round = 0; round < rounds; ++round) {
+        for (size_t i = 0; i < size; ++i)
+            hits += b[i];
+        nc_bench_do_not_optimize(&hits);
+    }
+    nc_bench_report("bytes_count", size, nc_bench_now() - start, (double)(rounds * size), "bits");
+
+    nc_bench_do_not_optimize(&hits);
+    free(a);
+    free(b);
+}
+
+static void bench_bit_set(size_t size, size_t operations) {
+    NC_BitSet a = nc_bit_set_init_with_size(size);
+    NC_BitSet b = nc_bit_set_init_with_size(size);
+    uint32_t state = 2463534242u;
+    for (size_t i = 0; i < size / 4; ++i) {
+        nc_bit_set_set(&a, xorshift(&state) % size);
+        nc_bit_set_set(&b, xorshift(&state) % size);
+    }
+
+    size_t hits = 0;
+    double start = nc_bench_now();
+    for (size_t i = 0; i < operations; ++i)
+        hits += nc_bit_set_test(&a, xorshift(&state) % size);
+    nc_bench_report("bit_set_test", size, nc_bench_now() - start, (double)operations, "ops");
+
+    const size_t rounds = operations / size + 1;
+    start = nc_bench_now();
+    for (size_t round = 0; round < rounds; ++round) {
+        nc_bit_set_and(&a, &b);
+        nc_bench_do_not_optimize(nc_bit_set_words(&a));
+    }
+    nc_bench_report("bit_set_and", size, nc_bench_now() - start, (double)(rounds * size), "bits");
+
+    start = nc_bench_now();
+    for (size_t round = 0; round < rounds; ++round) {
+        hits += nc_bit_set_count(&b);
+        nc_bench_do_not_optimize(&hits);
+    }
+    nc_bench_report("bit_set_count", size, nc_bench_now() - start, (double)(rounds * size), "bits");
+
+    nc_bench_do_not_optimize(&hits);
+    nc_bit_set_destroy(&a);
+    nc_bit_set_destroy(&b);
+}
+
+int main(int argc, char* argv[]) {
+    const size_t max_size = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 1 << 26;
+    const size_t operations = argc > 2 ? (size_t)strtoull(argv[2], NULL, 10) : 1 << 26;
+
+    for (size_t size = 1 << 12; size <= max_size; size *= 16) {
+        bench_bytes(size, operations);
+        bench_bit_set(size, operations);
+    }
+
+    return 0;
+}
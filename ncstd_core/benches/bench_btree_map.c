@@ -0,0 +1,109 @@
+#include "ncstd/bench/bench_common.h"
+
+#include <stdlib.h>
+
+#include "ncstd/containers/btree_map.h"
+#include "ncstd/util/sort.h"
+
+
+// Random inserts, lookups and range scans of a B-tree map with uint64_t keys, bulk loading of sorted keys
+// compared to inserting them, and lookups compared to bsearch over a sorted array of the same keys.
+//
+// Usage: ncstd_core_bench_btree_map [max_size] [range_length]
+
+int bench_u64_cmp(const void* a, const void* b, void* data) {
+    (void)data;
+    const uint64_t left = *(const uint64_t*)a;
+    const uint64_t right = *(const uint64_t*)b;
+
+    return (left > right) - (left < right);
+}
+
+NC_DEFINE_BTREE_MAP(uint64_t, uint64_t, u64, bench_u64_cmp)
+NC_INSTANTIATE_BTREE_MAP(uint64_t, uint64_t, u64)
+
+static uint64_t xorshift(uint64_t* state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+
+    return *state;
+}
+
+static int compare_u64(const void* a, const void* b) {
+    return bench_u64_cmp(a, b, NULL);
+}
+
+static void bench_size(size_t size, size_t range_length) {
+    uint64_t* const keys = malloc(size * sizeof(uint64_t));
+    uint64_t* const sorted = malloc(size * sizeof(uint64_t));
+    uint64_t* const scratch = malloc(size * sizeof(uint64_t));
+    if (keys == NULL || sorted == NULL || scratch == NULL) {
+        free(keys);
+        free(sorted);
+        free(scratch);
+        return;
+    }
+
+    uint64_t state = 88172645463325252ull;
+    for (size_t i = 0; i < size; ++i)
+        keys[i] = xorshift(&state);
+
+    NC_BTREE_MAP(u64) map = nc_btree_map_u64_init();
+    double start = nc_bench_now();
+    for (size_t i = 0; i < size; ++i)
+        nc_btree_map_u64_insert(&map, keys[i], i);
+    nc_bench_report("btree_insert_random", size, nc_bench_now() - start, (double)size, "ops");
+
+    uint64_t sum = 0;
+    start = nc_bench_now();
+    for (size_t i = 0; i < size; ++i)
+        sum += *nc_btree_map_u64_get(&map, &keys[(i * 7919) % size]);
+    nc_bench_report("btree_get_random", size, nc_bench_now() - start, (double)size, "ops");
+
+    memcpy(sorted, keys, size * sizeof(uint64_t));
+    nc_radix_sort_u64(sorted, size, scratch);
+    start = nc_bench_now();
+    for (size_t i = 0; i < size; ++i)
+        sum += *(const uint64_t*)bsearch(&keys[(i * 7919) % size], sorted, size, sizeof(uint64_t), compare_u64);
+    nc_bench_report("bsearch_get_random", size, nc_bench_now() - start, (double)size, "ops");
+
+    const size_t scans = size / range_length > 0 ? size / range_length : 1;
+    start = nc_bench_now();
+    for (size_t i = 0; i < scans; ++i) {
+        NC_BTREE_MAP_CURSOR(u64) cursor = nc_btree_map_u64_lower_bound(&map, &keys[(i * 7919) % size]);
+        uint64_t* value;
+        for (size_t j = 0; j < range_length && nc_btree_map_u64_cursor_next(&cursor, NULL, &value); ++j)
+            sum += *value;
+    }
+    nc_bench_report("btree_range_scan", size, nc_bench_now() - start, (double)scans * (double)range_length, "elements");
+    nc_btree_map_u64_destroy(&map);
+
+    map = nc_btree_map_u64_init();
+    start = nc_bench_now();
+    for (size_t i = 0; i < size; ++i)
+        nc_btree_map_u64_insert(&map, sorted[i], sorted[i]);
+    nc_bench_report("btree_insert_sorted", size, nc_bench_now() - start, (double)size, "ops");
+    nc_btree_map_u64_destroy(&map);
+
+    map = nc_btree_map_u64_init();
+    start = nc_bench_now();
+    nc_btree_map_u64_bulk_load(&map, sorted, sorted, size);
+    nc_bench_report("btree_bulk_load", size, nc_bench_now() - start, (double)size, "ops");
+    nc_btree_map_u64_destroy(&map);
+
+    nc_bench_do_not_optimize(&sum);
+    free(keys);
+    free(sorted);
+    free(scratch);
+}
+
+int main(int argc, char* argv[]) {
+    const size_t max_size = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 1 << 22;
+    const size_t range_length = argc > 2 ? (size_t)strtoull(argv[2], NULL, 10) : 100;
+
+    for (size_t size = 1 << 10; size <= max_size; size *= 16)
+        bench_size(size, range_length);
+
+    return 0;
+}
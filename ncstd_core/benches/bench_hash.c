@@ -0,0 +1,49 @@
+#include "ncstd/bench/bench_common.h"
+
+#include <stdlib.h>
+
+#include "ncstd/util/hash.h"
+
+
+// Throughput of nc_hash_bytes and of NC_Hasher fed with 4 KiB chunks, for inputs from 1 byte to 1 MiB.
+//
+// Usage: ncstd_core_bench_hash [total_bytes]
+
+#define MAX_SIZE ((size_t)1 << 20)
+#define CHUNK_SIZE 4096
+#define MAX_ITERATIONS 50000000
+
+int main(int argc, char* argv[]) {
+    const size_t total_bytes = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : (size_t)1 << 28;
+
+    uint8_t* const bytes = malloc(MAX_SIZE);
+    for (size_t i = 0; i < MAX_SIZE; ++i)
+        bytes[i] = (uint8_t)(i * 31 + 7);
+
+    for (size_t size = 1; size <= MAX_SIZE; size *= 2) {
+        const size_t iterations = total_bytes / size < MAX_ITERATIONS ? total_bytes / size : MAX_ITERATIONS;
+        uint64_t hash = 0;
+
+        double start = nc_bench_now();
+        for (size_t i = 0; i < iterations; ++i)
+            hash ^= nc_hash_bytes(bytes, size);
+        const double one_shot_time = nc_bench_now() - start;
+
+        start = nc_bench_now();
+        for (size_t i = 0; i < iterations; ++i) {
+            NC_Hasher hasher = nc_hasher_init();
+            for (size_t offset = 0; offset < size; offset += CHUNK_SIZE)
+                nc_hasher_update(&hasher, bytes + offset, size - offset < CHUNK_SIZE ? size - offset : CHUNK_SIZE);
+            hash ^= nc_hasher_finish(&hasher);
+        }
+        const double streaming_time = nc_bench_now() - start;
+
+        nc_bench_do_not_optimize(&hash);
+        nc_bench_report("hash_bytes", size, one_shot_time, (double)iterations * (double)size, "bytes");
+        nc_bench_report("hasher", size, streaming_time, (double)iterations * (double)size, "bytes");
+    }
+
+    free(bytes);
+
+    return 0;
+}
@@ -0,0 +1,157 @@
+#include "ncstd/bench/bench_common.h"
+
+#include <stdlib.h>
+
+#include "ncstd/containers/heap.h"
+#include "ncstd/containers/unsafe/raw_buffer.h"
+
+
+// Push/pop throughput of generated heaps of uint32_t with arity 2, 4 and 8, O(n) heapify compared
+// to n pushes, and a binary heap written on top of NC_RawBuffer accessors with a comparison callback.
+//
+// Usage: ncstd_core_bench_heap [max_size] [total_elements]
+
+#define bench_u32_less(a, b) (*(a) < *(b))
+
+NC_DEFINE_HEAP_WITH_ARITY(uint32_t, u32_2, bench_u32_less, 2)
+NC_INSTANTIATE_HEAP(uint32_t, u32_2)
+NC_DEFINE_HEAP_WITH_ARITY(uint32_t, u32_4, bench_u32_less, 4)
+NC_INSTANTIATE_HEAP(uint32_t, u32_4)
+NC_DEFINE_HEAP_WITH_ARITY(uint32_t, u32_8, bench_u32_less, 8)
+NC_INSTANTIATE_HEAP(uint32_t, u32_8)
+
+static uint32_t xorshift(uint32_t* state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+
+    return *state;
+}
+
+#define BENCH_HEAP(name, heap_snake_case, size, rounds)                                                                 \
+    do {                                                                                                                \
+        uint32_t state = 2463534242u;                                                                                   \
+        uint64_t sum = 0;                                                                                               \
+        const double start = nc_bench_now();                                                                            \
+        for (size_t round = 0; round < (rounds); ++round) {                                                             \
+            NC_HEAP(heap_snake_case) heap = nc_heap_##heap_snake_case##_init();                                         \
+            for (size_t i = 0; i < (size); ++i)                                                                         \
+                nc_heap_##heap_snake_case##_push(&heap, xorshift(&state));                                              \
+            uint32_t value;                                                                                             \
+            while (nc_heap_##heap_snake_case##_pop(&heap, &value))                                                      \
+                sum += value;                                                                                           \
+            nc_heap_##heap_snake_case##_destroy(&heap);                                                                 \
+        }                                                                                                               \
+        nc_bench_do_not_optimize(&sum);                                                                                 \
+        nc_bench_report(name, (size), nc_bench_now() - start, (double)(size) * (double)(rounds), "elements");           \
+    } while (0)
+
+static int compare_u32(const void* a, const void* b) {
+    const uint32_t left = *(const uint32_t*)a;
+    const uint32_t right = *(const uint32_t*)b;
+
+    return (left > right) - (left < right);
+}
+
+static void raw_buffer_swap(NC_RawBuffer* buffer, size_t a, size_t b) {
+    const uint32_t left = *(uint32_t*)nc_raw_buffer_get(buffer, a, sizeof(uint32_t));
+    const uint32_t right = *(uint32_t*)nc_raw_buffer_get(buffer, b, sizeof(uint32_t));
+    nc_raw_buffer_set(buffer, &right, a, sizeof(uint32_t));
+    nc_raw_buffer_set(buffer, &left, b, sizeof(uint32_t));
+}
+
+static void bench_raw_buffer_heap(size_t size, size_t rounds, int (*compare)(const void*, const void*)) {
+    uint32_t state = 2463534242u;
+    uint64_t sum = 0;
+
+    const double start = nc_bench_now();
+    for (size_t round = 0; round < rounds; ++round) {
+        NC_RawBuffer buffer = nc_raw_buffer_init(sizeof(uint32_t));
+        size_t count = 0;
+
+        for (size_t i = 0; i < size; ++i) {
+            const uint32_t value = xorshift(&state);
+            nc_raw_buffer_grow_amorthized(&buffer, count + 1, 2, sizeof(uint32_t));
+            nc_raw_buffer_set(&buffer, &value, count, sizeof(uint32_t));
+
+            for (size_t index = count++; index > 0;) {
+                const size_t parent = (index - 1) / 2;
+                const void* const item = nc_raw_buffer_get(&buffer, index, sizeof(uint32_t));
+                if (compare(item, nc_raw_buffer_get(&buffer, parent, sizeof(uint32_t))) >= 0)
+                    break;
+                raw_buffer_swap(&buffer, index, parent);
+                index = parent;
+            }
+        }
+
+        while (count > 0) {
+            sum += *(uint32_t*)nc_raw_buffer_get(&buffer, 0, sizeof(uint32_t));
+            raw_buffer_swap(&buffer, 0, --count);
+
+            for (size_t index = 0;;) {
+                size_t best = index;
+                for (size_t child = 2 * index + 1; child <= 2 * index + 2 && child < count; ++child) {
+                    const void* const item = nc_raw_buffer_get(&buffer, child, sizeof(uint32_t));
+                    if (compare(item, nc_raw_buffer_get(&buffer, best, sizeof(uint32_t))) < 0)
+                        best = child;
+                }
+                if (best == index)
+                    break;
+                raw_buffer_swap(&buffer, index, best);
+                index = best;
+            }
+        }
+
+        nc_raw_buffer_free(&buffer, sizeof(uint32_t));
+    }
+
+    nc_bench_do_not_optimize(&sum);
+    nc_bench_report("raw_buffer_heap", size, nc_bench_now() - start, (double)size * (double)rounds, "elements");
+}
+
+static void bench_heapify(size_t size, size_t rounds) {
+    uint32_t state = 2463534242u;
+    double push_time = 0.0;
+    double heapify_time = 0.0;
+
+    for (size_t round = 0; round < rounds; ++round) {
+        NC_RawBuffer buffer = nc_raw_buffer_init_with_capacity(size, sizeof(uint32_t));
+        uint32_t* const data = nc_raw_buffer_data(&buffer);
+        for (size_t i = 0; i < size; ++i)
+            data[i] = xorshift(&state);
+
+        double start = nc_bench_now();
+        NC_HEAP(u32_4) pushed = nc_heap_u32_4_init();
+        for (size_t i = 0; i < size; ++i)
+            nc_heap_u32_4_push(&pushed, data[i]);
+        push_time += nc_bench_now() - start;
+        nc_bench_do_not_optimize(nc_heap_u32_4_peek(&pushed));
+        nc_heap_u32_4_destroy(&pushed);
+
+        start = nc_bench_now();
+        NC_HEAP(u32_4) heapified = nc_heap_u32_4_from_raw_buffer(buffer, size);
+        heapify_time += nc_bench_now() - start;
+        nc_bench_do_not_optimize(nc_heap_u32_4_peek(&heapified));
+        nc_heap_u32_4_destroy(&heapified);
+    }
+
+    nc_bench_report("heap_4_build_push", size, push_time, (double)size * (double)rounds, "elements");
+    nc_bench_report("heap_4_build_heapify", size, heapify_time, (double)size * (double)rounds, "elements");
+}
+
+int main(int argc, char* argv[]) {
+    const size_t max_size = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 1 << 22;
+    const size_t total = argc > 2 ? (size_t)strtoull(argv[2], NULL, 10) : 1 << 22;
+
+    for (size_t size = 1 << 10; size <= max_size; size *= 16) {
+        const size_t rounds = total / size > 0 ? total / size : 1;
+
+        BENCH_HEAP("heap_2_push_pop", u32_2, size, rounds);
+        BENCH_HEAP("heap_4_push_pop", u32_4, size, rounds);
+        BENCH_HEAP("heap_8_push_pop", u32_8, size, rounds);
+        bench_raw_buffer_heap(size, rounds, compare_u32);
+        bench_heapify(size, rounds);
+    }
+
+    return 0;
+}
@@ -0,0 +1,78 @@
+#include "ncstd/bench/bench_common.h"
+
+#include <stdlib.h>
+#include <threads.h>
+
+#include "ncstd/memory.h"
+
+
+// Multi-threaded alloc/free throughput of nc_malloc/nc_free compared to stdlib malloc/free.
+// Configure with NCSTD_FEATURE_ENABLE_THREAD_CACHE=ON to measure the thread cache.
+//
+// Usage: ncstd_core_bench_malloc [max_threads] [iterations_per_thread]
+
+#define WINDOW_SIZE 64
+#define MAX_THREADS 64
+
+typedef struct {
+    void* (*malloc_fn)(size_t size);
+    void (*free_fn)(void* ptr);
+    size_t iterations;
+} BenchArgs;
+
+static int bench_thread(void* arg) {
+    const BenchArgs* const args = arg;
+    void* window[WINDOW_SIZE] = { NULL };
+
+    uint32_t state = 2463534242u;
+    for (size_t i = 0; i < args->iterations; ++i) {
+        // xorshift32 to pick a slot and a size between 8 and 512 bytes
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+
+        const size_t slot = state % WINDOW_SIZE;
+        const size_t size = 8 + (state >> 8) % 505;
+
+        args->free_fn(window[slot]);
+        window[slot] = args->malloc_fn(size);
+        nc_bench_do_not_optimize(window[slot]);
+    }
+
+    for (size_t slot = 0; slot < WINDOW_SIZE; ++slot)
+        args->free_fn(window[slot]);
+
+    return 0;
+}
+
+static void run(const char* name, const BenchArgs* args, size_t thread_count) {
+    thrd_t threads[MAX_THREADS];
+
+    const double start = nc_bench_now();
+    for (size_t i = 0; i < thread_count; ++i)
+        thrd_create(&threads[i], bench_thread, (void*)args);
+    for (size_t i = 0; i < thread_count; ++i)
+        thrd_join(threads[i], NULL);
+    const double elapsed = nc_bench_now() - start;
+
+    // Each iteration performs one allocation and one deallocation
+    nc_bench_report(name, thread_count, elapsed, 2.0 * (double)args->iterations * (double)thread_count, "ops");
+}
+
+int main(int argc, char* argv[]) {
+    size_t max_threads = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 16;
+    const size_t iterations = argc > 2 ? (size_t)strtoull(argv[2], NULL, 10) : 2000000;
+
+    if (max_threads > MAX_THREADS)
+        max_threads = MAX_THREADS;
+
+    const BenchArgs libc_args = { .malloc_fn = malloc, .free_fn = free, .iterations = iterations };
+    const BenchArgs nc_args = { .malloc_fn = nc_malloc, .free_fn = nc_free, .iterations = iterations };
+
+    for (size_t thread_count = 1; thread_count <= max_threads; thread_count *= 2) {
+        run("malloc/free", &libc_args, thread_count);
+        run("nc_malloc/nc_free", &nc_args, thread_count);
+    }
+
+    return 0;
+}
@@ -0,0 +1,191 @@
+#include "ncstd/bench/bench_common.h"
+
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <threads.h>
+
+#include "ncstd/containers/mpmc_queue.h"
+#include "ncstd/containers/spsc_queue.h"
+
+
+// Throughput of NC_SpscQueue and NC_MpmcQueue for single and batched operations across
+// producer/consumer counts, and round-trip latency of NC_SpscQueue between two threads.
+// Producers and consumers spin with thrd_yield() when the queue is full or empty,
+// so results with more threads than cores mostly measure the scheduler.
+//
+// Usage: ncstd_core_bench_queue [max_threads] [total_elements]
+
+#define QUEUE_CAPACITY 1024
+#define MAX_BATCH_SIZE 32
+#define MAX_THREADS 16
+
+typedef struct {
+    NC_SpscQueue* queue;
+    NC_SpscQueue* reply_queue;
+    NC_MpmcQueue* mpmc_queue;
+    size_t count;
+    size_t batch_size;
+    atomic_size_t* consumed;
+    size_t total;
+} BenchArgs;
+
+static int spsc_producer(void* arg) {
+    const BenchArgs* const args = arg;
+    uint64_t batch[MAX_BATCH_SIZE] = { 0 };
+
+    for (size_t i = 0; i < args->count;) {
+        const size_t batch_size = args->count - i < args->batch_size ? args->count - i : args->batch_size;
+        const size_t pushed = nc_spsc_queue_push_batch(args->queue, batch, batch_size);
+        i += pushed;
+        if (pushed == 0)
+            thrd_yield();
+    }
+
+    return 0;
+}
+
+static void bench_spsc(size_t count, size_t batch_size) {
+    NC_SpscQueue queue = nc_spsc_queue_init(QUEUE_CAPACITY, sizeof(uint64_t));
+    const BenchArgs args = { .queue = &queue, .count = count, .batch_size = batch_size };
+    uint64_t batch[MAX_BATCH_SIZE];
+
+    const double start = nc_bench_now();
+    thrd_t producer;
+    thrd_create(&producer, spsc_producer, (void*)&args);
+    for (size_t i = 0; i < count;) {
+        const size_t popped = nc_spsc_queue_pop_batch(&queue, batch, batch_size);
+        i += popped;
+        if (popped == 0)
+            thrd_yield();
+    }
+    thrd_join(producer, NULL);
+    const double elapsed = nc_bench_now() - start;
+
+    nc_bench_do_not_optimize(batch);
+    nc_bench_report("spsc_throughput", batch_size, elapsed, (double)count, "elements");
+
+    nc_spsc_queue_destroy(&queue);
+}
+
+static int spsc_echo(void* arg) {
+    const BenchArgs* const args = arg;
+
+    for (size_t i = 0; i < args->count; ++i) {
+        uint64_t value;
+        while (!nc_spsc_queue_try_pop(args->queue, &value))
+            thrd_yield();
+        while (!nc_spsc_queue_try_push(args->reply_queue, &value))
+            thrd_yield();
+    }
+
+    return 0;
+}
+
+static void bench_spsc_latency(size_t count) {
+    NC_SpscQueue queue = nc_spsc_queue_init(QUEUE_CAPACITY, sizeof(uint64_t));
+    NC_SpscQueue reply_queue = nc_spsc_queue_init(QUEUE_CAPACITY, sizeof(uint64_t));
+    const BenchArgs args = { .queue = &queue, .reply_queue = &reply_queue, .count = count };
+
+    thrd_t echo;
+    thrd_create(&echo, spsc_echo, (void*)&args);
+
+    const double start = nc_bench_now();
+    for (uint64_t i = 0; i < count; ++i) {
+        uint64_t value = i;
+        nc_spsc_queue_try_push(&queue, &value);
+        while (!nc_spsc_queue_try_pop(&reply_queue, &value))
+            thrd_yield();
+    }
+    const double elapsed = nc_bench_now() - start;
+    thrd_join(echo, NULL);
+
+    nc_bench_report("spsc_round_trip", 1, elapsed, (double)count, "round_trips");
+
+    nc_spsc_queue_destroy(&queue);
+    nc_spsc_queue_destroy(&reply_queue);
+}
+
+static int mpmc_producer(void* arg) {
+    const BenchArgs* const args = arg;
+    uint64_t batch[MAX_BATCH_SIZE] = { 0 };
+
+    for (size_t i = 0; i < args->count;) {
+        const size_t batch_size = args->count - i < args->batch_size ? args->count - i : args->batch_size;
+        const size_t pushed = nc_mpmc_queue_push_batch(args->mpmc_queue, batch, batch_size);
+        i += pushed;
+        if (pushed == 0)
+            thrd_yield();
+    }
+
+    return 0;
+}
+
+static int mpmc_consumer(void* arg) {
+    const BenchArgs* const args = arg;
+    uint64_t batch[MAX_BATCH_SIZE];
+
+    while (atomic_load_explicit(args->consumed, memory_order_relaxed) < args->total) {
+        const size_t popped = nc_mpmc_queue_pop_batch(args->mpmc_queue, batch, args->batch_size);
+        if (popped == 0)
+            thrd_yield();
+        else
+            atomic_fetch_add_explicit(args->consumed, popped, memory_order_relaxed);
+    }
+    nc_bench_do_not_optimize(batch);
+
+    return 0;
+}
+
+static void bench_mpmc(size_t total, size_t producer_count, size_t consumer_count, size_t batch_size) {
+    NC_MpmcQueue queue = nc_mpmc_queue_init(QUEUE_CAPACITY, sizeof(uint64_t));
+    atomic_size_t consumed = 0;
+    const BenchArgs args = {
+        .mpmc_queue = &queue,
+        .count = total / producer_count,
+        .batch_size = batch_size,
+        .consumed = &consumed,
+        .total = total / producer_count * producer_count
+    };
+
+    thrd_t producers[MAX_THREADS];
+    thrd_t consumers[MAX_THREADS];
+
+    const double start = nc_bench_now();
+    for (size_t i = 0; i < consumer_count; ++i)
+        thrd_create(&consumers[i], mpmc_consumer, (void*)&args);
+    for (size_t i = 0; i < producer_count; ++i)
+        thrd_create(&producers[i], mpmc_producer, (void*)&args);
+    for (size_t i = 0; i < producer_count; ++i)
+        thrd_join(producers[i], NULL);
+    for (size_t i = 0; i < consumer_count; ++i)
+        thrd_join(consumers[i], NULL);
+    const double elapsed = nc_bench_now() - start;
+
+    char name[64];
+    snprintf(name, sizeof(name), "mpmc_%zup_%zuc_batch_%zu", producer_count, consumer_count, batch_size);
+    nc_bench_report(name, producer_count + consumer_count, elapsed, (double)args.total, "elements");
+
+    nc_mpmc_queue_destroy(&queue);
+}
+
+int main(int argc, char* argv[]) {
+    size_t max_threads = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 4;
+    const size_t total = argc > 2 ? (size_t)strtoull(argv[2], NULL, 10) : 10000000;
+
+    if (max_threads > MAX_THREADS)
+        max_threads = MAX_THREADS;
+
+    for (size_t batch_size = 1; batch_size <= MAX_BATCH_SIZE; batch_size *= 4)
+        bench_spsc(total, batch_size);
+    bench_spsc_latency(total / 10);
+
+    for (size_t producer_count = 1; producer_count <= max_threads; producer_count *= 2) {
+        for (size_t consumer_count = 1; consumer_count <= max_threads; consumer_count *= 2) {
+            bench_mpmc(total, producer_count, consumer_count, 1);
+            bench_mpmc(total, producer_count, consumer_count, 16);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,79 @@
+#include "ncstd/bench/bench_common.h"
+
+#include <stdlib.h>
+
+#include "ncstd/containers/segmented_vec.h"
+#include "ncstd/containers/unsafe/raw_buffer.h"
+
+
+// Append throughput and worst single append latency of NC_SegmentedVec compared to NC_RawBuffer
+// with amortized doubling, followed by sequential reads through indexing and through segments.
+//
+// Usage: ncstd_core_bench_segmented_vec [max_size]
+
+static void report_latency(const char* name, size_t size, double worst) {
+    nc_bench_report(name, size, worst, 1.0, "appends");
+}
+
+static void bench_raw_buffer(size_t size) {
+    NC_RawBuffer buffer = nc_raw_buffer_init(sizeof(uint64_t));
+    double worst = 0.0;
+
+    const double start = nc_bench_now();
+    for (uint64_t i = 0; i < size; ++i) {
+        const double append_start = nc_bench_now();
+        nc_raw_buffer_grow_amorthized(&buffer, i + 1, 2, sizeof(uint64_t));
+        nc_raw_buffer_set_unchecked(&buffer, &i, i, sizeof(uint64_t));
+        const double elapsed = nc_bench_now() - append_start;
+        worst = elapsed > worst ? elapsed : worst;
+    }
+    nc_bench_report("raw_buffer_append", size, nc_bench_now() - start, (double)size, "elements");
+    report_latency("raw_buffer_worst_append", size, worst);
+
+    nc_bench_do_not_optimize(nc_raw_buffer_data(&buffer));
+    nc_raw_buffer_free(&buffer, sizeof(uint64_t));
+}
+
+static void bench_segmented_vec(size_t size) {
+    NC_SegmentedVec vec = nc_segmented_vec_init(sizeof(uint64_t));
+    double worst = 0.0;
+
+    double start = nc_bench_now();
+    for (uint64_t i = 0; i < size; ++i) {
+        const double append_start = nc_bench_now();
+        nc_segmented_vec_push(&vec, &i);
+        const double elapsed = nc_bench_now() - append_start;
+        worst = elapsed > worst ? elapsed : worst;
+    }
+    nc_bench_report("segmented_vec_append", size, nc_bench_now() - start, (double)size, "elements");
+    report_latency("segmented_vec_worst_append", size, worst);
+
+    uint64_t sum = 0;
+    start = nc_bench_now();
+    for (size_t i = 0; i < size; ++i)
+        sum += *(const uint64_t*)nc_segmented_vec_get_unchecked(&vec, i);
+    nc_bench_report("segmented_vec_read_indexed", size, nc_bench_now() - start, (double)size, "elements");
+
+    start = nc_bench_now();
+    for (size_t segment = 0; segment < nc_segmented_vec_segment_count(&vec); ++segment) {
+        size_t segment_size = 0;
+        const uint64_t* const data = nc_segmented_vec_segment(&vec, segment, &segment_size);
+        for (size_t i = 0; i < segment_size; ++i)
+            sum += data[i];
+    }
+    nc_bench_report("segmented_vec_read_segments", size, nc_bench_now() - start, (double)size, "elements");
+
+    nc_bench_do_not_optimize(&sum);
+    nc_segmented_vec_destroy(&vec);
+}
+
+int main(int argc, char* argv[]) {
+    const size_t max_size = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 1 << 24;
+
+    for (size_t size = 1 << 12; size <= max_size; size *= 16) {
+        bench_raw_buffer(size);
+        bench_segmented_vec(size);
+    }
+
+    return 0;
+}
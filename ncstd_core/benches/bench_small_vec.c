@@ -0,0 +1,72 @@
+#include "ncstd/bench/bench_common.h"
+
+#include <stdlib.h>
+
+#include "ncstd/containers/small_vec.h"
+#include "ncstd/containers/unsafe/raw_buffer.h"
+
+
+// Cost of building and destroying a short-lived list with NC_SMALL_VEC(uint32_t, 8),
+// compared to NC_RawBuffer, that allocates on first use.
+//
+// Usage: ncstd_core_bench_small_vec [iterations]
+
+NC_DEFINE_SMALL_VEC(uint32_t, u32, 8)
+NC_INSTANTIATE_SMALL_VEC(uint32_t, u32, 8)
+
+static void bench_small_vec(size_t size, size_t iterations) {
+    uint64_t sum = 0;
+
+    const double start = nc_bench_now();
+    for (size_t iteration = 0; iteration < iterations; ++iteration) {
+        NC_SMALL_VEC(uint32_t, 8) vec = nc_small_vec_u32_8_init();
+        for (size_t i = 0; i < size; ++i)
+            nc_small_vec_u32_8_push(&vec, (uint32_t)(i + iteration));
+
+        for (size_t i = 0; i < size; ++i)
+            sum += *nc_small_vec_u32_8_get_unchecked(&vec, i);
+
+        nc_bench_do_not_optimize(&vec);
+        nc_small_vec_u32_8_destroy(&vec);
+    }
+    const double elapsed = nc_bench_now() - start;
+
+    nc_bench_do_not_optimize(&sum);
+    nc_bench_report("small_vec_8", size, elapsed, (double)iterations, "lists");
+}
+
+static void bench_raw_buffer(size_t size, size_t iterations) {
+    uint64_t sum = 0;
+
+    const double start = nc_bench_now();
+    for (size_t iteration = 0; iteration < iterations; ++iteration) {
+        NC_RawBuffer buffer = nc_raw_buffer_init(sizeof(uint32_t));
+        for (size_t i = 0; i < size; ++i) {
+            const uint32_t value = (uint32_t)(i + iteration);
+            nc_raw_buffer_grow_amorthized(&buffer, i + 1, 2, sizeof(uint32_t));
+            nc_raw_buffer_set_unchecked(&buffer, &value, i, sizeof(uint32_t));
+        }
+
+        for (size_t i = 0; i < size; ++i)
+            sum += *(const uint32_t*)nc_raw_buffer_get_unchecked(&buffer, i, sizeof(uint32_t));
+
+        nc_bench_do_not_optimize(&buffer);
+        nc_raw_buffer_free(&buffer, sizeof(uint32_t));
+    }
+    const double elapsed = nc_bench_now() - start;
+
+    nc_bench_do_not_optimize(&sum);
+    nc_bench_report("raw_buffer", size, elapsed, (double)iterations, "lists");
+}
+
+int main(int argc, char* argv[]) {
+    const size_t iterations = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 2000000;
+
+    const size_t sizes[] = { 0, 1, 2, 4, 8, 16, 32, 64 };
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i) {
+        bench_small_vec(sizes[i], iterations);
+        bench_raw_buffer(sizes[i], iterations);
+    }
+
+    return 0;
+}
@@ -0,0 +1,164 @@
+#include "ncstd/bench/bench_common.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "ncstd/util/sort.h"
+
+
+// Sorting throughput of stdlib qsort compared to generated pdqsort, stable merge sort and LSD radix sort,
+// on random uint32_t keys and on 16-byte records with a uint64_t key. Every round sorts a fresh copy
+// of the same random input, copying is not measured.
+//
+// Usage: ncstd_core_bench_sort [max_size] [total_elements]
+
+typedef struct {
+    uint64_t key;
+    uint64_t payload;
+} BenchRecord;
+
+#define bench_u32_less(a, b) (*(a) < *(b))
+#define bench_record_less(a, b) ((a)->key < (b)->key)
+#define bench_record_key(record) ((record)->key)
+
+NC_DEFINE_SORT(uint32_t, u32, bench_u32_less)
+NC_INSTANTIATE_SORT(uint32_t, u32)
+NC_DEFINE_SORT(BenchRecord, record, bench_record_less)
+NC_INSTANTIATE_SORT(BenchRecord, record)
+NC_DEFINE_RADIX_SORT(BenchRecord, record, bench_record_key)
+NC_INSTANTIATE_RADIX_SORT(BenchRecord, record)
+
+typedef enum {
+    BENCH_SORT_QSORT,
+    BENCH_SORT_UNSTABLE,
+    BENCH_SORT_STABLE,
+    BENCH_SORT_RADIX
+} BenchSortKind;
+
+static uint64_t xorshift(uint64_t* state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+
+    return *state;
+}
+
+static int compare_u32(const void* a, const void* b) {
+    const uint32_t left = *(const uint32_t*)a;
+    const uint32_t right = *(const uint32_t*)b;
+
+    return (left > right) - (left < right);
+}
+
+static int compare_record(const void* a, const void* b) {
+    const uint64_t left = ((const BenchRecord*)a)->key;
+    const uint64_t right = ((const BenchRecord*)b)->key;
+
+    return (left > right) - (left < right);
+}
+
+static void sort_u32(BenchSortKind kind, uint32_t* data, size_t size, uint32_t* scratch) {
+    switch (kind) {
+    case BENCH_SORT_QSORT: qsort(data, size, sizeof(uint32_t), compare_u32); break;
+    case BENCH_SORT_UNSTABLE: nc_sort_u32_unstable(data, size); break;
+    case BENCH_SORT_STABLE: nc_sort_u32_stable(data, size, scratch); break;
+    case BENCH_SORT_RADIX: nc_radix_sort_u32(data, size, scratch); break;
+    }
+}
+
+static void sort_record(BenchSortKind kind, BenchRecord* data, size_t size, BenchRecord* scratch) {
+    switch (kind) {
+    case BENCH_SORT_QSORT: qsort(data, size, sizeof(BenchRecord), compare_record); break;
+    case BENCH_SORT_UNSTABLE: nc_sort_record_unstable(data, size); break;
+    case BENCH_SORT_STABLE: nc_sort_record_stable(data, size, scratch); break;
+    case BENCH_SORT_RADIX: nc_radix_sort_record(data, size, scratch); break;
+    }
+}
+
+static const char* const U32_NAMES[] = { "qsort_u32", "sort_unstable_u32", "sort_stable_u32", "radix_sort_u32" };
+static const char* const RECORD_NAMES[] = {
+    "qsort_record",
+    "sort_unstable_record",
+    "sort_stable_record",
+    "radix_sort_record"
+};
+
+static void bench_u32(size_t size, size_t rounds) {
+    uint32_t* const input = malloc(size * sizeof(uint32_t));
+    uint32_t* const data = malloc(size * sizeof(uint32_t));
+    uint32_t* const scratch = malloc(size * sizeof(uint32_t));
+    if (input == NULL || data == NULL || scratch == NULL) {
+        free(input);
+        free(data);
+        free(scratch);
+        return;
+    }
+
+    uint64_t state = 88172645463325252ull;
+    for (size_t i = 0; i < size; ++i)
+        input[i] = (uint32_t)xorshift(&state);
+
+    for (BenchSortKind kind = BENCH_SORT_QSORT; kind <= BENCH_SORT_RADIX; ++kind) {
+        double seconds = 0.0;
+        for (size_t round = 0; round < rounds; ++round) {
+            memcpy(data, input, size * sizeof(uint32_t));
+
+            const double start = nc_bench_now();
+            sort_u32(kind, data, size, scratch);
+            seconds += nc_bench_now() - start;
+            nc_bench_do_not_optimize(data);
+        }
+        nc_bench_report(U32_NAMES[kind], size, seconds, (double)size * (double)rounds, "elements");
+    }
+
+    free(input);
+    free(data);
+    free(scratch);
+}
+
+static void bench_record(size_t size, size_t rounds) {
+    BenchRecord* const input = malloc(size * sizeof(BenchRecord));
+    BenchRecord* const data = malloc(size * sizeof(BenchRecord));
+    BenchRecord* const scratch = malloc(size * sizeof(BenchRecord));
+    if (input == NULL || data == NULL || scratch == NULL) {
+        free(input);
+        free(data);
+        free(scratch);
+        return;
+    }
+
+    uint64_t state = 88172645463325252ull;
+    for (size_t i = 0; i < size; ++i)
+        input[i] = (BenchRecord){ .key = xorshift(&state), .payload = i };
+
+    for (BenchSortKind kind = BENCH_SORT_QSORT; kind <= BENCH_SORT_RADIX; ++kind) {
+        double seconds = 0.0;
+        for (size_t round = 0; round < rounds; ++round) {
+            memcpy(data, input, size * sizeof(BenchRecord));
+
+            const double start = nc_bench_now();
+            sort_record(kind, data, size, scratch);
+            seconds += nc_bench_now() - start;
+            nc_bench_do_not_optimize(data);
+        }
+        nc_bench_report(RECORD_NAMES[kind], size, seconds, (double)size * (double)rounds, "elements");
+    }
+
+    free(input);
+    free(data);
+    free(scratch);
+}
+
+int main(int argc, char* argv[]) {
+    const size_t max_size = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 100000000;
+    const size_t total = argc > 2 ? (size_t)strtoull(argv[2], NULL, 10) : 1 << 24;
+
+    for (size_t size = 1000; size <= max_size; size *= 10) {
+        const size_t rounds = total / size > 0 ? total / size : 1;
+
+        bench_u32(size, rounds);
+        bench_record(size, rounds);
+    }
+
+    return 0;
+}
@@ -0,0 +1,85 @@
+#include "ncstd/bench/bench_common.h"
+
+#include <stdlib.h>
+
+#include "ncstd/containers/unsafe/raw_buffer.h"
+#include "ncstd/containers/vec.h"
+
+
+// Push and element access throughput of NC_VEC(uint32_t) compared to NC_RawBuffer,
+// whose accessors are out-of-line and take the object size at runtime.
+// Typed vector's sum loop should compile down to plain loads (and vectorize).
+//
+// Usage: ncstd_core_bench_vec [max_size] [total_elements]
+
+NC_DEFINE_VEC(uint32_t, u32)
+NC_INSTANTIATE_VEC(uint32_t, u32)
+
+static void bench_vec(size_t size, size_t rounds) {
+    double push_time = 0.0;
+    double sum_time = 0.0;
+    uint64_t sum = 0;
+
+    for (size_t round = 0; round < rounds; ++round) {
+        NC_VEC(uint32_t) vec = nc_vec_u32_init();
+
+        double start = nc_bench_now();
+        for (size_t i = 0; i < size; ++i)
+            nc_vec_u32_push(&vec, (uint32_t)i);
+        push_time += nc_bench_now() - start;
+
+        start = nc_bench_now();
+        for (size_t i = 0; i < nc_vec_u32_size(&vec); ++i)
+            sum += *nc_vec_u32_get_unchecked(&vec, i);
+        sum_time += nc_bench_now() - start;
+
+        nc_vec_u32_destroy(&vec);
+    }
+
+    nc_bench_do_not_optimize(&sum);
+    nc_bench_report("vec_push", size, push_time, (double)size * (double)rounds, "elements");
+    nc_bench_report("vec_sum", size, sum_time, (double)size * (double)rounds, "elements");
+}
+
+static void bench_raw_buffer(size_t size, size_t rounds) {
+    double push_time = 0.0;
+    double sum_time = 0.0;
+    uint64_t sum = 0;
+
+    for (size_t round = 0; round < rounds; ++round) {
+        NC_RawBuffer buffer = nc_raw_buffer_init(sizeof(uint32_t));
+
+        double start = nc_bench_now();
+        for (size_t i = 0; i < size; ++i) {
+            const uint32_t value = (uint32_t)i;
+            nc_raw_buffer_grow_amorthized(&buffer, i + 1, 2, sizeof(uint32_t));
+            nc_raw_buffer_set_unchecked(&buffer, &value, i, sizeof(uint32_t));
+        }
+        push_time += nc_bench_now() - start;
+
+        start = nc_bench_now();
+        for (size_t i = 0; i < size; ++i)
+            sum += *(const uint32_t*)nc_raw_buffer_get_unchecked(&buffer, i, sizeof(uint32_t));
+        sum_time += nc_bench_now() - start;
+
+        nc_raw_buffer_free(&buffer, sizeof(uint32_t));
+    }
+
+    nc_bench_do_not_optimize(&sum);
+    nc_bench_report("raw_buffer_push", size, push_time, (double)size * (double)rounds, "elements");
+    nc_bench_report("raw_buffer_sum", size, sum_time, (double)size * (double)rounds, "elements");
+}
+
+int main(int argc, char* argv[]) {
+    const size_t max_size = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 1 << 20;
+    const size_t total_elements = argc > 2 ? (size_t)strtoull(argv[2], NULL, 10) : 1 << 26;
+
+    for (size_t size = 16; size <= max_size; size *= 16) {
+        const size_t rounds = total_elements / size;
+
+        bench_vec(size, rounds);
+        bench_raw_buffer(size, rounds);
+    }
+
+    return 0;
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+/**
+ * @file
+*/
+
+#include <stdio.h>
+
+
+/** \addtogroup alloc_stats
+ *  @brief Allocation instrumentation
+ *
+ *  When the library is configured with @p NCSTD_ENABLE_ALLOC_STATS, every allocation made through
+ *  the default allocator (@ref nc_allocator_default()) is recorded per call site and per size bucket:
+ *  allocation count and bytes, reallocation count and copied bytes, deallocation count and bytes,
+ *  live bytes and the high-water mark of live bytes.
+ *
+ *  Call site is the outermost instrumented library function (e.g. @p nc_string_reserve rather than
+ *  @p nc_raw_buffer_resize_unchecked it calls), so that the report shows what drives the heap traffic.
+ *  Allocations made outside of any instrumented function are reported as @p "(unattributed)".
+ *
+ *  Size buckets are powers of two, bucket with @p max_size N contains sizes in range (N / 2, N].
+ *
+ *  Without the option, instrumentation compiles to nothing.
+ *  @{
+*/
+
+#ifdef NC_DOXYGEN
+/**
+ * @brief Macro enabling allocation instrumentation, defined by @p NCSTD_ENABLE_ALLOC_STATS
+*/
+#define NC_ALLOC_STATS
+#endif
+
+/**
+ * @brief Writes allocation statistics to @p stream as a single JSON object
+ *
+ * ## Format
+ * @code
+ *  {
+ *    "enabled": true,
+ *    "total": { "allocations": 3, "allocated_bytes": 96, ... },
+ *    "sites": [ { "site": "nc_string_reserve", "allocations": 1, ... }, ... ],
+ *    "buckets": [ { "max_size": 32, "allocations": 3, ... }, ... ]
+ *  }
+ * @endcode
+ * Every counters object contains @p allocations, @p allocated_bytes, @p reallocations,
+ * @p realloc_copy_bytes, @p deallocations, @p freed_bytes, @p live_bytes and @p peak_live_bytes.
+ * If instrumentation is disabled, writes @p {"enabled":false}.
+ *
+ * @param stream output stream
+*/
+void nc_alloc_stats_dump(FILE* stream);
+/**
+ * @brief Resets all recorded statistics
+ *
+ * Memory that is still live is no longer accounted for after the reset.
+*/
+void nc_alloc_stats_reset();
+
+/**
+ * @}
+*/
+
+
+#ifdef NC_ALLOC_STATS
+
+const char* nc_internal_alloc_stats_enter_site(const char* site);
+void nc_internal_alloc_stats_leave_site(const char* previous_site);
+
+#define NC_INTERNAL_ALLOC_STATS_SITE_ENTER() \
+    const char* const nc_internal_alloc_stats_previous_site = nc_internal_alloc_stats_enter_site(__func__)
+#define NC_INTERNAL_ALLOC_STATS_SITE_LEAVE() \
+    nc_internal_alloc_stats_leave_site(nc_internal_alloc_stats_previous_site)
+
+#else
+
+#define NC_INTERNAL_ALLOC_STATS_SITE_ENTER() ((void)0)
+#define NC_INTERNAL_ALLOC_STATS_SITE_LEAVE() ((void)0)
+
+#endif
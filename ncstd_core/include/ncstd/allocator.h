@@ -0,0 +1,136 @@
+#pragma once
+
+/**
+ * @file
+*/
+
+#include <stdalign.h>
+#include <stddef.h>
+
+
+/** \addtogroup allocator
+ *  @brief Pluggable allocator interface
+ *  @{
+*/
+
+/**
+ * @brief Default alignment used by containers, equal to the alignment of @p max_align_t
+*/
+#define NC_DEFAULT_ALIGNMENT alignof(max_align_t)
+/**
+ * @brief Assumed cache line size in bytes, used to align data against false sharing
+*/
+#define NC_CACHE_LINE_SIZE 64
+
+typedef struct NC_Allocator NC_Allocator;
+
+/**
+ * @brief Table of functions implementing an allocator
+ *
+ * Implementations are responsible for reporting allocation failures
+ * using @ref nc_handle_out_of_memory(), the same way @ref nc_malloc() does.
+*/
+typedef struct {
+    /**
+     * Allocates @p size bytes aligned to @p alignment.
+     * Returns @p NULL on failure.
+    */
+    void* (* const alloc_fn)(NC_Allocator* allocator, size_t size, size_t alignment);
+    /**
+     * Resizes memory previously allocated with the same allocator from @p old_size to @p new_size bytes.
+     * Returns @p NULL on failure, in which case @p ptr stays valid.
+    */
+    void* (* const realloc_fn)(NC_Allocator* allocator, void* ptr, size_t old_size, size_t new_size, size_t alignment);
+    /**
+     * Deallocates memory of @p size bytes previously allocated with the same allocator.
+     * Must accept @p NULL pointer.
+    */
+    void (* const free_fn)(NC_Allocator* allocator, void* ptr, size_t size, size_t alignment);
+} NC_AllocatorVtable;
+
+/**
+ * @brief Allocator interface
+ *
+ * Concrete allocators embed this struct as their first member, so that
+ * pointer to the concrete allocator can be used as a pointer to @ref NC_Allocator.
+ *
+ * ## Example
+ * @code
+ *  typedef struct {
+ *      NC_Allocator allocator;
+ *      size_t allocation_count;
+ *  } CountingAllocator;
+ *
+ *  static void* counting_alloc(NC_Allocator* allocator, size_t size, size_t alignment) {
+ *      ((CountingAllocator*)allocator)->allocation_count += 1;
+ *
+ *      return nc_allocator_alloc(nc_allocator_default(), size, alignment);
+ *  }
+ *
+ *  ...
+ *
+ *  static const NC_AllocatorVtable COUNTING_VTABLE = { .alloc_fn = counting_alloc, ... };
+ *
+ *  CountingAllocator counting = { .allocator = { .vtable = &COUNTING_VTABLE } };
+ *  NC_RawBuffer buffer = nc_raw_buffer_init_with_capacity_in(16, sizeof(int), &counting.allocator);
+ * @endcode
+*/
+struct NC_Allocator {
+    /** Allocator function table */
+    const NC_AllocatorVtable* vtable;
+};
+
+/**
+ * @brief Returns the default allocator
+ *
+ * Default allocator uses @ref nc_malloc(), @ref nc_realloc_preserving() and @ref nc_free(),
+ * or their aligned counterparts (@ref nc_malloc_aligned(), etc.) when alignment is larger
+ * than @ref NC_DEFAULT_ALIGNMENT.
+ *
+ * @return pointer to the default allocator
+*/
+NC_Allocator* nc_allocator_default();
+
+/**
+ * @memberof NC_Allocator
+ *
+ * @brief Allocates @p size bytes of uninitialized storage aligned to @p alignment
+ *
+ * @param size number of bytes to allocate
+ * @param alignment alignment of the allocation, must be a power of two
+ *
+ * @return pointer to allocated memory or @p NULL if out of memory error handler ever returns
+*/
+void* nc_allocator_alloc(NC_Allocator* self, size_t size, size_t alignment);
+/**
+ * @memberof NC_Allocator
+ *
+ * @brief Resizes memory previously allocated by this allocator
+ *
+ * On failure, returns @p NULL and @p ptr stays valid with all the data.
+ * If @p ptr is @p NULL, the behaviour is the same as calling @ref nc_allocator_alloc().
+ *
+ * @param ptr pointer to allocated memory
+ * @param old_size size of the allocated memory in bytes
+ * @param new_size new size of the allocated memory in bytes
+ * @param alignment alignment of the allocation, must be the same as the one used to allocate @p ptr
+ *
+ * @return pointer to the resized memory or @p NULL if out of memory error handler ever returns
+*/
+void* nc_allocator_realloc(NC_Allocator* self, void* ptr, size_t old_size, size_t new_size, size_t alignment);
+/**
+ * @memberof NC_Allocator
+ *
+ * @brief Deallocates memory previously allocated by this allocator
+ *
+ * The function accepts (and does nothing with) the @p NULL pointer.
+ *
+ * @param ptr pointer to allocated memory
+ * @param size size of the allocated memory in bytes
+ * @param alignment alignment of the allocation
+*/
+void nc_allocator_free(NC_Allocator* self, void* ptr, size_t size, size_t alignment);
+
+/**
+ * @}
+*/
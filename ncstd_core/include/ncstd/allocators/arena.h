@@ -0,0 +1,174 @@
+#pragma once
+
+/**
+ * @file
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ncstd/allocator.h"
+
+
+/** \addtogroup allocators
+ *  @brief Allocator implementations
+ *  @{
+*/
+
+/**
+ * @brief Default size of a single arena chunk in bytes
+*/
+#define NC_ARENA_DEFAULT_CHUNK_SIZE ((size_t)64 * 1024)
+
+typedef struct NC_ArenaChunk NC_ArenaChunk;
+
+/**
+ * @brief Bump allocator that allocates memory from a linked list of chunks
+ *
+ * Allocation is a pointer increment, individual deallocations are no-ops
+ * (unless it's the most recent allocation), and everything allocated from
+ * the arena is released at once with @ref nc_arena_reset(), @ref nc_arena_reset_to_mark()
+ * or @ref nc_arena_destroy().
+ *
+ * Chunks are kept after reset and reused by subsequent allocations.
+ *
+ * ## Example
+ * @code
+ *  NC_Arena arena = nc_arena_init();
+ *
+ *  const NC_ArenaMark mark = nc_arena_mark(&arena);
+ *  NC_RawBuffer buffer = nc_raw_buffer_init_with_capacity_in(128, sizeof(int), nc_arena_allocator(&arena));
+ *  ...
+ *  nc_arena_reset_to_mark(&arena, mark);
+ *
+ *  nc_arena_destroy(&arena);
+ * @endcode
+*/
+typedef struct {
+    /** @protected Allocator interface, use @ref nc_arena_allocator() to access it */
+    NC_Allocator allocator;
+
+    /**
+     * @protected
+     *
+     * @brief Members are not stable, and are displayed for educational purposes only
+    */
+    struct {
+        /** @protected First chunk in the list */
+        NC_ArenaChunk* first;
+        /** @protected Chunk that allocations are currently served from */
+        NC_ArenaChunk* current;
+        /** @protected Start of the free space in the current chunk */
+        uint8_t* position;
+        /** @protected End of the current chunk */
+        uint8_t* end;
+        /** @protected Minimal size of newly allocated chunks */
+        size_t chunk_size;
+        /** @protected Allocator used to allocate chunks */
+        NC_Allocator* backing;
+    } p;
+} NC_Arena;
+
+/**
+ * @brief Saved arena state, that can be restored with @ref nc_arena_reset_to_mark()
+*/
+typedef struct {
+    /** @protected Members are not stable */
+    struct {
+        NC_ArenaChunk* chunk;
+        uint8_t* position;
+    } p;
+} NC_ArenaMark;
+
+/**
+ * @memberof NC_Arena
+ *
+ * @brief Initializes empty arena with @ref NC_ARENA_DEFAULT_CHUNK_SIZE (performs no dynamic allocations)
+ *
+ * @return created arena
+*/
+NC_Arena nc_arena_init();
+/**
+ * @memberof NC_Arena
+ *
+ * @brief Initializes empty arena with specified chunk size (performs no dynamic allocations)
+ *
+ * @param chunk_size minimal size of a single chunk in bytes
+ *
+ * @return created arena
+*/
+NC_Arena nc_arena_init_with_chunk_size(size_t chunk_size);
+/**
+ * @memberof NC_Arena
+ *
+ * @brief Initializes empty arena with specified chunk size, that allocates chunks using @p backing
+ * (performs no dynamic allocations)
+ *
+ * @param chunk_size minimal size of a single chunk in bytes
+ * @param backing allocator used to allocate chunks, must outlive the arena
+ *
+ * @return created arena
+*/
+NC_Arena nc_arena_init_with_chunk_size_in(size_t chunk_size, NC_Allocator* backing);
+/**
+ * @memberof NC_Arena
+ *
+ * @brief Destroys the arena, releasing all chunks to the backing allocator
+ *
+ * All memory allocated from the arena becomes invalid.
+*/
+void nc_arena_destroy(NC_Arena* self);
+
+/**
+ * @memberof NC_Arena
+ *
+ * @brief Returns allocator interface of the arena
+ *
+ * Returned pointer is valid as long as the arena is not moved.
+ *
+ * @return pointer to the allocator interface
+*/
+NC_Allocator* nc_arena_allocator(NC_Arena* self);
+
+/**
+ * @memberof NC_Arena
+ *
+ * @brief Allocates @p size bytes aligned to @p alignment
+ *
+ * @param size number of bytes to allocate
+ * @param alignment alignment of the allocation, must be a power of two
+ *
+ * @return pointer to allocated memory or @p NULL if out of memory error handler ever returns
+*/
+void* nc_arena_alloc(NC_Arena* self, size_t size, size_t alignment);
+
+/**
+ * @memberof NC_Arena
+ *
+ * @brief Saves current arena state
+ *
+ * @return mark, that can be passed to @ref nc_arena_reset_to_mark()
+*/
+NC_ArenaMark nc_arena_mark(const NC_Arena* self);
+/**
+ * @memberof NC_Arena
+ *
+ * @brief Releases all allocations made after @p mark was taken in O(1)
+ *
+ * ## Safety
+ * If @p mark was taken from another arena, or allocations it was taken after were
+ * already released, the behaviour is undefined.
+ *
+ * @param mark mark returned by @ref nc_arena_mark()
+*/
+void nc_arena_reset_to_mark(NC_Arena* self, NC_ArenaMark mark);
+/**
+ * @memberof NC_Arena
+ *
+ * @brief Releases all allocations in O(1), keeping chunks for reuse
+*/
+void nc_arena_reset(NC_Arena* self);
+
+/**
+ * @}
+*/
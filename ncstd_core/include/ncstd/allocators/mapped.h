@@ -0,0 +1,90 @@
+#pragma once
+
+/**
+ * @file
+*/
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "ncstd/allocator.h"
+
+
+/** \addtogroup allocators
+ *  @{
+*/
+
+/**
+ * @brief Flags that configure @ref NC_MappedAllocator
+*/
+typedef enum {
+    /** Advise the kernel to back mappings with transparent huge pages (@p MADV_HUGEPAGE) */
+    NC_MAPPED_ALLOCATOR_HUGE_PAGES = 1 << 0,
+    /**
+     * On shrink, release tail pages with @p MADV_DONTNEED and keep the mapping reserved,
+     * so that growing back doesn't need a syscall. Otherwise mapping is shrunk with @p mremap.
+    */
+    NC_MAPPED_ALLOCATOR_DONTNEED_ON_SHRINK = 1 << 1
+} NC_MappedAllocatorFlags;
+
+/**
+ * @brief Allocator that places every allocation into its own anonymous memory mapping
+ *
+ * Mappings grow and shrink with @p mremap, so resizing never copies the data.
+ * Meant for large buffers, since every allocation takes at least one page.
+ *
+ * On platforms without @p mremap (anything other than Linux), allocator forwards
+ * all calls to @ref nc_allocator_default().
+*/
+typedef struct {
+    /** @protected Allocator interface, use @ref nc_mapped_allocator_allocator() to access it */
+    NC_Allocator allocator;
+
+    /**
+     * @protected
+     *
+     * @brief Members are not stable, and are displayed for educational purposes only
+    */
+    struct {
+        /** @protected Combination of @ref NC_MappedAllocatorFlags */
+        unsigned flags;
+    } p;
+} NC_MappedAllocator;
+
+/**
+ * @brief Returns shared mapped allocator with no flags set
+ *
+ * @return pointer to the allocator
+*/
+NC_Allocator* nc_mapped_allocator_default();
+/**
+ * @brief Returns whether mapped allocator uses memory mappings on this platform
+ *
+ * @return @p true if memory mappings are used, @p false if allocator forwards to the default allocator
+*/
+bool nc_mapped_allocator_is_supported();
+
+/**
+ * @memberof NC_MappedAllocator
+ *
+ * @brief Initializes mapped allocator
+ *
+ * @param flags combination of @ref NC_MappedAllocatorFlags
+ *
+ * @return created allocator
+*/
+NC_MappedAllocator nc_mapped_allocator_init(unsigned flags);
+/**
+ * @memberof NC_MappedAllocator
+ *
+ * @brief Returns allocator interface of the mapped allocator
+ *
+ * Returned pointer is valid as long as the allocator is not moved.
+ *
+ * @return pointer to the allocator interface
+*/
+NC_Allocator* nc_mapped_allocator_allocator(NC_MappedAllocator* self);
+
+/**
+ * @}
+*/
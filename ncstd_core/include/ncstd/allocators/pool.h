@@ -0,0 +1,155 @@
+#pragma once
+
+/**
+ * @file
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ncstd/allocator.h"
+
+
+/** \addtogroup allocators
+ *  @{
+*/
+
+/**
+ * @brief Difference in bytes between two neighbouring size classes of the pool
+*/
+#define NC_POOL_SIZE_CLASS_GRANULARITY ((size_t)16)
+/**
+ * @brief Number of size classes of the pool
+*/
+#define NC_POOL_SIZE_CLASS_COUNT 16
+/**
+ * @brief Largest object size in bytes that is served from the pool.
+ * Larger allocations are forwarded to the backing allocator.
+*/
+#define NC_POOL_MAX_OBJECT_SIZE (NC_POOL_SIZE_CLASS_GRANULARITY * NC_POOL_SIZE_CLASS_COUNT)
+/**
+ * @brief Size of a single slab in bytes, requested from the backing allocator
+*/
+#define NC_POOL_SLAB_SIZE ((size_t)16 * 1024)
+
+typedef struct NC_PoolSlab NC_PoolSlab;
+typedef struct NC_PoolFreeNode NC_PoolFreeNode;
+
+/**
+ * @brief Allocator for small objects, that keeps freed objects in per size class freelists
+ *
+ * Object sizes are rounded up to a multiple of @ref NC_POOL_SIZE_CLASS_GRANULARITY.
+ * Freed objects are pushed onto an intrusive freelist of their size class and
+ * handed out again by the next allocation of the same class, so both operations are O(1).
+ * Memory is carved from slabs of @ref NC_POOL_SLAB_SIZE bytes, that are only returned
+ * to the backing allocator by @ref nc_pool_destroy().
+ *
+ * Pool isn't thread safe.
+ *
+ * ## Example
+ * @code
+ *  NC_Pool pool = nc_pool_init();
+ *
+ *  for (...) {
+ *      NC_Iterator* const iterator = nc_pointer_iterator_into_dyn_in(
+ *          nc_pointer_iterator_init(data, length, sizeof(int)),
+ *          nc_pool_allocator(&pool)
+ *      );
+ *      ...
+ *      nc_iterator_destroy(iterator);
+ *  }
+ *
+ *  nc_pool_destroy(&pool);
+ * @endcode
+*/
+typedef struct {
+    /** @protected Allocator interface, use @ref nc_pool_allocator() to access it */
+    NC_Allocator allocator;
+
+    /**
+     * @protected
+     *
+     * @brief Members are not stable, and are displayed for educational purposes only
+    */
+    struct {
+        /** @protected Freelist heads for each size class */
+        NC_PoolFreeNode* free_lists[NC_POOL_SIZE_CLASS_COUNT];
+        /** @protected List of allocated slabs */
+        NC_PoolSlab* slabs;
+        /** @protected Start of not yet carved memory in the newest slab */
+        uint8_t* position;
+        /** @protected End of the newest slab */
+        uint8_t* end;
+        /** @protected Allocator used to allocate slabs and large objects */
+        NC_Allocator* backing;
+    } p;
+} NC_Pool;
+
+/**
+ * @memberof NC_Pool
+ *
+ * @brief Initializes empty pool (performs no dynamic allocations)
+ *
+ * @return created pool
+*/
+NC_Pool nc_pool_init();
+/**
+ * @memberof NC_Pool
+ *
+ * @brief Initializes empty pool, that allocates slabs using @p backing (performs no dynamic allocations)
+ *
+ * @param backing allocator used to allocate slabs and objects larger than @ref NC_POOL_MAX_OBJECT_SIZE,
+ * must outlive the pool
+ *
+ * @return created pool
+*/
+NC_Pool nc_pool_init_in(NC_Allocator* backing);
+/**
+ * @memberof NC_Pool
+ *
+ * @brief Destroys the pool, releasing all slabs to the backing allocator
+ *
+ * All objects allocated from the pool, except for ones larger than @ref NC_POOL_MAX_OBJECT_SIZE,
+ * become invalid.
+*/
+void nc_pool_destroy(NC_Pool* self);
+
+/**
+ * @memberof NC_Pool
+ *
+ * @brief Returns allocator interface of the pool
+ *
+ * Returned pointer is valid as long as the pool is not moved.
+ *
+ * @return pointer to the allocator interface
+*/
+NC_Allocator* nc_pool_allocator(NC_Pool* self);
+
+/**
+ * @memberof NC_Pool
+ *
+ * @brief Allocates an object of @p size bytes aligned to @ref NC_DEFAULT_ALIGNMENT
+ *
+ * @param size object size in bytes
+ *
+ * @return pointer to allocated memory or @p NULL if out of memory error handler ever returns
+*/
+void* nc_pool_alloc(NC_Pool* self, size_t size);
+/**
+ * @memberof NC_Pool
+ *
+ * @brief Returns an object to the pool
+ *
+ * The function accepts (and does nothing with) the @p NULL pointer.
+ *
+ * ## Safety
+ * If @p ptr wasn't allocated from this pool with the same @p size, the behaviour is undefined.
+ *
+ * @param ptr pointer to the object
+ * @param size object size in bytes, same as the one passed to @ref nc_pool_alloc()
+*/
+void nc_pool_free(NC_Pool* self, void* ptr, size_t size);
+
+/**
+ * @}
+*/
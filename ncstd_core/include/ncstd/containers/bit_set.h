@@ -0,0 +1,270 @@
+#pragma once
+
+/**
+ * @file
+*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ncstd/allocator.h"
+#include "ncstd/containers/unsafe/raw_buffer.h"
+
+
+/** \addtogroup bit_set
+ *  @brief Dynamic set of bits
+ *  @{
+*/
+
+/**
+ * @brief Number of bits in a single word of a bit set
+*/
+#define NC_BIT_SET_WORD_BITS 64
+/**
+ * @brief Number of words in a block, that bulk operations process at once (256 bits)
+*/
+#define NC_BIT_SET_BLOCK_WORDS 4
+
+/**
+ * @brief Fixed size sequence of bits, packed into 64-bit words
+ *
+ * Storage is allocated in 256-bit blocks aligned to 32 bytes, so that bulk operations
+ * process whole blocks (using AVX2 when the library is compiled with it) without handling tails.
+ * Bits past the size are always zero.
+ *
+ * ## Example
+ * @code
+ *  NC_BitSet visited = nc_bit_set_init_with_size(node_count);
+ *  nc_bit_set_set(&visited, start);
+ *  ...
+ *  nc_bit_set_and_not(&candidates, &visited);
+ *
+ *  NC_BitSetIterator it = nc_bit_set_iter(&candidates);
+ *  size_t node;
+ *  while (nc_bit_set_iterator_next(&it, &node))
+ *      visit(node);
+ *
+ *  nc_bit_set_destroy(&visited);
+ * @endcode
+*/
+typedef struct {
+    /**
+     * @protected
+     *
+     * @brief Members are not stable, and are displayed for educational purposes only
+    */
+    struct {
+        /** @protected Words, capacity is a multiple of @ref NC_BIT_SET_BLOCK_WORDS */
+        NC_RawBuffer raw_buffer;
+        /** @protected Number of bits */
+        size_t size;
+    } p;
+} NC_BitSet;
+
+/**
+ * @brief Iterator over indices of set bits in increasing order
+ *
+ * Bit set must not be modified while it's iterated.
+*/
+typedef struct {
+    /**
+     * @protected
+     *
+     * @brief Members are not stable, and are displayed for educational purposes only
+    */
+    struct {
+        /** @protected Words of the bit set */
+        const uint64_t* words;
+        /** @protected Number of words */
+        size_t word_count;
+        /** @protected Index of the current word */
+        size_t word_index;
+        /** @protected Not yet visited bits of the current word */
+        uint64_t word;
+    } p;
+} NC_BitSetIterator;
+
+/**
+ * @memberof NC_BitSet
+ *
+ * @brief Initializes empty bit set (performs no dynamic allocations)
+ *
+ * @return created bit set
+*/
+NC_BitSet nc_bit_set_init();
+/**
+ * @memberof NC_BitSet
+ *
+ * @brief Initializes empty bit set that will use @p allocator for all its allocations
+ * (performs no dynamic allocations)
+ *
+ * @param allocator allocator, must outlive the bit set
+ *
+ * @return created bit set
+*/
+NC_BitSet nc_bit_set_init_in(NC_Allocator* allocator);
+/**
+ * @memberof NC_BitSet
+ *
+ * @brief Initializes bit set with @p size cleared bits
+ *
+ * @param size number of bits
+ *
+ * @return created bit set, empty if allocation has failed
+*/
+NC_BitSet nc_bit_set_init_with_size(size_t size);
+/**
+ * @memberof NC_BitSet
+ *
+ * @brief Same as @ref nc_bit_set_init_with_size(), but uses @p allocator for all allocations
+ *
+ * @param size number of bits
+ * @param allocator allocator, must outlive the bit set
+ *
+ * @return created bit set, empty if allocation has failed
+*/
+NC_BitSet nc_bit_set_init_with_size_in(size_t size, NC_Allocator* allocator);
+/**
+ * @memberof NC_BitSet
+ *
+ * @brief Deallocates the bit set memory
+*/
+void nc_bit_set_destroy(NC_BitSet* self);
+
+/**
+ * @memberof NC_BitSet
+ *
+ * @brief Returns number of bits in the bit set
+*/
+size_t nc_bit_set_size(const NC_BitSet* self);
+/**
+ * @memberof NC_BitSet
+ *
+ * @brief Returns pointer to the words of the bit set,
+ * bit @p i is stored in word @p i / 64 at position @p i % 64
+*/
+const uint64_t* nc_bit_set_words(const NC_BitSet* self);
+/**
+ * @memberof NC_BitSet
+ *
+ * @brief Changes number of bits to @p new_size, new bits are cleared
+ *
+ * @return @p true on success, @p false if allocation has failed
+*/
+bool nc_bit_set_resize(NC_BitSet* self, size_t new_size);
+
+/**
+ * @memberof NC_BitSet
+ *
+ * @brief Sets bit at @p index
+ *
+ * ## Safety
+ * Calling this function with @p index out of bounds leads to undefined behaviour
+*/
+void nc_bit_set_set(NC_BitSet* self, size_t index);
+/**
+ * @memberof NC_BitSet
+ *
+ * @brief Clears bit at @p index
+ *
+ * ## Safety
+ * Calling this function with @p index out of bounds leads to undefined behaviour
+*/
+void nc_bit_set_clear(NC_BitSet* self, size_t index);
+/**
+ * @memberof NC_BitSet
+ *
+ * @brief Returns whether bit at @p index is set
+ *
+ * ## Safety
+ * Calling this function with @p index out of bounds leads to undefined behaviour
+*/
+bool nc_bit_set_test(const NC_BitSet* self, size_t index);
+/**
+ * @memberof NC_BitSet
+ *
+ * @brief Sets all bits
+*/
+void nc_bit_set_set_all(NC_BitSet* self);
+/**
+ * @memberof NC_BitSet
+ *
+ * @brief Clears all bits, keeping the size
+*/
+void nc_bit_set_clear_all(NC_BitSet* self);
+
+/**
+ * @memberof NC_BitSet
+ *
+ * @brief Replaces the bit set with its intersection with @p other
+ *
+ * ## Safety
+ * Calling this function with bit sets of different sizes leads to undefined behaviour
+*/
+void nc_bit_set_and(NC_BitSet* self, const NC_BitSet* other);
+/**
+ * @memberof NC_BitSet
+ *
+ * @brief Replaces the bit set with its union with @p other
+ *
+ * ## Safety
+ * Calling this function with bit sets of different sizes leads to undefined behaviour
+*/
+void nc_bit_set_or(NC_BitSet* self, const NC_BitSet* other);
+/**
+ * @memberof NC_BitSet
+ *
+ * @brief Replaces the bit set with its symmetric difference with @p other
+ *
+ * ## Safety
+ * Calling this function with bit sets of different sizes leads to undefined behaviour
+*/
+void nc_bit_set_xor(NC_BitSet* self, const NC_BitSet* other);
+/**
+ * @memberof NC_BitSet
+ *
+ * @brief Clears all bits that are set in @p other
+ *
+ * ## Safety
+ * Calling this function with bit sets of different sizes leads to undefined behaviour
+*/
+void nc_bit_set_and_not(NC_BitSet* self, const NC_BitSet* other);
+
+/**
+ * @memberof NC_BitSet
+ *
+ * @brief Returns number of set bits
+*/
+size_t nc_bit_set_count(const NC_BitSet* self);
+/**
+ * @memberof NC_BitSet
+ *
+ * @brief Returns index of the first set bit at or after @p start,
+ * or size of the bit set if there is none
+*/
+size_t nc_bit_set_find_next(const NC_BitSet* self, size_t start);
+/**
+ * @memberof NC_BitSet
+ *
+ * @brief Returns index of the first set bit, or size of the bit set if there is none
+*/
+size_t nc_bit_set_find_first(const NC_BitSet* self);
+/**
+ * @memberof NC_BitSet
+ *
+ * @brief Creates iterator over indices of set bits
+*/
+NC_BitSetIterator nc_bit_set_iter(const NC_BitSet* self);
+/**
+ * @memberof NC_BitSetIterator
+ *
+ * @brief Advances the iterator, writing index of the next set bit to @p out_index
+ *
+ * @return @p true if there was a set bit, @p false if the iteration has finished
+*/
+bool nc_bit_set_iterator_next(NC_BitSetIterator* self, size_t* out_index);
+
+/**
+ * @}
+*/
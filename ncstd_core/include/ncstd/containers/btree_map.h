@@ -0,0 +1,1133 @@
+#pragma once
+
+/**
+ * @file
+*/
+
+#include <stdalign.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "ncstd/alloc_stats.h"
+#include "ncstd/allocator.h"
+
+
+/** \addtogroup btree_map
+ *  @brief Ordered maps based on B-trees
+ *  @{
+*/
+
+/**
+ * @brief Number of bytes of keys stored in a single node of a B-tree map
+ *
+ * Four cache lines of keys keep the tree shallow, while a lookup in a node touches
+ * only a few of them.
+*/
+#define NC_BTREE_MAP_NODE_KEY_BYTES 256
+
+/**
+ * @brief Macro that defines name of a B-tree map type
+ *
+ * Maps are named after @p map_snake_case rather than key and value types,
+ * so that the same types can have maps with different orderings.
+ *
+ * ## Example
+ * @code
+ *  NC_BTREE_MAP(string_view_int)
+ * @endcode
+ * expands to
+ * @code
+ *  NC_BTreeMap_string_view_int
+ * @endcode
+ *
+ * @param map_snake_case name passed to @ref NC_DEFINE_BTREE_MAP()
+*/
+#define NC_BTREE_MAP(map_snake_case) NC_BTreeMap_##map_snake_case
+/**
+ * @brief Macro that defines name of a B-tree map cursor type, that points to an entry of the map
+ *
+ * @param map_snake_case name passed to @ref NC_DEFINE_BTREE_MAP()
+*/
+#define NC_BTREE_MAP_CURSOR(map_snake_case) NC_BTreeMapCursor_##map_snake_case
+
+#define NC_INTERNAL_BTREE_MAP_NODE(map_snake_case) NC_BTreeMapNode_##map_snake_case
+#define NC_INTERNAL_BTREE_MAP_INTERNAL_NODE(map_snake_case) NC_BTreeMapInternalNode_##map_snake_case
+#define NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, function_name) nc_btree_map_##map_snake_case##_##function_name
+
+/* Maximum number of keys in a node, between 8 and 64 */
+#define NC_INTERNAL_BTREE_MAP_CAPACITY(key_type)                                                                        \
+    (NC_BTREE_MAP_NODE_KEY_BYTES / sizeof(key_type) < 8 ? 8                                                             \
+        : NC_BTREE_MAP_NODE_KEY_BYTES / sizeof(key_type) > 64 ? 64                                                      \
+        : NC_BTREE_MAP_NODE_KEY_BYTES / sizeof(key_type))
+/* Minimum number of keys in a node other than the root */
+#define NC_INTERNAL_BTREE_MAP_MIN_SIZE(key_type) (NC_INTERNAL_BTREE_MAP_CAPACITY(key_type) / 2 - 1)
+/* Every node other than the root has at least 4 children, so 32 levels hold more than SIZE_MAX keys */
+#define NC_INTERNAL_BTREE_MAP_MAX_HEIGHT 32
+#define NC_INTERNAL_BTREE_MAP_ALIGNMENT(type) (alignof(type) > NC_CACHE_LINE_SIZE ? alignof(type) : NC_CACHE_LINE_SIZE)
+
+/**
+ * @brief Macro that defines an ordered map from @p key_type to @p value_type
+ *
+ * Map is a B-tree with wide nodes: every node stores up to
+ * @ref NC_BTREE_MAP_NODE_KEY_BYTES bytes of keys (between 8 and 64 keys) contiguously,
+ * followed by the values, and internal nodes additionally store child pointers.
+ * Nodes are aligned to cache lines, and keys within a node are searched with branchless binary search,
+ * so a lookup costs a few cache misses per level and no mispredicted branches inside a node.
+ *
+ * Entries are iterated in ascending key order with cursors, that are created by @p iter,
+ * @p lower_bound and @p upper_bound, which makes range queries a seek followed by a linear scan.
+ * Sorted input can be loaded with @p bulk_load, that packs nodes fully in O(n).
+ *
+ * Keys and values are moved in and out of the map by value. The map doesn't destroy them,
+ * so for owning types use the out parameters of @p remove and iterate the map before @p destroy.
+ *
+ * ## Example
+ * @code
+ *  NC_DEFINE_BTREE_MAP(NC_StringView, int, string_view_int, nc_string_view_ptr_cmp)
+ *
+ *  NC_BTREE_MAP(string_view_int) map = nc_btree_map_string_view_int_init();
+ *  nc_btree_map_string_view_int_insert(&map, nc_string_view_from_cstr("one"), 1);
+ *
+ *  const NC_StringView from = nc_string_view_from_cstr("a");
+ *  const NC_StringView to = nc_string_view_from_cstr("p");
+ *  NC_BTREE_MAP_CURSOR(string_view_int) cursor = nc_btree_map_string_view_int_lower_bound(&map, &from);
+ *
+ *  const NC_StringView* key;
+ *  int* value;
+ *  while (nc_btree_map_string_view_int_cursor_next(&cursor, &key, &value) && nc_string_view_cmp(*key, to) < 0)
+ *      use(*key, *value);
+ *
+ *  nc_btree_map_string_view_int_destroy(&map);
+ * @endcode
+ *
+ * Since all generated functions are @p inline, exactly one translation unit
+ * must also contain @ref NC_INSTANTIATE_BTREE_MAP() with the same arguments.
+ *
+ * @param key_type type of the keys
+ * @param value_type type of the values
+ * @param map_snake_case name used in type and function names (@p nc_btree_map_<map_snake_case>_insert, etc.)
+ * @param cmp_fn function or macro with signature `int (const void* a, const void* b, void* data)`
+ * (e.g. @ref nc_string_view_ptr_cmp()), that returns negative value, zero or positive value
+ * if @p a is less than, equal to or greater than @p b. @p data is always @p NULL
+ *
+ * @note Since generated functions are @p inline with external linkage, @p cmp_fn must not be @p static.
+*/
+#define NC_DEFINE_BTREE_MAP(key_type, value_type, map_snake_case, cmp_fn)                                               \
+    struct NC_INTERNAL_BTREE_MAP_INTERNAL_NODE(map_snake_case);                                                         \
+                                                                                                                        \
+    typedef struct NC_INTERNAL_BTREE_MAP_NODE(map_snake_case) {                                                         \
+        /* Parent node, NULL for the root */                                                                            \
+        struct NC_INTERNAL_BTREE_MAP_INTERNAL_NODE(map_snake_case)* parent;                                             \
+        /* Index of the node in children of the parent */                                                               \
+        uint16_t parent_index;                                                                                          \
+        /* Number of keys */                                                                                            \
+        uint16_t size;                                                                                                  \
+        bool is_leaf;                                                                                                   \
+        key_type keys[NC_INTERNAL_BTREE_MAP_CAPACITY(key_type)];                                                        \
+        value_type values[NC_INTERNAL_BTREE_MAP_CAPACITY(key_type)];                                                    \
+    } NC_INTERNAL_BTREE_MAP_NODE(map_snake_case);                                                                       \
+                                                                                                                        \
+    typedef struct NC_INTERNAL_BTREE_MAP_INTERNAL_NODE(map_snake_case) {                                                \
+        NC_INTERNAL_BTREE_MAP_NODE(map_snake_case) base;                                                                \
+        /* Subtree at index i holds keys between keys i - 1 and i */                                                    \
+        NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* children[NC_INTERNAL_BTREE_MAP_CAPACITY(key_type) + 1];             \
+    } NC_INTERNAL_BTREE_MAP_INTERNAL_NODE(map_snake_case);                                                              \
+                                                                                                                        \
+    /**
+        @brief B-tree map
+    */                                                                                                                  \
+    typedef struct {                                                                                                    \
+        /**
+            @protected
+
+            @brief Members are not stable, and are displayed for educational purposes only
+        */                                                                                                              \
+        struct {                                                                                                        \
+            /** @protected Root node, @p NULL if the map is empty */                                                    \
+            NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* root;                                                           \
+            /** @protected Number of entries */                                                                         \
+            size_t size;                                                                                                \
+            /** @protected Allocator that owns the nodes */                                                             \
+            NC_Allocator* allocator;                                                                                    \
+        } p;                                                                                                            \
+    } NC_BTREE_MAP(map_snake_case);                                                                                     \
+                                                                                                                        \
+    /**
+        @brief Position of an entry in a B-tree map
+
+        Cursor is invalidated by any insertion or removal.
+    */                                                                                                                  \
+    typedef struct {                                                                                                    \
+        /**
+            @protected
+
+            @brief Members are not stable, and are displayed for educational purposes only
+        */                                                                                                              \
+        struct {                                                                                                        \
+            /** @protected Node of the entry, @p NULL past the last entry */                                            \
+            NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* node;                                                           \
+            /** @protected Index of the entry in the node */                                                            \
+            size_t index;                                                                                               \
+        } p;                                                                                                            \
+    } NC_BTREE_MAP_CURSOR(map_snake_case);                                                                              \
+                                                                                                                        \
+    /**
+        @memberof NC_BTreeMap_##map_snake_case
+
+        @brief Initializes an empty B-tree map that will use @p allocator (performs no dynamic allocations)
+
+        @param allocator allocator, must outlive the map
+
+        @return created B-tree map
+    */                                                                                                                  \
+    inline NC_BTREE_MAP(map_snake_case) NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, init_in)(                   \
+        NC_Allocator* allocator                                                                                         \
+    ) {                                                                                                                 \
+        return (NC_BTREE_MAP(map_snake_case)) { .p = { .root = NULL, .size = 0, .allocator = allocator } };             \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_BTreeMap_##map_snake_case
+
+        @brief Initializes an empty B-tree map (performs no dynamic allocations)
+
+        @return created B-tree map
+    */                                                                                                                  \
+    inline NC_BTREE_MAP(map_snake_case) NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, init)() {                   \
+        return NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, init_in)(nc_allocator_default());                    \
+    }                                                                                                                   \
+                                                                                                                        \
+    inline NC_INTERNAL_BTREE_MAP_INTERNAL_NODE(map_snake_case)* NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_internal)( \
+        NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* node                                                                \
+    ) {                                                                                                                 \
+        return (NC_INTERNAL_BTREE_MAP_INTERNAL_NODE(map_snake_case)*)node;                                              \
+    }                                                                                                                   \
+                                                                                                                        \
+    inline NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_alloc_node)( \
+        NC_BTREE_MAP(map_snake_case)* self,                                                                             \
+        bool is_leaf                                                                                                    \
+    ) {                                                                                                                 \
+        NC_INTERNAL_ALLOC_STATS_SITE_ENTER();                                                                           \
+        NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* const node = nc_allocator_alloc(                                    \
+            self->p.allocator,                                                                                          \
+            is_leaf                                                                                                     \
+                ? sizeof(NC_INTERNAL_BTREE_MAP_NODE(map_snake_case))                                                    \
+                : sizeof(NC_INTERNAL_BTREE_MAP_INTERNAL_NODE(map_snake_case)),                                          \
+            NC_INTERNAL_BTREE_MAP_ALIGNMENT(NC_INTERNAL_BTREE_MAP_INTERNAL_NODE(map_snake_case))                        \
+        );                                                                                                              \
+        NC_INTERNAL_ALLOC_STATS_SITE_LEAVE();                                                                           \
+        if (node == NULL)                                                                                               \
+            return NULL;                                                                                                \
+                                                                                                                        \
+        node->parent = NULL;                                                                                            \
+        node->parent_index = 0;                                                                                         \
+        node->size = 0;                                                                                                 \
+        node->is_leaf = is_leaf;                                                                                        \
+                                                                                                                        \
+        return node;                                                                                                    \
+    }                                                                                                                   \
+                                                                                                                        \
+    inline void NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_free_node)(                                       \
+        NC_BTREE_MAP(map_snake_case)* self,                                                                             \
+        NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* node                                                                \
+    ) {                                                                                                                 \
+        nc_allocator_free(                                                                                              \
+            self->p.allocator,                                                                                          \
+            node,                                                                                                       \
+            node->is_leaf                                                                                               \
+                ? sizeof(NC_INTERNAL_BTREE_MAP_NODE(map_snake_case))                                                    \
+                : sizeof(NC_INTERNAL_BTREE_MAP_INTERNAL_NODE(map_snake_case)),                                          \
+            NC_INTERNAL_BTREE_MAP_ALIGNMENT(NC_INTERNAL_BTREE_MAP_INTERNAL_NODE(map_snake_case))                        \
+        );                                                                                                              \
+    }                                                                                                                   \
+                                                                                                                        \
+    inline void NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_free_subtree)(                                    \
+        NC_BTREE_MAP(map_snake_case)* self,                                                                             \
+        NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* node                                                                \
+    ) {                                                                                                                 \
+        if (!node->is_leaf) {                                                                                           \
+            NC_INTERNAL_BTREE_MAP_INTERNAL_NODE(map_snake_case)* const internal =                                       \
+                NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_internal)(node);                                  \
+            for (size_t i = 0; i <= node->size; ++i)                                                                    \
+                NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_free_subtree)(self, internal->children[i]);       \
+        }                                                                                                               \
+                                                                                                                        \
+        NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_free_node)(self, node);                                   \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_BTreeMap_##map_snake_case
+
+        @brief Deallocates the map memory, keys and values are not destroyed
+    */                                                                                                                  \
+    inline void NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, destroy)(NC_BTREE_MAP(map_snake_case)* self) {      \
+        if (self->p.root != NULL)                                                                                       \
+            NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_free_subtree)(self, self->p.root);                    \
+                                                                                                                        \
+        *self = NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, init_in)(self->p.allocator);                        \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_BTreeMap_##map_snake_case
+
+        @brief Removes all entries and deallocates the nodes. Keys and values are not destroyed
+    */                                                                                                                  \
+    inline void NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, clear)(NC_BTREE_MAP(map_snake_case)* self) {        \
+        NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, destroy)(self);                                             \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_BTreeMap_##map_snake_case
+
+        @brief Returns number of entries in the map
+    */                                                                                                                  \
+    inline size_t NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, size)(const NC_BTREE_MAP(map_snake_case)* self) { \
+        return self->p.size;                                                                                            \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_BTreeMap_##map_snake_case
+
+        @brief Returns whether the map contains no entries
+    */                                                                                                                  \
+    inline bool NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, is_empty)(const NC_BTREE_MAP(map_snake_case)* self) { \
+        return self->p.size == 0;                                                                                       \
+    }                                                                                                                   \
+                                                                                                                        \
+    /* Returns number of keys in the node that are less than (or not greater than, if inclusive) the key */             \
+    inline size_t NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_search)(                                        \
+        const NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* node,                                                         \
+        const key_type* key,                                                                                            \
+        bool inclusive                                                                                                  \
+    ) {                                                                                                                 \
+        if (node->size == 0)                                                                                            \
+            return 0;                                                                                                   \
+                                                                                                                        \
+        /* Comparison result selects the next probe, which compiles to a conditional move */                            \
+        const int limit = inclusive ? 1 : 0;                                                                            \
+        size_t base = 0;                                                                                                \
+        size_t length = node->size;                                                                                     \
+        while (length > 1) {                                                                                            \
+            const size_t half = length / 2;                                                                             \
+            base = cmp_fn(&node->keys[base + half], key, NULL) < limit ? base + half : base;                            \
+            length -= half;                                                                                             \
+        }                                                                                                               \
+                                                                                                                        \
+        return base + (cmp_fn(&node->keys[base], key, NULL) < limit ? 1 : 0);                                           \
+    }                                                                                                                   \
+                                                                                                                        \
+    /* Finds the node and index of the key, returns NULL if there is none */                                            \
+    inline NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_find)(     \
+        const NC_BTREE_MAP(map_snake_case)* self,                                                                       \
+        const key_type* key,                                                                                            \
+        size_t* out_index                                                                                               \
+    ) {                                                                                                                 \
+        NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* node = self->p.root;                                                \
+        while (node != NULL) {                                                                                          \
+            const size_t index = NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_search)(node, key, false);       \
+            if (index < node->size && cmp_fn(&node->keys[index], key, NULL) == 0) {                                     \
+                *out_index = index;                                                                                     \
+                return node;                                                                                            \
+            }                                                                                                           \
+                                                                                                                        \
+            if (node->is_leaf)                                                                                          \
+                return NULL;                                                                                            \
+            node = NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_internal)(node)->children[index];              \
+        }                                                                                                               \
+                                                                                                                        \
+        return NULL;                                                                                                    \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_BTreeMap_##map_snake_case
+
+        @brief Returns pointer to the value associated with @p key or @p NULL if there is none
+
+        Pointer is valid until the next insertion or removal.
+    */                                                                                                                  \
+    inline value_type* NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, get)(                                        \
+        const NC_BTREE_MAP(map_snake_case)* self,                                                                       \
+        const key_type* key                                                                                             \
+    ) {                                                                                                                 \
+        size_t index = 0;                                                                                               \
+        NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* const node =                                                        \
+            NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_find)(self, key, &index);                             \
+                                                                                                                        \
+        return node != NULL ? &node->values[index] : NULL;                                                              \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_BTreeMap_##map_snake_case
+
+        @brief Returns whether the map contains @p key
+    */                                                                                                                  \
+    inline bool NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, contains)(                                          \
+        const NC_BTREE_MAP(map_snake_case)* self,                                                                       \
+        const key_type* key                                                                                             \
+    ) {                                                                                                                 \
+        return NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, get)(self, key) != NULL;                             \
+    }                                                                                                                   \
+                                                                                                                        \
+    inline void NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_set_child)(                                       \
+        NC_INTERNAL_BTREE_MAP_INTERNAL_NODE(map_snake_case)* node,                                                      \
+        size_t index,                                                                                                   \
+        NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* child                                                               \
+    ) {                                                                                                                 \
+        node->children[index] = child;                                                                                  \
+        child->parent = node;                                                                                           \
+        child->parent_index = (uint16_t)index;                                                                          \
+    }                                                                                                                   \
+                                                                                                                        \
+    /* Inserts the entry at index of a node that isn't full, with right_child following it in internal nodes */         \
+    inline void NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_node_insert)(                                     \
+        NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* node,                                                               \
+        size_t index,                                                                                                   \
+        const key_type* key,                                                                                            \
+        const value_type* value,                                                                                        \
+        NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* right_child                                                         \
+    ) {                                                                                                                 \
+        const size_t size = node->size;                                                                                 \
+        memmove(&node->keys[index + 1], &node->keys[index], (size - index) * sizeof(key_type));                         \
+        memmove(&node->values[index + 1], &node->values[index], (size - index) * sizeof(value_type));                   \
+        node->keys[index] = *key;                                                                                       \
+        node->values[index] = *value;                                                                                   \
+                                                                                                                        \
+        if (!node->is_leaf) {                                                                                           \
+            NC_INTERNAL_BTREE_MAP_INTERNAL_NODE(map_snake_case)* const internal =                                       \
+                NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_internal)(node);                                  \
+            for (size_t i = size + 1; i > index + 1; --i)                                                               \
+                NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_set_child)(internal, i, internal->children[i - 1]); \
+            NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_set_child)(internal, index + 1, right_child);         \
+        }                                                                                                               \
+                                                                                                                        \
+        node->size = (uint16_t)(size + 1);                                                                              \
+    }                                                                                                                   \
+                                                                                                                        \
+    /* Removes the entry at index of a node, together with the child following it in internal nodes */                  \
+    inline void NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_node_remove)(                                     \
+        NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* node,                                                               \
+        size_t index                                                                                                    \
+    ) {                                                                                                                 \
+        const size_t size = node->size;                                                                                 \
+        memmove(&node->keys[index], &node->keys[index + 1], (size - index - 1) * sizeof(key_type));                     \
+        memmove(&node->values[index], &node->values[index + 1], (size - index - 1) * sizeof(value_type));               \
+                                                                                                                        \
+        if (!node->is_leaf) {                                                                                           \
+            NC_INTERNAL_BTREE_MAP_INTERNAL_NODE(map_snake_case)* const internal =                                       \
+                NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_internal)(node);                                  \
+            for (size_t i = index + 1; i < size; ++i)                                                                   \
+                NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_set_child)(internal, i, internal->children[i + 1]); \
+        }                                                                                                               \
+                                                                                                                        \
+        node->size = (uint16_t)(size - 1);                                                                              \
+    }                                                                                                                   \
+                                                                                                                        \
+    /*                                                                                                                  \
+        Inserts the entry at index of a node, splitting full nodes up to the root with preallocated spare nodes.        \
+        Spare nodes are consumed from the end, first for the leaf level.                                                \
+    */                                                                                                                  \
+    inline void NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_insert_at)(                                       \
+        NC_BTREE_MAP(map_snake_case)* self,                                                                             \
+        NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* node,                                                               \
+        size_t index,                                                                                                   \
+        key_type key,                                                                                                   \
+        value_type value,                                                                                               \
+        NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)** spare,                                                             \
+        size_t spare_count                                                                                              \
+    ) {                                                                                                                 \
+        const size_t capacity = NC_INTERNAL_BTREE_MAP_CAPACITY(key_type);                                               \
+        NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* right_child = NULL;                                                 \
+        for (;;) {                                                                                                      \
+            if (node->size < capacity) {                                                                                \
+                NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_node_insert)(node, index, &key, &value, right_child); \
+                return;                                                                                                 \
+            }                                                                                                           \
+                                                                                                                        \
+            /* Split the full node around its middle entry, that moves to the parent */                                 \
+            const size_t middle = capacity / 2;                                                                         \
+            NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* const right = spare[--spare_count];                             \
+            const size_t right_size = capacity - middle - 1;                                                            \
+            memcpy(right->keys, &node->keys[middle + 1], right_size * sizeof(key_type));                                \
+            memcpy(right->values, &node->values[middle + 1], right_size * sizeof(value_type));                          \
+            if (!node->is_leaf) {                                                                                       \
+                NC_INTERNAL_BTREE_MAP_INTERNAL_NODE(map_snake_case)* const internal =                                   \
+                    NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_internal)(node);                              \
+                NC_INTERNAL_BTREE_MAP_INTERNAL_NODE(map_snake_case)* const right_internal =                             \
+                    NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_internal)(right);                             \
+                for (size_t i = 0; i <= right_size; ++i)                                                                \
+                    NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_set_child)(                                   \
+                        right_internal,                                                                                 \
+                        i,                                                                                              \
+                        internal->children[middle + 1 + i]                                                              \
+                    );                                                                                                  \
+            }                                                                                                           \
+            right->size = (uint16_t)right_size;                                                                         \
+            node->size = (uint16_t)middle;                                                                              \
+                                                                                                                        \
+            const key_type middle_key = node->keys[middle];                                                             \
+            const value_type middle_value = node->values[middle];                                                       \
+            if (index <= middle)                                                                                        \
+                NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_node_insert)(node, index, &key, &value, right_child); \
+            else                                                                                                        \
+                NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_node_insert)(                                     \
+                    right,                                                                                              \
+                    index - middle - 1,                                                                                 \
+                    &key,                                                                                               \
+                    &value,                                                                                             \
+                    right_child                                                                                         \
+                );                                                                                                      \
+                                                                                                                        \
+            key = middle_key;                                                                                           \
+            value = middle_value;                                                                                       \
+            right_child = right;                                                                                        \
+                                                                                                                        \
+            if (node->parent == NULL) {                                                                                 \
+                NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* const root = spare[--spare_count];                          \
+                root->keys[0] = key;                                                                                    \
+                root->values[0] = value;                                                                                \
+                root->size = 1;                                                                                         \
+                NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_set_child)(                                       \
+                    NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_internal)(root),                              \
+                    0,                                                                                                  \
+                    node                                                                                                \
+                );                                                                                                      \
+                NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_set_child)(                                       \
+                    NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_internal)(root),                              \
+                    1,                                                                                                  \
+                    right                                                                                               \
+                );                                                                                                      \
+                self->p.root = root;                                                                                    \
+                return;                                                                                                 \
+            }                                                                                                           \
+                                                                                                                        \
+            index = node->parent_index;                                                                                 \
+            node = &node->parent->base;                                                                                 \
+        }                                                                                                               \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_BTreeMap_##map_snake_case
+
+        @brief Inserts @p value associated with @p key
+
+        If the map already contains equal key, its value is overwritten,
+        and @p key is not stored (the caller keeps owning it).
+
+        @return @p true on success, @p false if allocation has failed (the map is not modified)
+    */                                                                                                                  \
+    inline bool NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, insert)(                                            \
+        NC_BTREE_MAP(map_snake_case)* self,                                                                             \
+        key_type key,                                                                                                   \
+        value_type value                                                                                                \
+    ) {                                                                                                                 \
+        if (self->p.root == NULL) {                                                                                     \
+            self->p.root = NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_alloc_node)(self, true);               \
+            if (self->p.root == NULL)                                                                                   \
+                return false;                                                                                           \
+        }                                                                                                               \
+                                                                                                                        \
+        NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* node = self->p.root;                                                \
+        size_t index = 0;                                                                                               \
+        for (;;) {                                                                                                      \
+            index = NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_search)(node, &key, false);                   \
+            if (index < node->size && cmp_fn(&node->keys[index], &key, NULL) == 0) {                                    \
+                node->values[index] = value;                                                                            \
+                return true;                                                                                            \
+            }                                                                                                           \
+                                                                                                                        \
+            if (node->is_leaf)                                                                                          \
+                break;                                                                                                  \
+            node = NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_internal)(node)->children[index];              \
+        }                                                                                                               \
+                                                                                                                        \
+        /* Allocate nodes for all splits upfront, so that failure leaves the map intact */                              \
+        NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* spare[NC_INTERNAL_BTREE_MAP_MAX_HEIGHT + 1];                        \
+        size_t spare_count = 0;                                                                                         \
+        const NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* full = node;                                                  \
+        while (full != NULL && full->size == NC_INTERNAL_BTREE_MAP_CAPACITY(key_type)) {                                \
+            full = full->parent != NULL ? &full->parent->base : NULL;                                                   \
+            spare_count += 1;                                                                                           \
+        }                                                                                                               \
+        if (full == NULL && spare_count > 0)                                                                            \
+            spare_count += 1;                                                                                           \
+                                                                                                                        \
+        for (size_t i = 0; i < spare_count; ++i) {                                                                      \
+            /* Spare nodes are used from the end, the last one is for the leaf level */                                 \
+            spare[spare_count - 1 - i] = NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_alloc_node)(             \
+                self,                                                                                                   \
+                i == 0                                                                                                  \
+            );                                                                                                          \
+            if (spare[spare_count - 1 - i] == NULL) {                                                                   \
+                for (size_t j = 0; j < i; ++j)                                                                          \
+                    NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_free_node)(self, spare[spare_count - 1 - j]); \
+                return false;                                                                                           \
+            }                                                                                                           \
+        }                                                                                                               \
+                                                                                                                        \
+        NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_insert_at)(self, node, index, key, value, spare, spare_count); \
+        self->p.size += 1;                                                                                              \
+                                                                                                                        \
+        return true;                                                                                                    \
+    }                                                                                                                   \
+                                                                                                                        \
+    /* Moves the last entry of the left sibling of child at index through the parent into the child */                  \
+    inline void NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_rotate_right)(                                    \
+        NC_INTERNAL_BTREE_MAP_INTERNAL_NODE(map_snake_case)* parent,                                                    \
+        size_t index                                                                                                    \
+    ) {                                                                                                                 \
+        NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* const left = parent->children[index - 1];                           \
+        NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* const child = parent->children[index];                              \
+        const size_t left_size = left->size;                                                                            \
+                                                                                                                        \
+        NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* moved_child = NULL;                                                 \
+        if (!left->is_leaf)                                                                                             \
+            moved_child = NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_internal)(left)->children[left_size];   \
+                                                                                                                        \
+        /* Insert at the front, shifting children right, then put the moved child first */                              \
+        const size_t size = child->size;                                                                                \
+        memmove(&child->keys[1], &child->keys[0], size * sizeof(key_type));                                             \
+        memmove(&child->values[1], &child->values[0], size * sizeof(value_type));                                       \
+        child->keys[0] = parent->base.keys[index - 1];                                                                  \
+        child->values[0] = parent->base.values[index - 1];                                                              \
+        if (!child->is_leaf) {                                                                                          \
+            NC_INTERNAL_BTREE_MAP_INTERNAL_NODE(map_snake_case)* const internal =                                       \
+                NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_internal)(child);                                 \
+            for (size_t i = size + 1; i > 0; --i)                                                                       \
+                NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_set_child)(internal, i, internal->children[i - 1]); \
+            NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_set_child)(internal, 0, moved_child);                 \
+        }                                                                                                               \
+        child->size = (uint16_t)(size + 1);                                                                             \
+                                                                                                                        \
+        parent->base.keys[index - 1] = left->keys[left_size - 1];                                                       \
+        parent->base.values[index - 1] = left->values[left_size - 1];                                                   \
+        left->size = (uint16_t)(left_size - 1);                                                                         \
+    }                                                                                                                   \
+                                                                                                                        \
+    /* Moves the first entry of the right sibling of child at index through the parent into the child */                \
+    inline void NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_rotate_left)(                                     \
+        NC_INTERNAL_BTREE_MAP_INTERNAL_NODE(map_snake_case)* parent,                                                    \
+        size_t index                                                                                                    \
+    ) {                                                                                                                 \
+        NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* const child = parent->children[index];                              \
+        NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* const right = parent->children[index + 1];                          \
+        const size_t size = child->size;                                                                                \
+                                                                                                                        \
+        child->keys[size] = parent->base.keys[index];                                                                   \
+        child->values[size] = parent->base.values[index];                                                               \
+        if (!child->is_leaf)                                                                                            \
+            NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_set_child)(                                           \
+                NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_internal)(child),                                 \
+                size + 1,                                                                                               \
+                NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_internal)(right)->children[0]                     \
+            );                                                                                                          \
+        child->size = (uint16_t)(size + 1);                                                                             \
+                                                                                                                        \
+        parent->base.keys[index] = right->keys[0];                                                                      \
+        parent->base.values[index] = right->values[0];                                                                  \
+                                                                                                                        \
+        /* Removing the first entry of the right node also drops its first child, which has just moved */               \
+        const size_t right_size = right->size;                                                                          \
+        memmove(&right->keys[0], &right->keys[1], (right_size - 1) * sizeof(key_type));                                 \
+        memmove(&right->values[0], &right->values[1], (right_size - 1) * sizeof(value_type));                           \
+        if (!right->is_leaf) {                                                                                          \
+            NC_INTERNAL_BTREE_MAP_INTERNAL_NODE(map_snake_case)* const internal =                                       \
+                NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_internal)(right);                                 \
+            for (size_t i = 0; i < right_size; ++i)                                                                     \
+                NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_set_child)(internal, i, internal->children[i + 1]); \
+        }                                                                                                               \
+        right->size = (uint16_t)(right_size - 1);                                                                       \
+    }                                                                                                                   \
+                                                                                                                        \
+    /* Merges child at index + 1 and the separating entry into child at index, and frees the merged node */             \
+    inline void NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_merge)(                                           \
+        NC_BTREE_MAP(map_snake_case)* self,                                                                             \
+        NC_INTERNAL_BTREE_MAP_INTERNAL_NODE(map_snake_case)* parent,                                                    \
+        size_t index                                                                                                    \
+    ) {                                                                                                                 \
+        NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* const left = parent->children[index];                               \
+        NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* const right = parent->children[index + 1];                          \
+        const size_t left_size = left->size;                                                                            \
+        const size_t right_size = right->size;                                                                          \
+                                                                                                                        \
+        left->keys[left_size] = parent->base.keys[index];                                                               \
+        left->values[left_size] = parent->base.values[index];                                                           \
+        memcpy(&left->keys[left_size + 1], right->keys, right_size * sizeof(key_type));                                 \
+        memcpy(&left->values[left_size + 1], right->values, right_size * sizeof(value_type));                           \
+        if (!left->is_leaf) {                                                                                           \
+            NC_INTERNAL_BTREE_MAP_INTERNAL_NODE(map_snake_case)* const internal =                                       \
+                NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_internal)(left);                                  \
+            NC_INTERNAL_BTREE_MAP_INTERNAL_NODE(map_snake_case)* const right_internal =                                 \
+                NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_internal)(right);                                 \
+            for (size_t i = 0; i <= right_size; ++i)                                                                    \
+                NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_set_child)(                                       \
+                    internal,                                                                                           \
+                    left_size + 1 + i,                                                                                  \
+                    right_internal->children[i]                                                                         \
+                );                                                                                                      \
+        }                                                                                                               \
+        left->size = (uint16_t)(left_size + 1 + right_size);                                                            \
+                                                                                                                        \
+        NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_node_remove)(&parent->base, index);                       \
+        NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_free_node)(self, right);                                  \
+    }                                                                                                                   \
+                                                                                                                        \
+    /* Restores minimum node sizes from the node up to the root, after an entry was removed from it */                  \
+    inline void NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_rebalance)(                                       \
+        NC_BTREE_MAP(map_snake_case)* self,                                                                             \
+        NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* node                                                                \
+    ) {                                                                                                                 \
+        const size_t min_size = NC_INTERNAL_BTREE_MAP_MIN_SIZE(key_type);                                               \
+        while (node->parent != NULL && node->size < min_size) {                                                         \
+            NC_INTERNAL_BTREE_MAP_INTERNAL_NODE(map_snake_case)* const parent = node->parent;                           \
+            const size_t index = node->parent_index;                                                                    \
+                                                                                                                        \
+            if (index > 0 && parent->children[index - 1]->size > min_size) {                                            \
+                NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_rotate_right)(parent, index);                     \
+                return;                                                                                                 \
+            }                                                                                                           \
+            if (index < parent->base.size && parent->children[index + 1]->size > min_size) {                            \
+                NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_rotate_left)(parent, index);                      \
+                return;                                                                                                 \
+            }                                                                                                           \
+                                                                                                                        \
+            NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_merge)(self, parent, index > 0 ? index - 1 : index);  \
+            node = &parent->base;                                                                                       \
+        }                                                                                                               \
+                                                                                                                        \
+        NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* const root = self->p.root;                                          \
+        if (root->size > 0)                                                                                             \
+            return;                                                                                                     \
+                                                                                                                        \
+        /* Root has lost its last entry, its only child (if any) becomes the root */                                    \
+        if (root->is_leaf) {                                                                                            \
+            self->p.root = NULL;                                                                                        \
+        } else {                                                                                                        \
+            self->p.root = NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_internal)(root)->children[0];          \
+            self->p.root->parent = NULL;                                                                                \
+            self->p.root->parent_index = 0;                                                                             \
+        }                                                                                                               \
+        NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_free_node)(self, root);                                   \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_BTreeMap_##map_snake_case
+
+        @brief Removes entry with @p key, writing stored key and value into @p out_key and @p out_value
+        unless they are @p NULL
+
+        @return @p true if entry was removed, @p false if there was none
+    */                                                                                                                  \
+    inline bool NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, remove)(                                            \
+        NC_BTREE_MAP(map_snake_case)* self,                                                                             \
+        const key_type* key,                                                                                            \
+        key_type* out_key,                                                                                              \
+        value_type* out_value                                                                                           \
+    ) {                                                                                                                 \
+        size_t index = 0;                                                                                               \
+        NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* node =                                                              \
+            NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_find)(self, key, &index);                             \
+        if (node == NULL)                                                                                               \
+            return false;                                                                                               \
+                                                                                                                        \
+        if (out_key != NULL)                                                                                            \
+            *out_key = node->keys[index];                                                                               \
+        if (out_value != NULL)                                                                                          \
+            *out_value = node->values[index];                                                                           \
+                                                                                                                        \
+        /* Entry of an internal node is replaced with its predecessor, that is removed from a leaf instead */           \
+        if (!node->is_leaf) {                                                                                           \
+            NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* leaf =                                                          \
+                NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_internal)(node)->children[index];                 \
+            while (!leaf->is_leaf)                                                                                      \
+                leaf = NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_internal)(leaf)->children[leaf->size];     \
+                                                                                                                        \
+            node->keys[index] = leaf->keys[leaf->size - 1];                                                             \
+            node->values[index] = leaf->values[leaf->size - 1];                                                         \
+            node = leaf;                                                                                                \
+            index = leaf->size - 1;                                                                                     \
+        }                                                                                                               \
+                                                                                                                        \
+        NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_node_remove)(node, index);                                \
+        self->p.size -= 1;                                                                                              \
+        NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_rebalance)(self, node);                                   \
+                                                                                                                        \
+        return true;                                                                                                    \
+    }                                                                                                                   \
+                                                                                                                        \
+    /* Links a chain of new empty nodes of given height as the last child of the node, returns the new leaf */          \
+    inline NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_push_chain)( \
+        NC_BTREE_MAP(map_snake_case)* self,                                                                             \
+        NC_INTERNAL_BTREE_MAP_INTERNAL_NODE(map_snake_case)* node,                                                      \
+        size_t height                                                                                                   \
+    ) {                                                                                                                 \
+        NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* chain[NC_INTERNAL_BTREE_MAP_MAX_HEIGHT + 1];                        \
+        for (size_t level = 0; level <= height; ++level) {                                                              \
+            chain[level] = NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_alloc_node)(self, level == height);    \
+            if (chain[level] == NULL) {                                                                                 \
+                for (size_t i = 0; i < level; ++i)                                                                      \
+                    NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_free_node)(self, chain[i]);                   \
+                return NULL;                                                                                            \
+            }                                                                                                           \
+        }                                                                                                               \
+                                                                                                                        \
+        NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_set_child)(node, node->base.size, chain[0]);              \
+        for (size_t level = 1; level <= height; ++level)                                                                \
+            NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_set_child)(                                           \
+                NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_internal)(chain[level - 1]),                      \
+                0,                                                                                                      \
+                chain[level]                                                                                            \
+            );                                                                                                          \
+                                                                                                                        \
+        return chain[height];                                                                                           \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_BTreeMap_##map_snake_case
+
+        @brief Builds the map from @p count entries with keys in strictly increasing order
+
+        Entries are appended to the rightmost leaf, so all nodes except the ones on the right border
+        are filled to capacity, which takes O(n) time and roughly half the memory of inserting
+        the entries one by one.
+
+        ## Safety
+        Calling this function on a non-empty map or with keys that are not strictly increasing,
+        leads to undefined behaviour
+
+        @param keys array of @p count keys
+        @param values array of @p count values
+        @param count number of entries
+
+        @return @p true on success, @p false if allocation has failed (the map is left empty)
+    */                                                                                                                  \
+    inline bool NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, bulk_load)(                                         \
+        NC_BTREE_MAP(map_snake_case)* self,                                                                             \
+        const key_type* keys,                                                                                           \
+        const value_type* values,                                                                                       \
+        size_t count                                                                                                    \
+    ) {                                                                                                                 \
+        if (count == 0)                                                                                                 \
+            return true;                                                                                                \
+                                                                                                                        \
+        const size_t capacity = NC_INTERNAL_BTREE_MAP_CAPACITY(key_type);                                               \
+        NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* leaf =                                                              \
+            NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_alloc_node)(self, true);                              \
+        if (leaf == NULL)                                                                                               \
+            return false;                                                                                               \
+        self->p.root = leaf;                                                                                            \
+                                                                                                                        \
+        for (size_t i = 0; i < count; ++i) {                                                                            \
+            if (leaf->size < capacity) {                                                                                \
+                leaf->keys[leaf->size] = keys[i];                                                                       \
+                leaf->values[leaf->size] = values[i];                                                                   \
+                leaf->size += 1;                                                                                        \
+                self->p.size += 1;                                                                                      \
+                continue;                                                                                               \
+            }                                                                                                           \
+                                                                                                                        \
+            /* Find the lowest ancestor with space, the entry becomes its last separator */                             \
+            NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* node = leaf;                                                    \
+            size_t height = 0;                                                                                          \
+            while (node->parent != NULL && node->parent->base.size == capacity) {                                       \
+                node = &node->parent->base;                                                                             \
+                height += 1;                                                                                            \
+            }                                                                                                           \
+                                                                                                                        \
+            NC_INTERNAL_BTREE_MAP_INTERNAL_NODE(map_snake_case)* open = node->parent;                                   \
+            if (open == NULL) {                                                                                         \
+                NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* const root =                                                \
+                    NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_alloc_node)(self, false);                     \
+                if (root == NULL) {                                                                                     \
+                    NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, destroy)(self);                                 \
+                    return false;                                                                                       \
+                }                                                                                                       \
+                                                                                                                        \
+                open = NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_internal)(root);                           \
+                NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_set_child)(open, 0, node);                        \
+                self->p.root = root;                                                                                    \
+            }                                                                                                           \
+                                                                                                                        \
+            open->base.keys[open->base.size] = keys[i];                                                                 \
+            open->base.values[open->base.size] = values[i];                                                             \
+            open->base.size += 1;                                                                                       \
+            self->p.size += 1;                                                                                          \
+                                                                                                                        \
+            leaf = NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_push_chain)(self, open, height);               \
+            if (leaf == NULL) {                                                                                         \
+                /* Separator has no right child yet */                                                                  \
+                open->base.size -= 1;                                                                                   \
+                NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, destroy)(self);                                     \
+                return false;                                                                                           \
+            }                                                                                                           \
+        }                                                                                                               \
+                                                                                                                        \
+        /* Only nodes on the right border can be underfull, fill them from their full left siblings */                  \
+        NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* node = self->p.root;                                                \
+        while (!node->is_leaf) {                                                                                        \
+            NC_INTERNAL_BTREE_MAP_INTERNAL_NODE(map_snake_case)* const internal =                                       \
+                NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_internal)(node);                                  \
+            NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* const last = internal->children[node->size];                    \
+            while (last->size < NC_INTERNAL_BTREE_MAP_MIN_SIZE(key_type))                                               \
+                NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_rotate_right)(internal, node->size);              \
+                                                                                                                        \
+            node = last;                                                                                                \
+        }                                                                                                               \
+                                                                                                                        \
+        return true;                                                                                                    \
+    }                                                                                                                   \
+                                                                                                                        \
+    /* Moves the cursor from the end of a node to the next separator of its ancestors */                                \
+    inline NC_BTREE_MAP_CURSOR(map_snake_case) NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_cursor_normalize)( \
+        NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* node,                                                               \
+        size_t index                                                                                                    \
+    ) {                                                                                                                 \
+        while (node != NULL && index == node->size) {                                                                   \
+            index = node->parent_index;                                                                                 \
+            node = node->parent != NULL ? &node->parent->base : NULL;                                                   \
+        }                                                                                                               \
+                                                                                                                        \
+        return (NC_BTREE_MAP_CURSOR(map_snake_case)) { .p = { .node = node, .index = index } };                         \
+    }                                                                                                                   \
+                                                                                                                        \
+    inline NC_BTREE_MAP_CURSOR(map_snake_case) NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_seek)(             \
+        const NC_BTREE_MAP(map_snake_case)* self,                                                                       \
+        const key_type* key,                                                                                            \
+        bool inclusive                                                                                                  \
+    ) {                                                                                                                 \
+        NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* node = self->p.root;                                                \
+        if (node == NULL)                                                                                               \
+            return (NC_BTREE_MAP_CURSOR(map_snake_case)) { .p = { .node = NULL, .index = 0 } };                         \
+                                                                                                                        \
+        for (;;) {                                                                                                      \
+            const size_t index = NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_search)(node, key, inclusive);   \
+            if (node->is_leaf)                                                                                          \
+                return NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_cursor_normalize)(node, index);            \
+            if (!inclusive && index < node->size && cmp_fn(&node->keys[index], key, NULL) == 0)                         \
+                return (NC_BTREE_MAP_CURSOR(map_snake_case)) { .p = { .node = node, .index = index } };                 \
+                                                                                                                        \
+            node = NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_internal)(node)->children[index];              \
+        }                                                                                                               \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_BTreeMap_##map_snake_case
+
+        @brief Returns cursor at the entry with the smallest key
+    */                                                                                                                  \
+    inline NC_BTREE_MAP_CURSOR(map_snake_case) NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, iter)(               \
+        const NC_BTREE_MAP(map_snake_case)* self                                                                        \
+    ) {                                                                                                                 \
+        NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* node = self->p.root;                                                \
+        while (node != NULL && !node->is_leaf)                                                                          \
+            node = NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_internal)(node)->children[0];                  \
+                                                                                                                        \
+        return NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_cursor_normalize)(node, 0);                        \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_BTreeMap_##map_snake_case
+
+        @brief Returns cursor at the first entry with key not less than @p key
+    */                                                                                                                  \
+    inline NC_BTREE_MAP_CURSOR(map_snake_case) NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, lower_bound)(        \
+        const NC_BTREE_MAP(map_snake_case)* self,                                                                       \
+        const key_type* key                                                                                             \
+    ) {                                                                                                                 \
+        return NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_seek)(self, key, false);                           \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_BTreeMap_##map_snake_case
+
+        @brief Returns cursor at the first entry with key greater than @p key
+    */                                                                                                                  \
+    inline NC_BTREE_MAP_CURSOR(map_snake_case) NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, upper_bound)(        \
+        const NC_BTREE_MAP(map_snake_case)* self,                                                                       \
+        const key_type* key                                                                                             \
+    ) {                                                                                                                 \
+        return NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_seek)(self, key, true);                            \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_BTreeMapCursor_##map_snake_case
+
+        @brief Writes pointers to the key and value of the entry at the cursor into @p out_key
+        and @p out_value (unless they are @p NULL), and advances the cursor to the next entry
+
+        Key must not be modified in a way that changes its ordering.
+
+        @return @p true if there was an entry, @p false if the cursor is past the last entry
+    */                                                                                                                  \
+    inline bool NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, cursor_next)(                                       \
+        NC_BTREE_MAP_CURSOR(map_snake_case)* self,                                                                      \
+        const key_type** out_key,                                                                                       \
+        value_type** out_value                                                                                          \
+    ) {                                                                                                                 \
+        NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* node = self->p.node;                                                \
+        if (node == NULL)                                                                                               \
+            return false;                                                                                               \
+                                                                                                                        \
+        const size_t index = self->p.index;                                                                             \
+        if (out_key != NULL)                                                                                            \
+            *out_key = &node->keys[index];                                                                              \
+        if (out_value != NULL)                                                                                          \
+            *out_value = &node->values[index];                                                                          \
+                                                                                                                        \
+        /* Successor of a separator is the first entry of the leftmost leaf of the subtree to its right */              \
+        if (!node->is_leaf) {                                                                                           \
+            node = NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_internal)(node)->children[index + 1];          \
+            while (!node->is_leaf)                                                                                      \
+                node = NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_internal)(node)->children[0];              \
+                                                                                                                        \
+            *self = (NC_BTREE_MAP_CURSOR(map_snake_case)) { .p = { .node = node, .index = 0 } };                        \
+        } else {                                                                                                        \
+            *self = NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_cursor_normalize)(node, index + 1);           \
+        }                                                                                                               \
+                                                                                                                        \
+        return true;                                                                                                    \
+    }
+
+/**
+ * @brief Macro that emits external definitions of the functions generated by @ref NC_DEFINE_BTREE_MAP()
+ *
+ * Must be used in exactly one translation unit, after @ref NC_DEFINE_BTREE_MAP() with the same arguments.
+*/
+#define NC_INSTANTIATE_BTREE_MAP(key_type, value_type, map_snake_case)                                                  \
+    extern inline NC_BTREE_MAP(map_snake_case) NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, init_in)(            \
+        NC_Allocator* allocator                                                                                         \
+    );                                                                                                                  \
+    extern inline NC_BTREE_MAP(map_snake_case) NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, init)();             \
+    extern inline NC_INTERNAL_BTREE_MAP_INTERNAL_NODE(map_snake_case)* NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_internal)( \
+        NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* node                                                                \
+    );                                                                                                                  \
+    extern inline NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_alloc_node)( \
+        NC_BTREE_MAP(map_snake_case)* self,                                                                             \
+        bool is_leaf                                                                                                    \
+    );                                                                                                                  \
+    extern inline void NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_free_node)(                                \
+        NC_BTREE_MAP(map_snake_case)* self,                                                                             \
+        NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* node                                                                \
+    );                                                                                                                  \
+    extern inline void NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_free_subtree)(                             \
+        NC_BTREE_MAP(map_snake_case)* self,                                                                             \
+        NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* node                                                                \
+    );                                                                                                                  \
+    extern inline void NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, destroy)(NC_BTREE_MAP(map_snake_case)* self); \
+    extern inline void NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, clear)(NC_BTREE_MAP(map_snake_case)* self);  \
+    extern inline size_t NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, size)(const NC_BTREE_MAP(map_snake_case)* self); \
+    extern inline bool NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, is_empty)(                                   \
+        const NC_BTREE_MAP(map_snake_case)* self                                                                        \
+    );                                                                                                                  \
+    extern inline size_t NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_search)(                                 \
+        const NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* node,                                                         \
+        const key_type* key,                                                                                            \
+        bool inclusive                                                                                                  \
+    );                                                                                                                  \
+    extern inline NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_find)( \
+        const NC_BTREE_MAP(map_snake_case)* self,                                                                       \
+        const key_type* key,                                                                                            \
+        size_t* out_index                                                                                               \
+    );                                                                                                                  \
+    extern inline value_type* NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, get)(                                 \
+        const NC_BTREE_MAP(map_snake_case)* self,                                                                       \
+        const key_type* key                                                                                             \
+    );                                                                                                                  \
+    extern inline bool NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, contains)(                                   \
+        const NC_BTREE_MAP(map_snake_case)* self,                                                                       \
+        const key_type* key                                                                                             \
+    );                                                                                                                  \
+    extern inline void NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_set_child)(                                \
+        NC_INTERNAL_BTREE_MAP_INTERNAL_NODE(map_snake_case)* node,                                                      \
+        size_t index,                                                                                                   \
+        NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* child                                                               \
+    );                                                                                                                  \
+    extern inline void NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_node_insert)(                              \
+        NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* node,                                                               \
+        size_t index,                                                                                                   \
+        const key_type* key,                                                                                            \
+        const value_type* value,                                                                                        \
+        NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* right_child                                                         \
+    );                                                                                                                  \
+    extern inline void NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_node_remove)(                              \
+        NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* node,                                                               \
+        size_t index                                                                                                    \
+    );                                                                                                                  \
+    extern inline void NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_insert_at)(                                \
+        NC_BTREE_MAP(map_snake_case)* self,                                                                             \
+        NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* node,                                                               \
+        size_t index,                                                                                                   \
+        key_type key,                                                                                                   \
+        value_type value,                                                                                               \
+        NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)** spare,                                                             \
+        size_t spare_count                                                                                              \
+    );                                                                                                                  \
+    extern inline bool NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, insert)(                                     \
+        NC_BTREE_MAP(map_snake_case)* self,                                                                             \
+        key_type key,                                                                                                   \
+        value_type value                                                                                                \
+    );                                                                                                                  \
+    extern inline void NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_rotate_right)(                             \
+        NC_INTERNAL_BTREE_MAP_INTERNAL_NODE(map_snake_case)* parent,                                                    \
+        size_t index                                                                                                    \
+    );                                                                                                                  \
+    extern inline void NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_rotate_left)(                              \
+        NC_INTERNAL_BTREE_MAP_INTERNAL_NODE(map_snake_case)* parent,                                                    \
+        size_t index                                                                                                    \
+    );                                                                                                                  \
+    extern inline void NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_merge)(                                    \
+        NC_BTREE_MAP(map_snake_case)* self,                                                                             \
+        NC_INTERNAL_BTREE_MAP_INTERNAL_NODE(map_snake_case)* parent,                                                    \
+        size_t index                                                                                                    \
+    );                                                                                                                  \
+    extern inline void NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_rebalance)(                                \
+        NC_BTREE_MAP(map_snake_case)* self,                                                                             \
+        NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* node                                                                \
+    );                                                                                                                  \
+    extern inline bool NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, remove)(                                     \
+        NC_BTREE_MAP(map_snake_case)* self,                                                                             \
+        const key_type* key,                                                                                            \
+        key_type* out_key,                                                                                              \
+        value_type* out_value                                                                                           \
+    );                                                                                                                  \
+    extern inline NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_push_chain)( \
+        NC_BTREE_MAP(map_snake_case)* self,                                                                             \
+        NC_INTERNAL_BTREE_MAP_INTERNAL_NODE(map_snake_case)* node,                                                      \
+        size_t height                                                                                                   \
+    );                                                                                                                  \
+    extern inline bool NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, bulk_load)(                                  \
+        NC_BTREE_MAP(map_snake_case)* self,                                                                             \
+        const key_type* keys,                                                                                           \
+        const value_type* values,                                                                                       \
+        size_t count                                                                                                    \
+    );                                                                                                                  \
+    extern inline NC_BTREE_MAP_CURSOR(map_snake_case) NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_cursor_normalize)( \
+        NC_INTERNAL_BTREE_MAP_NODE(map_snake_case)* node,                                                               \
+        size_t index                                                                                                    \
+    );                                                                                                                  \
+    extern inline NC_BTREE_MAP_CURSOR(map_snake_case) NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, p_seek)(      \
+        const NC_BTREE_MAP(map_snake_case)* self,                                                                       \
+        const key_type* key,                                                                                            \
+        bool inclusive                                                                                                  \
+    );                                                                                                                  \
+    extern inline NC_BTREE_MAP_CURSOR(map_snake_case) NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, iter)(        \
+        const NC_BTREE_MAP(map_snake_case)* self                                                                        \
+    );                                                                                                                  \
+    extern inline NC_BTREE_MAP_CURSOR(map_snake_case) NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, lower_bound)( \
+        const NC_BTREE_MAP(map_snake_case)* self,                                                                       \
+        const key_type* key                                                                                             \
+    );                                                                                                                  \
+    extern inline NC_BTREE_MAP_CURSOR(map_snake_case) NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, upper_bound)( \
+        const NC_BTREE_MAP(map_snake_case)* self,                                                                       \
+        const key_type* key                                                                                             \
+    );                                                                                                                  \
+    extern inline bool NC_INTERNAL_BTREE_MAP_FUNCTION_NAME(map_snake_case, cursor_next)(                                \
+        NC_BTREE_MAP_CURSOR(map_snake_case)* self,                                                                      \
+        const key_type** out_key,                                                                                       \
+        value_type** out_value                                                                                          \
+    );
+
+/**
+ * @}
+*/
@@ -0,0 +1,247 @@
+#pragma once
+
+/**
+ * @file
+*/
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "ncstd/allocator.h"
+#include "ncstd/containers/unsafe/raw_buffer.h"
+
+
+/** \addtogroup deque
+ *  @brief Double-ended queue
+ *  @{
+*/
+
+/**
+ * @brief Smallest capacity that deques allocate when growing from an empty state
+*/
+#define NC_DEQUE_MIN_CAPACITY 8
+
+/**
+ * @brief Double-ended queue of objects of the same size, stored in a ring buffer
+ *
+ * Capacity is always a power of two, so that positions wrap around with a mask.
+ * Pushing and popping at both ends is O(1), growth copies the elements
+ * into a new @ref NC_RawBuffer, unwrapping them to its start.
+ *
+ * ## Example
+ * @code
+ *  NC_Deque jobs = nc_deque_init(sizeof(Job));
+ *  nc_deque_push_back(&jobs, &job);
+ *  ...
+ *  const NC_DequeSlices slices = nc_deque_as_slices(&jobs);
+ *  process_jobs(slices.first, slices.first_size);
+ *  process_jobs(slices.second, slices.second_size);
+ *  nc_deque_consume_front(&jobs, slices.first_size + slices.second_size);
+ * @endcode
+*/
+typedef struct {
+    /**
+     * @protected
+     *
+     * @brief Members are not stable, and are displayed for educational purposes only
+    */
+    struct {
+        /** @protected Ring buffer, capacity is 0 or a power of two */
+        NC_RawBuffer raw_buffer;
+        /** @protected Position of the first element in the ring buffer */
+        size_t head;
+        /** @protected Number of elements */
+        size_t size;
+        /** @protected Size of a single element */
+        size_t object_size;
+    } p;
+} NC_Deque;
+
+/**
+ * @brief Contents of a deque as two contiguous ranges, that follow each other in deque order
+*/
+typedef struct {
+    /** Pointer to the first range, @p NULL if the deque is empty */
+    void* first;
+    /** Number of elements in the first range */
+    size_t first_size;
+    /** Pointer to the second range (elements that wrapped around), @p NULL if there are none */
+    void* second;
+    /** Number of elements in the second range */
+    size_t second_size;
+} NC_DequeSlices;
+
+/**
+ * @memberof NC_Deque
+ *
+ * @brief Initializes empty deque (performs no dynamic allocations)
+ *
+ * ## Safety
+ * Calling this function with @p object_size equal to 0, leads to undefined behaviour
+ *
+ * @param object_size size of a single element
+ *
+ * @return created deque
+*/
+NC_Deque nc_deque_init(size_t object_size);
+/**
+ * @memberof NC_Deque
+ *
+ * @brief Initializes empty deque that will use @p allocator for all its allocations
+ * (performs no dynamic allocations)
+ *
+ * @param object_size size of a single element
+ * @param allocator allocator, must outlive the deque
+ *
+ * @return created deque
+*/
+NC_Deque nc_deque_init_in(size_t object_size, NC_Allocator* allocator);
+/**
+ * @memberof NC_Deque
+ *
+ * @brief Initializes empty deque with space for at least @p capacity elements
+ *
+ * @param capacity starting capacity, rounded up to a power of two
+ * @param object_size size of a single element
+ *
+ * @return created deque
+*/
+NC_Deque nc_deque_init_with_capacity(size_t capacity, size_t object_size);
+/**
+ * @memberof NC_Deque
+ *
+ * @brief Same as @ref nc_deque_init_with_capacity(), but uses @p allocator for all allocations
+ *
+ * @param capacity starting capacity, rounded up to a power of two
+ * @param object_size size of a single element
+ * @param allocator allocator, must outlive the deque
+ *
+ * @return created deque
+*/
+NC_Deque nc_deque_init_with_capacity_in(size_t capacity, size_t object_size, NC_Allocator* allocator);
+/**
+ * @memberof NC_Deque
+ *
+ * @brief Deallocates the deque memory, elements are not destroyed
+*/
+void nc_deque_destroy(NC_Deque* self);
+
+/**
+ * @memberof NC_Deque
+ *
+ * @brief Returns number of elements in the deque
+*/
+size_t nc_deque_size(const NC_Deque* self);
+/**
+ * @memberof NC_Deque
+ *
+ * @brief Returns number of elements the deque can hold without reallocation
+*/
+size_t nc_deque_capacity(const NC_Deque* self);
+/**
+ * @memberof NC_Deque
+ *
+ * @brief Returns whether the deque contains no elements
+*/
+bool nc_deque_is_empty(const NC_Deque* self);
+
+/**
+ * @memberof NC_Deque
+ *
+ * @brief Returns pointer to the element at @p index counting from the front
+ *
+ * ## Safety
+ * Calling this function with @p index out of bounds leads to undefined behaviour
+*/
+void* nc_deque_get_unchecked(const NC_Deque* self, size_t index);
+/**
+ * @memberof NC_Deque
+ *
+ * @brief Returns pointer to the element at @p index counting from the front,
+ * or @p NULL if @p index is out of bounds
+*/
+void* nc_deque_get(const NC_Deque* self, size_t index);
+/**
+ * @memberof NC_Deque
+ *
+ * @brief Returns pointer to the first element or @p NULL if the deque is empty
+*/
+void* nc_deque_front(const NC_Deque* self);
+/**
+ * @memberof NC_Deque
+ *
+ * @brief Returns pointer to the last element or @p NULL if the deque is empty
+*/
+void* nc_deque_back(const NC_Deque* self);
+/**
+ * @memberof NC_Deque
+ *
+ * @brief Returns contents of the deque as two contiguous ranges, without copying
+ *
+ * Pointers are valid until the next modification of the deque.
+ *
+ * @return slices of the deque
+*/
+NC_DequeSlices nc_deque_as_slices(const NC_Deque* self);
+
+/**
+ * @memberof NC_Deque
+ *
+ * @brief Reserves capacity for at least @p new_capacity elements
+ *
+ * @param new_capacity required capacity, rounded up to a power of two
+ *
+ * @return @p true on success, @p false if allocation has failed
+*/
+bool nc_deque_reserve(NC_Deque* self, size_t new_capacity);
+/**
+ * @memberof NC_Deque
+ *
+ * @brief Copies @p object to the back of the deque
+ *
+ * @return @p true on success, @p false if allocation has failed
+*/
+bool nc_deque_push_back(NC_Deque* self, const void* object);
+/**
+ * @memberof NC_Deque
+ *
+ * @brief Copies @p object to the front of the deque
+ *
+ * @return @p true on success, @p false if allocation has failed
+*/
+bool nc_deque_push_front(NC_Deque* self, const void* object);
+/**
+ * @memberof NC_Deque
+ *
+ * @brief Removes the last element, copying it to @p out_object unless it's @p NULL
+ *
+ * @return @p true if element was removed, @p false if the deque is empty
+*/
+bool nc_deque_pop_back(NC_Deque* self, void* out_object);
+/**
+ * @memberof NC_Deque
+ *
+ * @brief Removes the first element, copying it to @p out_object unless it's @p NULL
+ *
+ * @return @p true if element was removed, @p false if the deque is empty
+*/
+bool nc_deque_pop_front(NC_Deque* self, void* out_object);
+/**
+ * @memberof NC_Deque
+ *
+ * @brief Removes @p count elements from the front without copying them,
+ * e.g. after processing them through @ref nc_deque_as_slices()
+ *
+ * If @p count is greater than the size, all elements are removed.
+*/
+void nc_deque_consume_front(NC_Deque* self, size_t count);
+/**
+ * @memberof NC_Deque
+ *
+ * @brief Removes all elements, keeping the capacity
+*/
+void nc_deque_clear(NC_Deque* self);
+
+/**
+ * @}
+*/
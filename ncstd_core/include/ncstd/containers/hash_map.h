@@ -0,0 +1,626 @@
+#pragma once
+
+/**
+ * @file
+*/
+
+#include <stdalign.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "ncstd/alloc_stats.h"
+#include "ncstd/allocator.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define NC_INTERNAL_HASH_MAP_SSE2
+#include <emmintrin.h>
+#endif
+
+
+/** \addtogroup hash_map
+ *  @brief Open-addressing hash maps
+ *  @{
+*/
+
+/**
+ * @brief Smallest non-zero capacity of a hash map
+*/
+#define NC_HASH_MAP_MIN_CAPACITY 16
+
+#define NC_INTERNAL_HASH_MAP_GROUP_WIDTH 16
+#define NC_INTERNAL_HASH_MAP_EMPTY ((uint8_t)0x80)
+
+#define NC_INTERNAL_HASH_MAP_ALIGNMENT(type) (alignof(type) > NC_DEFAULT_ALIGNMENT ? alignof(type) : NC_DEFAULT_ALIGNMENT)
+
+inline uint32_t nc_internal_hash_map_group_match(const uint8_t* group, uint8_t h2) {
+#ifdef NC_INTERNAL_HASH_MAP_SSE2
+    const __m128i ctrl = _mm_loadu_si128((const __m128i*)group);
+
+    return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8((char)h2)));
+#else
+    uint32_t mask = 0;
+    for (uint32_t i = 0; i < NC_INTERNAL_HASH_MAP_GROUP_WIDTH; ++i)
+        mask |= (uint32_t)(group[i] == h2) << i;
+
+    return mask;
+#endif
+}
+
+inline uint32_t nc_internal_hash_map_group_match_empty(const uint8_t* group) {
+#ifdef NC_INTERNAL_HASH_MAP_SSE2
+    return (uint32_t)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)group));
+#else
+    uint32_t mask = 0;
+    for (uint32_t i = 0; i < NC_INTERNAL_HASH_MAP_GROUP_WIDTH; ++i)
+        mask |= (uint32_t)(group[i] >> 7) << i;
+
+    return mask;
+#endif
+}
+
+inline uint32_t nc_internal_hash_map_lowest_bit(uint32_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (uint32_t)__builtin_ctz(mask);
+#else
+    uint32_t index = 0;
+    while (!(mask & 1)) {
+        mask >>= 1;
+        index += 1;
+    }
+
+    return index;
+#endif
+}
+
+// Maximum load factor is 7/8
+inline size_t nc_internal_hash_map_max_size(size_t capacity) {
+    return capacity - capacity / 8;
+}
+
+// First GROUP_WIDTH - 1 control bytes are mirrored after the end,
+// so that a group can be loaded starting from any slot without wrapping around
+inline void nc_internal_hash_map_set_ctrl(uint8_t* ctrl, size_t capacity, size_t index, uint8_t value) {
+    ctrl[index] = value;
+    if (index < NC_INTERNAL_HASH_MAP_GROUP_WIDTH - 1)
+        ctrl[capacity + index] = value;
+}
+
+/**
+ * @brief Macro that defines name of a hash map type
+ *
+ * ## Example
+ * @code
+ *  NC_HASH_MAP(NC_StringView, int)
+ * @endcode
+ * expands to
+ * @code
+ *  NC_HashMap_NC_StringView_int
+ * @endcode
+ *
+ * @param key_type type of the keys
+ * @param value_type type of the values
+*/
+#define NC_HASH_MAP(key_type, value_type) NC_HashMap_##key_type##_##value_type
+/**
+ * @brief Macro that defines name of a hash map entry type, that holds @p key and @p value members
+ *
+ * @param key_type type of the keys
+ * @param value_type type of the values
+*/
+#define NC_HASH_MAP_ENTRY(key_type, value_type) NC_HashMapEntry_##key_type##_##value_type
+
+#define NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, function_name) nc_hash_map_##map_snake_case##_##function_name
+
+/**
+ * @brief Macro that defines a hash map from @p key_type to @p value_type
+ *
+ * Map is a flat open-addressing table in the style of Swiss tables: every slot has a control byte,
+ * that is either empty or holds 7 bits of the key hash. Lookup compares control bytes of 16 consecutive slots
+ * at once (using SSE2 when available) and calls @p eq_fn only for slots with matching hash bits.
+ *
+ * Slots are probed linearly, which allows deletion to shift the following entries back
+ * instead of leaving tombstones, so lookups never slow down after many removals.
+ *
+ * Keys and values are moved in and out of the map by value. The map doesn't destroy them,
+ * so for owning types (e.g. @ref NC_String) use the out parameters of @p remove and iterate
+ * with @p next_entry before @p destroy.
+ *
+ * ## Example
+ * @code
+ *  NC_DEFINE_HASH_MAP(NC_StringView, int, string_view_int, nc_string_view_ptr_hash, nc_string_view_ptr_eq)
+ *
+ *  NC_HASH_MAP(NC_StringView, int) map = nc_hash_map_string_view_int_init();
+ *  nc_hash_map_string_view_int_insert(&map, nc_string_view_from_cstr("one"), 1);
+ *
+ *  const NC_StringView key = nc_string_view_from_cstr("one");
+ *  int* const value = nc_hash_map_string_view_int_get(&map, &key);
+ *
+ *  nc_hash_map_string_view_int_destroy(&map);
+ * @endcode
+ *
+ * Since all generated functions are @p inline, exactly one translation unit
+ * must also contain @ref NC_INSTANTIATE_HASH_MAP() with the same arguments.
+ *
+ * @param key_type type of the keys
+ * @param value_type type of the values
+ * @param map_snake_case name used in generated function names (@p nc_hash_map_<map_snake_case>_insert, etc.)
+ * @param hash_fn function with signature `uint64_t (const void* key, void* data)`, @p data is always @p NULL
+ * @param eq_fn function with signature `bool (const void* a, const void* b, void* data)`
+ * (e.g. @ref nc_string_view_ptr_eq()), @p data is always @p NULL
+ *
+ * @note Since generated functions are @p inline with external linkage, @p hash_fn and @p eq_fn
+ * must not be @p static.
+*/
+#define NC_DEFINE_HASH_MAP(key_type, value_type, map_snake_case, hash_fn, eq_fn)                                        \
+    /**
+        @brief Hash map entry
+    */                                                                                                                  \
+    typedef struct {                                                                                                    \
+        /** Key */                                                                                                      \
+        key_type key;                                                                                                   \
+        /** Value */                                                                                                    \
+        value_type value;                                                                                               \
+    } NC_HASH_MAP_ENTRY(key_type, value_type);                                                                          \
+                                                                                                                        \
+    /**
+        @brief Hash map
+    */                                                                                                                  \
+    typedef struct {                                                                                                    \
+        /**
+            @protected
+
+            @brief Members are not stable, and are displayed for educational purposes only
+        */                                                                                                              \
+        struct {                                                                                                        \
+            /** @protected Entry slots, followed by control bytes in the same allocation */                             \
+            NC_HASH_MAP_ENTRY(key_type, value_type)* entries;                                                           \
+            /** @protected Control bytes, one per slot plus mirrored bytes of the first group */                        \
+            uint8_t* ctrl;                                                                                              \
+            /** @protected Number of slots, 0 or a power of two */                                                      \
+            size_t capacity;                                                                                            \
+            /** @protected Number of entries */                                                                         \
+            size_t size;                                                                                                \
+            /** @protected Allocator that owns the table memory */                                                      \
+            NC_Allocator* allocator;                                                                                    \
+        } p;                                                                                                            \
+    } NC_HASH_MAP(key_type, value_type);                                                                                \
+                                                                                                                        \
+    /**
+        @memberof NC_HashMap_##key_type##_##value_type
+
+        @brief Initializes an empty hash map that will use @p allocator (performs no dynamic allocations)
+
+        @param allocator allocator, must outlive the map
+
+        @return created hash map
+    */                                                                                                                  \
+    inline NC_HASH_MAP(key_type, value_type) NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, init_in)(               \
+        NC_Allocator* allocator                                                                                         \
+    ) {                                                                                                                 \
+        return (NC_HASH_MAP(key_type, value_type)) {                                                                    \
+            .p = { .entries = NULL, .ctrl = NULL, .capacity = 0, .size = 0, .allocator = allocator }                    \
+        };                                                                                                              \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_HashMap_##key_type##_##value_type
+
+        @brief Initializes an empty hash map (performs no dynamic allocations)
+
+        @return created hash map
+    */                                                                                                                  \
+    inline NC_HASH_MAP(key_type, value_type) NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, init)() {               \
+        return NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, init_in)(nc_allocator_default());                     \
+    }                                                                                                                   \
+                                                                                                                        \
+    inline size_t NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, p_allocation_size)(size_t capacity) {              \
+        return capacity * sizeof(NC_HASH_MAP_ENTRY(key_type, value_type))                                               \
+            + capacity + NC_INTERNAL_HASH_MAP_GROUP_WIDTH - 1;                                                          \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_HashMap_##key_type##_##value_type
+
+        @brief Deallocates the map memory, keys and values are not destroyed
+    */                                                                                                                  \
+    inline void NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, destroy)(NC_HASH_MAP(key_type, value_type)* self) {  \
+        nc_allocator_free(                                                                                              \
+            self->p.allocator,                                                                                          \
+            self->p.entries,                                                                                            \
+            NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, p_allocation_size)(self->p.capacity),                    \
+            NC_INTERNAL_HASH_MAP_ALIGNMENT(NC_HASH_MAP_ENTRY(key_type, value_type))                                     \
+        );                                                                                                              \
+                                                                                                                        \
+        *self = NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, init_in)(self->p.allocator);                         \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_HashMap_##key_type##_##value_type
+
+        @brief Returns number of entries in the map
+    */                                                                                                                  \
+    inline size_t NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, size)(const NC_HASH_MAP(key_type, value_type)* self) { \
+        return self->p.size;                                                                                            \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_HashMap_##key_type##_##value_type
+
+        @brief Returns number of slots in the map
+    */                                                                                                                  \
+    inline size_t NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, capacity)(                                         \
+        const NC_HASH_MAP(key_type, value_type)* self                                                                   \
+    ) {                                                                                                                 \
+        return self->p.capacity;                                                                                        \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_HashMap_##key_type##_##value_type
+
+        @brief Returns whether the map contains no entries
+    */                                                                                                                  \
+    inline bool NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, is_empty)(                                           \
+        const NC_HASH_MAP(key_type, value_type)* self                                                                   \
+    ) {                                                                                                                 \
+        return self->p.size == 0;                                                                                       \
+    }                                                                                                                   \
+                                                                                                                        \
+    inline size_t NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, p_home)(                                           \
+        const NC_HASH_MAP(key_type, value_type)* self,                                                                  \
+        uint64_t hash                                                                                                   \
+    ) {                                                                                                                 \
+        return (size_t)(hash >> 7) & (self->p.capacity - 1);                                                            \
+    }                                                                                                                   \
+                                                                                                                        \
+    /* Returns index of the slot holding @p key, or index of the first empty slot after its home */                     \
+    inline size_t NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, p_probe)(                                          \
+        const NC_HASH_MAP(key_type, value_type)* self,                                                                  \
+        const key_type* key,                                                                                            \
+        uint64_t hash,                                                                                                  \
+        bool* out_found                                                                                                 \
+    ) {                                                                                                                 \
+        const size_t mask = self->p.capacity - 1;                                                                       \
+        const uint8_t h2 = (uint8_t)(hash & 0x7F);                                                                      \
+                                                                                                                        \
+        size_t position = NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, p_home)(self, hash);                       \
+        for (;;) {                                                                                                      \
+            const uint8_t* const group = self->p.ctrl + position;                                                       \
+                                                                                                                        \
+            for (uint32_t matches = nc_internal_hash_map_group_match(group, h2); matches != 0; matches &= matches - 1) { \
+                const size_t index = (position + nc_internal_hash_map_lowest_bit(matches)) & mask;                      \
+                if (eq_fn(&self->p.entries[index].key, key, NULL)) {                                                    \
+                    *out_found = true;                                                                                  \
+                    return index;                                                                                       \
+                }                                                                                                       \
+            }                                                                                                           \
+                                                                                                                        \
+            const uint32_t empty = nc_internal_hash_map_group_match_empty(group);                                       \
+            if (empty != 0) {                                                                                           \
+                *out_found = false;                                                                                     \
+                return (position + nc_internal_hash_map_lowest_bit(empty)) & mask;                                      \
+            }                                                                                                           \
+                                                                                                                        \
+            position = (position + NC_INTERNAL_HASH_MAP_GROUP_WIDTH) & mask;                                            \
+        }                                                                                                               \
+    }                                                                                                                   \
+                                                                                                                        \
+    inline size_t NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, p_find_empty)(                                     \
+        const NC_HASH_MAP(key_type, value_type)* self,                                                                  \
+        uint64_t hash                                                                                                   \
+    ) {                                                                                                                 \
+        const size_t mask = self->p.capacity - 1;                                                                       \
+                                                                                                                        \
+        size_t position = NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, p_home)(self, hash);                       \
+        for (;;) {                                                                                                      \
+            const uint32_t empty = nc_internal_hash_map_group_match_empty(self->p.ctrl + position);                     \
+            if (empty != 0)                                                                                             \
+                return (position + nc_internal_hash_map_lowest_bit(empty)) & mask;                                      \
+                                                                                                                        \
+            position = (position + NC_INTERNAL_HASH_MAP_GROUP_WIDTH) & mask;                                            \
+        }                                                                                                               \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_HashMap_##key_type##_##value_type
+
+        @brief Returns pointer to the value associated with @p key or @p NULL if there is none
+
+        Pointer is valid until the next insertion or removal.
+    */                                                                                                                  \
+    inline value_type* NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, get)(                                         \
+        const NC_HASH_MAP(key_type, value_type)* self,                                                                  \
+        const key_type* key                                                                                             \
+    ) {                                                                                                                 \
+        if (self->p.size == 0)                                                                                          \
+            return NULL;                                                                                                \
+                                                                                                                        \
+        bool found;                                                                                                     \
+        const size_t index = NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, p_probe)(self, key, hash_fn(key, NULL), &found); \
+                                                                                                                        \
+        return found ? &self->p.entries[index].value : NULL;                                                            \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_HashMap_##key_type##_##value_type
+
+        @brief Returns whether the map contains @p key
+    */                                                                                                                  \
+    inline bool NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, contains)(                                           \
+        const NC_HASH_MAP(key_type, value_type)* self,                                                                  \
+        const key_type* key                                                                                             \
+    ) {                                                                                                                 \
+        return NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, get)(self, key) != NULL;                              \
+    }                                                                                                                   \
+                                                                                                                        \
+    inline bool NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, p_rehash)(                                           \
+        NC_HASH_MAP(key_type, value_type)* self,                                                                        \
+        size_t new_capacity                                                                                             \
+    ) {                                                                                                                 \
+        NC_INTERNAL_ALLOC_STATS_SITE_ENTER();                                                                           \
+        void* const table = nc_allocator_alloc(                                                                         \
+            self->p.allocator,                                                                                          \
+            NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, p_allocation_size)(new_capacity),                        \
+            NC_INTERNAL_HASH_MAP_ALIGNMENT(NC_HASH_MAP_ENTRY(key_type, value_type))                                     \
+        );                                                                                                              \
+        NC_INTERNAL_ALLOC_STATS_SITE_LEAVE();                                                                           \
+        if (table == NULL)                                                                                              \
+            return false;                                                                                               \
+                                                                                                                        \
+        NC_HASH_MAP(key_type, value_type) old = *self;                                                                  \
+                                                                                                                        \
+        self->p.entries = table;                                                                                        \
+        self->p.ctrl = (uint8_t*)table + new_capacity * sizeof(NC_HASH_MAP_ENTRY(key_type, value_type));                \
+        self->p.capacity = new_capacity;                                                                                \
+        memset(self->p.ctrl, NC_INTERNAL_HASH_MAP_EMPTY, new_capacity + NC_INTERNAL_HASH_MAP_GROUP_WIDTH - 1);          \
+                                                                                                                        \
+        for (size_t i = 0; i < old.p.capacity; ++i) {                                                                   \
+            if (old.p.ctrl[i] == NC_INTERNAL_HASH_MAP_EMPTY)                                                            \
+                continue;                                                                                               \
+                                                                                                                        \
+            const uint64_t hash = hash_fn(&old.p.entries[i].key, NULL);                                                 \
+            const size_t index = NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, p_find_empty)(self, hash);          \
+            self->p.entries[index] = old.p.entries[i];                                                                  \
+            nc_internal_hash_map_set_ctrl(self->p.ctrl, new_capacity, index, old.p.ctrl[i]);                            \
+        }                                                                                                               \
+                                                                                                                        \
+        nc_allocator_free(                                                                                              \
+            old.p.allocator,                                                                                            \
+            old.p.entries,                                                                                              \
+            NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, p_allocation_size)(old.p.capacity),                      \
+            NC_INTERNAL_HASH_MAP_ALIGNMENT(NC_HASH_MAP_ENTRY(key_type, value_type))                                     \
+        );                                                                                                              \
+                                                                                                                        \
+        return true;                                                                                                    \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_HashMap_##key_type##_##value_type
+
+        @brief Reserves space for at least @p count entries, so that inserting them doesn't rehash the map
+
+        @return @p true on success, @p false if allocation has failed
+    */                                                                                                                  \
+    inline bool NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, reserve)(                                            \
+        NC_HASH_MAP(key_type, value_type)* self,                                                                        \
+        size_t count                                                                                                    \
+    ) {                                                                                                                 \
+        if (count <= nc_internal_hash_map_max_size(self->p.capacity))                                                   \
+            return true;                                                                                                \
+                                                                                                                        \
+        size_t new_capacity = self->p.capacity < NC_HASH_MAP_MIN_CAPACITY ? NC_HASH_MAP_MIN_CAPACITY : self->p.capacity * 2; \
+        while (count > nc_internal_hash_map_max_size(new_capacity))                                                     \
+            new_capacity *= 2;                                                                                          \
+                                                                                                                        \
+        return NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, p_rehash)(self, new_capacity);                        \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_HashMap_##key_type##_##value_type
+
+        @brief Inserts @p value associated with @p key
+
+        If the map already contains equal key, its value is overwritten,
+        and @p key is not stored (the caller keeps owning it).
+
+        @return @p true on success, @p false if allocation has failed
+    */                                                                                                                  \
+    inline bool NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, insert)(                                             \
+        NC_HASH_MAP(key_type, value_type)* self,                                                                        \
+        key_type key,                                                                                                   \
+        value_type value                                                                                                \
+    ) {                                                                                                                 \
+        const uint64_t hash = hash_fn(&key, NULL);                                                                      \
+                                                                                                                        \
+        size_t index = 0;                                                                                               \
+        bool found = false;                                                                                             \
+        if (self->p.capacity != 0)                                                                                      \
+            index = NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, p_probe)(self, &key, hash, &found);              \
+                                                                                                                        \
+        if (found) {                                                                                                    \
+            self->p.entries[index].value = value;                                                                       \
+            return true;                                                                                                \
+        }                                                                                                               \
+                                                                                                                        \
+        if (self->p.size + 1 > nc_internal_hash_map_max_size(self->p.capacity)) {                                       \
+            if (!NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, reserve)(self, self->p.size + 1))                   \
+                return false;                                                                                           \
+                                                                                                                        \
+            index = NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, p_find_empty)(self, hash);                       \
+        }                                                                                                               \
+                                                                                                                        \
+        self->p.entries[index] = (NC_HASH_MAP_ENTRY(key_type, value_type)) { .key = key, .value = value };              \
+        nc_internal_hash_map_set_ctrl(self->p.ctrl, self->p.capacity, index, (uint8_t)(hash & 0x7F));                   \
+        self->p.size += 1;                                                                                              \
+                                                                                                                        \
+        return true;                                                                                                    \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_HashMap_##key_type##_##value_type
+
+        @brief Removes entry with @p key, writing stored key and value into @p out_key and @p out_value
+        unless they are @p NULL
+
+        @return @p true if entry was removed, @p false if there was none
+    */                                                                                                                  \
+    inline bool NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, remove)(                                             \
+        NC_HASH_MAP(key_type, value_type)* self,                                                                        \
+        const key_type* key,                                                                                            \
+        key_type* out_key,                                                                                              \
+        value_type* out_value                                                                                           \
+    ) {                                                                                                                 \
+        if (self->p.size == 0)                                                                                          \
+            return false;                                                                                               \
+                                                                                                                        \
+        bool found;                                                                                                     \
+        size_t hole = NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, p_probe)(self, key, hash_fn(key, NULL), &found); \
+        if (!found)                                                                                                     \
+            return false;                                                                                               \
+                                                                                                                        \
+        if (out_key != NULL)                                                                                            \
+            *out_key = self->p.entries[hole].key;                                                                       \
+        if (out_value != NULL)                                                                                          \
+            *out_value = self->p.entries[hole].value;                                                                   \
+                                                                                                                        \
+        /* Shift following entries of the cluster back, if the hole is between their home and their slot */             \
+        const size_t mask = self->p.capacity - 1;                                                                       \
+        for (size_t next = (hole + 1) & mask; self->p.ctrl[next] != NC_INTERNAL_HASH_MAP_EMPTY; next = (next + 1) & mask) { \
+            const size_t home = NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, p_home)(                             \
+                self,                                                                                                   \
+                hash_fn(&self->p.entries[next].key, NULL)                                                               \
+            );                                                                                                          \
+            if (((next - home) & mask) < ((next - hole) & mask))                                                        \
+                continue;                                                                                               \
+                                                                                                                        \
+            self->p.entries[hole] = self->p.entries[next];                                                              \
+            nc_internal_hash_map_set_ctrl(self->p.ctrl, self->p.capacity, hole, self->p.ctrl[next]);                    \
+            hole = next;                                                                                                \
+        }                                                                                                               \
+                                                                                                                        \
+        nc_internal_hash_map_set_ctrl(self->p.ctrl, self->p.capacity, hole, NC_INTERNAL_HASH_MAP_EMPTY);                \
+        self->p.size -= 1;                                                                                              \
+                                                                                                                        \
+        return true;                                                                                                    \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_HashMap_##key_type##_##value_type
+
+        @brief Removes all entries, keeping the capacity. Keys and values are not destroyed
+    */                                                                                                                  \
+    inline void NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, clear)(NC_HASH_MAP(key_type, value_type)* self) {    \
+        if (self->p.capacity != 0)                                                                                      \
+            memset(self->p.ctrl, NC_INTERNAL_HASH_MAP_EMPTY, self->p.capacity + NC_INTERNAL_HASH_MAP_GROUP_WIDTH - 1);  \
+                                                                                                                        \
+        self->p.size = 0;                                                                                               \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_HashMap_##key_type##_##value_type
+
+        @brief Returns the next entry, starting from slot @p *cursor, and advances the cursor past it
+
+        ## Example
+        @code
+         size_t cursor = 0;
+         for (NC_HashMapEntry_... * entry; (entry = nc_hash_map_..._next_entry(&map, &cursor)) != NULL;)
+             use(entry->key, entry->value);
+        @endcode
+
+        @param cursor iteration state, must be 0 before the first call
+
+        @return pointer to the entry or @p NULL if there are no more entries
+    */                                                                                                                  \
+    inline NC_HASH_MAP_ENTRY(key_type, value_type)* NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, next_entry)(     \
+        const NC_HASH_MAP(key_type, value_type)* self,                                                                  \
+        size_t* cursor                                                                                                  \
+    ) {                                                                                                                 \
+        for (size_t i = *cursor; i < self->p.capacity; ++i) {                                                           \
+            if (self->p.ctrl[i] != NC_INTERNAL_HASH_MAP_EMPTY) {                                                        \
+                *cursor = i + 1;                                                                                        \
+                return &self->p.entries[i];                                                                             \
+            }                                                                                                           \
+        }                                                                                                               \
+                                                                                                                        \
+        *cursor = self->p.capacity;                                                                                     \
+                                                                                                                        \
+        return NULL;                                                                                                    \
+    }
+
+/**
+ * @brief Macro that emits external definitions of the functions generated by @ref NC_DEFINE_HASH_MAP()
+ *
+ * Must be used in exactly one translation unit, after @ref NC_DEFINE_HASH_MAP() with the same arguments.
+*/
+#define NC_INSTANTIATE_HASH_MAP(key_type, value_type, map_snake_case)                                                   \
+    extern inline NC_HASH_MAP(key_type, value_type) NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, init_in)(        \
+        NC_Allocator* allocator                                                                                         \
+    );                                                                                                                  \
+    extern inline NC_HASH_MAP(key_type, value_type) NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, init)();         \
+    extern inline size_t NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, p_allocation_size)(size_t capacity);        \
+    extern inline void NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, destroy)(                                     \
+        NC_HASH_MAP(key_type, value_type)* self                                                                         \
+    );                                                                                                                  \
+    extern inline size_t NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, size)(                                      \
+        const NC_HASH_MAP(key_type, value_type)* self                                                                   \
+    );                                                                                                                  \
+    extern inline size_t NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, capacity)(                                  \
+        const NC_HASH_MAP(key_type, value_type)* self                                                                   \
+    );                                                                                                                  \
+    extern inline bool NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, is_empty)(                                    \
+        const NC_HASH_MAP(key_type, value_type)* self                                                                   \
+    );                                                                                                                  \
+    extern inline size_t NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, p_home)(                                    \
+        const NC_HASH_MAP(key_type, value_type)* self,                                                                  \
+        uint64_t hash                                                                                                   \
+    );                                                                                                                  \
+    extern inline size_t NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, p_probe)(                                   \
+        const NC_HASH_MAP(key_type, value_type)* self,                                                                  \
+        const key_type* key,                                                                                            \
+        uint64_t hash,                                                                                                  \
+        bool* out_found                                                                                                 \
+    );                                                                                                                  \
+    extern inline size_t NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, p_find_empty)(                              \
+        const NC_HASH_MAP(key_type, value_type)* self,                                                                  \
+        uint64_t hash                                                                                                   \
+    );                                                                                                                  \
+    extern inline value_type* NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, get)(                                  \
+        const NC_HASH_MAP(key_type, value_type)* self,                                                                  \
+        const key_type* key                                                                                             \
+    );                                                                                                                  \
+    extern inline bool NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, contains)(                                    \
+        const NC_HASH_MAP(key_type, value_type)* self,                                                                  \
+        const key_type* key                                                                                             \
+    );                                                                                                                  \
+    extern inline bool NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, p_rehash)(                                    \
+        NC_HASH_MAP(key_type, value_type)* self,                                                                        \
+        size_t new_capacity                                                                                             \
+    );                                                                                                                  \
+    extern inline bool NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, reserve)(                                     \
+        NC_HASH_MAP(key_type, value_type)* self,                                                                        \
+        size_t count                                                                                                    \
+    );                                                                                                                  \
+    extern inline bool NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, insert)(                                      \
+        NC_HASH_MAP(key_type, value_type)* self,                                                                        \
+        key_type key,                                                                                                   \
+        value_type value                                                                                                \
+    );                                                                                                                  \
+    extern inline bool NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, remove)(                                      \
+        NC_HASH_MAP(key_type, value_type)* self,                                                                        \
+        const key_type* key,                                                                                            \
+        key_type* out_key,                                                                                              \
+        value_type* out_value                                                                                           \
+    );                                                                                                                  \
+    extern inline void NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, clear)(                                       \
+        NC_HASH_MAP(key_type, value_type)* self                                                                         \
+    );                                                                                                                  \
+    extern inline NC_HASH_MAP_ENTRY(key_type, value_type)* NC_INTERNAL_HASH_MAP_FUNCTION_NAME(map_snake_case, next_entry)( \
+        const NC_HASH_MAP(key_type, value_type)* self,                                                                  \
+        size_t* cursor                                                                                                  \
+    );
+
+/**
+ *  @}
+*/
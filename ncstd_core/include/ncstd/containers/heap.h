@@ -0,0 +1,913 @@
+#pragma once
+
+/**
+ * @file
+*/
+
+#include <stdalign.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ncstd/alloc_stats.h"
+#include "ncstd/allocator.h"
+#include "ncstd/containers/unsafe/raw_buffer.h"
+#include "ncstd/containers/vec.h"
+
+
+/** \addtogroup heap
+ *  @brief Type-specialized d-ary heaps
+ *  @{
+*/
+
+/**
+ * @brief Number of children of every node of heaps defined with @ref NC_DEFINE_HEAP()
+ * and @ref NC_DEFINE_INDEXED_HEAP()
+ *
+ * Four children per node halve the tree height compared to a binary heap, and siblings
+ * that are compared during sift down usually share a cache line.
+*/
+#define NC_HEAP_DEFAULT_ARITY 4
+
+/**
+ * @brief Value of a position, that marks ids absent from an indexed heap
+*/
+#define NC_INDEXED_HEAP_ABSENT SIZE_MAX
+
+/**
+ * @brief Macro that defines name of a heap type
+ *
+ * Heaps are named after @p heap_snake_case rather than the element type,
+ * so that the same type can have heaps with different orderings.
+ *
+ * ## Example
+ * @code
+ *  NC_HEAP(job)
+ * @endcode
+ * expands to
+ * @code
+ *  NC_Heap_job
+ * @endcode
+ *
+ * @param heap_snake_case name passed to @ref NC_DEFINE_HEAP()
+*/
+#define NC_HEAP(heap_snake_case) NC_Heap_##heap_snake_case
+/**
+ * @brief Macro that defines name of an indexed heap type
+ *
+ * @param heap_snake_case name passed to @ref NC_DEFINE_INDEXED_HEAP()
+*/
+#define NC_INDEXED_HEAP(heap_snake_case) NC_IndexedHeap_##heap_snake_case
+/**
+ * @brief Macro that defines name of an indexed heap entry type, that holds @p id and @p value members
+ *
+ * @param heap_snake_case name passed to @ref NC_DEFINE_INDEXED_HEAP()
+*/
+#define NC_INDEXED_HEAP_ENTRY(heap_snake_case) NC_IndexedHeapEntry_##heap_snake_case
+
+#define NC_INTERNAL_HEAP_FUNCTION_NAME(heap_snake_case, function_name) nc_heap_##heap_snake_case##_##function_name
+#define NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, function_name)                                          \
+    nc_indexed_heap_##heap_snake_case##_##function_name
+
+#define NC_INTERNAL_HEAP_ALIGNMENT(type) (alignof(type) > NC_DEFAULT_ALIGNMENT ? alignof(type) : NC_DEFAULT_ALIGNMENT)
+
+/**
+ * @brief Macro that defines a 4-ary min-heap of @p type
+ *
+ * Same as @ref NC_DEFINE_HEAP_WITH_ARITY() with @ref NC_HEAP_DEFAULT_ARITY.
+ *
+ * ## Example
+ * @code
+ *  #define job_less(a, b) ((a)->deadline < (b)->deadline)
+ *  NC_DEFINE_HEAP(Job, job, job_less)
+ *
+ *  NC_HEAP(job) jobs = nc_heap_job_init();
+ *  nc_heap_job_push(&jobs, job);
+ *  ...
+ *  Job next;
+ *  while (nc_heap_job_pop(&jobs, &next))
+ *      run(&next);
+ *  nc_heap_job_destroy(&jobs);
+ * @endcode
+ *
+ * Since all generated functions are @p inline, exactly one translation unit
+ * must also contain @ref NC_INSTANTIATE_HEAP() with the same arguments.
+*/
+#define NC_DEFINE_HEAP(type, heap_snake_case, less_fn)                                                                  \
+    NC_DEFINE_HEAP_WITH_ARITY(type, heap_snake_case, less_fn, NC_HEAP_DEFAULT_ARITY)
+
+/**
+ * @brief Macro that defines a d-ary min-heap of @p type, ordered by @p less_fn
+ *
+ * Elements are stored in a @ref NC_RawBuffer in level order, children of the element at index @p i
+ * are at indices from @p i * @p arity + 1 to @p i * @p arity + @p arity.
+ * All element accesses and comparisons are inline, only reallocation goes through the raw buffer.
+ * For a max-heap, pass a comparison that returns whether @p a is greater than @p b.
+ *
+ * Functions that allocate return @p false if allocation has failed (and out of memory handler has returned),
+ * in which case the heap is left unchanged.
+ *
+ * @param type type of the heap elements
+ * @param heap_snake_case name used in the type name and generated function names
+ * (@p nc_heap_<heap_snake_case>_push, etc.)
+ * @param less_fn function or macro with signature `bool (const type* a, const type* b)`,
+ * that returns whether @p a must be closer to the top than @p b
+ * @param arity number of children of every node, at least 2
+ *
+ * @note Since generated functions are @p inline with external linkage, @p less_fn must not be @p static.
+*/
+#define NC_DEFINE_HEAP_WITH_ARITY(type, heap_snake_case, less_fn, arity)                                                \
+    /**
+        @brief D-ary min-heap
+    */                                                                                                                  \
+    typedef struct {                                                                                                    \
+        /**
+            @protected
+
+            @brief Members are not stable, and are displayed for educational purposes only
+        */                                                                                                              \
+        struct {                                                                                                        \
+            /** @protected Buffer holding the elements in level order */                                                \
+            NC_RawBuffer raw_buffer;                                                                                    \
+            /** @protected Number of elements */                                                                        \
+            size_t size;                                                                                                \
+        } p;                                                                                                            \
+    } NC_HEAP(heap_snake_case);                                                                                         \
+                                                                                                                        \
+    inline void NC_INTERNAL_HEAP_FUNCTION_NAME(heap_snake_case, p_sift_up)(type* data, size_t index) {                  \
+        const type value = data[index];                                                                                 \
+        while (index > 0) {                                                                                             \
+            const size_t parent = (index - 1) / (arity);                                                                \
+            if (!less_fn(&value, &data[parent]))                                                                        \
+                break;                                                                                                  \
+                                                                                                                        \
+            data[index] = data[parent];                                                                                 \
+            index = parent;                                                                                             \
+        }                                                                                                               \
+        data[index] = value;                                                                                            \
+    }                                                                                                                   \
+                                                                                                                        \
+    inline void NC_INTERNAL_HEAP_FUNCTION_NAME(heap_snake_case, p_sift_down)(type* data, size_t size, size_t index) {   \
+        const type value = data[index];                                                                                 \
+        for (;;) {                                                                                                      \
+            const size_t first_child = index * (arity) + 1;                                                             \
+            if (first_child >= size)                                                                                    \
+                break;                                                                                                  \
+                                                                                                                        \
+            const size_t end_child = size - first_child < (arity) ? size : first_child + (arity);                       \
+            size_t best_child = first_child;                                                                            \
+            for (size_t child = first_child + 1; child < end_child; ++child) {                                          \
+                if (less_fn(&data[child], &data[best_child]))                                                           \
+                    best_child = child;                                                                                 \
+            }                                                                                                           \
+                                                                                                                        \
+            if (!less_fn(&data[best_child], &value))                                                                    \
+                break;                                                                                                  \
+                                                                                                                        \
+            data[index] = data[best_child];                                                                             \
+            index = best_child;                                                                                         \
+        }                                                                                                               \
+        data[index] = value;                                                                                            \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_Heap_##heap_snake_case
+
+        @brief Initializes an empty heap that will use @p allocator (performs no dynamic allocations)
+
+        @param allocator allocator, must outlive the heap
+
+        @return created heap
+    */                                                                                                                  \
+    inline NC_HEAP(heap_snake_case) NC_INTERNAL_HEAP_FUNCTION_NAME(heap_snake_case, init_in)(NC_Allocator* allocator) { \
+        return (NC_HEAP(heap_snake_case)) {                                                                             \
+            .p = {                                                                                                      \
+                .raw_buffer = nc_raw_buffer_init_aligned_in(sizeof(type), NC_INTERNAL_HEAP_ALIGNMENT(type), allocator), \
+                .size = 0                                                                                               \
+            }                                                                                                           \
+        };                                                                                                              \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_Heap_##heap_snake_case
+
+        @brief Initializes an empty heap (performs no dynamic allocations)
+
+        @return created heap
+    */                                                                                                                  \
+    inline NC_HEAP(heap_snake_case) NC_INTERNAL_HEAP_FUNCTION_NAME(heap_snake_case, init)() {                           \
+        return NC_INTERNAL_HEAP_FUNCTION_NAME(heap_snake_case, init_in)(nc_allocator_default());                        \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_Heap_##heap_snake_case
+
+        @brief Creates a heap that takes ownership of the first @p size elements of @p raw_buffer,
+        and rearranges them into heap order in O(n)
+
+        @param raw_buffer buffer of elements of @p type, that must not be used afterwards
+        @param size number of elements in @p raw_buffer
+
+        @return created heap
+    */                                                                                                                  \
+    inline NC_HEAP(heap_snake_case) NC_INTERNAL_HEAP_FUNCTION_NAME(heap_snake_case, from_raw_buffer)(                   \
+        NC_RawBuffer raw_buffer,                                                                                        \
+        size_t size                                                                                                     \
+    ) {                                                                                                                 \
+        NC_HEAP(heap_snake_case) self = { .p = { .raw_buffer = raw_buffer, .size = size } };                            \
+                                                                                                                        \
+        type* const data = (type*)self.p.raw_buffer.p.data;                                                             \
+        if (size > 1) {                                                                                                 \
+            /* Sift down every node that has children, starting from the last one */                                    \
+            for (size_t i = (size - 2) / (arity) + 1; i-- > 0;)                                                         \
+                NC_INTERNAL_HEAP_FUNCTION_NAME(heap_snake_case, p_sift_down)(data, size, i);                            \
+        }                                                                                                               \
+                                                                                                                        \
+        return self;                                                                                                    \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_Heap_##heap_snake_case
+
+        @brief Deallocates the heap memory, elements are not destroyed
+    */                                                                                                                  \
+    inline void NC_INTERNAL_HEAP_FUNCTION_NAME(heap_snake_case, destroy)(NC_HEAP(heap_snake_case)* self) {              \
+        nc_raw_buffer_free(&self->p.raw_buffer, sizeof(type));                                                          \
+        self->p.size = 0;                                                                                               \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_Heap_##heap_snake_case
+
+        @brief Returns number of elements in the heap
+    */                                                                                                                  \
+    inline size_t NC_INTERNAL_HEAP_FUNCTION_NAME(heap_snake_case, size)(const NC_HEAP(heap_snake_case)* self) {         \
+        return self->p.size;                                                                                            \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_Heap_##heap_snake_case
+
+        @brief Returns number of elements the heap can hold without reallocation
+    */                                                                                                                  \
+    inline size_t NC_INTERNAL_HEAP_FUNCTION_NAME(heap_snake_case, capacity)(const NC_HEAP(heap_snake_case)* self) {     \
+        return self->p.raw_buffer.p.capacity;                                                                           \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_Heap_##heap_snake_case
+
+        @brief Returns whether the heap contains no elements
+    */                                                                                                                  \
+    inline bool NC_INTERNAL_HEAP_FUNCTION_NAME(heap_snake_case, is_empty)(const NC_HEAP(heap_snake_case)* self) {       \
+        return self->p.size == 0;                                                                                       \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_Heap_##heap_snake_case
+
+        @brief Returns pointer to the elements in level order, valid until the next modification
+    */                                                                                                                  \
+    inline const type* NC_INTERNAL_HEAP_FUNCTION_NAME(heap_snake_case, data)(const NC_HEAP(heap_snake_case)* self) {    \
+        return (const type*)self->p.raw_buffer.p.data;                                                                  \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_Heap_##heap_snake_case
+
+        @brief Returns pointer to the top element or @p NULL if the heap is empty
+    */                                                                                                                  \
+    inline const type* NC_INTERNAL_HEAP_FUNCTION_NAME(heap_snake_case, peek)(const NC_HEAP(heap_snake_case)* self) {    \
+        if (self->p.size == 0)                                                                                          \
+            return NULL;                                                                                                \
+                                                                                                                        \
+        return NC_INTERNAL_HEAP_FUNCTION_NAME(heap_snake_case, data)(self);                                             \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_Heap_##heap_snake_case
+
+        @brief Reserves capacity for at least @p new_capacity elements
+
+        @return @p true on success, @p false if allocation has failed
+    */                                                                                                                  \
+    inline bool NC_INTERNAL_HEAP_FUNCTION_NAME(heap_snake_case, reserve)(NC_HEAP(heap_snake_case)* self, size_t new_capacity) { \
+        const size_t capacity = self->p.raw_buffer.p.capacity;                                                          \
+        if (new_capacity <= capacity)                                                                                   \
+            return true;                                                                                                \
+                                                                                                                        \
+        NC_INTERNAL_ALLOC_STATS_SITE_ENTER();                                                                           \
+        nc_raw_buffer_resize_unchecked(&self->p.raw_buffer, nc_vec_growth_double(capacity, new_capacity), sizeof(type)); \
+        NC_INTERNAL_ALLOC_STATS_SITE_LEAVE();                                                                           \
+                                                                                                                        \
+        return self->p.raw_buffer.p.capacity >= new_capacity;                                                           \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_Heap_##heap_snake_case
+
+        @brief Adds @p value to the heap in O(log n)
+
+        @return @p true on success, @p false if allocation has failed
+    */                                                                                                                  \
+    inline bool NC_INTERNAL_HEAP_FUNCTION_NAME(heap_snake_case, push)(NC_HEAP(heap_snake_case)* self, type value) {     \
+        if (self->p.size == self->p.raw_buffer.p.capacity                                                               \
+            && !NC_INTERNAL_HEAP_FUNCTION_NAME(heap_snake_case, reserve)(self, self->p.size + 1))                       \
+            return false;                                                                                               \
+                                                                                                                        \
+        type* const data = (type*)self->p.raw_buffer.p.data;                                                            \
+        data[self->p.size] = value;                                                                                     \
+        NC_INTERNAL_HEAP_FUNCTION_NAME(heap_snake_case, p_sift_up)(data, self->p.size);                                 \
+        self->p.size += 1;                                                                                              \
+                                                                                                                        \
+        return true;                                                                                                    \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_Heap_##heap_snake_case
+
+        @brief Removes the top element in O(log n), and writes it to @p out_value unless it's @p NULL
+
+        @return @p true if element was removed, @p false if the heap is empty
+    */                                                                                                                  \
+    inline bool NC_INTERNAL_HEAP_FUNCTION_NAME(heap_snake_case, pop)(NC_HEAP(heap_snake_case)* self, type* out_value) { \
+        if (self->p.size == 0)                                                                                          \
+            return false;                                                                                               \
+                                                                                                                        \
+        type* const data = (type*)self->p.raw_buffer.p.data;                                                            \
+        if (out_value != NULL)                                                                                          \
+            *out_value = data[0];                                                                                       \
+                                                                                                                        \
+        self->p.size -= 1;                                                                                              \
+        if (self->p.size > 0) {                                                                                         \
+            data[0] = data[self->p.size];                                                                               \
+            NC_INTERNAL_HEAP_FUNCTION_NAME(heap_snake_case, p_sift_down)(data, self->p.size, 0);                        \
+        }                                                                                                               \
+                                                                                                                        \
+        return true;                                                                                                    \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_Heap_##heap_snake_case
+
+        @brief Replaces the top element with @p value, writing the old one to @p out_value unless it's @p NULL
+
+        Cheaper than @p pop followed by @p push, e.g. for keeping the k largest elements
+        in a min-heap of size k.
+
+        @return @p true if element was replaced, @p false if the heap is empty
+    */                                                                                                                  \
+    inline bool NC_INTERNAL_HEAP_FUNCTION_NAME(heap_snake_case, replace_top)(                                           \
+        NC_HEAP(heap_snake_case)* self,                                                                                 \
+        type value,                                                                                                     \
+        type* out_value                                                                                                 \
+    ) {                                                                                                                 \
+        if (self->p.size == 0)                                                                                          \
+            return false;                                                                                               \
+                                                                                                                        \
+        type* const data = (type*)self->p.raw_buffer.p.data;                                                            \
+        if (out_value != NULL)                                                                                          \
+            *out_value = data[0];                                                                                       \
+                                                                                                                        \
+        data[0] = value;                                                                                                \
+        NC_INTERNAL_HEAP_FUNCTION_NAME(heap_snake_case, p_sift_down)(data, self->p.size, 0);                            \
+                                                                                                                        \
+        return true;                                                                                                    \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_Heap_##heap_snake_case
+
+        @brief Removes all elements, keeping the capacity
+    */                                                                                                                  \
+    inline void NC_INTERNAL_HEAP_FUNCTION_NAME(heap_snake_case, clear)(NC_HEAP(heap_snake_case)* self) {                \
+        self->p.size = 0;                                                                                               \
+    }
+
+/**
+ * @brief Macro that emits external definitions of the functions generated by @ref NC_DEFINE_HEAP()
+ *
+ * Must be used in exactly one translation unit, after @ref NC_DEFINE_HEAP() with the same arguments.
+*/
+#define NC_INSTANTIATE_HEAP(type, heap_snake_case)                                                                      \
+    extern inline void NC_INTERNAL_HEAP_FUNCTION_NAME(heap_snake_case, p_sift_up)(type* data, size_t index);            \
+    extern inline void NC_INTERNAL_HEAP_FUNCTION_NAME(heap_snake_case, p_sift_down)(type* data, size_t size, size_t index); \
+    extern inline NC_HEAP(heap_snake_case) NC_INTERNAL_HEAP_FUNCTION_NAME(heap_snake_case, init_in)(NC_Allocator* allocator); \
+    extern inline NC_HEAP(heap_snake_case) NC_INTERNAL_HEAP_FUNCTION_NAME(heap_snake_case, init)();                     \
+    extern inline NC_HEAP(heap_snake_case) NC_INTERNAL_HEAP_FUNCTION_NAME(heap_snake_case, from_raw_buffer)(            \
+        NC_RawBuffer raw_buffer,                                                                                        \
+        size_t size                                                                                                     \
+    );                                                                                                                  \
+    extern inline void NC_INTERNAL_HEAP_FUNCTION_NAME(heap_snake_case, destroy)(NC_HEAP(heap_snake_case)* self);        \
+    extern inline size_t NC_INTERNAL_HEAP_FUNCTION_NAME(heap_snake_case, size)(const NC_HEAP(heap_snake_case)* self);   \
+    extern inline size_t NC_INTERNAL_HEAP_FUNCTION_NAME(heap_snake_case, capacity)(const NC_HEAP(heap_snake_case)* self); \
+    extern inline bool NC_INTERNAL_HEAP_FUNCTION_NAME(heap_snake_case, is_empty)(const NC_HEAP(heap_snake_case)* self); \
+    extern inline const type* NC_INTERNAL_HEAP_FUNCTION_NAME(heap_snake_case, data)(const NC_HEAP(heap_snake_case)* self); \
+    extern inline const type* NC_INTERNAL_HEAP_FUNCTION_NAME(heap_snake_case, peek)(const NC_HEAP(heap_snake_case)* self); \
+    extern inline bool NC_INTERNAL_HEAP_FUNCTION_NAME(heap_snake_case, reserve)(NC_HEAP(heap_snake_case)* self, size_t new_capacity); \
+    extern inline bool NC_INTERNAL_HEAP_FUNCTION_NAME(heap_snake_case, push)(NC_HEAP(heap_snake_case)* self, type value); \
+    extern inline bool NC_INTERNAL_HEAP_FUNCTION_NAME(heap_snake_case, pop)(NC_HEAP(heap_snake_case)* self, type* out_value); \
+    extern inline bool NC_INTERNAL_HEAP_FUNCTION_NAME(heap_snake_case, replace_top)(                                    \
+        NC_HEAP(heap_snake_case)* self,                                                                                 \
+        type value,                                                                                                     \
+        type* out_value                                                                                                 \
+    );                                                                                                                  \
+    extern inline void NC_INTERNAL_HEAP_FUNCTION_NAME(heap_snake_case, clear)(NC_HEAP(heap_snake_case)* self);
+
+/**
+ * @brief Macro that defines a 4-ary indexed min-heap of @p type
+ *
+ * Same as @ref NC_DEFINE_INDEXED_HEAP_WITH_ARITY() with @ref NC_HEAP_DEFAULT_ARITY.
+ *
+ * ## Example
+ * @code
+ *  #define distance_less(a, b) (*(a) < *(b))
+ *  NC_DEFINE_INDEXED_HEAP(uint64_t, distance, distance_less)
+ *
+ *  NC_INDEXED_HEAP(distance) queue = nc_indexed_heap_distance_init();
+ *  nc_indexed_heap_distance_push(&queue, source, 0);
+ *
+ *  NC_INDEXED_HEAP_ENTRY(distance) entry;
+ *  while (nc_indexed_heap_distance_pop(&queue, &entry)) {
+ *      for (...) {
+ *          if (!nc_indexed_heap_distance_contains(&queue, neighbour))
+ *              nc_indexed_heap_distance_push(&queue, neighbour, entry.value + weight);
+ *          else if (entry.value + weight < *nc_indexed_heap_distance_get(&queue, neighbour))
+ *              nc_indexed_heap_distance_decrease_key(&queue, neighbour, entry.value + weight);
+ *      }
+ *  }
+ *  nc_indexed_heap_distance_destroy(&queue);
+ * @endcode
+ *
+ * Since all generated functions are @p inline, exactly one translation unit
+ * must also contain @ref NC_INSTANTIATE_INDEXED_HEAP() with the same arguments.
+*/
+#define NC_DEFINE_INDEXED_HEAP(type, heap_snake_case, less_fn)                                                          \
+    NC_DEFINE_INDEXED_HEAP_WITH_ARITY(type, heap_snake_case, less_fn, NC_HEAP_DEFAULT_ARITY)
+
+/**
+ * @brief Macro that defines a d-ary min-heap of @p type, whose elements are addressed by integer ids
+ *
+ * Every element is pushed with an id, that can later be used to look up, change or remove the element
+ * in O(log n) (e.g. decrease-key in Dijkstra's algorithm or rescheduling in timer queues).
+ * Ids are indices into a position table, that grows to the largest pushed id, so they should be dense
+ * (e.g. node or slot indices).
+ *
+ * Functions that allocate return @p false if allocation has failed (and out of memory handler has returned),
+ * in which case the heap is left unchanged.
+ *
+ * @param type type of the heap elements
+ * @param heap_snake_case name used in the type name and generated function names
+ * (@p nc_indexed_heap_<heap_snake_case>_push, etc.)
+ * @param less_fn function or macro with signature `bool (const type* a, const type* b)`,
+ * that returns whether @p a must be closer to the top than @p b
+ * @param arity number of children of every node, at least 2
+ *
+ * @note Since generated functions are @p inline with external linkage, @p less_fn must not be @p static.
+*/
+#define NC_DEFINE_INDEXED_HEAP_WITH_ARITY(type, heap_snake_case, less_fn, arity)                                        \
+    /**
+        @brief Indexed heap entry
+    */                                                                                                                  \
+    typedef struct {                                                                                                    \
+        /** Id of the element */                                                                                        \
+        size_t id;                                                                                                      \
+        /** Value */                                                                                                    \
+        type value;                                                                                                     \
+    } NC_INDEXED_HEAP_ENTRY(heap_snake_case);                                                                           \
+                                                                                                                        \
+    /**
+        @brief D-ary min-heap with elements addressed by ids
+    */                                                                                                                  \
+    typedef struct {                                                                                                    \
+        /**
+            @protected
+
+            @brief Members are not stable, and are displayed for educational purposes only
+        */                                                                                                              \
+        struct {                                                                                                        \
+            /** @protected Buffer holding the entries in level order */                                                 \
+            NC_RawBuffer entries;                                                                                       \
+            /** @protected Position of every id in the entries, or @ref NC_INDEXED_HEAP_ABSENT */                       \
+            NC_RawBuffer positions;                                                                                     \
+            /** @protected Number of entries */                                                                         \
+            size_t size;                                                                                                \
+        } p;                                                                                                            \
+    } NC_INDEXED_HEAP(heap_snake_case);                                                                                 \
+                                                                                                                        \
+    inline NC_INDEXED_HEAP_ENTRY(heap_snake_case)* NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, p_entries)(  \
+        const NC_INDEXED_HEAP(heap_snake_case)* self                                                                    \
+    ) {                                                                                                                 \
+        return (NC_INDEXED_HEAP_ENTRY(heap_snake_case)*)self->p.entries.p.data;                                         \
+    }                                                                                                                   \
+                                                                                                                        \
+    inline size_t* NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, p_positions)(                                \
+        const NC_INDEXED_HEAP(heap_snake_case)* self                                                                    \
+    ) {                                                                                                                 \
+        return (size_t*)self->p.positions.p.data;                                                                       \
+    }                                                                                                                   \
+                                                                                                                        \
+    inline void NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, p_sift_up)(                                     \
+        NC_INDEXED_HEAP(heap_snake_case)* self,                                                                         \
+        size_t index                                                                                                    \
+    ) {                                                                                                                 \
+        NC_INDEXED_HEAP_ENTRY(heap_snake_case)* const entries = NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, p_entries)(self); \
+        size_t* const positions = NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, p_positions)(self);           \
+                                                                                                                        \
+        const NC_INDEXED_HEAP_ENTRY(heap_snake_case) entry = entries[index];                                            \
+        while (index > 0) {                                                                                             \
+            const size_t parent = (index - 1) / (arity);                                                                \
+            if (!less_fn(&entry.value, &entries[parent].value))                                                         \
+                break;                                                                                                  \
+                                                                                                                        \
+            entries[index] = entries[parent];                                                                           \
+            positions[entries[index].id] = index;                                                                       \
+            index = parent;                                                                                             \
+        }                                                                                                               \
+        entries[index] = entry;                                                                                         \
+        positions[entry.id] = index;                                                                                    \
+    }                                                                                                                   \
+                                                                                                                        \
+    inline void NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, p_sift_down)(                                   \
+        NC_INDEXED_HEAP(heap_snake_case)* self,                                                                         \
+        size_t index                                                                                                    \
+    ) {                                                                                                                 \
+        NC_INDEXED_HEAP_ENTRY(heap_snake_case)* const entries = NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, p_entries)(self); \
+        size_t* const positions = NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, p_positions)(self);           \
+        const size_t size = self->p.size;                                                                               \
+                                                                                                                        \
+        const NC_INDEXED_HEAP_ENTRY(heap_snake_case) entry = entries[index];                                            \
+        for (;;) {                                                                                                      \
+            const size_t first_child = index * (arity) + 1;                                                             \
+            if (first_child >= size)                                                                                    \
+                break;                                                                                                  \
+                                                                                                                        \
+            const size_t end_child = size - first_child < (arity) ? size : first_child + (arity);                       \
+            size_t best_child = first_child;                                                                            \
+            for (size_t child = first_child + 1; child < end_child; ++child) {                                          \
+                if (less_fn(&entries[child].value, &entries[best_child].value))                                         \
+                    best_child = child;                                                                                 \
+            }                                                                                                           \
+                                                                                                                        \
+            if (!less_fn(&entries[best_child].value, &entry.value))                                                     \
+                break;                                                                                                  \
+                                                                                                                        \
+            entries[index] = entries[best_child];                                                                       \
+            positions[entries[index].id] = index;                                                                       \
+            index = best_child;                                                                                         \
+        }                                                                                                               \
+        entries[index] = entry;                                                                                         \
+        positions[entry.id] = index;                                                                                    \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_IndexedHeap_##heap_snake_case
+
+        @brief Initializes an empty indexed heap that will use @p allocator (performs no dynamic allocations)
+
+        @param allocator allocator, must outlive the heap
+
+        @return created heap
+    */                                                                                                                  \
+    inline NC_INDEXED_HEAP(heap_snake_case) NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, init_in)(           \
+        NC_Allocator* allocator                                                                                         \
+    ) {                                                                                                                 \
+        return (NC_INDEXED_HEAP(heap_snake_case)) {                                                                     \
+            .p = {                                                                                                      \
+                .entries = nc_raw_buffer_init_aligned_in(                                                               \
+                    sizeof(NC_INDEXED_HEAP_ENTRY(heap_snake_case)),                                                     \
+                    NC_INTERNAL_HEAP_ALIGNMENT(NC_INDEXED_HEAP_ENTRY(heap_snake_case)),                                 \
+                    allocator                                                                                           \
+                ),                                                                                                      \
+                .positions = nc_raw_buffer_init_in(sizeof(size_t), allocator),                                          \
+                .size = 0                                                                                               \
+            }                                                                                                           \
+        };                                                                                                              \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_IndexedHeap_##heap_snake_case
+
+        @brief Initializes an empty indexed heap (performs no dynamic allocations)
+
+        @return created heap
+    */                                                                                                                  \
+    inline NC_INDEXED_HEAP(heap_snake_case) NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, init)() {           \
+        return NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, init_in)(nc_allocator_default());                \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_IndexedHeap_##heap_snake_case
+
+        @brief Deallocates the heap memory, elements are not destroyed
+    */                                                                                                                  \
+    inline void NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, destroy)(NC_INDEXED_HEAP(heap_snake_case)* self) { \
+        nc_raw_buffer_free(&self->p.entries, sizeof(NC_INDEXED_HEAP_ENTRY(heap_snake_case)));                           \
+        nc_raw_buffer_free(&self->p.positions, sizeof(size_t));                                                         \
+        self->p.size = 0;                                                                                               \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_IndexedHeap_##heap_snake_case
+
+        @brief Returns number of elements in the heap
+    */                                                                                                                  \
+    inline size_t NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, size)(const NC_INDEXED_HEAP(heap_snake_case)* self) { \
+        return self->p.size;                                                                                            \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_IndexedHeap_##heap_snake_case
+
+        @brief Returns whether the heap contains no elements
+    */                                                                                                                  \
+    inline bool NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, is_empty)(const NC_INDEXED_HEAP(heap_snake_case)* self) { \
+        return self->p.size == 0;                                                                                       \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_IndexedHeap_##heap_snake_case
+
+        @brief Returns whether the heap contains an element with @p id
+    */                                                                                                                  \
+    inline bool NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, contains)(                                      \
+        const NC_INDEXED_HEAP(heap_snake_case)* self,                                                                   \
+        size_t id                                                                                                       \
+    ) {                                                                                                                 \
+        return id < self->p.positions.p.capacity                                                                        \
+            && NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, p_positions)(self)[id] != NC_INDEXED_HEAP_ABSENT; \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_IndexedHeap_##heap_snake_case
+
+        @brief Returns pointer to the value of element with @p id, or @p NULL if there is none
+
+        Value must only be changed through @p decrease_key or @p update.
+    */                                                                                                                  \
+    inline const type* NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, get)(                                    \
+        const NC_INDEXED_HEAP(heap_snake_case)* self,                                                                   \
+        size_t id                                                                                                       \
+    ) {                                                                                                                 \
+        if (!NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, contains)(self, id))                               \
+            return NULL;                                                                                                \
+                                                                                                                        \
+        const size_t position = NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, p_positions)(self)[id];         \
+                                                                                                                        \
+        return &NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, p_entries)(self)[position].value;               \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_IndexedHeap_##heap_snake_case
+
+        @brief Returns pointer to the top entry or @p NULL if the heap is empty
+    */                                                                                                                  \
+    inline const NC_INDEXED_HEAP_ENTRY(heap_snake_case)* NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, peek)( \
+        const NC_INDEXED_HEAP(heap_snake_case)* self                                                                    \
+    ) {                                                                                                                 \
+        if (self->p.size == 0)                                                                                          \
+            return NULL;                                                                                                \
+                                                                                                                        \
+        return NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, p_entries)(self);                                \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_IndexedHeap_##heap_snake_case
+
+        @brief Adds @p value with @p id to the heap in O(log n)
+
+        @return @p true on success, @p false if the heap already contains @p id or allocation has failed
+    */                                                                                                                  \
+    inline bool NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, push)(                                          \
+        NC_INDEXED_HEAP(heap_snake_case)* self,                                                                         \
+        size_t id,                                                                                                      \
+        type value                                                                                                      \
+    ) {                                                                                                                 \
+        if (NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, contains)(self, id))                                \
+            return false;                                                                                               \
+                                                                                                                        \
+        const size_t position_count = self->p.positions.p.capacity;                                                     \
+        if (id >= position_count) {                                                                                     \
+            NC_INTERNAL_ALLOC_STATS_SITE_ENTER();                                                                       \
+            nc_raw_buffer_resize_unchecked(                                                                             \
+                &self->p.positions,                                                                                     \
+                nc_vec_growth_double(position_count, id + 1),                                                           \
+                sizeof(size_t)                                                                                          \
+            );                                                                                                          \
+            NC_INTERNAL_ALLOC_STATS_SITE_LEAVE();                                                                       \
+            if (self->p.positions.p.capacity <= id)                                                                     \
+                return false;                                                                                           \
+                                                                                                                        \
+            size_t* const positions = NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, p_positions)(self);       \
+            for (size_t i = position_count; i < self->p.positions.p.capacity; ++i)                                      \
+                positions[i] = NC_INDEXED_HEAP_ABSENT;                                                                  \
+        }                                                                                                               \
+                                                                                                                        \
+        const size_t capacity = self->p.entries.p.capacity;                                                             \
+        if (self->p.size == capacity) {                                                                                 \
+            NC_INTERNAL_ALLOC_STATS_SITE_ENTER();                                                                       \
+            nc_raw_buffer_resize_unchecked(                                                                             \
+                &self->p.entries,                                                                                       \
+                nc_vec_growth_double(capacity, capacity + 1),                                                           \
+                sizeof(NC_INDEXED_HEAP_ENTRY(heap_snake_case))                                                          \
+            );                                                                                                          \
+            NC_INTERNAL_ALLOC_STATS_SITE_LEAVE();                                                                       \
+            if (self->p.entries.p.capacity == capacity)                                                                 \
+                return false;                                                                                           \
+        }                                                                                                               \
+                                                                                                                        \
+        NC_INDEXED_HEAP_ENTRY(heap_snake_case)* const entries = NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, p_entries)(self); \
+        entries[self->p.size] = (NC_INDEXED_HEAP_ENTRY(heap_snake_case)) { .id = id, .value = value };                  \
+        self->p.size += 1;                                                                                              \
+        NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, p_sift_up)(self, self->p.size - 1);                     \
+                                                                                                                        \
+        return true;                                                                                                    \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_IndexedHeap_##heap_snake_case
+
+        @brief Removes element with @p id in O(log n), writing its value to @p out_value unless it's @p NULL
+
+        @return @p true if element was removed, @p false if the heap doesn't contain @p id
+    */                                                                                                                  \
+    inline bool NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, remove)(                                        \
+        NC_INDEXED_HEAP(heap_snake_case)* self,                                                                         \
+        size_t id,                                                                                                      \
+        type* out_value                                                                                                 \
+    ) {                                                                                                                 \
+        if (!NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, contains)(self, id))                               \
+            return false;                                                                                               \
+                                                                                                                        \
+        NC_INDEXED_HEAP_ENTRY(heap_snake_case)* const entries = NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, p_entries)(self); \
+        size_t* const positions = NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, p_positions)(self);           \
+                                                                                                                        \
+        const size_t position = positions[id];                                                                          \
+        if (out_value != NULL)                                                                                          \
+            *out_value = entries[position].value;                                                                       \
+                                                                                                                        \
+        positions[id] = NC_INDEXED_HEAP_ABSENT;                                                                         \
+        self->p.size -= 1;                                                                                              \
+        if (position == self->p.size)                                                                                   \
+            return true;                                                                                                \
+                                                                                                                        \
+        /* Last entry takes the freed position, and might need to move either way */                                    \
+        entries[position] = entries[self->p.size];                                                                      \
+        positions[entries[position].id] = position;                                                                     \
+        NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, p_sift_up)(self, position);                             \
+        NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, p_sift_down)(self, positions[entries[position].id]);    \
+                                                                                                                        \
+        return true;                                                                                                    \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_IndexedHeap_##heap_snake_case
+
+        @brief Removes the top entry in O(log n), and writes it to @p out_entry unless it's @p NULL
+
+        @return @p true if entry was removed, @p false if the heap is empty
+    */                                                                                                                  \
+    inline bool NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, pop)(                                           \
+        NC_INDEXED_HEAP(heap_snake_case)* self,                                                                         \
+        NC_INDEXED_HEAP_ENTRY(heap_snake_case)* out_entry                                                               \
+    ) {                                                                                                                 \
+        if (self->p.size == 0)                                                                                          \
+            return false;                                                                                               \
+                                                                                                                        \
+        const NC_INDEXED_HEAP_ENTRY(heap_snake_case) top = NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, p_entries)(self)[0]; \
+        if (out_entry != NULL)                                                                                          \
+            *out_entry = top;                                                                                           \
+                                                                                                                        \
+        return NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, remove)(self, top.id, NULL);                     \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_IndexedHeap_##heap_snake_case
+
+        @brief Replaces value of element with @p id by @p value, that is not greater than the current one,
+        moving the element towards the top in O(log n)
+
+        ## Safety
+        Calling this function with @p value greater than the current value breaks heap order
+
+        @return @p true if value was changed, @p false if the heap doesn't contain @p id
+    */                                                                                                                  \
+    inline bool NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, decrease_key)(                                  \
+        NC_INDEXED_HEAP(heap_snake_case)* self,                                                                         \
+        size_t id,                                                                                                      \
+        type value                                                                                                      \
+    ) {                                                                                                                 \
+        if (!NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, contains)(self, id))                               \
+            return false;                                                                                               \
+                                                                                                                        \
+        const size_t position = NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, p_positions)(self)[id];         \
+        NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, p_entries)(self)[position].value = value;               \
+        NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, p_sift_up)(self, position);                             \
+                                                                                                                        \
+        return true;                                                                                                    \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_IndexedHeap_##heap_snake_case
+
+        @brief Replaces value of element with @p id by @p value, moving the element in either direction in O(log n)
+
+        @return @p true if value was changed, @p false if the heap doesn't contain @p id
+    */                                                                                                                  \
+    inline bool NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, update)(                                        \
+        NC_INDEXED_HEAP(heap_snake_case)* self,                                                                         \
+        size_t id,                                                                                                      \
+        type value                                                                                                      \
+    ) {                                                                                                                 \
+        if (!NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, decrease_key)(self, id, value))                    \
+            return false;                                                                                               \
+                                                                                                                        \
+        const size_t position = NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, p_positions)(self)[id];         \
+        NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, p_sift_down)(self, position);                           \
+                                                                                                                        \
+        return true;                                                                                                    \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_IndexedHeap_##heap_snake_case
+
+        @brief Removes all elements, keeping the capacity
+    */                                                                                                                  \
+    inline void NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, clear)(NC_INDEXED_HEAP(heap_snake_case)* self) { \
+        NC_INDEXED_HEAP_ENTRY(heap_snake_case)* const entries = NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, p_entries)(self); \
+        size_t* const positions = NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, p_positions)(self);           \
+        for (size_t i = 0; i < self->p.size; ++i)                                                                       \
+            positions[entries[i].id] = NC_INDEXED_HEAP_ABSENT;                                                          \
+                                                                                                                        \
+        self->p.size = 0;                                                                                               \
+    }
+
+/**
+ * @brief Macro that emits external definitions of the functions generated by @ref NC_DEFINE_INDEXED_HEAP()
+ *
+ * Must be used in exactly one translation unit, after @ref NC_DEFINE_INDEXED_HEAP() with the same arguments.
+*/
+#define NC_INSTANTIATE_INDEXED_HEAP(type, heap_snake_case)                                                              \
+    extern inline NC_INDEXED_HEAP_ENTRY(heap_snake_case)* NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, p_entries)( \
+        const NC_INDEXED_HEAP(heap_snake_case)* self                                                                    \
+    );                                                                                                                  \
+    extern inline size_t* NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, p_positions)(                         \
+        const NC_INDEXED_HEAP(heap_snake_case)* self                                                                    \
+    );                                                                                                                  \
+    extern inline void NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, p_sift_up)(                              \
+        NC_INDEXED_HEAP(heap_snake_case)* self,                                                                         \
+        size_t index                                                                                                    \
+    );                                                                                                                  \
+    extern inline void NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, p_sift_down)(                            \
+        NC_INDEXED_HEAP(heap_snake_case)* self,                                                                         \
+        size_t index                                                                                                    \
+    );                                                                                                                  \
+    extern inline NC_INDEXED_HEAP(heap_snake_case) NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, init_in)(    \
+        NC_Allocator* allocator                                                                                         \
+    );                                                                                                                  \
+    extern inline NC_INDEXED_HEAP(heap_snake_case) NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, init)();     \
+    extern inline void NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, destroy)(NC_INDEXED_HEAP(heap_snake_case)* self); \
+    extern inline size_t NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, size)(const NC_INDEXED_HEAP(heap_snake_case)* self); \
+    extern inline bool NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, is_empty)(                               \
+        const NC_INDEXED_HEAP(heap_snake_case)* self                                                                    \
+    );                                                                                                                  \
+    extern inline bool NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, contains)(                               \
+        const NC_INDEXED_HEAP(heap_snake_case)* self,                                                                   \
+        size_t id                                                                                                       \
+    );                                                                                                                  \
+    extern inline const type* NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, get)(                             \
+        const NC_INDEXED_HEAP(heap_snake_case)* self,                                                                   \
+        size_t id                                                                                                       \
+    );                                                                                                                  \
+    extern inline const NC_INDEXED_HEAP_ENTRY(heap_snake_case)* NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, peek)( \
+        const NC_INDEXED_HEAP(heap_snake_case)* self                                                                    \
+    );                                                                                                                  \
+    extern inline bool NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, push)(                                   \
+        NC_INDEXED_HEAP(heap_snake_case)* self,                                                                         \
+        size_t id,                                                                                                      \
+        type value                                                                                                      \
+    );                                                                                                                  \
+    extern inline bool NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, remove)(                                 \
+        NC_INDEXED_HEAP(heap_snake_case)* self,                                                                         \
+        size_t id,                                                                                                      \
+        type* out_value                                                                                                 \
+    );                                                                                                                  \
+    extern inline bool NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, pop)(                                    \
+        NC_INDEXED_HEAP(heap_snake_case)* self,                                                                         \
+        NC_INDEXED_HEAP_ENTRY(heap_snake_case)* out_entry                                                               \
+    );                                                                                                                  \
+    extern inline bool NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, decrease_key)(                           \
+        NC_INDEXED_HEAP(heap_snake_case)* self,                                                                         \
+        size_t id,                                                                                                      \
+        type value                                                                                                      \
+    );                                                                                                                  \
+    extern inline bool NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, update)(                                 \
+        NC_INDEXED_HEAP(heap_snake_case)* self,                                                                         \
+        size_t id,                                                                                                      \
+        type value                                                                                                      \
+    );                                                                                                                  \
+    extern inline void NC_INTERNAL_INDEXED_HEAP_FUNCTION_NAME(heap_snake_case, clear)(NC_INDEXED_HEAP(heap_snake_case)* self);
+
+/**
+ *  @}
+*/
@@ -0,0 +1,172 @@
+#pragma once
+
+/**
+ * @file
+*/
+
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "ncstd/allocator.h"
+#include "ncstd/containers/unsafe/raw_buffer.h"
+
+
+/** \addtogroup mpmc_queue
+ *  @brief Bounded multi-producer/multi-consumer queue
+ *  @{
+*/
+
+/**
+ * @brief Bounded queue for passing objects of the same size between any number
+ * of producer and consumer threads
+ *
+ * Implements Dmitry Vyukov's bounded queue: every cell of the power-of-two ring buffer carries
+ * a sequence number, that tells producers and consumers whether the cell is ready for them in the
+ * current lap around the ring. A thread claims cells with a single compare-and-swap on the
+ * enqueue or dequeue position, then copies the objects without holding any lock.
+ * Enqueue and dequeue positions live on separate cache lines.
+ *
+ * Batched operations claim a run of consecutive ready cells at once, so a batch costs one
+ * compare-and-swap on the shared position instead of one per element.
+ *
+ * Queue is aligned to the cache line size, heap allocated queues need memory with that alignment.
+ * Initialization and destruction are not thread safe, the queue must not be moved while shared.
+ *
+ * ## Example
+ * @code
+ *  NC_MpmcQueue queue = nc_mpmc_queue_init(1024, sizeof(Task));
+ *
+ *  // Any producer thread
+ *  while (!nc_mpmc_queue_try_push(&queue, &task))
+ *      thrd_yield();
+ *
+ *  // Any consumer thread
+ *  Task task;
+ *  if (nc_mpmc_queue_try_pop(&queue, &task))
+ *      run_task(&task);
+ *  ...
+ *  nc_mpmc_queue_destroy(&queue);
+ * @endcode
+*/
+typedef struct {
+    /**
+     * @protected
+     *
+     * @brief Members are not stable, and are displayed for educational purposes only
+    */
+    struct {
+        /** @protected Ring buffer of cells, capacity is 0 or a power of two */
+        NC_RawBuffer raw_buffer;
+        /** @protected Size of a single element */
+        size_t object_size;
+        /** @protected Size of a single cell, that holds sequence number followed by the element */
+        size_t cell_size;
+
+        /** @protected Position of the next cell to be claimed by a producer, starts its own cache line */
+        alignas(NC_CACHE_LINE_SIZE) atomic_size_t enqueue_position;
+
+        /** @protected Position of the next cell to be claimed by a consumer, starts its own cache line */
+        alignas(NC_CACHE_LINE_SIZE) atomic_size_t dequeue_position;
+    } p;
+} NC_MpmcQueue;
+
+/**
+ * @memberof NC_MpmcQueue
+ *
+ * @brief Initializes empty queue that can hold at least @p capacity elements
+ *
+ * ## Safety
+ * Calling this function with @p capacity or @p object_size equal to 0, leads to undefined behaviour
+ *
+ * @param capacity maximum number of elements, rounded up to a power of two
+ * @param object_size size of a single element
+ *
+ * @return created queue, with capacity 0 if allocation has failed
+*/
+NC_MpmcQueue nc_mpmc_queue_init(size_t capacity, size_t object_size);
+/**
+ * @memberof NC_MpmcQueue
+ *
+ * @brief Same as @ref nc_mpmc_queue_init(), but uses @p allocator for all allocations
+ *
+ * @param capacity maximum number of elements, rounded up to a power of two
+ * @param object_size size of a single element
+ * @param allocator allocator, must outlive the queue
+ *
+ * @return created queue, with capacity 0 if allocation has failed
+*/
+NC_MpmcQueue nc_mpmc_queue_init_in(size_t capacity, size_t object_size, NC_Allocator* allocator);
+/**
+ * @memberof NC_MpmcQueue
+ *
+ * @brief Deallocates the queue memory, elements are not destroyed
+*/
+void nc_mpmc_queue_destroy(NC_MpmcQueue* self);
+
+/**
+ * @memberof NC_MpmcQueue
+ *
+ * @brief Returns maximum number of elements in the queue
+*/
+size_t nc_mpmc_queue_capacity(const NC_MpmcQueue* self);
+/**
+ * @memberof NC_MpmcQueue
+ *
+ * @brief Returns number of claimed, but not yet dequeued cells
+ *
+ * @note Exact only when no other thread accesses the queue,
+ * otherwise the value might be outdated by the time it's returned
+*/
+size_t nc_mpmc_queue_size(NC_MpmcQueue* self);
+
+/**
+ * @memberof NC_MpmcQueue
+ *
+ * @brief Copies @p object to the back of the queue
+ *
+ * @return @p true on success, @p false if the queue is full
+*/
+bool nc_mpmc_queue_try_push(NC_MpmcQueue* self, const void* object);
+/**
+ * @memberof NC_MpmcQueue
+ *
+ * @brief Copies up to @p count consecutive objects to the back of the queue
+ *
+ * Elements are claimed at once, but each becomes visible to consumers as soon as it's copied.
+ * Elements of a batch are dequeued in order, but might be interleaved with batches of other producers
+ * when they are popped by different consumers.
+ *
+ * @param objects array of @p count elements
+ * @param count number of elements in @p objects
+ *
+ * @return number of pushed elements, that form a prefix of @p objects
+*/
+size_t nc_mpmc_queue_push_batch(NC_MpmcQueue* self, const void* objects, size_t count);
+/**
+ * @memberof NC_MpmcQueue
+ *
+ * @brief Removes the first element, copying it to @p out_object
+ *
+ * @return @p true if element was removed, @p false if the queue is empty
+*/
+bool nc_mpmc_queue_try_pop(NC_MpmcQueue* self, void* out_object);
+/**
+ * @memberof NC_MpmcQueue
+ *
+ * @brief Removes up to @p max_count first elements, copying them to @p out_objects
+ *
+ * Only elements that are already fully pushed are removed, so the result might be smaller
+ * than the number of claimed cells while producers are still copying.
+ *
+ * @param out_objects array with space for @p max_count elements
+ * @param max_count maximum number of elements to remove
+ *
+ * @return number of removed elements
+*/
+size_t nc_mpmc_queue_pop_batch(NC_MpmcQueue* self, void* out_objects, size_t max_count);
+
+/**
+ * @}
+*/
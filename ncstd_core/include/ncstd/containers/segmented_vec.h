@@ -0,0 +1,210 @@
+#pragma once
+
+/**
+ * @file
+*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ncstd/allocator.h"
+
+
+/** \addtogroup segmented_vec
+ *  @brief Growable array with stable element addresses
+ *  @{
+*/
+
+/**
+ * @brief Capacity of the first segment of a segmented vector, every next segment is twice as large
+*/
+#define NC_SEGMENTED_VEC_FIRST_SEGMENT_CAPACITY 16
+
+#define NC_INTERNAL_SEGMENTED_VEC_FIRST_SEGMENT_SHIFT 4
+#define NC_INTERNAL_SEGMENTED_VEC_MAX_SEGMENTS (sizeof(size_t) * 8 - NC_INTERNAL_SEGMENTED_VEC_FIRST_SEGMENT_SHIFT)
+
+/**
+ * @brief Growable array of objects of the same size, that never moves its elements
+ *
+ * Elements are stored in segments, where segment @p k holds
+ * @ref NC_SEGMENTED_VEC_FIRST_SEGMENT_CAPACITY * 2^k elements. Growth allocates the next segment
+ * instead of reallocating, so pointers to elements stay valid until the elements are popped,
+ * and appending never copies existing elements. Segment and offset of an index are computed
+ * from the position of its highest set bit, so indexing is O(1) without loops or divisions.
+ *
+ * ## Example
+ * @code
+ *  NC_SegmentedVec nodes = nc_segmented_vec_init(sizeof(Node));
+ *
+ *  Node* const root = nc_segmented_vec_push_uninit(&nodes);
+ *  ...
+ *  // root stays valid while more nodes are pushed
+ *  Node* const child = nc_segmented_vec_push_uninit(&nodes);
+ *  child->parent = root;
+ *
+ *  nc_segmented_vec_destroy(&nodes);
+ * @endcode
+*/
+typedef struct {
+    /**
+     * @protected
+     *
+     * @brief Members are not stable, and are displayed for educational purposes only
+    */
+    struct {
+        /** @protected Allocated segments, segment @p k has capacity of 16 * 2^k elements */
+        void* segments[NC_INTERNAL_SEGMENTED_VEC_MAX_SEGMENTS];
+        /** @protected Number of allocated segments */
+        size_t segment_count;
+        /** @protected Number of elements */
+        size_t size;
+        /** @protected Size of a single element */
+        size_t object_size;
+        /** @protected Allocator that owns the segments */
+        NC_Allocator* allocator;
+    } p;
+} NC_SegmentedVec;
+
+/**
+ * @memberof NC_SegmentedVec
+ *
+ * @brief Initializes empty segmented vector (performs no dynamic allocations)
+ *
+ * ## Safety
+ * Calling this function with @p object_size equal to 0, leads to undefined behaviour
+ *
+ * @param object_size size of a single element
+ *
+ * @return created segmented vector
+*/
+NC_SegmentedVec nc_segmented_vec_init(size_t object_size);
+/**
+ * @memberof NC_SegmentedVec
+ *
+ * @brief Same as @ref nc_segmented_vec_init(), but uses @p allocator for all allocations
+ *
+ * @param object_size size of a single element
+ * @param allocator allocator, must outlive the segmented vector
+ *
+ * @return created segmented vector
+*/
+NC_SegmentedVec nc_segmented_vec_init_in(size_t object_size, NC_Allocator* allocator);
+/**
+ * @memberof NC_SegmentedVec
+ *
+ * @brief Deallocates all segments, elements are not destroyed
+*/
+void nc_segmented_vec_destroy(NC_SegmentedVec* self);
+
+/**
+ * @memberof NC_SegmentedVec
+ *
+ * @brief Returns number of elements
+*/
+size_t nc_segmented_vec_size(const NC_SegmentedVec* self);
+/**
+ * @memberof NC_SegmentedVec
+ *
+ * @brief Returns number of elements that fit into the allocated segments
+*/
+size_t nc_segmented_vec_capacity(const NC_SegmentedVec* self);
+/**
+ * @memberof NC_SegmentedVec
+ *
+ * @brief Returns whether the segmented vector contains no elements
+*/
+bool nc_segmented_vec_is_empty(const NC_SegmentedVec* self);
+
+/**
+ * @memberof NC_SegmentedVec
+ *
+ * @brief Returns pointer to the element at @p index
+ *
+ * Pointer stays valid until the element is popped or the segmented vector is destroyed.
+ *
+ * ## Safety
+ * Calling this function with @p index out of bounds leads to undefined behaviour
+*/
+void* nc_segmented_vec_get_unchecked(const NC_SegmentedVec* self, size_t index);
+/**
+ * @memberof NC_SegmentedVec
+ *
+ * @brief Returns pointer to the element at @p index, or @p NULL if @p index is out of bounds
+*/
+void* nc_segmented_vec_get(const NC_SegmentedVec* self, size_t index);
+/**
+ * @memberof NC_SegmentedVec
+ *
+ * @brief Returns pointer to the last element, or @p NULL if the segmented vector is empty
+*/
+void* nc_segmented_vec_back(const NC_SegmentedVec* self);
+
+/**
+ * @memberof NC_SegmentedVec
+ *
+ * @brief Returns number of segments that contain elements
+*/
+size_t nc_segmented_vec_segment_count(const NC_SegmentedVec* self);
+/**
+ * @memberof NC_SegmentedVec
+ *
+ * @brief Returns pointer to contiguous elements of segment @p segment_index,
+ * and writes their number into @p out_size
+ *
+ * Iterating segments visits elements in order, with a tight loop over each segment.
+ *
+ * ## Safety
+ * Calling this function with @p segment_index not less than @ref nc_segmented_vec_segment_count(),
+ * leads to undefined behaviour
+*/
+void* nc_segmented_vec_segment(const NC_SegmentedVec* self, size_t segment_index, size_t* out_size);
+
+/**
+ * @memberof NC_SegmentedVec
+ *
+ * @brief Allocates segments for at least @p new_capacity elements
+ *
+ * @return @p true on success, @p false if allocation has failed
+*/
+bool nc_segmented_vec_reserve(NC_SegmentedVec* self, size_t new_capacity);
+/**
+ * @memberof NC_SegmentedVec
+ *
+ * @brief Copies @p object to the end
+ *
+ * @return @p true on success, @p false if allocation has failed
+*/
+bool nc_segmented_vec_push(NC_SegmentedVec* self, const void* object);
+/**
+ * @memberof NC_SegmentedVec
+ *
+ * @brief Appends an uninitialized element, that the caller constructs in place
+ *
+ * @return pointer to the new element, @p NULL if allocation has failed
+*/
+void* nc_segmented_vec_push_uninit(NC_SegmentedVec* self);
+/**
+ * @memberof NC_SegmentedVec
+ *
+ * @brief Removes the last element, copying it to @p out_object unless it's @p NULL
+ *
+ * @return @p true if element was removed, @p false if the segmented vector is empty
+*/
+bool nc_segmented_vec_pop(NC_SegmentedVec* self, void* out_object);
+/**
+ * @memberof NC_SegmentedVec
+ *
+ * @brief Removes all elements, keeping the segments. Elements are not destroyed
+*/
+void nc_segmented_vec_clear(NC_SegmentedVec* self);
+/**
+ * @memberof NC_SegmentedVec
+ *
+ * @brief Deallocates segments that contain no elements
+*/
+void nc_segmented_vec_shrink_to_fit(NC_SegmentedVec* self);
+
+/**
+ * @}
+*/
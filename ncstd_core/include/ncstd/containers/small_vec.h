@@ -0,0 +1,399 @@
+#pragma once
+
+/**
+ * @file
+*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "ncstd/alloc_stats.h"
+#include "ncstd/allocator.h"
+#include "ncstd/containers/unsafe/raw_buffer.h"
+#include "ncstd/containers/vec.h"
+
+
+/** \addtogroup small_vec
+ *  @brief Vectors with inline storage for a few elements
+ *  @{
+*/
+
+/**
+ * @brief Macro that defines name of a small vector type
+ *
+ * ## Example
+ * @code
+ *  NC_SMALL_VEC(int, 8)
+ * @endcode
+ * expands to
+ * @code
+ *  NC_SmallVec_int_8
+ * @endcode
+ *
+ * @param type type of the vector elements
+ * @param inline_capacity number of elements stored inline
+*/
+#define NC_SMALL_VEC(type, inline_capacity) NC_SmallVec_##type##_##inline_capacity
+
+#define NC_INTERNAL_SMALL_VEC_FUNCTION_NAME(type_snake_case, inline_capacity, function_name)                           \
+    nc_small_vec_##type_snake_case##_##inline_capacity##_##function_name
+
+/**
+ * @brief Macro that defines a vector of @p type, that keeps up to @p inline_capacity elements
+ * inside the struct and moves them to the heap only when it grows past that
+ *
+ * Spilled elements are stored in a @ref NC_RawBuffer, that grows according to @ref nc_vec_growth_double().
+ * Once spilled, the vector stays on the heap until destroyed.
+ *
+ * Struct holds no pointers into itself, so it can be freely moved by value.
+ *
+ * ## Example
+ * @code
+ *  NC_DEFINE_SMALL_VEC(int, int, 8)
+ *
+ *  NC_SMALL_VEC(int, 8) ints = nc_small_vec_int_8_init();
+ *  nc_small_vec_int_8_push(&ints, 1);
+ *  nc_small_vec_int_8_destroy(&ints);
+ * @endcode
+ *
+ * Since all generated functions are @p inline, exactly one translation unit
+ * must also contain @ref NC_INSTANTIATE_SMALL_VEC() with the same arguments.
+ *
+ * @param type type of the vector elements
+ * @param type_snake_case name used in generated function names
+ * (@p nc_small_vec_<type_snake_case>_<inline_capacity>_push, etc.)
+ * @param inline_capacity number of elements stored inline, must be an integer literal greater than 0
+*/
+#define NC_DEFINE_SMALL_VEC(type, type_snake_case, inline_capacity)                                                     \
+    /**
+        @brief Vector of elements with inline storage
+    */                                                                                                                  \
+    typedef struct {                                                                                                    \
+        /**
+            @protected
+
+            @brief Members are not stable, and are displayed for educational purposes only
+        */                                                                                                              \
+        struct {                                                                                                        \
+            /** @protected Number of elements */                                                                        \
+            size_t size;                                                                                                \
+            /** @protected Whether elements are stored in @p storage.raw_buffer */                                      \
+            bool is_spilled;                                                                                            \
+            /** @protected Allocator used once the vector spills to the heap */                                         \
+            NC_Allocator* allocator;                                                                                    \
+            /** @protected Element storage */                                                                           \
+            union {                                                                                                     \
+                /** @protected Inline elements, active until the vector spills */                                       \
+                type inline_data[inline_capacity];                                                                      \
+                /** @protected Heap buffer, active after the vector spills */                                           \
+                NC_RawBuffer raw_buffer;                                                                                \
+            } storage;                                                                                                  \
+        } p;                                                                                                            \
+    } NC_SMALL_VEC(type, inline_capacity);                                                                              \
+                                                                                                                        \
+    /**
+        @memberof NC_SmallVec_##type##_##inline_capacity
+
+        @brief Initializes an empty vector that will use @p allocator once it spills (performs no dynamic allocations)
+
+        @param allocator allocator, must outlive the vector
+
+        @return created vector
+    */                                                                                                                  \
+    inline NC_SMALL_VEC(type, inline_capacity)                                                                          \
+    NC_INTERNAL_SMALL_VEC_FUNCTION_NAME(type_snake_case, inline_capacity, init_in)(NC_Allocator* allocator) {           \
+        return (NC_SMALL_VEC(type, inline_capacity)) {                                                                  \
+            .p = { .size = 0, .is_spilled = false, .allocator = allocator }                                             \
+        };                                                                                                              \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_SmallVec_##type##_##inline_capacity
+
+        @brief Initializes an empty vector (performs no dynamic allocations)
+
+        @return created vector
+    */                                                                                                                  \
+    inline NC_SMALL_VEC(type, inline_capacity)                                                                          \
+    NC_INTERNAL_SMALL_VEC_FUNCTION_NAME(type_snake_case, inline_capacity, init)() {                                     \
+        return NC_INTERNAL_SMALL_VEC_FUNCTION_NAME(type_snake_case, inline_capacity, init_in)(nc_allocator_default());  \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_SmallVec_##type##_##inline_capacity
+
+        @brief Deallocates the vector memory if it has spilled, elements are not destroyed
+    */                                                                                                                  \
+    inline void NC_INTERNAL_SMALL_VEC_FUNCTION_NAME(type_snake_case, inline_capacity, destroy)(                         \
+        NC_SMALL_VEC(type, inline_capacity)* self                                                                       \
+    ) {                                                                                                                 \
+        if (self->p.is_spilled)                                                                                         \
+            nc_raw_buffer_free(&self->p.storage.raw_buffer, sizeof(type));                                              \
+                                                                                                                        \
+        self->p.size = 0;                                                                                               \
+        self->p.is_spilled = false;                                                                                     \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_SmallVec_##type##_##inline_capacity
+
+        @brief Returns number of elements in the vector
+    */                                                                                                                  \
+    inline size_t NC_INTERNAL_SMALL_VEC_FUNCTION_NAME(type_snake_case, inline_capacity, size)(                          \
+        const NC_SMALL_VEC(type, inline_capacity)* self                                                                 \
+    ) {                                                                                                                 \
+        return self->p.size;                                                                                            \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_SmallVec_##type##_##inline_capacity
+
+        @brief Returns number of elements the vector can hold without reallocation
+    */                                                                                                                  \
+    inline size_t NC_INTERNAL_SMALL_VEC_FUNCTION_NAME(type_snake_case, inline_capacity, capacity)(                      \
+        const NC_SMALL_VEC(type, inline_capacity)* self                                                                 \
+    ) {                                                                                                                 \
+        return self->p.is_spilled ? self->p.storage.raw_buffer.p.capacity : (inline_capacity);                          \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_SmallVec_##type##_##inline_capacity
+
+        @brief Returns whether the vector contains no elements
+    */                                                                                                                  \
+    inline bool NC_INTERNAL_SMALL_VEC_FUNCTION_NAME(type_snake_case, inline_capacity, is_empty)(                        \
+        const NC_SMALL_VEC(type, inline_capacity)* self                                                                 \
+    ) {                                                                                                                 \
+        return self->p.size == 0;                                                                                       \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_SmallVec_##type##_##inline_capacity
+
+        @brief Returns whether elements have been moved to the heap
+    */                                                                                                                  \
+    inline bool NC_INTERNAL_SMALL_VEC_FUNCTION_NAME(type_snake_case, inline_capacity, is_spilled)(                      \
+        const NC_SMALL_VEC(type, inline_capacity)* self                                                                 \
+    ) {                                                                                                                 \
+        return self->p.is_spilled;                                                                                      \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_SmallVec_##type##_##inline_capacity
+
+        @brief Returns pointer to the first element, valid until the vector is moved or reallocated
+    */                                                                                                                  \
+    inline type* NC_INTERNAL_SMALL_VEC_FUNCTION_NAME(type_snake_case, inline_capacity, data)(                           \
+        NC_SMALL_VEC(type, inline_capacity)* self                                                                       \
+    ) {                                                                                                                 \
+        return self->p.is_spilled ? (type*)self->p.storage.raw_buffer.p.data : self->p.storage.inline_data;             \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_SmallVec_##type##_##inline_capacity
+
+        @brief Returns pointer to the element at @p index
+
+        ## Safety
+        Calling this function with @p index out of bounds leads to undefined behaviour
+    */                                                                                                                  \
+    inline type* NC_INTERNAL_SMALL_VEC_FUNCTION_NAME(type_snake_case, inline_capacity, get_unchecked)(                  \
+        NC_SMALL_VEC(type, inline_capacity)* self,                                                                      \
+        size_t index                                                                                                    \
+    ) {                                                                                                                 \
+        return NC_INTERNAL_SMALL_VEC_FUNCTION_NAME(type_snake_case, inline_capacity, data)(self) + index;               \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_SmallVec_##type##_##inline_capacity
+
+        @brief Returns pointer to the element at @p index or @p NULL if @p index is out of bounds
+    */                                                                                                                  \
+    inline type* NC_INTERNAL_SMALL_VEC_FUNCTION_NAME(type_snake_case, inline_capacity, get)(                            \
+        NC_SMALL_VEC(type, inline_capacity)* self,                                                                      \
+        size_t index                                                                                                    \
+    ) {                                                                                                                 \
+        if (index >= self->p.size)                                                                                      \
+            return NULL;                                                                                                \
+                                                                                                                        \
+        return NC_INTERNAL_SMALL_VEC_FUNCTION_NAME(type_snake_case, inline_capacity, get_unchecked)(self, index);       \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_SmallVec_##type##_##inline_capacity
+
+        @brief Reserves capacity for at least @p new_capacity elements, spilling to the heap if needed
+
+        @return @p true on success, @p false if allocation has failed
+    */                                                                                                                  \
+    inline bool NC_INTERNAL_SMALL_VEC_FUNCTION_NAME(type_snake_case, inline_capacity, reserve)(                         \
+        NC_SMALL_VEC(type, inline_capacity)* self,                                                                      \
+        size_t new_capacity                                                                                             \
+    ) {                                                                                                                 \
+        const size_t capacity = NC_INTERNAL_SMALL_VEC_FUNCTION_NAME(type_snake_case, inline_capacity, capacity)(self);  \
+        if (new_capacity <= capacity)                                                                                   \
+            return true;                                                                                                \
+                                                                                                                        \
+        NC_INTERNAL_ALLOC_STATS_SITE_ENTER();                                                                           \
+        if (self->p.is_spilled) {                                                                                       \
+            nc_raw_buffer_resize_unchecked(                                                                             \
+                &self->p.storage.raw_buffer,                                                                            \
+                nc_vec_growth_double(capacity, new_capacity),                                                           \
+                sizeof(type)                                                                                            \
+            );                                                                                                          \
+        } else {                                                                                                        \
+            const NC_RawBuffer raw_buffer = nc_raw_buffer_init_with_capacity_aligned_in(                                \
+                nc_vec_growth_double(capacity, new_capacity),                                                           \
+                sizeof(type),                                                                                           \
+                NC_INTERNAL_VEC_ALIGNMENT(type),                                                                        \
+                self->p.allocator                                                                                       \
+            );                                                                                                          \
+            if (nc_raw_buffer_data(&raw_buffer) != NULL) {                                                              \
+                memcpy(nc_raw_buffer_data(&raw_buffer), self->p.storage.inline_data, self->p.size * sizeof(type));      \
+                self->p.storage.raw_buffer = raw_buffer;                                                                \
+                self->p.is_spilled = true;                                                                              \
+            }                                                                                                           \
+        }                                                                                                               \
+        NC_INTERNAL_ALLOC_STATS_SITE_LEAVE();                                                                           \
+                                                                                                                        \
+        return NC_INTERNAL_SMALL_VEC_FUNCTION_NAME(type_snake_case, inline_capacity, capacity)(self) >= new_capacity;   \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_SmallVec_##type##_##inline_capacity
+
+        @brief Appends @p value to the end of the vector
+
+        @return @p true on success, @p false if allocation has failed
+    */                                                                                                                  \
+    inline bool NC_INTERNAL_SMALL_VEC_FUNCTION_NAME(type_snake_case, inline_capacity, push)(                            \
+        NC_SMALL_VEC(type, inline_capacity)* self,                                                                      \
+        type value                                                                                                      \
+    ) {                                                                                                                 \
+        if (!NC_INTERNAL_SMALL_VEC_FUNCTION_NAME(type_snake_case, inline_capacity, reserve)(self, self->p.size + 1))    \
+            return false;                                                                                               \
+                                                                                                                        \
+        NC_INTERNAL_SMALL_VEC_FUNCTION_NAME(type_snake_case, inline_capacity, data)(self)[self->p.size++] = value;      \
+                                                                                                                        \
+        return true;                                                                                                    \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_SmallVec_##type##_##inline_capacity
+
+        @brief Removes the last element, and writes it to @p out_value unless it's @p NULL
+
+        @return @p true if element was removed, @p false if the vector is empty
+    */                                                                                                                  \
+    inline bool NC_INTERNAL_SMALL_VEC_FUNCTION_NAME(type_snake_case, inline_capacity, pop)(                             \
+        NC_SMALL_VEC(type, inline_capacity)* self,                                                                      \
+        type* out_value                                                                                                 \
+    ) {                                                                                                                 \
+        if (self->p.size == 0)                                                                                          \
+            return false;                                                                                               \
+                                                                                                                        \
+        self->p.size -= 1;                                                                                              \
+        if (out_value != NULL)                                                                                          \
+            *out_value = NC_INTERNAL_SMALL_VEC_FUNCTION_NAME(type_snake_case, inline_capacity, data)(self)[self->p.size]; \
+                                                                                                                        \
+        return true;                                                                                                    \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_SmallVec_##type##_##inline_capacity
+
+        @brief Appends @p count elements pointed to by @p values
+
+        @p values must not point into this vector.
+
+        @return @p true on success, @p false if allocation has failed
+    */                                                                                                                  \
+    inline bool NC_INTERNAL_SMALL_VEC_FUNCTION_NAME(type_snake_case, inline_capacity, extend)(                          \
+        NC_SMALL_VEC(type, inline_capacity)* self,                                                                      \
+        const type* values,                                                                                             \
+        size_t count                                                                                                    \
+    ) {                                                                                                                 \
+        if (count == 0)                                                                                                 \
+            return true;                                                                                                \
+        if (!NC_INTERNAL_SMALL_VEC_FUNCTION_NAME(type_snake_case, inline_capacity, reserve)(self, self->p.size + count)) \
+            return false;                                                                                               \
+                                                                                                                        \
+        type* const data = NC_INTERNAL_SMALL_VEC_FUNCTION_NAME(type_snake_case, inline_capacity, data)(self);           \
+        memcpy(data + self->p.size, values, count * sizeof(type));                                                      \
+        self->p.size += count;                                                                                          \
+                                                                                                                        \
+        return true;                                                                                                    \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_SmallVec_##type##_##inline_capacity
+
+        @brief Removes all elements, keeping the capacity
+    */                                                                                                                  \
+    inline void NC_INTERNAL_SMALL_VEC_FUNCTION_NAME(type_snake_case, inline_capacity, clear)(                           \
+        NC_SMALL_VEC(type, inline_capacity)* self                                                                       \
+    ) {                                                                                                                 \
+        self->p.size = 0;                                                                                               \
+    }
+
+/**
+ * @brief Macro that emits external definitions of the functions generated by @ref NC_DEFINE_SMALL_VEC()
+ *
+ * Must be used in exactly one translation unit, after @ref NC_DEFINE_SMALL_VEC() with the same arguments.
+*/
+#define NC_INSTANTIATE_SMALL_VEC(type, type_snake_case, inline_capacity)                                                \
+    extern inline NC_SMALL_VEC(type, inline_capacity)                                                                   \
+    NC_INTERNAL_SMALL_VEC_FUNCTION_NAME(type_snake_case, inline_capacity, init_in)(NC_Allocator* allocator);            \
+    extern inline NC_SMALL_VEC(type, inline_capacity)                                                                   \
+    NC_INTERNAL_SMALL_VEC_FUNCTION_NAME(type_snake_case, inline_capacity, init)();                                      \
+    extern inline void NC_INTERNAL_SMALL_VEC_FUNCTION_NAME(type_snake_case, inline_capacity, destroy)(                  \
+        NC_SMALL_VEC(type, inline_capacity)* self                                                                       \
+    );                                                                                                                  \
+    extern inline size_t NC_INTERNAL_SMALL_VEC_FUNCTION_NAME(type_snake_case, inline_capacity, size)(                   \
+        const NC_SMALL_VEC(type, inline_capacity)* self                                                                 \
+    );                                                                                                                  \
+    extern inline size_t NC_INTERNAL_SMALL_VEC_FUNCTION_NAME(type_snake_case, inline_capacity, capacity)(               \
+        const NC_SMALL_VEC(type, inline_capacity)* self                                                                 \
+    );                                                                                                                  \
+    extern inline bool NC_INTERNAL_SMALL_VEC_FUNCTION_NAME(type_snake_case, inline_capacity, is_empty)(                 \
+        const NC_SMALL_VEC(type, inline_capacity)* self                                                                 \
+    );                                                                                                                  \
+    extern inline bool NC_INTERNAL_SMALL_VEC_FUNCTION_NAME(type_snake_case, inline_capacity, is_spilled)(               \
+        const NC_SMALL_VEC(type, inline_capacity)* self                                                                 \
+    );                                                                                                                  \
+    extern inline type* NC_INTERNAL_SMALL_VEC_FUNCTION_NAME(type_snake_case, inline_capacity, data)(                    \
+        NC_SMALL_VEC(type, inline_capacity)* self                                                                       \
+    );                                                                                                                  \
+    extern inline type* NC_INTERNAL_SMALL_VEC_FUNCTION_NAME(type_snake_case, inline_capacity, get_unchecked)(           \
+        NC_SMALL_VEC(type, inline_capacity)* self,                                                                      \
+        size_t index                                                                                                    \
+    );                                                                                                                  \
+    extern inline type* NC_INTERNAL_SMALL_VEC_FUNCTION_NAME(type_snake_case, inline_capacity, get)(                     \
+        NC_SMALL_VEC(type, inline_capacity)* self,                                                                      \
+        size_t index                                                                                                    \
+    );                                                                                                                  \
+    extern inline bool NC_INTERNAL_SMALL_VEC_FUNCTION_NAME(type_snake_case, inline_capacity, reserve)(                  \
+        NC_SMALL_VEC(type, inline_capacity)* self,                                                                      \
+        size_t new_capacity                                                                                             \
+    );                                                                                                                  \
+    extern inline bool NC_INTERNAL_SMALL_VEC_FUNCTION_NAME(type_snake_case, inline_capacity, push)(                     \
+        NC_SMALL_VEC(type, inline_capacity)* self,                                                                      \
+        type value                                                                                                      \
+    );                                                                                                                  \
+    extern inline bool NC_INTERNAL_SMALL_VEC_FUNCTION_NAME(type_snake_case, inline_capacity, pop)(                      \
+        NC_SMALL_VEC(type, inline_capacity)* self,                                                                      \
+        type* out_value                                                                                                 \
+    );                                                                                                                  \
+    extern inline bool NC_INTERNAL_SMALL_VEC_FUNCTION_NAME(type_snake_case, inline_capacity, extend)(                   \
+        NC_SMALL_VEC(type, inline_capacity)* self,                                                                      \
+        const type* values,                                                                                             \
+        size_t count                                                                                                    \
+    );                                                                                                                  \
+    extern inline void NC_INTERNAL_SMALL_VEC_FUNCTION_NAME(type_snake_case, inline_capacity, clear)(                    \
+        NC_SMALL_VEC(type, inline_capacity)* self                                                                       \
+    );
+
+/**
+ *  @}
+*/
@@ -0,0 +1,166 @@
+#pragma once
+
+/**
+ * @file
+*/
+
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "ncstd/allocator.h"
+#include "ncstd/containers/unsafe/raw_buffer.h"
+
+
+/** \addtogroup spsc_queue
+ *  @brief Lock-free single-producer/single-consumer queue
+ *  @{
+*/
+
+/**
+ * @brief Bounded lock-free queue for passing objects of the same size
+ * from exactly one producer thread to exactly one consumer thread
+ *
+ * Objects are stored in a ring buffer with power-of-two capacity.
+ * Producer and consumer positions live on separate cache lines, and each side keeps a cached copy
+ * of the other side's position, so the shared cache lines are only touched when the cached value
+ * doesn't allow the operation to proceed.
+ *
+ * Queue is aligned to the cache line size, heap allocated queues need memory with that alignment.
+ * Initialization and destruction are not thread safe, the queue must not be moved while shared.
+ *
+ * ## Example
+ * @code
+ *  NC_SpscQueue queue = nc_spsc_queue_init(1024, sizeof(Message));
+ *
+ *  // Producer thread
+ *  while (!nc_spsc_queue_try_push(&queue, &message))
+ *      ;
+ *
+ *  // Consumer thread
+ *  Message messages[32];
+ *  const size_t count = nc_spsc_queue_pop_batch(&queue, messages, 32);
+ *  ...
+ *  nc_spsc_queue_destroy(&queue);
+ * @endcode
+*/
+typedef struct {
+    /**
+     * @protected
+     *
+     * @brief Members are not stable, and are displayed for educational purposes only
+    */
+    struct {
+        /** @protected Ring buffer, capacity is 0 or a power of two */
+        NC_RawBuffer raw_buffer;
+        /** @protected Size of a single element */
+        size_t object_size;
+
+        /** @protected Number of pushed elements, written by the producer, starts its own cache line */
+        alignas(NC_CACHE_LINE_SIZE) atomic_size_t tail;
+        /** @protected Producer copy of @ref head, refreshed when the queue looks full */
+        size_t cached_head;
+
+        /** @protected Number of popped elements, written by the consumer, starts its own cache line */
+        alignas(NC_CACHE_LINE_SIZE) atomic_size_t head;
+        /** @protected Consumer copy of @ref tail, refreshed when the queue looks empty */
+        size_t cached_tail;
+    } p;
+} NC_SpscQueue;
+
+/**
+ * @memberof NC_SpscQueue
+ *
+ * @brief Initializes empty queue that can hold at least @p capacity elements
+ *
+ * ## Safety
+ * Calling this function with @p capacity or @p object_size equal to 0, leads to undefined behaviour
+ *
+ * @param capacity maximum number of elements, rounded up to a power of two
+ * @param object_size size of a single element
+ *
+ * @return created queue, with capacity 0 if allocation has failed
+*/
+NC_SpscQueue nc_spsc_queue_init(size_t capacity, size_t object_size);
+/**
+ * @memberof NC_SpscQueue
+ *
+ * @brief Same as @ref nc_spsc_queue_init(), but uses @p allocator for all allocations
+ *
+ * @param capacity maximum number of elements, rounded up to a power of two
+ * @param object_size size of a single element
+ * @param allocator allocator, must outlive the queue
+ *
+ * @return created queue, with capacity 0 if allocation has failed
+*/
+NC_SpscQueue nc_spsc_queue_init_in(size_t capacity, size_t object_size, NC_Allocator* allocator);
+/**
+ * @memberof NC_SpscQueue
+ *
+ * @brief Deallocates the queue memory, elements are not destroyed
+*/
+void nc_spsc_queue_destroy(NC_SpscQueue* self);
+
+/**
+ * @memberof NC_SpscQueue
+ *
+ * @brief Returns maximum number of elements in the queue
+*/
+size_t nc_spsc_queue_capacity(const NC_SpscQueue* self);
+/**
+ * @memberof NC_SpscQueue
+ *
+ * @brief Returns number of elements in the queue
+ *
+ * @note Exact only when called by the producer or the consumer while the other side is idle,
+ * otherwise the value might be outdated by the time it's returned
+*/
+size_t nc_spsc_queue_size(NC_SpscQueue* self);
+
+/**
+ * @memberof NC_SpscQueue
+ *
+ * @brief Copies @p object to the back of the queue, must only be called by the producer
+ *
+ * @return @p true on success, @p false if the queue is full
+*/
+bool nc_spsc_queue_try_push(NC_SpscQueue* self, const void* object);
+/**
+ * @memberof NC_SpscQueue
+ *
+ * @brief Copies up to @p count consecutive objects to the back of the queue,
+ * must only be called by the producer
+ *
+ * Elements become visible to the consumer at once, after all of them are copied.
+ *
+ * @param objects array of @p count elements
+ * @param count number of elements in @p objects
+ *
+ * @return number of pushed elements, that form a prefix of @p objects
+*/
+size_t nc_spsc_queue_push_batch(NC_SpscQueue* self, const void* objects, size_t count);
+/**
+ * @memberof NC_SpscQueue
+ *
+ * @brief Removes the first element, copying it to @p out_object, must only be called by the consumer
+ *
+ * @return @p true if element was removed, @p false if the queue is empty
+*/
+bool nc_spsc_queue_try_pop(NC_SpscQueue* self, void* out_object);
+/**
+ * @memberof NC_SpscQueue
+ *
+ * @brief Removes up to @p max_count first elements, copying them to @p out_objects,
+ * must only be called by the consumer
+ *
+ * @param out_objects array with space for @p max_count elements
+ * @param max_count maximum number of elements to remove
+ *
+ * @return number of removed elements
+*/
+size_t nc_spsc_queue_pop_batch(NC_SpscQueue* self, void* out_objects, size_t max_count);
+
+/**
+ * @}
+*/
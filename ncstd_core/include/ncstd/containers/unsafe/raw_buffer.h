@@ -7,12 +7,19 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include "ncstd/allocator.h"
+
 
 /** \addtogroup unsafe_containers
  *  @brief Unsafe containers
  *  @{
 */
 
+/**
+ * @brief Default size in bytes, starting from which raw buffers move to the large buffer allocator
+*/
+#define NC_RAW_BUFFER_DEFAULT_LARGE_THRESHOLD ((size_t)32 * 1024 * 1024)
+
 /**
  * @brief Structure providing capabilities to allocate, reallocate and deallocate
  * memory on the heap for storing multiple objects of the same type.
@@ -31,6 +38,10 @@ typedef struct {
         uint8_t* data;
         /** @protected Capacity of the raw buffer */
         size_t capacity;
+        /** @protected Allocator that owns the buffer memory */
+        NC_Allocator* allocator;
+        /** @protected Alignment of the buffer data */
+        size_t alignment;
     } p;
 } NC_RawBuffer;
 
@@ -49,6 +60,33 @@ typedef struct {
  * @return created raw buffer
 */
 NC_RawBuffer nc_raw_buffer_init(size_t object_size);
+/**
+ * @memberof NC_RawBuffer
+ * 
+ * @brief Initializes empty raw buffer that will use @p allocator for all its allocations
+ * (performs no dynamic allocations)
+ * 
+ * @param object_size size of a single object, must be persistent between all function calls
+ * on this buffer
+ * @param allocator allocator, must outlive the buffer
+ * 
+ * @return created raw buffer
+*/
+NC_RawBuffer nc_raw_buffer_init_in(size_t object_size, NC_Allocator* allocator);
+/**
+ * @memberof NC_RawBuffer
+ * 
+ * @brief Initializes empty raw buffer, that will keep its data aligned to @p alignment
+ * and use @p allocator for all its allocations (performs no dynamic allocations)
+ * 
+ * @param object_size size of a single object, must be persistent between all function calls
+ * on this buffer
+ * @param alignment alignment of the buffer data, must be a power of two. Preserved on every resize
+ * @param allocator allocator, must outlive the buffer
+ * 
+ * @return created raw buffer
+*/
+NC_RawBuffer nc_raw_buffer_init_aligned_in(size_t object_size, size_t alignment, NC_Allocator* allocator);
 /**
  * @memberof NC_RawBuffer
  * 
@@ -64,6 +102,54 @@ NC_RawBuffer nc_raw_buffer_init(size_t object_size);
  * @return created raw buffer
 */
 NC_RawBuffer nc_raw_buffer_init_with_capacity(size_t capacity, size_t object_size);
+/**
+ * @memberof NC_RawBuffer
+ * 
+ * @brief Initalizes raw buffer with specified capacity and object size, that will use
+ * @p allocator for all its allocations
+ * 
+ * ## Safety
+ * Calling this function with @p object_size equal to 0, leads to undefined behaviour
+ * 
+ * @param capacity starting capacity of the buffer
+ * @param object_size size of a single object, must be persistent between all function calls
+ * on this buffer
+ * @param allocator allocator, must outlive the buffer
+ * 
+ * @return created raw buffer
+*/
+NC_RawBuffer nc_raw_buffer_init_with_capacity_in(size_t capacity, size_t object_size, NC_Allocator* allocator);
+/**
+ * @memberof NC_RawBuffer
+ * 
+ * @brief Initalizes raw buffer with specified capacity and object size, that will keep its
+ * data aligned to @p alignment (e.g. @ref NC_CACHE_LINE_SIZE or SIMD register width)
+ * 
+ * ## Safety
+ * Calling this function with @p object_size equal to 0, leads to undefined behaviour
+ * 
+ * @param capacity starting capacity of the buffer
+ * @param object_size size of a single object, must be persistent between all function calls
+ * on this buffer
+ * @param alignment alignment of the buffer data, must be a power of two. Preserved on every resize
+ * 
+ * @return created raw buffer
+*/
+NC_RawBuffer nc_raw_buffer_init_with_capacity_aligned(size_t capacity, size_t object_size, size_t alignment);
+/**
+ * @memberof NC_RawBuffer
+ * 
+ * @brief Same as @ref nc_raw_buffer_init_with_capacity_aligned(), but uses @p allocator for all allocations
+ * 
+ * @param capacity starting capacity of the buffer
+ * @param object_size size of a single object, must be persistent between all function calls
+ * on this buffer
+ * @param alignment alignment of the buffer data, must be a power of two. Preserved on every resize
+ * @param allocator allocator, must outlive the buffer
+ * 
+ * @return created raw buffer
+*/
+NC_RawBuffer nc_raw_buffer_init_with_capacity_aligned_in(size_t capacity, size_t object_size, size_t alignment, NC_Allocator* allocator);
 /**
  * @memberof NC_RawBuffer
  * 
@@ -82,12 +168,28 @@ NC_RawBuffer nc_raw_buffer_init_with_capacity(size_t capacity, size_t object_siz
  * @return created raw buffer
 */
 NC_RawBuffer nc_raw_buffer_init_with_objects(const void* objects, size_t count, size_t object_size);
+/**
+ * @memberof NC_RawBuffer
+ * 
+ * @brief Same as @ref nc_raw_buffer_init_with_objects(), but uses @p allocator for all allocations
+ * 
+ * @param objects pointer to objects
+ * @param count object count
+ * @param object_size size of a single object, must be persistent between all calls
+ * to this buffer
+ * @param allocator allocator, must outlive the buffer
+ * 
+ * @return created raw buffer
+*/
+NC_RawBuffer nc_raw_buffer_init_with_objects_in(const void* objects, size_t count, size_t object_size, NC_Allocator* allocator);
 /**
  * @memberof NC_RawBuffer
  * 
  * @brief Destroys the raw buffer by freeing all memory allocated by it
+ * 
+ * @param object_size object size, persisent between all function calls on this buffer
 */
-void nc_raw_buffer_free(NC_RawBuffer* self);
+void nc_raw_buffer_free(NC_RawBuffer* self, size_t object_size);
 
 /**
  * @memberof NC_RawBuffer
@@ -105,6 +207,22 @@ void* nc_raw_buffer_data(const NC_RawBuffer* self);
  * @return capacity of the raw buffer
 */
 size_t nc_raw_buffer_capacity(const NC_RawBuffer* self);
+/**
+ * @memberof NC_RawBuffer
+ * 
+ * @brief Returns allocator used by the raw buffer
+ * 
+ * @return allocator used by the raw buffer
+*/
+NC_Allocator* nc_raw_buffer_allocator(const NC_RawBuffer* self);
+/**
+ * @memberof NC_RawBuffer
+ * 
+ * @brief Returns alignment of the raw buffer data
+ * 
+ * @return alignment of the raw buffer data
+*/
+size_t nc_raw_buffer_alignment(const NC_RawBuffer* self);
 
 /**
  * @memberof NC_RawBuffer
@@ -219,6 +337,8 @@ void nc_raw_buffer_set_multiple_unchecked(NC_RawBuffer* self, const void* object
  * 
  * @brief Resizes the buffer, expanding or shrinking it to @p new_capacity
  * 
+ * Alignment of the buffer data is preserved.
+ * 
  * ## Safety
  * If the @p new_capacity or @p object_size is 0, the behaviour is undefined
  * 
@@ -231,6 +351,24 @@ void nc_raw_buffer_resize_unchecked(NC_RawBuffer* self, size_t new_capacity, siz
 // TODO
 void nc_raw_buffer_grow_amorthized(NC_RawBuffer* self, size_t required_capacity, size_t growth_factor, size_t object_size);
 
+/**
+ * @brief Configures allocation of large raw buffers
+ * 
+ * Raw buffers that use @ref nc_allocator_default() and reach @p threshold bytes
+ * (on initialization or resize) move their memory to @p large_allocator and keep using it afterwards.
+ * By default, @ref nc_mapped_allocator_default() is used with @ref NC_RAW_BUFFER_DEFAULT_LARGE_THRESHOLD,
+ * so that large buffers grow with @p mremap instead of copying.
+ * 
+ * Buffers that use any other allocator are not affected.
+ * 
+ * ## Safety
+ * The function isn't thread safe, and is meant to be called once at startup.
+ * 
+ * @param large_allocator allocator for large buffers, or @p NULL to use @ref nc_mapped_allocator_default()
+ * @param threshold size in bytes, @p SIZE_MAX disables switching
+*/
+void nc_raw_buffer_set_large_allocator(NC_Allocator* large_allocator, size_t threshold);
+
 /**
  * @}
 */
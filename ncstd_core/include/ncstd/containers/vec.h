@@ -0,0 +1,454 @@
+#pragma once
+
+/**
+ * @file
+*/
+
+#include <stdalign.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "ncstd/alloc_stats.h"
+#include "ncstd/allocator.h"
+#include "ncstd/containers/unsafe/raw_buffer.h"
+
+
+/** \addtogroup vec
+ *  @brief Type-specialized growable vectors
+ *  @{
+*/
+
+/**
+ * @brief Smallest capacity that vectors allocate when growing from an empty state
+*/
+#define NC_VEC_MIN_CAPACITY 4
+
+/**
+ * @brief Growth policy that doubles the capacity
+ *
+ * @param capacity current capacity
+ * @param required_capacity capacity that is needed
+ *
+ * @return new capacity, not less than @p required_capacity
+*/
+inline size_t nc_vec_growth_double(size_t capacity, size_t required_capacity) {
+    const size_t grown_capacity = capacity < NC_VEC_MIN_CAPACITY / 2 ? NC_VEC_MIN_CAPACITY : capacity * 2;
+
+    return required_capacity < grown_capacity ? grown_capacity : required_capacity;
+}
+
+/**
+ * @brief Growth policy that grows the capacity by half, trading more reallocations
+ * for less unused memory
+ *
+ * @param capacity current capacity
+ * @param required_capacity capacity that is needed
+ *
+ * @return new capacity, not less than @p required_capacity
+*/
+inline size_t nc_vec_growth_half(size_t capacity, size_t required_capacity) {
+    const size_t grown_capacity = capacity < NC_VEC_MIN_CAPACITY ? NC_VEC_MIN_CAPACITY : capacity + capacity / 2;
+
+    return required_capacity < grown_capacity ? grown_capacity : required_capacity;
+}
+
+/**
+ * @brief Macro that defines name of a vector type
+ *
+ * ## Example
+ * @code
+ *  NC_VEC(int)
+ * @endcode
+ * expands to
+ * @code
+ *  NC_Vec_int
+ * @endcode
+ *
+ * @param type type of the vector elements
+*/
+#define NC_VEC(type) NC_Vec_##type
+
+#define NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, function_name) nc_vec_##type_snake_case##_##function_name
+
+#define NC_INTERNAL_VEC_ALIGNMENT(type) (alignof(type) > NC_DEFAULT_ALIGNMENT ? alignof(type) : NC_DEFAULT_ALIGNMENT)
+
+/**
+ * @brief Macro that defines a growable vector of @p type, that doubles its capacity when full
+ *
+ * Same as @ref NC_DEFINE_VEC_WITH_GROWTH() with @ref nc_vec_growth_double() policy.
+ *
+ * ## Example
+ * @code
+ *  NC_DEFINE_VEC(Foo, foo)
+ *
+ *  NC_VEC(Foo) foos = nc_vec_foo_init();
+ *  nc_vec_foo_push(&foos, (Foo) { .some_value = 1 });
+ *  nc_vec_foo_get_unchecked(&foos, 0)->some_value += 1;
+ *  nc_vec_foo_destroy(&foos);
+ * @endcode
+ *
+ * Since all generated functions are @p inline, exactly one translation unit
+ * must also contain @ref NC_INSTANTIATE_VEC() with the same arguments.
+*/
+#define NC_DEFINE_VEC(type, type_snake_case) NC_DEFINE_VEC_WITH_GROWTH(type, type_snake_case, nc_vec_growth_double)
+
+/**
+ * @brief Macro that defines a growable vector of @p type with a custom growth policy
+ *
+ * Elements are stored contiguously in a @ref NC_RawBuffer, but unlike the raw buffer
+ * all element accesses are inline, typed and don't need the object size,
+ * so they compile down to plain loads and stores. Only reallocation goes through the raw buffer.
+ *
+ * Functions that allocate return @p false if allocation has failed (and out of memory handler has returned),
+ * in which case the vector is left unchanged.
+ *
+ * @param type type of the vector elements
+ * @param type_snake_case name used in generated function names (@p nc_vec_<type_snake_case>_push, etc.)
+ * @param growth_fn function or macro with signature `size_t (size_t capacity, size_t required_capacity)`,
+ * that returns new capacity (e.g. @ref nc_vec_growth_double() or @ref nc_vec_growth_half())
+*/
+#define NC_DEFINE_VEC_WITH_GROWTH(type, type_snake_case, growth_fn)                                                     \
+    /**
+        @brief Growable vector of elements
+    */                                                                                                                  \
+    typedef struct {                                                                                                    \
+        /**
+            @protected
+
+            @brief Members are not stable, and are displayed for educational purposes only
+        */                                                                                                              \
+        struct {                                                                                                        \
+            /** @protected Buffer holding the elements */                                                               \
+            NC_RawBuffer raw_buffer;                                                                                    \
+            /** @protected Number of elements */                                                                        \
+            size_t size;                                                                                                \
+        } p;                                                                                                            \
+    } NC_VEC(type);                                                                                                     \
+                                                                                                                        \
+    /**
+        @memberof NC_Vec_##type
+
+        @brief Initializes an empty vector that will use @p allocator (performs no dynamic allocations)
+
+        @param allocator allocator, must outlive the vector
+
+        @return created vector
+    */                                                                                                                  \
+    inline NC_VEC(type) NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, init_in)(NC_Allocator* allocator) {              \
+        return (NC_VEC(type)) {                                                                                         \
+            .p = {                                                                                                      \
+                .raw_buffer = nc_raw_buffer_init_aligned_in(sizeof(type), NC_INTERNAL_VEC_ALIGNMENT(type), allocator),  \
+                .size = 0                                                                                               \
+            }                                                                                                           \
+        };                                                                                                              \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_Vec_##type
+
+        @brief Initializes an empty vector (performs no dynamic allocations)
+
+        @return created vector
+    */                                                                                                                  \
+    inline NC_VEC(type) NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, init)() {                                        \
+        return NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, init_in)(nc_allocator_default());                         \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_Vec_##type
+
+        @brief Initializes an empty vector with space for @p capacity elements, that will use @p allocator
+
+        @param capacity starting capacity
+        @param allocator allocator, must outlive the vector
+
+        @return created vector
+    */                                                                                                                  \
+    inline NC_VEC(type) NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, init_with_capacity_in)(                          \
+        size_t capacity,                                                                                                \
+        NC_Allocator* allocator                                                                                         \
+    ) {                                                                                                                 \
+        NC_INTERNAL_ALLOC_STATS_SITE_ENTER();                                                                           \
+        const NC_RawBuffer raw_buffer = nc_raw_buffer_init_with_capacity_aligned_in(                                    \
+            capacity,                                                                                                   \
+            sizeof(type),                                                                                               \
+            NC_INTERNAL_VEC_ALIGNMENT(type),                                                                            \
+            allocator                                                                                                   \
+        );                                                                                                              \
+        NC_INTERNAL_ALLOC_STATS_SITE_LEAVE();                                                                           \
+                                                                                                                        \
+        return (NC_VEC(type)) { .p = { .raw_buffer = raw_buffer, .size = 0 } };                                         \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_Vec_##type
+
+        @brief Initializes an empty vector with space for @p capacity elements
+
+        @param capacity starting capacity
+
+        @return created vector
+    */                                                                                                                  \
+    inline NC_VEC(type) NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, init_with_capacity)(size_t capacity) {           \
+        return NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, init_with_capacity_in)(capacity, nc_allocator_default()); \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_Vec_##type
+
+        @brief Deallocates the vector memory, elements are not destroyed
+    */                                                                                                                  \
+    inline void NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, destroy)(NC_VEC(type)* self) {                           \
+        nc_raw_buffer_free(&self->p.raw_buffer, sizeof(type));                                                          \
+        self->p.size = 0;                                                                                               \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_Vec_##type
+
+        @brief Returns number of elements in the vector
+    */                                                                                                                  \
+    inline size_t NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, size)(const NC_VEC(type)* self) {                      \
+        return self->p.size;                                                                                            \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_Vec_##type
+
+        @brief Returns number of elements the vector can hold without reallocation
+    */                                                                                                                  \
+    inline size_t NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, capacity)(const NC_VEC(type)* self) {                  \
+        return self->p.raw_buffer.p.capacity;                                                                           \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_Vec_##type
+
+        @brief Returns whether the vector contains no elements
+    */                                                                                                                  \
+    inline bool NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, is_empty)(const NC_VEC(type)* self) {                    \
+        return self->p.size == 0;                                                                                       \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_Vec_##type
+
+        @brief Returns pointer to the first element, valid until the next reallocation
+    */                                                                                                                  \
+    inline type* NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, data)(const NC_VEC(type)* self) {                       \
+        return (type*)self->p.raw_buffer.p.data;                                                                        \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_Vec_##type
+
+        @brief Returns pointer to the element at @p index
+
+        ## Safety
+        Calling this function with @p index out of bounds leads to undefined behaviour
+    */                                                                                                                  \
+    inline type* NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, get_unchecked)(const NC_VEC(type)* self, size_t index) { \
+        return NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, data)(self) + index;                                      \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_Vec_##type
+
+        @brief Returns pointer to the element at @p index or @p NULL if @p index is out of bounds
+    */                                                                                                                  \
+    inline type* NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, get)(const NC_VEC(type)* self, size_t index) {          \
+        if (index >= self->p.size)                                                                                      \
+            return NULL;                                                                                                \
+                                                                                                                        \
+        return NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, get_unchecked)(self, index);                              \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_Vec_##type
+
+        @brief Reserves capacity for at least @p new_capacity elements, growing according to the growth policy
+
+        @return @p true on success, @p false if allocation has failed
+    */                                                                                                                  \
+    inline bool NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, reserve)(NC_VEC(type)* self, size_t new_capacity) {      \
+        const size_t capacity = self->p.raw_buffer.p.capacity;                                                          \
+        if (new_capacity <= capacity)                                                                                   \
+            return true;                                                                                                \
+                                                                                                                        \
+        NC_INTERNAL_ALLOC_STATS_SITE_ENTER();                                                                           \
+        nc_raw_buffer_resize_unchecked(&self->p.raw_buffer, growth_fn(capacity, new_capacity), sizeof(type));           \
+        NC_INTERNAL_ALLOC_STATS_SITE_LEAVE();                                                                           \
+                                                                                                                        \
+        return self->p.raw_buffer.p.capacity >= new_capacity;                                                           \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_Vec_##type
+
+        @brief Shrinks the capacity to the number of elements
+    */                                                                                                                  \
+    inline void NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, shrink_to_fit)(NC_VEC(type)* self) {                     \
+        if (self->p.size == self->p.raw_buffer.p.capacity)                                                              \
+            return;                                                                                                     \
+                                                                                                                        \
+        if (self->p.size == 0) {                                                                                        \
+            NC_RawBuffer* const raw_buffer = &self->p.raw_buffer;                                                       \
+            nc_raw_buffer_free(raw_buffer, sizeof(type));                                                               \
+            *raw_buffer = nc_raw_buffer_init_aligned_in(                                                                \
+                sizeof(type),                                                                                           \
+                nc_raw_buffer_alignment(raw_buffer),                                                                    \
+                nc_raw_buffer_allocator(raw_buffer)                                                                     \
+            );                                                                                                          \
+            return;                                                                                                     \
+        }                                                                                                               \
+                                                                                                                        \
+        NC_INTERNAL_ALLOC_STATS_SITE_ENTER();                                                                           \
+        nc_raw_buffer_resize_unchecked(&self->p.raw_buffer, self->p.size, sizeof(type));                                \
+        NC_INTERNAL_ALLOC_STATS_SITE_LEAVE();                                                                           \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_Vec_##type
+
+        @brief Appends @p value to the end of the vector
+
+        @return @p true on success, @p false if allocation has failed
+    */                                                                                                                  \
+    inline bool NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, push)(NC_VEC(type)* self, type value) {                  \
+        if (self->p.size == self->p.raw_buffer.p.capacity                                                               \
+            && !NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, reserve)(self, self->p.size + 1))                        \
+            return false;                                                                                               \
+                                                                                                                        \
+        NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, data)(self)[self->p.size++] = value;                             \
+                                                                                                                        \
+        return true;                                                                                                    \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_Vec_##type
+
+        @brief Removes the last element, and writes it to @p out_value unless it's @p NULL
+
+        @return @p true if element was removed, @p false if the vector is empty
+    */                                                                                                                  \
+    inline bool NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, pop)(NC_VEC(type)* self, type* out_value) {              \
+        if (self->p.size == 0)                                                                                          \
+            return false;                                                                                               \
+                                                                                                                        \
+        self->p.size -= 1;                                                                                              \
+        if (out_value != NULL)                                                                                          \
+            *out_value = NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, data)(self)[self->p.size];                      \
+                                                                                                                        \
+        return true;                                                                                                    \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_Vec_##type
+
+        @brief Inserts @p value at @p index, shifting all elements after it
+
+        @return @p true on success, @p false if @p index is greater than size or allocation has failed
+    */                                                                                                                  \
+    inline bool NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, insert)(NC_VEC(type)* self, size_t index, type value) {  \
+        if (index > self->p.size)                                                                                       \
+            return false;                                                                                               \
+        if (!NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, reserve)(self, self->p.size + 1))                           \
+            return false;                                                                                               \
+                                                                                                                        \
+        type* const data = NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, data)(self);                                  \
+        memmove(data + index + 1, data + index, (self->p.size - index) * sizeof(type));                                 \
+        data[index] = value;                                                                                            \
+        self->p.size += 1;                                                                                              \
+                                                                                                                        \
+        return true;                                                                                                    \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_Vec_##type
+
+        @brief Removes the element at @p index, shifting all elements after it
+
+        @return @p true if element was removed, @p false if @p index is out of bounds
+    */                                                                                                                  \
+    inline bool NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, erase)(NC_VEC(type)* self, size_t index) {               \
+        if (index >= self->p.size)                                                                                      \
+            return false;                                                                                               \
+                                                                                                                        \
+        type* const data = NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, data)(self);                                  \
+        memmove(data + index, data + index + 1, (self->p.size - index - 1) * sizeof(type));                             \
+        self->p.size -= 1;                                                                                              \
+                                                                                                                        \
+        return true;                                                                                                    \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_Vec_##type
+
+        @brief Appends @p count elements pointed to by @p values
+
+        @p values must not point into this vector.
+
+        @return @p true on success, @p false if allocation has failed
+    */                                                                                                                  \
+    inline bool NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, extend)(                                                 \
+        NC_VEC(type)* self,                                                                                             \
+        const type* values,                                                                                             \
+        size_t count                                                                                                    \
+    ) {                                                                                                                 \
+        if (count == 0)                                                                                                 \
+            return true;                                                                                                \
+        if (!NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, reserve)(self, self->p.size + count))                       \
+            return false;                                                                                               \
+                                                                                                                        \
+        memcpy(NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, data)(self) + self->p.size, values, count * sizeof(type)); \
+        self->p.size += count;                                                                                          \
+                                                                                                                        \
+        return true;                                                                                                    \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_Vec_##type
+
+        @brief Removes all elements, keeping the capacity
+    */                                                                                                                  \
+    inline void NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, clear)(NC_VEC(type)* self) {                             \
+        self->p.size = 0;                                                                                               \
+    }
+
+/**
+ * @brief Macro that emits external definitions of the functions generated by @ref NC_DEFINE_VEC()
+ *
+ * Must be used in exactly one translation unit, after @ref NC_DEFINE_VEC() with the same arguments.
+*/
+#define NC_INSTANTIATE_VEC(type, type_snake_case)                                                                       \
+    extern inline NC_VEC(type) NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, init_in)(NC_Allocator* allocator);        \
+    extern inline NC_VEC(type) NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, init)();                                  \
+    extern inline NC_VEC(type) NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, init_with_capacity_in)(                   \
+        size_t capacity,                                                                                                \
+        NC_Allocator* allocator                                                                                         \
+    );                                                                                                                  \
+    extern inline NC_VEC(type) NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, init_with_capacity)(size_t capacity);     \
+    extern inline void NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, destroy)(NC_VEC(type)* self);                     \
+    extern inline size_t NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, size)(const NC_VEC(type)* self);                \
+    extern inline size_t NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, capacity)(const NC_VEC(type)* self);            \
+    extern inline bool NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, is_empty)(const NC_VEC(type)* self);              \
+    extern inline type* NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, data)(const NC_VEC(type)* self);                 \
+    extern inline type* NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, get_unchecked)(const NC_VEC(type)* self, size_t index); \
+    extern inline type* NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, get)(const NC_VEC(type)* self, size_t index);    \
+    extern inline bool NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, reserve)(NC_VEC(type)* self, size_t new_capacity); \
+    extern inline void NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, shrink_to_fit)(NC_VEC(type)* self);               \
+    extern inline bool NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, push)(NC_VEC(type)* self, type value);            \
+    extern inline bool NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, pop)(NC_VEC(type)* self, type* out_value);        \
+    extern inline bool NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, insert)(NC_VEC(type)* self, size_t index, type value); \
+    extern inline bool NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, erase)(NC_VEC(type)* self, size_t index);         \
+    extern inline bool NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, extend)(                                          \
+        NC_VEC(type)* self,                                                                                             \
+        const type* values,                                                                                             \
+        size_t count                                                                                                    \
+    );                                                                                                                  \
+    extern inline void NC_INTERNAL_VEC_FUNCTION_NAME(type_snake_case, clear)(NC_VEC(type)* self);
+
+/**
+ *  @}
+*/
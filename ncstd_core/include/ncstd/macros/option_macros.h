@@ -65,7 +65,8 @@
  *  }
  * @endcode
  * 
- * If the type can represent none state internally, implementation can be created manually.
+ * If the type can represent none state internally, use @ref NC_DEFINE_OPTION_NICHE(),
+ * or create the implementation manually.
  * It is your responsibility to avoid creating object in an invalid state.
  * ## Example
  * @code
@@ -132,6 +133,15 @@
     /**
         @memberof NC_Option_##type
      
+        @brief Returns whether option contains a value
+    */                                                                                                                  \
+    inline bool NC_INTERNAL_OPTION_FUNCTION_NAME(type_snake_case, is_some)(NC_OPTION(type) self) {                      \
+        return self.is_some;                                                                                            \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_Option_##type
+     
         @brief Returns the contained value or provided default value
     
         @param default_value default value that will be returned if option contains no value
@@ -147,6 +157,125 @@
 
     // TODO(@rchuk): Add more helper functions
 
+/**
+ * @brief Macro that defines an optional type without a flag, that stores none state as a @p sentinel value
+ *
+ * Option has the same size and alignment as @p type, so arrays of options take no extra memory.
+ * Works for types comparable with @p ==, for example pointers (with @p NULL sentinel),
+ * indices (with @p SIZE_MAX sentinel) or codepoints (with any sentinel greater than 0x10FFFF).
+ * Use @ref NC_DEFINE_OPTION_NICHE_FN() for structs.
+ *
+ * Generated functions are the same as for @ref NC_DEFINE_OPTION(), but option has no @p is_some member,
+ * and has to be checked with @p is_some function instead.
+ *
+ * ## Safety
+ * Initializing option with @p init_some from the @p sentinel value creates an option without a value
+ *
+ * ## Example
+ * @code
+ *  typedef Node* NodePtr;
+ *
+ *  NC_DEFINE_OPTION_NICHE(NodePtr, node_ptr, NULL)
+ *
+ *  NC_OPTION(NodePtr) parent = nc_option_node_ptr_init_none();
+ *  if (nc_option_node_ptr_is_some(parent))
+ *      ...
+ * @endcode
+ *
+ * @param type type that is wrapped into option
+ * @param type_snake_case name of the type used in function names
+ * @param sentinel value of @p type that represents none state
+*/
+#define NC_DEFINE_OPTION_NICHE(type, type_snake_case, sentinel)                                                         \
+    NC_INTERNAL_DEFINE_OPTION_NICHE(type, type_snake_case, (sentinel), self.value == (sentinel))
+
+/**
+ * @brief Same as @ref NC_DEFINE_OPTION_NICHE(), but for types that can't be compared with @p ==
+ *
+ * ## Example
+ * @code
+ *  NC_DEFINE_OPTION_NICHE_FN(NC_StringView, string_view, nc_string_view_init_unchecked(NULL, 0), nc_string_view_is_null)
+ * @endcode
+ *
+ * @param type type that is wrapped into option
+ * @param type_snake_case name of the type used in function names
+ * @param none_value expression creating value of @p type that represents none state
+ * @param is_none_fn function of shape @p bool(type), that returns whether value represents none state
+*/
+#define NC_DEFINE_OPTION_NICHE_FN(type, type_snake_case, none_value, is_none_fn)                                        \
+    NC_INTERNAL_DEFINE_OPTION_NICHE(type, type_snake_case, (none_value), is_none_fn(self.value))
+
+#define NC_INTERNAL_DEFINE_OPTION_NICHE(type, type_snake_case, none_value, is_none_expression)                          \
+    /**
+        @brief Struct that represents an optional value of type, storing none state inside the value
+
+        @details State should be checked with @p is_some function.
+        Then in case it's present, object can be retrieved from @p value member.
+    */                                                                                                                  \
+    typedef struct {                                                                                                    \
+        /** Contained object (or the sentinel, in case option doesn't contain a value) */                               \
+        type value;                                                                                                     \
+    } NC_OPTION(type);                                                                                                  \
+                                                                                                                        \
+    /**
+        @memberof NC_Option_##type
+
+        @brief Initializes an option with given @p value object
+
+        @param value object, must not be the sentinel
+
+        @return option containing given object
+    */                                                                                                                  \
+    inline NC_OPTION(type) NC_INTERNAL_OPTION_FUNCTION_NAME(type_snake_case, init_some)(type value) {                   \
+        return (NC_OPTION(type)) { .value = value };                                                                    \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_Option_##type
+
+        @brief Initializes an option containing no value
+
+        @return option containing no value
+    */                                                                                                                  \
+    inline NC_OPTION(type) NC_INTERNAL_OPTION_FUNCTION_NAME(type_snake_case, init_none)() {                             \
+        return (NC_OPTION(type)) { .value = none_value };                                                               \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_Option_##type
+
+        @brief Returns whether option contains a value
+    */                                                                                                                  \
+    inline bool NC_INTERNAL_OPTION_FUNCTION_NAME(type_snake_case, is_some)(NC_OPTION(type) self) {                      \
+        return !(is_none_expression);                                                                                   \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @memberof NC_Option_##type
+
+        @brief Returns the contained value or provided default value
+
+        @param default_value default value that will be returned if option contains no value
+
+        @return contained value if option contains a value or @p default_value otherwise
+    */                                                                                                                  \
+    inline type NC_INTERNAL_OPTION_FUNCTION_NAME(type_snake_case, value_or)(NC_OPTION(type) self, type default_value) { \
+        if (is_none_expression)                                                                                         \
+            return default_value;                                                                                       \
+                                                                                                                        \
+        return self.value;                                                                                              \
+    }
+
+/**
+ * @brief Macro that emits external definitions of inline functions of an option,
+ * has to be used in exactly one source file for every defined option
+*/
+#define NC_INSTANTIATE_OPTION(type, type_snake_case)                                                                    \
+    extern inline NC_OPTION(type) NC_INTERNAL_OPTION_FUNCTION_NAME(type_snake_case, init_some)(type value);             \
+    extern inline NC_OPTION(type) NC_INTERNAL_OPTION_FUNCTION_NAME(type_snake_case, init_none)();                       \
+    extern inline bool NC_INTERNAL_OPTION_FUNCTION_NAME(type_snake_case, is_some)(NC_OPTION(type) self);                \
+    extern inline type NC_INTERNAL_OPTION_FUNCTION_NAME(type_snake_case, value_or)(NC_OPTION(type) self, type default_value);
+
 /**
  *  @}
 */
@@ -9,6 +9,11 @@
 
 /** \addtogroup memory
  *  @brief Memory management utilities
+ *
+ *  When the library is configured with @p NCSTD_FEATURE_ENABLE_THREAD_CACHE, small allocations
+ *  are served from per-thread size class caches, that return freed blocks to a shared depot in batches.
+ *  Memory allocated by this module must then only be released with @ref nc_free() or resized with
+ *  @ref nc_realloc() / @ref nc_realloc_preserving().
  *  @{
 */
 
@@ -98,6 +103,78 @@ bool nc_realloc_preserving(void** in_out_ptr, size_t new_size);
 */
 void nc_free(void* ptr);
 
+/**
+ * @brief Allocates @p size bytes of uninitialized storage aligned to @p alignment
+ * 
+ * # Safety
+ * If @p alignment isn't a power of two, the behaviour is undefined.
+ * 
+ * @note Handles out of memory error using @ref nc_handle_out_of_memory(),
+ * that might or might not ever return.
+ * 
+ * @param size number of bytes to allocate
+ * @param alignment alignment of the allocated memory, must be a power of two
+ * 
+ * @return pointer to the beginning of newly allocated memory, that must be deallocated with
+ * @ref nc_free_aligned(). On failure returns a null pointer if error handler ever returns
+*/
+void* nc_malloc_aligned(size_t size, size_t alignment);
+/**
+ * @brief Reallocates the given area of memory allocated with @ref nc_malloc_aligned(),
+ * preserving its alignment
+ * 
+ * On success, function returns pointer to newly allocated memory.
+ * On failure, returns @p NULL and passed pointer is freed.
+ * For preserving old pointer look at @ref nc_realloc_aligned_preserving()
+ * 
+ * If @p ptr is @p NULL, the behavior is the same as calling @ref nc_malloc_aligned().
+ * 
+ * # Safety
+ * If @p ptr wasn't allocated with @ref nc_malloc_aligned() with the same @p alignment,
+ * the behaviour is undefined.
+ * 
+ * @note Handles out of memory error using @ref nc_handle_out_of_memory(),
+ * that might or might not ever return.
+ * 
+ * @param[in, out] ptr pointer to the allocated memory
+ * @param new_size new size of the allocated memory in bytes 
+ * @param alignment alignment of the allocated memory
+ * 
+ * @return pointer to the beginning of newly allocated memory.
+ * On failure returns a null pointer if error handler ever returns
+*/
+void* nc_realloc_aligned(void* ptr, size_t new_size, size_t alignment);
+/**
+ * @brief Reallocates the given area of memory allocated with @ref nc_malloc_aligned(),
+ * preserving its alignment
+ * 
+ * Function returns whether area was reallocated with the new size.
+ * On success, it ovewrites the pointer with the new address.
+ * On failure, passed pointer stays valid with all the data.
+ * 
+ * # Safety
+ * If variable pointed to by @p in_out_ptr wasn't allocated with @ref nc_malloc_aligned()
+ * with the same @p alignment, the behaviour is undefined.
+ * 
+ * @note Handles out of memory error using @ref nc_handle_out_of_memory(),
+ * that might or might not ever return.
+ * 
+ * @param[in, out] in_out_ptr pointer to variable that stores memory pointer 
+ * @param new_size new size of the allocated memory in bytes 
+ * @param alignment alignment of the allocated memory
+ * 
+ * @return whether reallocation was successful
+*/
+bool nc_realloc_aligned_preserving(void** in_out_ptr, size_t new_size, size_t alignment);
+/**
+ * @brief Deallocates the space previously allocated by @ref nc_malloc_aligned() or @ref nc_realloc_aligned().
+ * 
+ * The function accepts (and does nothing with) the @p NULL pointer.
+ * 
+ * @param ptr pointer to the memory to deallocate
+*/
+void nc_free_aligned(void* ptr);
+
 /**
  * @}
 */
\ No newline at end of file
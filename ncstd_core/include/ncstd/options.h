@@ -0,0 +1,31 @@
+#pragma once
+
+/**
+ * @file
+*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <uchar.h>
+
+#include "ncstd/macros/option_macros.h"
+
+
+/** \addtogroup option_macros
+ *  @{
+*/
+
+/**
+ * @brief Value of @p char32_t, that represents none state of @p NC_OPTION(char32_t),
+ * since it's greater than any Unicode codepoint
+*/
+#define NC_OPTION_CHAR32_SENTINEL ((char32_t)UINT32_MAX)
+
+NC_DEFINE_OPTION_NICHE(char32_t, char32, NC_OPTION_CHAR32_SENTINEL)
+NC_DEFINE_OPTION_NICHE(size_t, size, SIZE_MAX)
+NC_DEFINE_OPTION_NICHE(uint32_t, u32, UINT32_MAX)
+
+/**
+ *  @}
+*/
@@ -8,7 +8,8 @@
 #include <stdlib.h>
 #include <string.h>
 
-#include "ncstd/memory.h"
+#include "ncstd/alloc_stats.h"
+#include "ncstd/allocator.h"
 
 
 /** \addtogroup create_util
@@ -17,20 +18,66 @@
 */
 
 /**
- * @brief Creates an object on the heap
+ * @brief Creates an object using @p allocator
  * 
- * Dynamically allocates memory with malloc, and then copies data
+ * Allocates memory with @p allocator, and then copies data
  * pointed to by @p self_init with specified size.
  * 
  * @param self_init struct initialization data
  * @param size struct size
+ * @param allocator allocator used to allocate the object
  * 
- * @return pointer to allocated memory containing initialized object
+ * @return pointer to allocated memory containing initialized object, that must be deallocated with
+ * @ref nc_allocator_free() on @p allocator with @p size and @ref NC_DEFAULT_ALIGNMENT
+*/
+inline void* nc_util_create_with_in(void* self_init, size_t size, NC_Allocator* allocator) {
+    NC_INTERNAL_ALLOC_STATS_SITE_ENTER();
+    void* const self = nc_allocator_alloc(allocator, size, NC_DEFAULT_ALIGNMENT);
+    NC_INTERNAL_ALLOC_STATS_SITE_LEAVE();
+
+    memcpy(self, self_init, size);
+
+    return self;
+}
+
+/**
+ * @brief Creates an object on the heap
+ * 
+ * Same as @ref nc_util_create_with_in() with the default allocator (@ref nc_allocator_default()).
+ * Memory isn't allocated with @ref nc_malloc(), and must not be released with @ref nc_free().
+ * 
+ * @param self_init struct initialization data
+ * @param size struct size
+ * 
+ * @return pointer to allocated memory containing initialized object, that must be deallocated with
+ * @p nc_allocator_free(nc_allocator_default(), ptr, size, NC_DEFAULT_ALIGNMENT)
 */
 inline void* nc_util_create_with(void* self_init, size_t size) {
-    void* const self = nc_malloc(size);
+    return nc_util_create_with_in(self_init, size, nc_allocator_default());
+}
+
+/**
+ * @brief Creates an object with flexible array of bytes member using @p allocator
+ * 
+ * Same as @ref nc_util_create_with_flexible(), but allocates memory with @p allocator.
+ * Allocation size is equal to @p size + @p flexible_size.
+ * 
+ * @param self_init struct initialization data
+ * @param size struct size
+ * @param flexible_init flexible struct initialization data
+ * @param flexible_size flexible struct size
+ * @param allocator allocator used to allocate the object
+ * 
+ * @return pointer to allocated memory containing initialized object, that must be deallocated with
+ * @ref nc_allocator_free() on @p allocator with @p size + @p flexible_size and @ref NC_DEFAULT_ALIGNMENT
+*/
+inline void* nc_util_create_with_flexible_in(void* self_init, size_t size, void* flexible_init, size_t flexible_size, NC_Allocator* allocator) {
+    NC_INTERNAL_ALLOC_STATS_SITE_ENTER();
+    void* const self = nc_allocator_alloc(allocator, size + flexible_size, NC_DEFAULT_ALIGNMENT);
+    NC_INTERNAL_ALLOC_STATS_SITE_LEAVE();
 
     memcpy(self, self_init, size);
+    memcpy((uint8_t*)self + size, flexible_init, flexible_size);
 
     return self;
 }
@@ -38,8 +85,9 @@ inline void* nc_util_create_with(void* self_init, size_t size) {
 /**
  * @brief Creates an object with flexible array of bytes member on the heap
  * 
- * Dynamically allocates memory with malloc, and then copies data
+ * Allocates memory with the default allocator (@ref nc_allocator_default()), and then copies data
  * pointed to by @p self_init and @p flexible_init with specified sizes.
+ * Memory isn't allocated with @ref nc_malloc(), and must not be released with @ref nc_free().
  * 
  * ## Example
  * @code
@@ -74,6 +122,9 @@ inline void* nc_util_create_with(void* self_init, size_t size) {
  *  );
  * 
  *  ...
+ * 
+ *  nc_allocator_free(nc_allocator_default(), foo, sizeof(Foo) + sizeof(Bar), NC_DEFAULT_ALIGNMENT);
+ *  nc_allocator_free(nc_allocator_default(), other_foo, sizeof(Foo) + sizeof(Baz), NC_DEFAULT_ALIGNMENT);
  * @endcode
  * 
  * @param self_init struct initialization data
@@ -81,15 +132,11 @@ inline void* nc_util_create_with(void* self_init, size_t size) {
  * @param flexible_init flexible struct initialization data
  * @param flexible_size flexible struct size
  * 
- * @return pointer to allocated memory containing initialized object
+ * @return pointer to allocated memory containing initialized object, that must be deallocated with
+ * @p nc_allocator_free(nc_allocator_default(), ptr, size + flexible_size, NC_DEFAULT_ALIGNMENT)
 */
 inline void* nc_util_create_with_flexible(void* self_init, size_t size, void* flexible_init, size_t flexible_size) {
-    void* const self = nc_malloc(size + flexible_size);
-
-    memcpy(self, self_init, size);
-    memcpy((uint8_t*)self + size, flexible_init, flexible_size);
-
-    return self;
+    return nc_util_create_with_flexible_in(self_init, size, flexible_init, flexible_size, nc_allocator_default());
 }
 
 /**
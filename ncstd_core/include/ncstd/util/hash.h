@@ -0,0 +1,131 @@
+#pragma once
+
+/**
+ * @file
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+/** \addtogroup hash
+ *  @brief Non-cryptographic hash functions
+ *
+ *  Byte hashes follow the wyhash construction: input is consumed with 64-bit loads
+ *  in three independent 48-byte lanes, inputs of up to 16 bytes are read with a few overlapping loads,
+ *  and every step is a 64x64->128 bit multiply folded back into 64 bits.
+ *
+ *  Hashes are stable within one build of the library, but may change between versions,
+ *  so they must not be persisted.
+ *  @{
+*/
+
+/**
+ * @brief Incremental hasher, that produces the same hash as @ref nc_hash_bytes_seeded()
+ * for the concatenation of all the data it was fed with
+ *
+ * ## Example
+ * @code
+ *  NC_Hasher hasher = nc_hasher_init();
+ *  nc_hasher_update(&hasher, "Hello, ", 7);
+ *  nc_hasher_update(&hasher, "World!", 6);
+ *
+ *  assert(nc_hasher_finish(&hasher) == nc_hash_bytes("Hello, World!", 13));
+ * @endcode
+*/
+typedef struct {
+    /**
+     * @protected
+     *
+     * @brief Members are not stable, and are displayed for educational purposes only
+    */
+    struct {
+        /** @protected State of the three lanes */
+        uint64_t lanes[3];
+        /** @protected Data that hasn't been consumed yet */
+        uint8_t buffer[48];
+        /** @protected Last 16 bytes of consumed data */
+        uint8_t tail[16];
+        /** @protected Number of bytes in @p buffer */
+        size_t buffer_size;
+        /** @protected Total number of bytes fed to the hasher */
+        size_t total_size;
+    } p;
+} NC_Hasher;
+
+/**
+ * @brief Mixes bits of @p value, so that every input bit affects every output bit
+ *
+ * Suitable for hashing integer keys.
+ *
+ * @param value value to hash
+ *
+ * @return hash of the value
+*/
+uint64_t nc_hash_u64(uint64_t value);
+/**
+ * @brief Hashes @p size bytes pointed to by @p data
+ *
+ * Same as @ref nc_hash_bytes_seeded() with seed 0.
+ *
+ * @param data bytes to hash, may be @p NULL if @p size is 0
+ * @param size number of bytes
+ *
+ * @return hash of the bytes
+*/
+uint64_t nc_hash_bytes(const void* data, size_t size);
+/**
+ * @brief Hashes @p size bytes pointed to by @p data with @p seed
+ *
+ * Hash tables that store keys coming from untrusted input should use a seed,
+ * that is chosen randomly at startup, so that colliding keys can't be precomputed.
+ *
+ * @param data bytes to hash, may be @p NULL if @p size is 0
+ * @param size number of bytes
+ * @param seed seed value
+ *
+ * @return hash of the bytes
+*/
+uint64_t nc_hash_bytes_seeded(const void* data, size_t size, uint64_t seed);
+
+/**
+ * @memberof NC_Hasher
+ *
+ * @brief Initializes incremental hasher with seed 0
+ *
+ * @return created hasher
+*/
+NC_Hasher nc_hasher_init();
+/**
+ * @memberof NC_Hasher
+ *
+ * @brief Initializes incremental hasher with @p seed
+ *
+ * @param seed seed value
+ *
+ * @return created hasher
+*/
+NC_Hasher nc_hasher_init_seeded(uint64_t seed);
+/**
+ * @memberof NC_Hasher
+ *
+ * @brief Feeds @p size bytes pointed to by @p data to the hasher
+ *
+ * @param data bytes to hash, may be @p NULL if @p size is 0
+ * @param size number of bytes
+*/
+void nc_hasher_update(NC_Hasher* self, const void* data, size_t size);
+/**
+ * @memberof NC_Hasher
+ *
+ * @brief Returns hash of all the data fed to the hasher so far
+ *
+ * Hasher is not modified, so more data can be fed to it afterwards.
+ *
+ * @return hash of the data
+*/
+uint64_t nc_hasher_finish(const NC_Hasher* self);
+
+/**
+ * @}
+*/
@@ -0,0 +1,557 @@
+#pragma once
+
+/**
+ * @file
+*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+
+/** \addtogroup sort
+ *  @brief Type-specialized sorting algorithms
+ *  @{
+*/
+
+#define NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, function_name) nc_sort_##sort_snake_case##_##function_name
+#define NC_INTERNAL_RADIX_SORT_FUNCTION_NAME(sort_snake_case) nc_radix_sort_##sort_snake_case
+
+#define NC_INTERNAL_SORT_INSERTION_THRESHOLD 24
+#define NC_INTERNAL_SORT_NINTHER_THRESHOLD 128
+#define NC_INTERNAL_SORT_PARTIAL_INSERTION_LIMIT 8
+#define NC_INTERNAL_SORT_STABLE_RUN 16
+
+#define NC_INTERNAL_RADIX_SORT_PASSES 8
+#define NC_INTERNAL_RADIX_SORT_BUCKETS 256
+
+/**
+ * @brief Macro that defines comparison sorts of arrays of @p type, ordered by @p less_fn
+ *
+ * Generates two functions:
+ * - @p nc_sort_<sort_snake_case>_unstable, pattern-defeating quicksort (pdqsort), that runs in O(n log n)
+ *   in the worst case by falling back to heapsort, and in O(n) on sorted, reversed and
+ *   many-equal-elements inputs. It sorts in place and doesn't preserve order of equal elements.
+ * - @p nc_sort_<sort_snake_case>_stable, merge sort that preserves order of equal elements,
+ *   using caller-supplied scratch space instead of allocating.
+ *
+ * Unlike stdlib @p qsort, comparisons are inlined and elements are moved as @p type values
+ * instead of byte by byte. To sort an @ref NC_RawBuffer, pass @ref nc_raw_buffer_data().
+ *
+ * ## Example
+ * @code
+ *  #define point_less(a, b) ((a)->x < (b)->x)
+ *  NC_DEFINE_SORT(Point, point, point_less)
+ *
+ *  nc_sort_point_unstable(points, count);
+ *  nc_sort_point_stable(points, count, scratch);
+ * @endcode
+ *
+ * Since all generated functions are @p inline, exactly one translation unit
+ * must also contain @ref NC_INSTANTIATE_SORT() with the same arguments.
+ *
+ * @param type type of the elements
+ * @param sort_snake_case name used in generated function names
+ * @param less_fn function or macro with signature `bool (const type* a, const type* b)`,
+ * that returns whether @p a must be placed before @p b (strict weak ordering)
+ *
+ * @note Since generated functions are @p inline with external linkage, @p less_fn must not be @p static.
+*/
+#define NC_DEFINE_SORT(type, sort_snake_case, less_fn)                                                                  \
+    inline void NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_swap)(type* a, type* b) {                             \
+        const type tmp = *a;                                                                                            \
+        *a = *b;                                                                                                        \
+        *b = tmp;                                                                                                       \
+    }                                                                                                                   \
+                                                                                                                        \
+    inline void NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_sort2)(type* a, type* b) {                            \
+        if (less_fn(b, a))                                                                                              \
+            NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_swap)(a, b);                                              \
+    }                                                                                                                   \
+                                                                                                                        \
+    inline void NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_sort3)(type* a, type* b, type* c) {                   \
+        NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_sort2)(a, b);                                                 \
+        NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_sort2)(b, c);                                                 \
+        NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_sort2)(a, b);                                                 \
+    }                                                                                                                   \
+                                                                                                                        \
+    inline void NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_insertion_sort)(type* begin, type* end) {             \
+        if (begin == end)                                                                                               \
+            return;                                                                                                     \
+                                                                                                                        \
+        for (type* current = begin + 1; current != end; ++current) {                                                    \
+            type* sift = current;                                                                                       \
+            if (less_fn(sift, sift - 1)) {                                                                              \
+                const type value = *sift;                                                                               \
+                do {                                                                                                    \
+                    *sift = *(sift - 1);                                                                                \
+                    sift -= 1;                                                                                          \
+                } while (sift != begin && less_fn(&value, sift - 1));                                                   \
+                *sift = value;                                                                                          \
+            }                                                                                                           \
+        }                                                                                                               \
+    }                                                                                                                   \
+                                                                                                                        \
+    /* Same as insertion sort, but relies on the element before begin not being greater than any element */             \
+    inline void NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_unguarded_insertion_sort)(type* begin, type* end) {   \
+        if (begin == end)                                                                                               \
+            return;                                                                                                     \
+                                                                                                                        \
+        for (type* current = begin + 1; current != end; ++current) {                                                    \
+            type* sift = current;                                                                                       \
+            if (less_fn(sift, sift - 1)) {                                                                              \
+                const type value = *sift;                                                                               \
+                do {                                                                                                    \
+                    *sift = *(sift - 1);                                                                                \
+                    sift -= 1;                                                                                          \
+                } while (less_fn(&value, sift - 1));                                                                    \
+                *sift = value;                                                                                          \
+            }                                                                                                           \
+        }                                                                                                               \
+    }                                                                                                                   \
+                                                                                                                        \
+    /* Insertion sort that gives up after moving elements too many times, returns whether it has finished */            \
+    inline bool NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_partial_insertion_sort)(type* begin, type* end) {     \
+        if (begin == end)                                                                                               \
+            return true;                                                                                                \
+                                                                                                                        \
+        size_t moves = 0;                                                                                               \
+        for (type* current = begin + 1; current != end; ++current) {                                                    \
+            type* sift = current;                                                                                       \
+            if (less_fn(sift, sift - 1)) {                                                                              \
+                const type value = *sift;                                                                               \
+                do {                                                                                                    \
+                    *sift = *(sift - 1);                                                                                \
+                    sift -= 1;                                                                                          \
+                } while (sift != begin && less_fn(&value, sift - 1));                                                   \
+                *sift = value;                                                                                          \
+                moves += (size_t)(current - sift);                                                                      \
+            }                                                                                                           \
+                                                                                                                        \
+            if (moves > NC_INTERNAL_SORT_PARTIAL_INSERTION_LIMIT)                                                       \
+                return false;                                                                                           \
+        }                                                                                                               \
+                                                                                                                        \
+        return true;                                                                                                    \
+    }                                                                                                                   \
+                                                                                                                        \
+    inline void NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_sift_down)(type* data, size_t size, size_t index) {   \
+        const type value = data[index];                                                                                 \
+        for (;;) {                                                                                                      \
+            size_t child = 2 * index + 1;                                                                               \
+            if (child >= size)                                                                                          \
+                break;                                                                                                  \
+            if (child + 1 < size && less_fn(&data[child], &data[child + 1]))                                            \
+                child += 1;                                                                                             \
+            if (!less_fn(&value, &data[child]))                                                                         \
+                break;                                                                                                  \
+                                                                                                                        \
+            data[index] = data[child];                                                                                  \
+            index = child;                                                                                              \
+        }                                                                                                               \
+        data[index] = value;                                                                                            \
+    }                                                                                                                   \
+                                                                                                                        \
+    inline void NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_heapsort)(type* begin, type* end) {                   \
+        const size_t size = (size_t)(end - begin);                                                                      \
+        for (size_t i = size / 2; i-- > 0;)                                                                             \
+            NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_sift_down)(begin, size, i);                               \
+                                                                                                                        \
+        for (size_t last = size; last-- > 1;) {                                                                         \
+            NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_swap)(begin, begin + last);                               \
+            NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_sift_down)(begin, last, 0);                               \
+        }                                                                                                               \
+    }                                                                                                                   \
+                                                                                                                        \
+    /*                                                                                                                  \
+        Partitions around the pivot at begin, putting elements equal to it into the right part.                         \
+        Returns pivot position, and whether the range was already partitioned.                                          \
+    */                                                                                                                  \
+    inline type* NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_partition_right)(                                    \
+        type* begin,                                                                                                    \
+        type* end,                                                                                                      \
+        bool* out_already_partitioned                                                                                   \
+    ) {                                                                                                                 \
+        const type pivot = *begin;                                                                                      \
+        type* first = begin;                                                                                            \
+        type* last = end;                                                                                               \
+                                                                                                                        \
+        while (less_fn(++first, &pivot))                                                                                \
+            ;                                                                                                           \
+        if (first - 1 == begin) {                                                                                       \
+            while (first < last && !less_fn(--last, &pivot))                                                            \
+                ;                                                                                                       \
+        } else {                                                                                                        \
+            while (!less_fn(--last, &pivot))                                                                            \
+                ;                                                                                                       \
+        }                                                                                                               \
+                                                                                                                        \
+        *out_already_partitioned = first >= last;                                                                       \
+        while (first < last) {                                                                                          \
+            NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_swap)(first, last);                                       \
+            while (less_fn(++first, &pivot))                                                                            \
+                ;                                                                                                       \
+            while (!less_fn(--last, &pivot))                                                                            \
+                ;                                                                                                       \
+        }                                                                                                               \
+                                                                                                                        \
+        type* const pivot_position = first - 1;                                                                         \
+        *begin = *pivot_position;                                                                                       \
+        *pivot_position = pivot;                                                                                        \
+                                                                                                                        \
+        return pivot_position;                                                                                          \
+    }                                                                                                                   \
+                                                                                                                        \
+    /* Partitions around the pivot at begin, putting elements equal to it into the left part */                         \
+    inline type* NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_partition_left)(type* begin, type* end) {            \
+        const type pivot = *begin;                                                                                      \
+        type* first = begin;                                                                                            \
+        type* last = end;                                                                                               \
+                                                                                                                        \
+        while (less_fn(&pivot, --last))                                                                                 \
+            ;                                                                                                           \
+        if (last + 1 == end) {                                                                                          \
+            while (first < last && !less_fn(&pivot, ++first))                                                           \
+                ;                                                                                                       \
+        } else {                                                                                                        \
+            while (!less_fn(&pivot, ++first))                                                                           \
+                ;                                                                                                       \
+        }                                                                                                               \
+                                                                                                                        \
+        while (first < last) {                                                                                          \
+            NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_swap)(first, last);                                       \
+            while (less_fn(&pivot, --last))                                                                             \
+                ;                                                                                                       \
+            while (!less_fn(&pivot, ++first))                                                                           \
+                ;                                                                                                       \
+        }                                                                                                               \
+                                                                                                                        \
+        *begin = *last;                                                                                                 \
+        *last = pivot;                                                                                                  \
+                                                                                                                        \
+        return last;                                                                                                    \
+    }                                                                                                                   \
+                                                                                                                        \
+    /* Swaps elements at the quarter points of a part, to break patterns that led to a bad partition */                 \
+    inline void NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_shuffle)(type* begin, type* end) {                    \
+        const size_t size = (size_t)(end - begin);                                                                      \
+        if (size < NC_INTERNAL_SORT_INSERTION_THRESHOLD)                                                                \
+            return;                                                                                                     \
+                                                                                                                        \
+        const size_t quarter = size / 4;                                                                                \
+        NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_swap)(begin, begin + quarter);                                \
+        NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_swap)(end - 1, end - quarter);                                \
+        if (size > NC_INTERNAL_SORT_NINTHER_THRESHOLD) {                                                                \
+            NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_swap)(begin + 1, begin + (quarter + 1));                  \
+            NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_swap)(begin + 2, begin + (quarter + 2));                  \
+            NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_swap)(end - 2, end - (quarter + 1));                      \
+            NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_swap)(end - 3, end - (quarter + 2));                      \
+        }                                                                                                               \
+    }                                                                                                                   \
+                                                                                                                        \
+    inline void NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_pdqsort)(                                             \
+        type* begin,                                                                                                    \
+        type* end,                                                                                                      \
+        size_t bad_allowed,                                                                                             \
+        bool leftmost                                                                                                   \
+    ) {                                                                                                                 \
+        for (;;) {                                                                                                      \
+            const size_t size = (size_t)(end - begin);                                                                  \
+            if (size < NC_INTERNAL_SORT_INSERTION_THRESHOLD) {                                                          \
+                if (leftmost)                                                                                           \
+                    NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_insertion_sort)(begin, end);                      \
+                else                                                                                                    \
+                    NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_unguarded_insertion_sort)(begin, end);            \
+                return;                                                                                                 \
+            }                                                                                                           \
+                                                                                                                        \
+            /* Move median of 3 (or pseudomedian of 9 for large ranges) to begin */                                     \
+            const size_t half = size / 2;                                                                               \
+            if (size > NC_INTERNAL_SORT_NINTHER_THRESHOLD) {                                                            \
+                NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_sort3)(begin, begin + half, end - 1);                 \
+                NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_sort3)(begin + 1, begin + (half - 1), end - 2);       \
+                NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_sort3)(begin + 2, begin + (half + 1), end - 3);       \
+                NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_sort3)(begin + (half - 1), begin + half, begin + (half + 1)); \
+                NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_swap)(begin, begin + half);                           \
+            } else {                                                                                                    \
+                NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_sort3)(begin + half, begin, end - 1);                 \
+            }                                                                                                           \
+                                                                                                                        \
+            /* Pivot equal to the preceding element means the range has many equal elements, skip them */               \
+            if (!leftmost && !less_fn(begin - 1, begin)) {                                                              \
+                begin = NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_partition_left)(begin, end) + 1;              \
+                continue;                                                                                               \
+            }                                                                                                           \
+                                                                                                                        \
+            bool already_partitioned = false;                                                                           \
+            type* const pivot = NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_partition_right)(                     \
+                begin,                                                                                                  \
+                end,                                                                                                    \
+                &already_partitioned                                                                                    \
+            );                                                                                                          \
+                                                                                                                        \
+            const size_t left_size = (size_t)(pivot - begin);                                                           \
+            const size_t right_size = (size_t)(end - (pivot + 1));                                                      \
+            if (left_size < size / 8 || right_size < size / 8) {                                                        \
+                bad_allowed -= 1;                                                                                       \
+                if (bad_allowed == 0) {                                                                                 \
+                    NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_heapsort)(begin, end);                            \
+                    return;                                                                                             \
+                }                                                                                                       \
+                                                                                                                        \
+                NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_shuffle)(begin, pivot);                               \
+                NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_shuffle)(pivot + 1, end);                             \
+            } else if (already_partitioned                                                                              \
+                && NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_partial_insertion_sort)(begin, pivot)              \
+                && NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_partial_insertion_sort)(pivot + 1, end)) {         \
+                return;                                                                                                 \
+            }                                                                                                           \
+                                                                                                                        \
+            NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_pdqsort)(begin, pivot, bad_allowed, leftmost);            \
+            begin = pivot + 1;                                                                                          \
+            leftmost = false;                                                                                           \
+        }                                                                                                               \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @brief Sorts @p count elements pointed to by @p data in place, using pattern-defeating quicksort
+
+        Order of equal elements is not preserved.
+
+        @param data array of @p count elements
+        @param count number of elements
+    */                                                                                                                  \
+    inline void NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, unstable)(type* data, size_t count) {                   \
+        if (count < 2)                                                                                                  \
+            return;                                                                                                     \
+                                                                                                                        \
+        size_t bad_allowed = 1;                                                                                         \
+        for (size_t remaining = count; remaining > 1; remaining /= 2)                                                   \
+            bad_allowed += 1;                                                                                           \
+                                                                                                                        \
+        NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_pdqsort)(data, data + count, bad_allowed, true);              \
+    }                                                                                                                   \
+                                                                                                                        \
+    /**
+        @brief Sorts @p count elements pointed to by @p data, preserving order of equal elements
+
+        Uses merge sort, that copies the left half of each merged range into @p scratch.
+
+        @param data array of @p count elements
+        @param count number of elements
+        @param scratch array with space for at least @p count / 2 elements, that doesn't overlap @p data
+    */                                                                                                                  \
+    inline void NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, stable)(type* data, size_t count, type* scratch) {      \
+        if (count <= NC_INTERNAL_SORT_STABLE_RUN) {                                                                     \
+            NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_insertion_sort)(data, data + count);                      \
+            return;                                                                                                     \
+        }                                                                                                               \
+                                                                                                                        \
+        const size_t middle = count / 2;                                                                                \
+        NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, stable)(data, middle, scratch);                                 \
+        NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, stable)(data + middle, count - middle, scratch);                \
+                                                                                                                        \
+        /* Halves are already in order */                                                                               \
+        if (!less_fn(&data[middle], &data[middle - 1]))                                                                 \
+            return;                                                                                                     \
+                                                                                                                        \
+        memcpy(scratch, data, middle * sizeof(type));                                                                   \
+                                                                                                                        \
+        size_t left = 0;                                                                                                \
+        size_t right = middle;                                                                                          \
+        size_t output = 0;                                                                                              \
+        while (left < middle && right < count) {                                                                        \
+            if (less_fn(&data[right], &scratch[left]))                                                                  \
+                data[output++] = data[right++];                                                                         \
+            else                                                                                                        \
+                data[output++] = scratch[left++];                                                                       \
+        }                                                                                                               \
+        /* Remaining right elements are already in place */                                                             \
+        while (left < middle)                                                                                           \
+            data[output++] = scratch[left++];                                                                           \
+    }
+
+/**
+ * @brief Macro that emits external definitions of the functions generated by @ref NC_DEFINE_SORT()
+ *
+ * Must be used in exactly one translation unit, after @ref NC_DEFINE_SORT() with the same arguments.
+*/
+#define NC_INSTANTIATE_SORT(type, sort_snake_case)                                                                      \
+    extern inline void NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_swap)(type* a, type* b);                       \
+    extern inline void NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_sort2)(type* a, type* b);                      \
+    extern inline void NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_sort3)(type* a, type* b, type* c);             \
+    extern inline void NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_insertion_sort)(type* begin, type* end);       \
+    extern inline void NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_unguarded_insertion_sort)(type* begin, type* end); \
+    extern inline bool NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_partial_insertion_sort)(type* begin, type* end); \
+    extern inline void NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_sift_down)(type* data, size_t size, size_t index); \
+    extern inline void NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_heapsort)(type* begin, type* end);             \
+    extern inline type* NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_partition_right)(                             \
+        type* begin,                                                                                                    \
+        type* end,                                                                                                      \
+        bool* out_already_partitioned                                                                                   \
+    );                                                                                                                  \
+    extern inline type* NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_partition_left)(type* begin, type* end);      \
+    extern inline void NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_shuffle)(type* begin, type* end);              \
+    extern inline void NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, p_pdqsort)(                                      \
+        type* begin,                                                                                                    \
+        type* end,                                                                                                      \
+        size_t bad_allowed,                                                                                             \
+        bool leftmost                                                                                                   \
+    );                                                                                                                  \
+    extern inline void NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, unstable)(type* data, size_t count);             \
+    extern inline void NC_INTERNAL_SORT_FUNCTION_NAME(sort_snake_case, stable)(type* data, size_t count, type* scratch);
+
+/**
+ * @brief Macro that defines a least significant digit radix sort of arrays of @p type,
+ * ordered by an unsigned integer key
+ *
+ * Generates @p nc_radix_sort_<sort_snake_case>, that sorts in O(n) by distributing elements
+ * by one byte of the key at a time, starting from the least significant one. Histograms of all bytes
+ * are computed in a single pass, and bytes that are equal across all keys are skipped,
+ * so keys with fewer significant bits need fewer passes. The sort is stable.
+ *
+ * To sort by a signed or floating point key, map it with @ref nc_radix_key_i64() or @ref nc_radix_key_f64()
+ * (or their 32-bit counterparts), that preserve ordering.
+ *
+ * ## Example
+ * @code
+ *  #define order_key(order) ((uint64_t)(order)->timestamp)
+ *  NC_DEFINE_RADIX_SORT(Order, order, order_key)
+ *
+ *  nc_radix_sort_order(orders, count, scratch);
+ * @endcode
+ *
+ * Since all generated functions are @p inline, exactly one translation unit
+ * must also contain @ref NC_INSTANTIATE_RADIX_SORT() with the same arguments.
+ *
+ * @param type type of the elements
+ * @param sort_snake_case name used in generated function name
+ * @param key_fn function or macro with signature `uint64_t (const type* value)`, that returns the sort key
+ *
+ * @note Since generated functions are @p inline with external linkage, @p key_fn must not be @p static.
+*/
+#define NC_DEFINE_RADIX_SORT(type, sort_snake_case, key_fn)                                                             \
+    /**
+        @brief Sorts @p count elements pointed to by @p data by their keys, preserving order of equal keys
+
+        @param data array of @p count elements
+        @param count number of elements
+        @param scratch array with space for at least @p count elements, that doesn't overlap @p data
+    */                                                                                                                  \
+    inline void NC_INTERNAL_RADIX_SORT_FUNCTION_NAME(sort_snake_case)(type* data, size_t count, type* scratch) {        \
+        size_t counts[NC_INTERNAL_RADIX_SORT_PASSES][NC_INTERNAL_RADIX_SORT_BUCKETS] = { { 0 } };                       \
+        for (size_t i = 0; i < count; ++i) {                                                                            \
+            const uint64_t key = key_fn(&data[i]);                                                                      \
+            for (size_t pass = 0; pass < NC_INTERNAL_RADIX_SORT_PASSES; ++pass)                                         \
+                counts[pass][(key >> (pass * 8)) & 0xFF] += 1;                                                          \
+        }                                                                                                               \
+                                                                                                                        \
+        type* source = data;                                                                                            \
+        type* destination = scratch;                                                                                    \
+        for (size_t pass = 0; pass < NC_INTERNAL_RADIX_SORT_PASSES; ++pass) {                                           \
+            size_t* const pass_counts = counts[pass];                                                                   \
+                                                                                                                        \
+            /* Turn counts into bucket offsets, skipping the pass if all keys fall into one bucket */                   \
+            bool is_trivial = false;                                                                                    \
+            size_t offset = 0;                                                                                          \
+            for (size_t bucket = 0; bucket < NC_INTERNAL_RADIX_SORT_BUCKETS; ++bucket) {                                \
+                const size_t bucket_count = pass_counts[bucket];                                                        \
+                if (bucket_count == count) {                                                                            \
+                    is_trivial = true;                                                                                  \
+                    break;                                                                                              \
+                }                                                                                                       \
+                                                                                                                        \
+                pass_counts[bucket] = offset;                                                                           \
+                offset += bucket_count;                                                                                 \
+            }                                                                                                           \
+            if (is_trivial)                                                                                             \
+                continue;                                                                                               \
+                                                                                                                        \
+            for (size_t i = 0; i < count; ++i) {                                                                        \
+                const size_t bucket = (key_fn(&source[i]) >> (pass * 8)) & 0xFF;                                        \
+                destination[pass_counts[bucket]++] = source[i];                                                         \
+            }                                                                                                           \
+                                                                                                                        \
+            type* const tmp = source;                                                                                   \
+            source = destination;                                                                                       \
+            destination = tmp;                                                                                          \
+        }                                                                                                               \
+                                                                                                                        \
+        if (source != data)                                                                                             \
+            memcpy(data, source, count * sizeof(type));                                                                 \
+    }
+
+/**
+ * @brief Macro that emits external definitions of the functions generated by @ref NC_DEFINE_RADIX_SORT()
+ *
+ * Must be used in exactly one translation unit, after @ref NC_DEFINE_RADIX_SORT() with the same arguments.
+*/
+#define NC_INSTANTIATE_RADIX_SORT(type, sort_snake_case)                                                                \
+    extern inline void NC_INTERNAL_RADIX_SORT_FUNCTION_NAME(sort_snake_case)(type* data, size_t count, type* scratch);
+
+/**
+ * @brief Maps signed integer to unsigned key with the same ordering, for @ref NC_DEFINE_RADIX_SORT()
+*/
+inline uint64_t nc_radix_key_i64(int64_t value) {
+    return (uint64_t)value ^ ((uint64_t)1 << 63);
+}
+
+/**
+ * @brief Maps signed integer to unsigned key with the same ordering, for @ref NC_DEFINE_RADIX_SORT()
+*/
+inline uint64_t nc_radix_key_i32(int32_t value) {
+    return (uint32_t)value ^ ((uint32_t)1 << 31);
+}
+
+/**
+ * @brief Maps floating point number to unsigned key with the same ordering, for @ref NC_DEFINE_RADIX_SORT()
+ *
+ * Negative zero is ordered before positive zero, NaNs are ordered after infinity of the same sign.
+*/
+inline uint64_t nc_radix_key_f64(double value) {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+
+    /* Flip all bits of negative numbers to reverse their order, and only the sign bit of positive ones */
+    const uint64_t mask = (uint64_t)-(int64_t)(bits >> 63) | ((uint64_t)1 << 63);
+
+    return bits ^ mask;
+}
+
+/**
+ * @brief Maps floating point number to unsigned key with the same ordering, for @ref NC_DEFINE_RADIX_SORT()
+ *
+ * Negative zero is ordered before positive zero, NaNs are ordered after infinity of the same sign.
+*/
+inline uint64_t nc_radix_key_f32(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+
+    const uint32_t mask = (uint32_t)-(int32_t)(bits >> 31) | ((uint32_t)1 << 31);
+
+    return bits ^ mask;
+}
+
+#define NC_INTERNAL_RADIX_SORT_KEY_U32(value) ((uint64_t)*(value))
+#define NC_INTERNAL_RADIX_SORT_KEY_U64(value) (*(value))
+#define NC_INTERNAL_RADIX_SORT_KEY_I32(value) nc_radix_key_i32(*(value))
+#define NC_INTERNAL_RADIX_SORT_KEY_I64(value) nc_radix_key_i64(*(value))
+#define NC_INTERNAL_RADIX_SORT_KEY_F32(value) nc_radix_key_f32(*(value))
+#define NC_INTERNAL_RADIX_SORT_KEY_F64(value) nc_radix_key_f64(*(value))
+
+/*
+    Radix sorts of arithmetic types in ascending order:
+    nc_radix_sort_u32, nc_radix_sort_u64, nc_radix_sort_i32, nc_radix_sort_i64,
+    nc_radix_sort_f32, nc_radix_sort_f64 (with NaNs ordered as described in nc_radix_key_f64).
+*/
+NC_DEFINE_RADIX_SORT(uint32_t, u32, NC_INTERNAL_RADIX_SORT_KEY_U32)
+NC_DEFINE_RADIX_SORT(uint64_t, u64, NC_INTERNAL_RADIX_SORT_KEY_U64)
+NC_DEFINE_RADIX_SORT(int32_t, i32, NC_INTERNAL_RADIX_SORT_KEY_I32)
+NC_DEFINE_RADIX_SORT(int64_t, i64, NC_INTERNAL_RADIX_SORT_KEY_I64)
+NC_DEFINE_RADIX_SORT(float, f32, NC_INTERNAL_RADIX_SORT_KEY_F32)
+NC_DEFINE_RADIX_SORT(double, f64, NC_INTERNAL_RADIX_SORT_KEY_F64)
+
+/**
+ *  @}
+*/
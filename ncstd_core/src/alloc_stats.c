@@ -0,0 +1,243 @@
+#include "ncstd/alloc_stats.h"
+
+#ifdef NC_ALLOC_STATS
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "alloc_stats_record.h"
+
+
+#define MAX_SITE_COUNT 128
+#define BUCKET_COUNT 64
+
+static const uint32_t UNATTRIBUTED_SITE = 0;
+
+
+typedef struct {
+    uint64_t allocations;
+    uint64_t allocated_bytes;
+    uint64_t reallocations;
+    uint64_t realloc_copy_bytes;
+    uint64_t deallocations;
+    uint64_t freed_bytes;
+    uint64_t live_bytes;
+    uint64_t peak_live_bytes;
+} NC_AllocStatsCounters;
+
+static struct {
+    const char* site_names[MAX_SITE_COUNT];
+    NC_AllocStatsCounters sites[MAX_SITE_COUNT];
+    uint32_t site_count;
+
+    NC_AllocStatsCounters buckets[BUCKET_COUNT];
+    NC_AllocStatsCounters total;
+} stats = {
+    .site_names = { "(unattributed)" },
+    .site_count = 1
+};
+
+static atomic_flag stats_lock = ATOMIC_FLAG_INIT;
+
+static _Thread_local const char* current_site = NULL;
+
+
+static void nc_p_alloc_stats_lock() {
+    while (atomic_flag_test_and_set_explicit(&stats_lock, memory_order_acquire))
+        ;
+}
+
+static void nc_p_alloc_stats_unlock() {
+    atomic_flag_clear_explicit(&stats_lock, memory_order_release);
+}
+
+static size_t nc_p_alloc_stats_bucket(size_t size) {
+    size_t bucket = 0;
+    while (bucket + 1 < BUCKET_COUNT && ((size_t)1 << bucket) < size)
+        ++bucket;
+
+    return bucket;
+}
+
+static uint32_t nc_p_alloc_stats_site_index(const char* site) {
+    if (site == NULL)
+        return UNATTRIBUTED_SITE;
+
+    for (uint32_t i = 1; i < stats.site_count; ++i) {
+        if (stats.site_names[i] == site || strcmp(stats.site_names[i], site) == 0)
+            return i;
+    }
+
+    if (stats.site_count == MAX_SITE_COUNT)
+        return UNATTRIBUTED_SITE;
+
+    stats.site_names[stats.site_count] = site;
+
+    return stats.site_count++;
+}
+
+static void nc_p_alloc_stats_add_live(NC_AllocStatsCounters* counters, size_t size) {
+    counters->live_bytes += size;
+    if (counters->live_bytes > counters->peak_live_bytes)
+        counters->peak_live_bytes = counters->live_bytes;
+}
+
+static void nc_p_alloc_stats_sub_live(NC_AllocStatsCounters* counters, size_t size) {
+    // Memory allocated before a reset isn't accounted for
+    counters->live_bytes = counters->live_bytes > size ? counters->live_bytes - size : 0;
+}
+
+static void nc_p_alloc_stats_count_alloc(NC_AllocStatsCounters* counters, size_t size) {
+    counters->allocations += 1;
+    counters->allocated_bytes += size;
+    nc_p_alloc_stats_add_live(counters, size);
+}
+
+static void nc_p_alloc_stats_count_free(NC_AllocStatsCounters* counters, size_t size) {
+    counters->deallocations += 1;
+    counters->freed_bytes += size;
+    nc_p_alloc_stats_sub_live(counters, size);
+}
+
+static void nc_p_alloc_stats_count_realloc(NC_AllocStatsCounters* counters, size_t old_size, size_t new_size) {
+    counters->reallocations += 1;
+    counters->realloc_copy_bytes += old_size < new_size ? old_size : new_size;
+}
+
+static void nc_p_alloc_stats_write_counters(FILE* stream, const NC_AllocStatsCounters* counters) {
+    fprintf(
+        stream,
+        "\"allocations\":%llu,\"allocated_bytes\":%llu,\"reallocations\":%llu,\"realloc_copy_bytes\":%llu,"
+        "\"deallocations\":%llu,\"freed_bytes\":%llu,\"live_bytes\":%llu,\"peak_live_bytes\":%llu",
+        (unsigned long long)counters->allocations,
+        (unsigned long long)counters->allocated_bytes,
+        (unsigned long long)counters->reallocations,
+        (unsigned long long)counters->realloc_copy_bytes,
+        (unsigned long long)counters->deallocations,
+        (unsigned long long)counters->freed_bytes,
+        (unsigned long long)counters->live_bytes,
+        (unsigned long long)counters->peak_live_bytes
+    );
+}
+
+
+const char* nc_internal_alloc_stats_enter_site(const char* site) {
+    const char* const previous_site = current_site;
+
+    // The outermost instrumented function owns the allocations made by the functions it calls
+    if (current_site == NULL)
+        current_site = site;
+
+    return previous_site;
+}
+
+void nc_internal_alloc_stats_leave_site(const char* previous_site) {
+    current_site = previous_site;
+}
+
+uint32_t nc_p_alloc_stats_record_alloc(size_t size) {
+    nc_p_alloc_stats_lock();
+
+    const uint32_t site = nc_p_alloc_stats_site_index(current_site);
+    nc_p_alloc_stats_count_alloc(&stats.sites[site], size);
+    nc_p_alloc_stats_count_alloc(&stats.buckets[nc_p_alloc_stats_bucket(size)], size);
+    nc_p_alloc_stats_count_alloc(&stats.total, size);
+
+    nc_p_alloc_stats_unlock();
+
+    return site;
+}
+
+uint32_t nc_p_alloc_stats_record_realloc(uint32_t site, size_t old_size, size_t new_size) {
+    nc_p_alloc_stats_lock();
+
+    // Reallocated memory is moved to the site that reallocated it
+    const uint32_t new_site = nc_p_alloc_stats_site_index(current_site);
+    nc_p_alloc_stats_sub_live(&stats.sites[site], old_size);
+    nc_p_alloc_stats_add_live(&stats.sites[new_site], new_size);
+    nc_p_alloc_stats_count_realloc(&stats.sites[new_site], old_size, new_size);
+
+    NC_AllocStatsCounters* const old_bucket = &stats.buckets[nc_p_alloc_stats_bucket(old_size)];
+    NC_AllocStatsCounters* const new_bucket = &stats.buckets[nc_p_alloc_stats_bucket(new_size)];
+    nc_p_alloc_stats_sub_live(old_bucket, old_size);
+    nc_p_alloc_stats_add_live(new_bucket, new_size);
+    nc_p_alloc_stats_count_realloc(new_bucket, old_size, new_size);
+
+    nc_p_alloc_stats_sub_live(&stats.total, old_size);
+    nc_p_alloc_stats_add_live(&stats.total, new_size);
+    nc_p_alloc_stats_count_realloc(&stats.total, old_size, new_size);
+
+    nc_p_alloc_stats_unlock();
+
+    return new_site;
+}
+
+void nc_p_alloc_stats_record_free(uint32_t site, size_t size) {
+    nc_p_alloc_stats_lock();
+
+    nc_p_alloc_stats_count_free(&stats.sites[site], size);
+    nc_p_alloc_stats_count_free(&stats.buckets[nc_p_alloc_stats_bucket(size)], size);
+    nc_p_alloc_stats_count_free(&stats.total, size);
+
+    nc_p_alloc_stats_unlock();
+}
+
+void nc_alloc_stats_dump(FILE* stream) {
+    nc_p_alloc_stats_lock();
+
+    fprintf(stream, "{\"enabled\":true,\"total\":{");
+    nc_p_alloc_stats_write_counters(stream, &stats.total);
+
+    fprintf(stream, "},\"sites\":[");
+    bool is_first = true;
+    for (uint32_t i = 0; i < stats.site_count; ++i) {
+        if (stats.sites[i].allocations == 0 && stats.sites[i].reallocations == 0 && stats.sites[i].deallocations == 0)
+            continue;
+
+        fprintf(stream, "%s{\"site\":\"%s\",", is_first ? "" : ",", stats.site_names[i]);
+        nc_p_alloc_stats_write_counters(stream, &stats.sites[i]);
+        fprintf(stream, "}");
+
+        is_first = false;
+    }
+
+    fprintf(stream, "],\"buckets\":[");
+    is_first = true;
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        if (stats.buckets[i].allocations == 0 && stats.buckets[i].reallocations == 0 && stats.buckets[i].deallocations == 0)
+            continue;
+
+        fprintf(stream, "%s{\"max_size\":%llu,", is_first ? "" : ",", (unsigned long long)((uint64_t)1 << i));
+        nc_p_alloc_stats_write_counters(stream, &stats.buckets[i]);
+        fprintf(stream, "}");
+
+        is_first = false;
+    }
+
+    fprintf(stream, "]}\n");
+
+    nc_p_alloc_stats_unlock();
+}
+
+void nc_alloc_stats_reset() {
+    nc_p_alloc_stats_lock();
+
+    memset(stats.sites, 0, sizeof stats.sites);
+    memset(stats.buckets, 0, sizeof stats.buckets);
+    memset(&stats.total, 0, sizeof stats.total);
+
+    nc_p_alloc_stats_unlock();
+}
+
+#else
+
+void nc_alloc_stats_dump(FILE* stream) {
+    fprintf(stream, "{\"enabled\":false}\n");
+}
+
+void nc_alloc_stats_reset() {
+}
+
+#endif
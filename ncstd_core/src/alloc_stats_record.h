@@ -0,0 +1,12 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+// Recording hooks used by the default allocator when NC_ALLOC_STATS is defined.
+// Each allocation remembers the site index returned by the hook that created it.
+
+uint32_t nc_p_alloc_stats_record_alloc(size_t size);
+uint32_t nc_p_alloc_stats_record_realloc(uint32_t site, size_t old_size, size_t new_size);
+void nc_p_alloc_stats_record_free(uint32_t site, size_t size);
@@ -0,0 +1,147 @@
+#include "ncstd/allocator.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ncstd/memory.h"
+
+#ifdef NC_ALLOC_STATS
+#include "alloc_stats_record.h"
+#endif
+
+
+static bool nc_p_default_allocator_is_overaligned(size_t alignment) {
+    return alignment > NC_DEFAULT_ALIGNMENT;
+}
+
+static void* nc_p_default_allocator_raw_alloc(size_t size, size_t alignment) {
+    if (nc_p_default_allocator_is_overaligned(alignment))
+        return nc_malloc_aligned(size, alignment);
+
+    return nc_malloc(size);
+}
+
+static bool nc_p_default_allocator_raw_realloc(void** in_out_ptr, size_t new_size, size_t alignment) {
+    if (nc_p_default_allocator_is_overaligned(alignment))
+        return nc_realloc_aligned_preserving(in_out_ptr, new_size, alignment);
+
+    return nc_realloc_preserving(in_out_ptr, new_size);
+}
+
+static void nc_p_default_allocator_raw_free(void* ptr, size_t alignment) {
+    if (nc_p_default_allocator_is_overaligned(alignment))
+        nc_free_aligned(ptr);
+    else
+        nc_free(ptr);
+}
+
+
+#ifdef NC_ALLOC_STATS
+
+// Every allocation is prefixed with the index of the call site that owns it,
+// header takes the whole alignment, so that the data stays aligned
+static size_t nc_p_default_allocator_header_size(size_t alignment) {
+    return nc_p_default_allocator_is_overaligned(alignment) ? alignment : NC_DEFAULT_ALIGNMENT;
+}
+
+static uint32_t* nc_p_default_allocator_site(void* ptr, size_t alignment) {
+    return (uint32_t*)((uint8_t*)ptr - nc_p_default_allocator_header_size(alignment));
+}
+
+static void* nc_p_default_allocator_alloc(NC_Allocator* allocator, size_t size, size_t alignment) {
+    (void)allocator;
+
+    const size_t header_size = nc_p_default_allocator_header_size(alignment);
+
+    uint8_t* const base = nc_p_default_allocator_raw_alloc(header_size + size, alignment);
+    if (base == NULL)
+        return NULL;
+
+    void* const ptr = base + header_size;
+    *nc_p_default_allocator_site(ptr, alignment) = nc_p_alloc_stats_record_alloc(size);
+
+    return ptr;
+}
+
+static void* nc_p_default_allocator_realloc(NC_Allocator* allocator, void* ptr, size_t old_size, size_t new_size, size_t alignment) {
+    (void)allocator;
+
+    const size_t header_size = nc_p_default_allocator_header_size(alignment);
+
+    void* base = (uint8_t*)ptr - header_size;
+    if (!nc_p_default_allocator_raw_realloc(&base, header_size + new_size, alignment))
+        return NULL;
+
+    void* const new_ptr = (uint8_t*)base + header_size;
+    uint32_t* const site = nc_p_default_allocator_site(new_ptr, alignment);
+    *site = nc_p_alloc_stats_record_realloc(*site, old_size, new_size);
+
+    return new_ptr;
+}
+
+static void nc_p_default_allocator_free(NC_Allocator* allocator, void* ptr, size_t size, size_t alignment) {
+    (void)allocator;
+
+    nc_p_alloc_stats_record_free(*nc_p_default_allocator_site(ptr, alignment), size);
+    nc_p_default_allocator_raw_free((uint8_t*)ptr - nc_p_default_allocator_header_size(alignment), alignment);
+}
+
+#else
+
+static void* nc_p_default_allocator_alloc(NC_Allocator* allocator, size_t size, size_t alignment) {
+    (void)allocator;
+
+    return nc_p_default_allocator_raw_alloc(size, alignment);
+}
+
+static void* nc_p_default_allocator_realloc(NC_Allocator* allocator, void* ptr, size_t old_size, size_t new_size, size_t alignment) {
+    (void)allocator;
+    (void)old_size;
+
+    if (!nc_p_default_allocator_raw_realloc(&ptr, new_size, alignment))
+        return NULL;
+
+    return ptr;
+}
+
+static void nc_p_default_allocator_free(NC_Allocator* allocator, void* ptr, size_t size, size_t alignment) {
+    (void)allocator;
+    (void)size;
+
+    nc_p_default_allocator_raw_free(ptr, alignment);
+}
+
+#endif
+
+static const NC_AllocatorVtable DEFAULT_ALLOCATOR_VTABLE = {
+    .alloc_fn = nc_p_default_allocator_alloc,
+    .realloc_fn = nc_p_default_allocator_realloc,
+    .free_fn = nc_p_default_allocator_free
+};
+
+static NC_Allocator DEFAULT_ALLOCATOR = {
+    .vtable = &DEFAULT_ALLOCATOR_VTABLE
+};
+
+
+NC_Allocator* nc_allocator_default() {
+    return &DEFAULT_ALLOCATOR;
+}
+
+void* nc_allocator_alloc(NC_Allocator* self, size_t size, size_t alignment) {
+    return self->vtable->alloc_fn(self, size, alignment);
+}
+
+void* nc_allocator_realloc(NC_Allocator* self, void* ptr, size_t old_size, size_t new_size, size_t alignment) {
+    if (ptr == NULL)
+        return nc_allocator_alloc(self, new_size, alignment);
+
+    return self->vtable->realloc_fn(self, ptr, old_size, new_size, alignment);
+}
+
+void nc_allocator_free(NC_Allocator* self, void* ptr, size_t size, size_t alignment) {
+    if (ptr == NULL)
+        return;
+
+    self->vtable->free_fn(self, ptr, size, alignment);
+}
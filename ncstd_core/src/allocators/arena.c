@@ -0,0 +1,190 @@
+#include "ncstd/allocators/arena.h"
+
+#include <stdbool.h>
+#include <string.h>
+
+
+struct NC_ArenaChunk {
+    NC_ArenaChunk* next;
+    size_t capacity;
+};
+
+static const size_t CHUNK_HEADER_SIZE =
+    (sizeof(NC_ArenaChunk) + NC_DEFAULT_ALIGNMENT - 1) / NC_DEFAULT_ALIGNMENT * NC_DEFAULT_ALIGNMENT;
+
+
+static uint8_t* nc_p_arena_align_up(uint8_t* ptr, size_t alignment) {
+    const uintptr_t address = (uintptr_t)ptr;
+
+    return ptr + (((address + alignment - 1) & ~(uintptr_t)(alignment - 1)) - address);
+}
+
+static uint8_t* nc_p_arena_chunk_data(NC_ArenaChunk* chunk) {
+    return (uint8_t*)chunk + CHUNK_HEADER_SIZE;
+}
+
+static bool nc_p_arena_fits(const NC_Arena* self, uint8_t* ptr, size_t size) {
+    return self->p.current != NULL && ptr <= self->p.end && size <= (size_t)(self->p.end - ptr);
+}
+
+static void nc_p_arena_use_chunk(NC_Arena* self, NC_ArenaChunk* chunk) {
+    self->p.current = chunk;
+    self->p.position = nc_p_arena_chunk_data(chunk);
+    self->p.end = self->p.position + chunk->capacity;
+}
+
+static bool nc_p_arena_advance_chunk(NC_Arena* self, size_t size, size_t alignment) {
+    const size_t required_capacity = size + alignment;
+
+    NC_ArenaChunk* const next = self->p.current ? self->p.current->next : self->p.first;
+    if (next != NULL && next->capacity >= required_capacity) {
+        nc_p_arena_use_chunk(self, next);
+
+        return true;
+    }
+
+    const size_t capacity = required_capacity < self->p.chunk_size ? self->p.chunk_size : required_capacity;
+    NC_ArenaChunk* const chunk = nc_allocator_alloc(self->p.backing, CHUNK_HEADER_SIZE + capacity, NC_DEFAULT_ALIGNMENT);
+    if (chunk == NULL)
+        return false;
+
+    chunk->next = next;
+    chunk->capacity = capacity;
+
+    if (self->p.current)
+        self->p.current->next = chunk;
+    else
+        self->p.first = chunk;
+
+    nc_p_arena_use_chunk(self, chunk);
+
+    return true;
+}
+
+static void* nc_p_arena_alloc_untyped(NC_Allocator* allocator, size_t size, size_t alignment) {
+    return nc_arena_alloc((NC_Arena*)allocator, size, alignment);
+}
+
+static void* nc_p_arena_realloc_untyped(NC_Allocator* allocator, void* ptr, size_t old_size, size_t new_size, size_t alignment) {
+    NC_Arena* const self = (NC_Arena*)allocator;
+    uint8_t* const bytes = ptr;
+
+    // The most recent allocation can be resized in place
+    if (bytes + old_size == self->p.position && nc_p_arena_fits(self, bytes, new_size)) {
+        self->p.position = bytes + new_size;
+
+        return ptr;
+    }
+
+    if (new_size <= old_size)
+        return ptr;
+
+    void* const new_ptr = nc_arena_alloc(self, new_size, alignment);
+    if (new_ptr == NULL)
+        return NULL;
+
+    memcpy(new_ptr, ptr, old_size);
+
+    return new_ptr;
+}
+
+static void nc_p_arena_free_untyped(NC_Allocator* allocator, void* ptr, size_t size, size_t alignment) {
+    NC_Arena* const self = (NC_Arena*)allocator;
+    uint8_t* const bytes = ptr;
+    (void)alignment;
+
+    // Only the most recent allocation can be given back
+    if (bytes + size == self->p.position)
+        self->p.position = bytes;
+}
+
+static const NC_AllocatorVtable ARENA_ALLOCATOR_VTABLE = {
+    .alloc_fn = nc_p_arena_alloc_untyped,
+    .realloc_fn = nc_p_arena_realloc_untyped,
+    .free_fn = nc_p_arena_free_untyped
+};
+
+
+NC_Allocator* nc_arena_allocator(NC_Arena* self) {
+    return &self->allocator;
+}
+
+void* nc_arena_alloc(NC_Arena* self, size_t size, size_t alignment) {
+    uint8_t* ptr = nc_p_arena_align_up(self->p.position, alignment);
+    if (!nc_p_arena_fits(self, ptr, size)) {
+        if (!nc_p_arena_advance_chunk(self, size, alignment))
+            return NULL;
+
+        ptr = nc_p_arena_align_up(self->p.position, alignment);
+    }
+
+    self->p.position = ptr + size;
+
+    return ptr;
+}
+
+NC_ArenaMark nc_arena_mark(const NC_Arena* self) {
+    return (NC_ArenaMark) {
+        .p = {
+            .chunk = self->p.current,
+            .position = self->p.position
+        }
+    };
+}
+
+void nc_arena_reset_to_mark(NC_Arena* self, NC_ArenaMark mark) {
+    if (mark.p.chunk == NULL) {
+        nc_arena_reset(self);
+
+        return;
+    }
+
+    self->p.current = mark.p.chunk;
+    self->p.position = mark.p.position;
+    self->p.end = nc_p_arena_chunk_data(mark.p.chunk) + mark.p.chunk->capacity;
+}
+
+void nc_arena_reset(NC_Arena* self) {
+    self->p.current = NULL;
+    self->p.position = NULL;
+    self->p.end = NULL;
+}
+
+
+NC_Arena nc_arena_init() {
+    return nc_arena_init_with_chunk_size(NC_ARENA_DEFAULT_CHUNK_SIZE);
+}
+
+NC_Arena nc_arena_init_with_chunk_size(size_t chunk_size) {
+    return nc_arena_init_with_chunk_size_in(chunk_size, nc_allocator_default());
+}
+
+NC_Arena nc_arena_init_with_chunk_size_in(size_t chunk_size, NC_Allocator* backing) {
+    return (NC_Arena) {
+        .allocator = { .vtable = &ARENA_ALLOCATOR_VTABLE },
+        .p = {
+            .first = NULL,
+            .current = NULL,
+            .position = NULL,
+            .end = NULL,
+            .chunk_size = chunk_size,
+            .backing = backing
+        }
+    };
+}
+
+void nc_arena_destroy(NC_Arena* self) {
+    if (!self)
+        return;
+
+    NC_ArenaChunk* chunk = self->p.first;
+    while (chunk != NULL) {
+        NC_ArenaChunk* const next = chunk->next;
+        nc_allocator_free(self->p.backing, chunk, CHUNK_HEADER_SIZE + chunk->capacity, NC_DEFAULT_ALIGNMENT);
+
+        chunk = next;
+    }
+
+    self->p.first = NULL;
+    nc_arena_reset(self);
+}
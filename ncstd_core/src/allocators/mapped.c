@@ -0,0 +1,200 @@
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
+#include "ncstd/allocators/mapped.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "ncstd/util/panic_handlers.h"
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+
+#ifdef __linux__
+
+// Every allocation is preceded by a header storing its mapping, the data is placed
+// at an offset that keeps the requested alignment.
+typedef struct {
+    void* mapping;
+    size_t mapping_size;
+} NC_MappingHeader;
+
+static size_t nc_p_mapped_header_size(size_t alignment) {
+    return alignment < NC_DEFAULT_ALIGNMENT ? NC_DEFAULT_ALIGNMENT : alignment;
+}
+
+static size_t nc_p_mapped_page_size() {
+    static size_t page_size = 0;
+    if (page_size == 0)
+        page_size = (size_t)sysconf(_SC_PAGESIZE);
+
+    return page_size;
+}
+
+static size_t nc_p_mapped_round_to_pages(size_t size) {
+    const size_t page_size = nc_p_mapped_page_size();
+
+    return (size + page_size - 1) / page_size * page_size;
+}
+
+// Mappings are only page aligned, larger alignments need room to move the data forward
+static size_t nc_p_mapped_max_offset(size_t alignment) {
+    const size_t page_size = nc_p_mapped_page_size();
+
+    return nc_p_mapped_header_size(alignment) + (alignment > page_size ? alignment - page_size : 0);
+}
+
+static uint8_t* nc_p_mapped_data(void* mapping, size_t alignment) {
+    const uintptr_t address = (uintptr_t)mapping + nc_p_mapped_header_size(alignment);
+
+    return (uint8_t*)((address + alignment - 1) & ~(uintptr_t)(alignment - 1));
+}
+
+static NC_MappingHeader* nc_p_mapped_header(void* ptr, size_t alignment) {
+    return (NC_MappingHeader*)((uint8_t*)ptr - nc_p_mapped_header_size(alignment));
+}
+
+static void nc_p_mapped_advise(const NC_MappedAllocator* self, void* mapping, size_t mapping_size) {
+#ifdef MADV_HUGEPAGE
+    if (self->p.flags & NC_MAPPED_ALLOCATOR_HUGE_PAGES)
+        madvise(mapping, mapping_size, MADV_HUGEPAGE);
+#else
+    (void)self;
+    (void)mapping;
+    (void)mapping_size;
+#endif
+}
+
+static void* nc_p_mapped_alloc_untyped(NC_Allocator* allocator, size_t size, size_t alignment) {
+    NC_MappedAllocator* const self = (NC_MappedAllocator*)allocator;
+
+    const size_t mapping_size = nc_p_mapped_round_to_pages(nc_p_mapped_max_offset(alignment) + size);
+
+    void* const mapping = mmap(NULL, mapping_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapping == MAP_FAILED) {
+        nc_handle_out_of_memory();
+
+        return NULL;
+    }
+
+    nc_p_mapped_advise(self, mapping, mapping_size);
+
+    uint8_t* const data = nc_p_mapped_data(mapping, alignment);
+    *nc_p_mapped_header(data, alignment) = (NC_MappingHeader) { .mapping = mapping, .mapping_size = mapping_size };
+
+    return data;
+}
+
+static void* nc_p_mapped_realloc_untyped(NC_Allocator* allocator, void* ptr, size_t old_size, size_t new_size, size_t alignment) {
+    NC_MappedAllocator* const self = (NC_MappedAllocator*)allocator;
+
+    NC_MappingHeader* const header = nc_p_mapped_header(ptr, alignment);
+    uint8_t* const mapping = header->mapping;
+    const size_t mapping_size = header->mapping_size;
+    const size_t offset = (size_t)((uint8_t*)ptr - mapping);
+
+    const size_t new_mapping_size = nc_p_mapped_round_to_pages(offset + new_size);
+    if (new_mapping_size == mapping_size)
+        return ptr;
+
+    if (new_mapping_size < mapping_size) {
+        if (self->p.flags & NC_MAPPED_ALLOCATOR_DONTNEED_ON_SHRINK) {
+            madvise(mapping + new_mapping_size, mapping_size - new_mapping_size, MADV_DONTNEED);
+
+            return ptr;
+        }
+
+        if (mremap(mapping, mapping_size, new_mapping_size, 0) != MAP_FAILED)
+            header->mapping_size = new_mapping_size;
+
+        return ptr;
+    }
+
+    // Grows to the size of a new allocation, in case data has to be moved to keep its alignment
+    const size_t grown_mapping_size = nc_p_mapped_round_to_pages(nc_p_mapped_max_offset(alignment) + new_size);
+    uint8_t* const new_mapping = mremap(mapping, mapping_size, grown_mapping_size, MREMAP_MAYMOVE);
+    if (new_mapping == MAP_FAILED) {
+        nc_handle_out_of_memory();
+
+        return NULL;
+    }
+
+    nc_p_mapped_advise(self, new_mapping, grown_mapping_size);
+
+    uint8_t* const data = nc_p_mapped_data(new_mapping, alignment);
+    if (data != new_mapping + offset)
+        memmove(data, new_mapping + offset, old_size);
+    *nc_p_mapped_header(data, alignment) = (NC_MappingHeader) { .mapping = new_mapping, .mapping_size = grown_mapping_size };
+
+    return data;
+}
+
+static void nc_p_mapped_free_untyped(NC_Allocator* allocator, void* ptr, size_t size, size_t alignment) {
+    (void)allocator;
+    (void)size;
+
+    const NC_MappingHeader* const header = nc_p_mapped_header(ptr, alignment);
+    munmap(header->mapping, header->mapping_size);
+}
+
+#else
+
+static void* nc_p_mapped_alloc_untyped(NC_Allocator* allocator, size_t size, size_t alignment) {
+    (void)allocator;
+
+    return nc_allocator_alloc(nc_allocator_default(), size, alignment);
+}
+
+static void* nc_p_mapped_realloc_untyped(NC_Allocator* allocator, void* ptr, size_t old_size, size_t new_size, size_t alignment) {
+    (void)allocator;
+
+    return nc_allocator_realloc(nc_allocator_default(), ptr, old_size, new_size, alignment);
+}
+
+static void nc_p_mapped_free_untyped(NC_Allocator* allocator, void* ptr, size_t size, size_t alignment) {
+    (void)allocator;
+
+    nc_allocator_free(nc_allocator_default(), ptr, size, alignment);
+}
+
+#endif
+
+static const NC_AllocatorVtable MAPPED_ALLOCATOR_VTABLE = {
+    .alloc_fn = nc_p_mapped_alloc_untyped,
+    .realloc_fn = nc_p_mapped_realloc_untyped,
+    .free_fn = nc_p_mapped_free_untyped
+};
+
+static NC_MappedAllocator DEFAULT_MAPPED_ALLOCATOR = {
+    .allocator = { .vtable = &MAPPED_ALLOCATOR_VTABLE },
+    .p = { .flags = 0 }
+};
+
+
+NC_Allocator* nc_mapped_allocator_default() {
+    return &DEFAULT_MAPPED_ALLOCATOR.allocator;
+}
+
+bool nc_mapped_allocator_is_supported() {
+#ifdef __linux__
+    return true;
+#else
+    return false;
+#endif
+}
+
+NC_Allocator* nc_mapped_allocator_allocator(NC_MappedAllocator* self) {
+    return &self->allocator;
+}
+
+NC_MappedAllocator nc_mapped_allocator_init(unsigned flags) {
+    return (NC_MappedAllocator) {
+        .allocator = { .vtable = &MAPPED_ALLOCATOR_VTABLE },
+        .p = { .flags = flags }
+    };
+}
@@ -0,0 +1,178 @@
+#include "ncstd/allocators/pool.h"
+
+#include <stdbool.h>
+#include <string.h>
+
+
+struct NC_PoolSlab {
+    NC_PoolSlab* next;
+};
+
+struct NC_PoolFreeNode {
+    NC_PoolFreeNode* next;
+};
+
+static const size_t SLAB_HEADER_SIZE =
+    (sizeof(NC_PoolSlab) + NC_DEFAULT_ALIGNMENT - 1) / NC_DEFAULT_ALIGNMENT * NC_DEFAULT_ALIGNMENT;
+
+
+static bool nc_p_pool_is_pooled(size_t size, size_t alignment) {
+    return size <= NC_POOL_MAX_OBJECT_SIZE && alignment <= NC_DEFAULT_ALIGNMENT;
+}
+
+static size_t nc_p_pool_size_class(size_t size) {
+    if (size == 0)
+        return 0;
+
+    return (size - 1) / NC_POOL_SIZE_CLASS_GRANULARITY;
+}
+
+static size_t nc_p_pool_size_class_size(size_t size_class) {
+    return (size_class + 1) * NC_POOL_SIZE_CLASS_GRANULARITY;
+}
+
+static bool nc_p_pool_add_slab(NC_Pool* self) {
+    NC_PoolSlab* const slab = nc_allocator_alloc(self->p.backing, NC_POOL_SLAB_SIZE, NC_DEFAULT_ALIGNMENT);
+    if (slab == NULL)
+        return false;
+
+    slab->next = self->p.slabs;
+    self->p.slabs = slab;
+
+    self->p.position = (uint8_t*)slab + SLAB_HEADER_SIZE;
+    self->p.end = (uint8_t*)slab + NC_POOL_SLAB_SIZE;
+
+    return true;
+}
+
+static void* nc_p_pool_carve(NC_Pool* self, size_t object_size) {
+    if (self->p.slabs == NULL || (size_t)(self->p.end - self->p.position) < object_size) {
+        if (!nc_p_pool_add_slab(self))
+            return NULL;
+    }
+
+    void* const object = self->p.position;
+    self->p.position += object_size;
+
+    return object;
+}
+
+static void* nc_p_pool_alloc_untyped(NC_Allocator* allocator, size_t size, size_t alignment) {
+    NC_Pool* const self = (NC_Pool*)allocator;
+
+    if (!nc_p_pool_is_pooled(size, alignment))
+        return nc_allocator_alloc(self->p.backing, size, alignment);
+
+    return nc_pool_alloc(self, size);
+}
+
+static void* nc_p_pool_realloc_untyped(NC_Allocator* allocator, void* ptr, size_t old_size, size_t new_size, size_t alignment) {
+    NC_Pool* const self = (NC_Pool*)allocator;
+
+    const bool old_pooled = nc_p_pool_is_pooled(old_size, alignment);
+    const bool new_pooled = nc_p_pool_is_pooled(new_size, alignment);
+
+    if (!old_pooled && !new_pooled)
+        return nc_allocator_realloc(self->p.backing, ptr, old_size, new_size, alignment);
+
+    if (old_pooled && new_pooled && nc_p_pool_size_class(old_size) == nc_p_pool_size_class(new_size))
+        return ptr;
+
+    void* const new_ptr = nc_p_pool_alloc_untyped(allocator, new_size, alignment);
+    if (new_ptr == NULL)
+        return NULL;
+
+    memcpy(new_ptr, ptr, old_size < new_size ? old_size : new_size);
+    nc_allocator_free(allocator, ptr, old_size, alignment);
+
+    return new_ptr;
+}
+
+static void nc_p_pool_free_untyped(NC_Allocator* allocator, void* ptr, size_t size, size_t alignment) {
+    NC_Pool* const self = (NC_Pool*)allocator;
+
+    if (!nc_p_pool_is_pooled(size, alignment)) {
+        nc_allocator_free(self->p.backing, ptr, size, alignment);
+
+        return;
+    }
+
+    nc_pool_free(self, ptr, size);
+}
+
+static const NC_AllocatorVtable POOL_ALLOCATOR_VTABLE = {
+    .alloc_fn = nc_p_pool_alloc_untyped,
+    .realloc_fn = nc_p_pool_realloc_untyped,
+    .free_fn = nc_p_pool_free_untyped
+};
+
+
+NC_Allocator* nc_pool_allocator(NC_Pool* self) {
+    return &self->allocator;
+}
+
+void* nc_pool_alloc(NC_Pool* self, size_t size) {
+    if (size > NC_POOL_MAX_OBJECT_SIZE)
+        return nc_allocator_alloc(self->p.backing, size, NC_DEFAULT_ALIGNMENT);
+
+    const size_t size_class = nc_p_pool_size_class(size);
+
+    NC_PoolFreeNode* const node = self->p.free_lists[size_class];
+    if (node != NULL) {
+        self->p.free_lists[size_class] = node->next;
+
+        return node;
+    }
+
+    return nc_p_pool_carve(self, nc_p_pool_size_class_size(size_class));
+}
+
+void nc_pool_free(NC_Pool* self, void* ptr, size_t size) {
+    if (ptr == NULL)
+        return;
+
+    if (size > NC_POOL_MAX_OBJECT_SIZE) {
+        nc_allocator_free(self->p.backing, ptr, size, NC_DEFAULT_ALIGNMENT);
+
+        return;
+    }
+
+    const size_t size_class = nc_p_pool_size_class(size);
+
+    NC_PoolFreeNode* const node = ptr;
+    node->next = self->p.free_lists[size_class];
+    self->p.free_lists[size_class] = node;
+}
+
+
+NC_Pool nc_pool_init() {
+    return nc_pool_init_in(nc_allocator_default());
+}
+
+NC_Pool nc_pool_init_in(NC_Allocator* backing) {
+    return (NC_Pool) {
+        .allocator = { .vtable = &POOL_ALLOCATOR_VTABLE },
+        .p = {
+            .free_lists = { NULL },
+            .slabs = NULL,
+            .position = NULL,
+            .end = NULL,
+            .backing = backing
+        }
+    };
+}
+
+void nc_pool_destroy(NC_Pool* self) {
+    if (!self)
+        return;
+
+    NC_PoolSlab* slab = self->p.slabs;
+    while (slab != NULL) {
+        NC_PoolSlab* const next = slab->next;
+        nc_allocator_free(self->p.backing, slab, NC_POOL_SLAB_SIZE, NC_DEFAULT_ALIGNMENT);
+
+        slab = next;
+    }
+
+    *self = nc_pool_init_in(self->p.backing);
+}
@@ -0,0 +1,257 @@
+#include "ncstd/containers/bit_set.h"
+
+#include <string.h>
+
+#include "ncstd/alloc_stats.h"
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+
+// Alignment of a 256-bit block
+#define NC_P_BIT_SET_ALIGNMENT (NC_BIT_SET_BLOCK_WORDS * sizeof(uint64_t))
+
+static size_t nc_p_bit_set_word_count(size_t size) {
+    return (size + NC_BIT_SET_WORD_BITS - 1) / NC_BIT_SET_WORD_BITS;
+}
+
+static size_t nc_p_bit_set_block_word_count(size_t size) {
+    const size_t word_count = nc_p_bit_set_word_count(size);
+
+    return (word_count + NC_BIT_SET_BLOCK_WORDS - 1) / NC_BIT_SET_BLOCK_WORDS * NC_BIT_SET_BLOCK_WORDS;
+}
+
+static uint64_t* nc_p_bit_set_words(const NC_BitSet* self) {
+    return nc_raw_buffer_data(&self->p.raw_buffer);
+}
+
+static size_t nc_p_bit_set_capacity_words(const NC_BitSet* self) {
+    return nc_raw_buffer_capacity(&self->p.raw_buffer);
+}
+
+static uint32_t nc_p_bit_set_ctz(uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (uint32_t)__builtin_ctzll(word);
+#else
+    uint32_t index = 0;
+    while (!(word & 1)) {
+        word >>= 1;
+        index += 1;
+    }
+
+    return index;
+#endif
+}
+
+static size_t nc_p_bit_set_popcount(uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (size_t)__builtin_popcountll(word);
+#else
+    word = word - ((word >> 1) & 0x5555555555555555ull);
+    word = (word & 0x3333333333333333ull) + ((word >> 2) & 0x3333333333333333ull);
+    word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+
+    return (size_t)((word * 0x0101010101010101ull) >> 56);
+#endif
+}
+
+// Clears bits past the size in the last word, to keep all bits past the size zeroed
+static void nc_p_bit_set_clear_tail(NC_BitSet* self) {
+    const size_t used_bits = self->p.size % NC_BIT_SET_WORD_BITS;
+    if (used_bits != 0)
+        nc_p_bit_set_words(self)[self->p.size / NC_BIT_SET_WORD_BITS] &= (UINT64_C(1) << used_bits) - 1;
+}
+
+// Applies operation to whole blocks of both bit sets, 256 bits at a time
+#ifdef __AVX2__
+#define NC_P_BIT_SET_BULK_OP(name, vector_op, scalar_op)                                                                \
+    void nc_bit_set_##name(NC_BitSet* self, const NC_BitSet* other) {                                                   \
+        uint64_t* const words = nc_p_bit_set_words(self);                                                               \
+        const uint64_t* const other_words = nc_p_bit_set_words(other);                                                  \
+        const size_t word_count = nc_p_bit_set_block_word_count(self->p.size);                                          \
+                                                                                                                        \
+        for (size_t i = 0; i < word_count; i += NC_BIT_SET_BLOCK_WORDS) {                                               \
+            const __m256i a = _mm256_load_si256((const __m256i*)(words + i));                                           \
+            const __m256i b = _mm256_load_si256((const __m256i*)(other_words + i));                                     \
+            _mm256_store_si256((__m256i*)(words + i), vector_op);                                                       \
+        }                                                                                                               \
+    }
+#else
+#define NC_P_BIT_SET_BULK_OP(name, vector_op, scalar_op)                                                                \
+    void nc_bit_set_##name(NC_BitSet* self, const NC_BitSet* other) {                                                   \
+        uint64_t* const words = nc_p_bit_set_words(self);                                                               \
+        const uint64_t* const other_words = nc_p_bit_set_words(other);                                                  \
+        const size_t word_count = nc_p_bit_set_block_word_count(self->p.size);                                          \
+                                                                                                                        \
+        for (size_t i = 0; i < word_count; ++i) {                                                                       \
+            const uint64_t a = words[i];                                                                                \
+            const uint64_t b = other_words[i];                                                                          \
+            words[i] = scalar_op;                                                                                       \
+        }                                                                                                               \
+    }
+#endif
+
+
+NC_BitSet nc_bit_set_init() {
+    return nc_bit_set_init_in(nc_allocator_default());
+}
+
+NC_BitSet nc_bit_set_init_in(NC_Allocator* allocator) {
+    return (NC_BitSet) {
+        .p = {
+            .raw_buffer = nc_raw_buffer_init_aligned_in(sizeof(uint64_t), NC_P_BIT_SET_ALIGNMENT, allocator),
+            .size = 0
+        }
+    };
+}
+
+NC_BitSet nc_bit_set_init_with_size(size_t size) {
+    return nc_bit_set_init_with_size_in(size, nc_allocator_default());
+}
+
+NC_BitSet nc_bit_set_init_with_size_in(size_t size, NC_Allocator* allocator) {
+    NC_BitSet self = nc_bit_set_init_in(allocator);
+    nc_bit_set_resize(&self, size);
+
+    return self;
+}
+
+void nc_bit_set_destroy(NC_BitSet* self) {
+    NC_Allocator* const allocator = nc_raw_buffer_allocator(&self->p.raw_buffer);
+    nc_raw_buffer_free(&self->p.raw_buffer, sizeof(uint64_t));
+
+    *self = nc_bit_set_init_in(allocator);
+}
+
+size_t nc_bit_set_size(const NC_BitSet* self) {
+    return self->p.size;
+}
+
+const uint64_t* nc_bit_set_words(const NC_BitSet* self) {
+    return nc_p_bit_set_words(self);
+}
+
+bool nc_bit_set_resize(NC_BitSet* self, size_t new_size) {
+    const size_t old_word_count = nc_p_bit_set_word_count(self->p.size);
+    const size_t new_word_count = nc_p_bit_set_word_count(new_size);
+    const size_t old_capacity = nc_p_bit_set_capacity_words(self);
+    const size_t new_capacity = nc_p_bit_set_block_word_count(new_size);
+
+    if (new_capacity > old_capacity) {
+        NC_INTERNAL_ALLOC_STATS_SITE_ENTER();
+        nc_raw_buffer_resize_unchecked(&self->p.raw_buffer, new_capacity, sizeof(uint64_t));
+        NC_INTERNAL_ALLOC_STATS_SITE_LEAVE();
+        if (nc_p_bit_set_capacity_words(self) < new_capacity)
+            return false;
+
+        memset(nc_p_bit_set_words(self) + old_capacity, 0, (new_capacity - old_capacity) * sizeof(uint64_t));
+    }
+
+    // Words past the size are kept zeroed, so that growing needs no clearing
+    if (new_word_count < old_word_count)
+        memset(nc_p_bit_set_words(self) + new_word_count, 0, (old_word_count - new_word_count) * sizeof(uint64_t));
+
+    self->p.size = new_size;
+    nc_p_bit_set_clear_tail(self);
+
+    return true;
+}
+
+void nc_bit_set_set(NC_BitSet* self, size_t index) {
+    nc_p_bit_set_words(self)[index / NC_BIT_SET_WORD_BITS] |= UINT64_C(1) << (index % NC_BIT_SET_WORD_BITS);
+}
+
+void nc_bit_set_clear(NC_BitSet* self, size_t index) {
+    nc_p_bit_set_words(self)[index / NC_BIT_SET_WORD_BITS] &= ~(UINT64_C(1) << (index % NC_BIT_SET_WORD_BITS));
+}
+
+bool nc_bit_set_test(const NC_BitSet* self, size_t index) {
+    return (nc_p_bit_set_words(self)[index / NC_BIT_SET_WORD_BITS] >> (index % NC_BIT_SET_WORD_BITS)) & 1;
+}
+
+void nc_bit_set_set_all(NC_BitSet* self) {
+    if (self->p.size == 0)
+        return;
+
+    memset(nc_p_bit_set_words(self), 0xFF, nc_p_bit_set_word_count(self->p.size) * sizeof(uint64_t));
+    nc_p_bit_set_clear_tail(self);
+}
+
+void nc_bit_set_clear_all(NC_BitSet* self) {
+    if (self->p.size == 0)
+        return;
+
+    memset(nc_p_bit_set_words(self), 0, nc_p_bit_set_word_count(self->p.size) * sizeof(uint64_t));
+}
+
+NC_P_BIT_SET_BULK_OP(and, _mm256_and_si256(a, b), a & b)
+NC_P_BIT_SET_BULK_OP(or, _mm256_or_si256(a, b), a | b)
+NC_P_BIT_SET_BULK_OP(xor, _mm256_xor_si256(a, b), a ^ b)
+NC_P_BIT_SET_BULK_OP(and_not, _mm256_andnot_si256(b, a), a & ~b)
+
+size_t nc_bit_set_count(const NC_BitSet* self) {
+    const uint64_t* const words = nc_p_bit_set_words(self);
+    const size_t word_count = nc_p_bit_set_block_word_count(self->p.size);
+
+    // Independent accumulators per block lane, so that popcounts don't wait for each other
+    size_t counts[NC_BIT_SET_BLOCK_WORDS] = { 0 };
+    for (size_t i = 0; i < word_count; i += NC_BIT_SET_BLOCK_WORDS) {
+        for (size_t lane = 0; lane < NC_BIT_SET_BLOCK_WORDS; ++lane)
+            counts[lane] += nc_p_bit_set_popcount(words[i + lane]);
+    }
+
+    return counts[0] + counts[1] + counts[2] + counts[3];
+}
+
+size_t nc_bit_set_find_next(const NC_BitSet* self, size_t start) {
+    if (start >= self->p.size)
+        return self->p.size;
+
+    const uint64_t* const words = nc_p_bit_set_words(self);
+    const size_t word_count = nc_p_bit_set_word_count(self->p.size);
+
+    size_t word_index = start / NC_BIT_SET_WORD_BITS;
+    uint64_t word = words[word_index] & (~UINT64_C(0) << (start % NC_BIT_SET_WORD_BITS));
+    while (word == 0) {
+        word_index += 1;
+        if (word_index == word_count)
+            return self->p.size;
+        word = words[word_index];
+    }
+
+    return word_index * NC_BIT_SET_WORD_BITS + nc_p_bit_set_ctz(word);
+}
+
+size_t nc_bit_set_find_first(const NC_BitSet* self) {
+    return nc_bit_set_find_next(self, 0);
+}
+
+NC_BitSetIterator nc_bit_set_iter(const NC_BitSet* self) {
+    const size_t word_count = nc_p_bit_set_word_count(self->p.size);
+
+    return (NC_BitSetIterator) {
+        .p = {
+            .words = nc_p_bit_set_words(self),
+            .word_count = word_count,
+            .word_index = 0,
+            .word = word_count > 0 ? nc_p_bit_set_words(self)[0] : 0
+        }
+    };
+}
+
+bool nc_bit_set_iterator_next(NC_BitSetIterator* self, size_t* out_index) {
+    while (self->p.word == 0) {
+        if (self->p.word_index + 1 >= self->p.word_count)
+            return false;
+
+        self->p.word_index += 1;
+        self->p.word = self->p.words[self->p.word_index];
+    }
+
+    *out_index = self->p.word_index * NC_BIT_SET_WORD_BITS + nc_p_bit_set_ctz(self->p.word);
+    // Clear the lowest set bit
+    self->p.word &= self->p.word - 1;
+
+    return true;
+}
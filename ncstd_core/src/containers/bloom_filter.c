@@ -0,0 +1,171 @@
+#include "ncstd/containers/bloom_filter.h"
+
+#include <string.h>
+
+#include "ncstd/alloc_stats.h"
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+
+#define NC_P_BLOOM_FILTER_BLOCK_BITS (NC_BLOOM_FILTER_BLOCK_SIZE * 8)
+// Distance in keys at which bulk operations prefetch blocks
+#define NC_P_BLOOM_FILTER_PREFETCH_DISTANCE 8
+
+// Odd multipliers, each turns low half of a hash into a bit index for one word of a block
+static const uint32_t NC_P_BLOOM_FILTER_SALTS[NC_BLOOM_FILTER_BITS_PER_HASH] = {
+    0x47b6137bu, 0x44974d91u, 0x8824ad5bu, 0xa2b7289du,
+    0x705495c7u, 0x2df1424bu, 0x9efc4947u, 0x5c6bfb31u
+};
+
+static uint64_t* nc_p_bloom_filter_block(const NC_BloomFilter* self, uint64_t hash) {
+    // Multiply-shift maps high half of the hash to block index without a division
+    const uint64_t index = ((hash >> 32) * (uint64_t)nc_bloom_filter_block_count(self)) >> 32;
+
+    return (uint64_t*)nc_raw_buffer_data(&self->p.raw_buffer) + index * NC_BLOOM_FILTER_BITS_PER_HASH;
+}
+
+static void nc_p_bloom_filter_prefetch(const uint64_t* block) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(block);
+#else
+    (void)block;
+#endif
+}
+
+#ifdef __AVX2__
+// Creates masks with a single bit for each word of the block, for words 0-3 and 4-7
+static void nc_p_bloom_filter_masks(uint64_t hash, __m256i* out_low, __m256i* out_high) {
+    const __m256i salts = _mm256_loadu_si256((const __m256i*)NC_P_BLOOM_FILTER_SALTS);
+    const __m256i bits = _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_set1_epi32((int)(uint32_t)hash), salts), 26);
+    const __m256i one = _mm256_set1_epi64x(1);
+
+    *out_low = _mm256_sllv_epi64(one, _mm256_cvtepu32_epi64(_mm256_castsi256_si128(bits)));
+    *out_high = _mm256_sllv_epi64(one, _mm256_cvtepu32_epi64(_mm256_extracti128_si256(bits, 1)));
+}
+
+static void nc_p_bloom_filter_insert(uint64_t* block, uint64_t hash) {
+    __m256i low, high;
+    nc_p_bloom_filter_masks(hash, &low, &high);
+
+    __m256i* const words = (__m256i*)block;
+    _mm256_store_si256(words, _mm256_or_si256(_mm256_load_si256(words), low));
+    _mm256_store_si256(words + 1, _mm256_or_si256(_mm256_load_si256(words + 1), high));
+}
+
+static bool nc_p_bloom_filter_contains(const uint64_t* block, uint64_t hash) {
+    __m256i low, high;
+    nc_p_bloom_filter_masks(hash, &low, &high);
+
+    const __m256i* const words = (const __m256i*)block;
+
+    return _mm256_testc_si256(_mm256_load_si256(words), low) & _mm256_testc_si256(_mm256_load_si256(words + 1), high);
+}
+#else
+static uint64_t nc_p_bloom_filter_mask(uint64_t hash, size_t word) {
+    return UINT64_C(1) << (((uint32_t)hash * NC_P_BLOOM_FILTER_SALTS[word]) >> 26);
+}
+
+static void nc_p_bloom_filter_insert(uint64_t* block, uint64_t hash) {
+    for (size_t i = 0; i < NC_BLOOM_FILTER_BITS_PER_HASH; ++i)
+        block[i] |= nc_p_bloom_filter_mask(hash, i);
+}
+
+static bool nc_p_bloom_filter_contains(const uint64_t* block, uint64_t hash) {
+    // Combine all words instead of exiting early, misses are unpredictable
+    uint64_t missing = 0;
+    for (size_t i = 0; i < NC_BLOOM_FILTER_BITS_PER_HASH; ++i) {
+        const uint64_t mask = nc_p_bloom_filter_mask(hash, i);
+        missing |= mask & ~block[i];
+    }
+
+    return missing == 0;
+}
+#endif
+
+
+NC_BloomFilter nc_bloom_filter_init(size_t expected_count, size_t bits_per_key) {
+    return nc_bloom_filter_init_in(expected_count, bits_per_key, nc_allocator_default());
+}
+
+NC_BloomFilter nc_bloom_filter_init_in(size_t expected_count, size_t bits_per_key, NC_Allocator* allocator) {
+    size_t block_count = (expected_count * bits_per_key + NC_P_BLOOM_FILTER_BLOCK_BITS - 1) / NC_P_BLOOM_FILTER_BLOCK_BITS;
+    if (block_count == 0)
+        block_count = 1;
+
+    NC_INTERNAL_ALLOC_STATS_SITE_ENTER();
+    NC_RawBuffer raw_buffer = nc_raw_buffer_init_with_capacity_aligned_in(
+        block_count,
+        NC_BLOOM_FILTER_BLOCK_SIZE,
+        NC_CACHE_LINE_SIZE,
+        allocator
+    );
+    NC_INTERNAL_ALLOC_STATS_SITE_LEAVE();
+    if (nc_raw_buffer_data(&raw_buffer) == NULL)
+        raw_buffer = nc_raw_buffer_init_aligned_in(NC_BLOOM_FILTER_BLOCK_SIZE, NC_CACHE_LINE_SIZE, allocator);
+
+    NC_BloomFilter self = { .p = { .raw_buffer = raw_buffer } };
+    nc_bloom_filter_clear(&self);
+
+    return self;
+}
+
+void nc_bloom_filter_destroy(NC_BloomFilter* self) {
+    NC_Allocator* const allocator = nc_raw_buffer_allocator(&self->p.raw_buffer);
+    nc_raw_buffer_free(&self->p.raw_buffer, NC_BLOOM_FILTER_BLOCK_SIZE);
+
+    self->p.raw_buffer = nc_raw_buffer_init_aligned_in(NC_BLOOM_FILTER_BLOCK_SIZE, NC_CACHE_LINE_SIZE, allocator);
+}
+
+size_t nc_bloom_filter_block_count(const NC_BloomFilter* self) {
+    return nc_raw_buffer_capacity(&self->p.raw_buffer);
+}
+
+void nc_bloom_filter_clear(NC_BloomFilter* self) {
+    if (nc_bloom_filter_block_count(self) > 0)
+        memset(nc_raw_buffer_data(&self->p.raw_buffer), 0, nc_bloom_filter_block_count(self) * NC_BLOOM_FILTER_BLOCK_SIZE);
+}
+
+void nc_bloom_filter_insert_hash(NC_BloomFilter* self, uint64_t hash) {
+    if (nc_bloom_filter_block_count(self) > 0)
+        nc_p_bloom_filter_insert(nc_p_bloom_filter_block(self, hash), hash);
+}
+
+bool nc_bloom_filter_contains_hash(const NC_BloomFilter* self, uint64_t hash) {
+    if (nc_bloom_filter_block_count(self) == 0)
+        return true;
+
+    return nc_p_bloom_filter_contains(nc_p_bloom_filter_block(self, hash), hash);
+}
+
+void nc_bloom_filter_insert_hashes(NC_BloomFilter* self, const uint64_t* hashes, size_t count) {
+    if (nc_bloom_filter_block_count(self) == 0)
+        return;
+
+    for (size_t i = 0; i < count; ++i) {
+        if (i + NC_P_BLOOM_FILTER_PREFETCH_DISTANCE < count)
+            nc_p_bloom_filter_prefetch(nc_p_bloom_filter_block(self, hashes[i + NC_P_BLOOM_FILTER_PREFETCH_DISTANCE]));
+
+        nc_p_bloom_filter_insert(nc_p_bloom_filter_block(self, hashes[i]), hashes[i]);
+    }
+}
+
+size_t nc_bloom_filter_contains_hashes(const NC_BloomFilter* self, const uint64_t* hashes, size_t count, bool* out_results) {
+    if (nc_bloom_filter_block_count(self) == 0) {
+        for (size_t i = 0; i < count; ++i)
+            out_results[i] = true;
+        return count;
+    }
+
+    size_t found = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (i + NC_P_BLOOM_FILTER_PREFETCH_DISTANCE < count)
+            nc_p_bloom_filter_prefetch(nc_p_bloom_filter_block(self, hashes[i + NC_P_BLOOM_FILTER_PREFETCH_DISTANCE]));
+
+        out_results[i] = nc_p_bloom_filter_contains(nc_p_bloom_filter_block(self, hashes[i]), hashes[i]);
+        found += out_results[i];
+    }
+
+    return found;
+}
@@ -0,0 +1,214 @@
+#include "ncstd/containers/deque.h"
+
+#include <string.h>
+
+#include "ncstd/alloc_stats.h"
+
+
+static size_t nc_p_deque_round_capacity(size_t capacity) {
+    size_t rounded = NC_DEQUE_MIN_CAPACITY;
+    while (rounded < capacity)
+        rounded *= 2;
+
+    return rounded;
+}
+
+static size_t nc_p_deque_position(const NC_Deque* self, size_t index) {
+    return (self->p.head + index) & (nc_deque_capacity(self) - 1);
+}
+
+static uint8_t* nc_p_deque_slot(const NC_Deque* self, size_t position) {
+    return (uint8_t*)nc_raw_buffer_data(&self->p.raw_buffer) + position * self->p.object_size;
+}
+
+static bool nc_p_deque_grow_if_full(NC_Deque* self) {
+    if (self->p.size < nc_deque_capacity(self))
+        return true;
+
+    return nc_deque_reserve(self, self->p.size + 1);
+}
+
+
+NC_Deque nc_deque_init(size_t object_size) {
+    return nc_deque_init_in(object_size, nc_allocator_default());
+}
+
+NC_Deque nc_deque_init_in(size_t object_size, NC_Allocator* allocator) {
+    return (NC_Deque) {
+        .p = {
+            .raw_buffer = nc_raw_buffer_init_in(object_size, allocator),
+            .head = 0,
+            .size = 0,
+            .object_size = object_size
+        }
+    };
+}
+
+NC_Deque nc_deque_init_with_capacity(size_t capacity, size_t object_size) {
+    return nc_deque_init_with_capacity_in(capacity, object_size, nc_allocator_default());
+}
+
+NC_Deque nc_deque_init_with_capacity_in(size_t capacity, size_t object_size, NC_Allocator* allocator) {
+    NC_Deque self = nc_deque_init_in(object_size, allocator);
+    nc_deque_reserve(&self, capacity);
+
+    return self;
+}
+
+void nc_deque_destroy(NC_Deque* self) {
+    nc_raw_buffer_free(&self->p.raw_buffer, self->p.object_size);
+
+    *self = nc_deque_init_in(self->p.object_size, nc_raw_buffer_allocator(&self->p.raw_buffer));
+}
+
+size_t nc_deque_size(const NC_Deque* self) {
+    return self->p.size;
+}
+
+size_t nc_deque_capacity(const NC_Deque* self) {
+    return nc_raw_buffer_capacity(&self->p.raw_buffer);
+}
+
+bool nc_deque_is_empty(const NC_Deque* self) {
+    return self->p.size == 0;
+}
+
+void* nc_deque_get_unchecked(const NC_Deque* self, size_t index) {
+    return nc_p_deque_slot(self, nc_p_deque_position(self, index));
+}
+
+void* nc_deque_get(const NC_Deque* self, size_t index) {
+    if (index >= self->p.size)
+        return NULL;
+
+    return nc_deque_get_unchecked(self, index);
+}
+
+void* nc_deque_front(const NC_Deque* self) {
+    return nc_deque_get(self, 0);
+}
+
+void* nc_deque_back(const NC_Deque* self) {
+    if (self->p.size == 0)
+        return NULL;
+
+    return nc_deque_get_unchecked(self, self->p.size - 1);
+}
+
+NC_DequeSlices nc_deque_as_slices(const NC_Deque* self) {
+    if (self->p.size == 0)
+        return (NC_DequeSlices) { .first = NULL, .first_size = 0, .second = NULL, .second_size = 0 };
+
+    const size_t until_end = nc_deque_capacity(self) - self->p.head;
+    if (self->p.size <= until_end) {
+        return (NC_DequeSlices) {
+            .first = nc_p_deque_slot(self, self->p.head),
+            .first_size = self->p.size,
+            .second = NULL,
+            .second_size = 0
+        };
+    }
+
+    return (NC_DequeSlices) {
+        .first = nc_p_deque_slot(self, self->p.head),
+        .first_size = until_end,
+        .second = nc_p_deque_slot(self, 0),
+        .second_size = self->p.size - until_end
+    };
+}
+
+bool nc_deque_reserve(NC_Deque* self, size_t new_capacity) {
+    if (new_capacity <= nc_deque_capacity(self))
+        return true;
+
+    const NC_RawBuffer* const old_buffer = &self->p.raw_buffer;
+
+    NC_INTERNAL_ALLOC_STATS_SITE_ENTER();
+    NC_RawBuffer new_buffer = nc_raw_buffer_init_with_capacity_aligned_in(
+        nc_p_deque_round_capacity(new_capacity),
+        self->p.object_size,
+        nc_raw_buffer_alignment(old_buffer),
+        nc_raw_buffer_allocator(old_buffer)
+    );
+    NC_INTERNAL_ALLOC_STATS_SITE_LEAVE();
+    if (nc_raw_buffer_data(&new_buffer) == NULL)
+        return false;
+
+    // Unwrap elements to the start of the new buffer
+    const NC_DequeSlices slices = nc_deque_as_slices(self);
+    if (slices.first_size > 0)
+        nc_raw_buffer_set_multiple_unchecked(&new_buffer, slices.first, 0, slices.first_size, self->p.object_size);
+    if (slices.second_size > 0) {
+        nc_raw_buffer_set_multiple_unchecked(
+            &new_buffer,
+            slices.second,
+            slices.first_size,
+            slices.second_size,
+            self->p.object_size
+        );
+    }
+
+    nc_raw_buffer_free(&self->p.raw_buffer, self->p.object_size);
+    self->p.raw_buffer = new_buffer;
+    self->p.head = 0;
+
+    return true;
+}
+
+bool nc_deque_push_back(NC_Deque* self, const void* object) {
+    if (!nc_p_deque_grow_if_full(self))
+        return false;
+
+    memcpy(nc_deque_get_unchecked(self, self->p.size), object, self->p.object_size);
+    self->p.size += 1;
+
+    return true;
+}
+
+bool nc_deque_push_front(NC_Deque* self, const void* object) {
+    if (!nc_p_deque_grow_if_full(self))
+        return false;
+
+    self->p.head = (self->p.head - 1) & (nc_deque_capacity(self) - 1);
+    memcpy(nc_p_deque_slot(self, self->p.head), object, self->p.object_size);
+    self->p.size += 1;
+
+    return true;
+}
+
+bool nc_deque_pop_back(NC_Deque* self, void* out_object) {
+    if (self->p.size == 0)
+        return false;
+
+    self->p.size -= 1;
+    if (out_object != NULL)
+        memcpy(out_object, nc_deque_get_unchecked(self, self->p.size), self->p.object_size);
+
+    return true;
+}
+
+bool nc_deque_pop_front(NC_Deque* self, void* out_object) {
+    if (self->p.size == 0)
+        return false;
+
+    if (out_object != NULL)
+        memcpy(out_object, nc_p_deque_slot(self, self->p.head), self->p.object_size);
+    nc_deque_consume_front(self, 1);
+
+    return true;
+}
+
+void nc_deque_consume_front(NC_Deque* self, size_t count) {
+    if (count >= self->p.size) {
+        nc_deque_clear(self);
+        return;
+    }
+
+    self->p.head = nc_p_deque_position(self, count);
+    self->p.size -= count;
+}
+
+void nc_deque_clear(NC_Deque* self) {
+    self->p.head = 0;
+    self->p.size = 0;
+}
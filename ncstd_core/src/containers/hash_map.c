@@ -0,0 +1,8 @@
+#include "ncstd/containers/hash_map.h"
+
+
+extern inline uint32_t nc_internal_hash_map_group_match(const uint8_t* group, uint8_t h2);
+extern inline uint32_t nc_internal_hash_map_group_match_empty(const uint8_t* group);
+extern inline uint32_t nc_internal_hash_map_lowest_bit(uint32_t mask);
+extern inline size_t nc_internal_hash_map_max_size(size_t capacity);
+extern inline void nc_internal_hash_map_set_ctrl(uint8_t* ctrl, size_t capacity, size_t index, uint8_t value);
@@ -0,0 +1,195 @@
+#include "ncstd/containers/mpmc_queue.h"
+
+#include <stdalign.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "ncstd/alloc_stats.h"
+
+
+// Elements are copied in and out with memcpy, so they only need to follow the sequence number
+#define NC_P_MPMC_QUEUE_DATA_OFFSET sizeof(atomic_size_t)
+
+static size_t nc_p_mpmc_queue_round_capacity(size_t capacity) {
+    size_t rounded = 1;
+    while (rounded < capacity)
+        rounded *= 2;
+
+    return rounded;
+}
+
+static size_t nc_p_mpmc_queue_cell_size(size_t object_size) {
+    const size_t alignment = alignof(atomic_size_t);
+
+    return (NC_P_MPMC_QUEUE_DATA_OFFSET + object_size + alignment - 1) / alignment * alignment;
+}
+
+static uint8_t* nc_p_mpmc_queue_cell(const NC_MpmcQueue* self, size_t position) {
+    const size_t mask = nc_mpmc_queue_capacity(self) - 1;
+
+    return (uint8_t*)nc_raw_buffer_data(&self->p.raw_buffer) + (position & mask) * self->p.cell_size;
+}
+
+static atomic_size_t* nc_p_mpmc_queue_sequence(uint8_t* cell) {
+    return (atomic_size_t*)cell;
+}
+
+// Difference of positions, that stays correct when they wrap around
+static intptr_t nc_p_mpmc_queue_distance(size_t from, size_t to) {
+    return (intptr_t)(to - from);
+}
+
+// Claims up to count consecutive cells, whose sequence equals their position plus sequence_offset.
+// Returns number of claimed cells and writes position of the first one to out_position.
+static size_t nc_p_mpmc_queue_claim(
+    NC_MpmcQueue* self,
+    atomic_size_t* shared_position,
+    size_t sequence_offset,
+    size_t count,
+    size_t* out_position
+) {
+    if (count == 0 || nc_mpmc_queue_capacity(self) == 0)
+        return 0;
+
+    size_t position = atomic_load_explicit(shared_position, memory_order_relaxed);
+    for (;;) {
+        size_t ready = 0;
+        intptr_t distance = 0;
+        while (ready < count) {
+            const size_t expected = position + ready + sequence_offset;
+            const size_t sequence = atomic_load_explicit(
+                nc_p_mpmc_queue_sequence(nc_p_mpmc_queue_cell(self, position + ready)),
+                memory_order_acquire
+            );
+
+            distance = nc_p_mpmc_queue_distance(expected, sequence);
+            if (distance != 0)
+                break;
+            ready += 1;
+        }
+
+        if (ready == 0) {
+            // Cell is still in the previous lap, so the queue is full (or empty for consumers)
+            if (distance < 0)
+                return 0;
+
+            // Other thread has claimed the cell
+            position = atomic_load_explicit(shared_position, memory_order_relaxed);
+            continue;
+        }
+
+        if (atomic_compare_exchange_weak_explicit(
+            shared_position,
+            &position,
+            position + ready,
+            memory_order_relaxed,
+            memory_order_relaxed
+        )) {
+            *out_position = position;
+            return ready;
+        }
+    }
+}
+
+
+NC_MpmcQueue nc_mpmc_queue_init(size_t capacity, size_t object_size) {
+    return nc_mpmc_queue_init_in(capacity, object_size, nc_allocator_default());
+}
+
+NC_MpmcQueue nc_mpmc_queue_init_in(size_t capacity, size_t object_size, NC_Allocator* allocator) {
+    const size_t cell_size = nc_p_mpmc_queue_cell_size(object_size);
+
+    NC_INTERNAL_ALLOC_STATS_SITE_ENTER();
+    NC_RawBuffer raw_buffer = nc_raw_buffer_init_with_capacity_aligned_in(
+        nc_p_mpmc_queue_round_capacity(capacity),
+        cell_size,
+        NC_CACHE_LINE_SIZE,
+        allocator
+    );
+    NC_INTERNAL_ALLOC_STATS_SITE_LEAVE();
+    if (nc_raw_buffer_data(&raw_buffer) == NULL)
+        raw_buffer = nc_raw_buffer_init_aligned_in(cell_size, NC_CACHE_LINE_SIZE, allocator);
+
+    NC_MpmcQueue self = {
+        .p = {
+            .raw_buffer = raw_buffer,
+            .object_size = object_size,
+            .cell_size = cell_size
+        }
+    };
+    atomic_init(&self.p.enqueue_position, 0);
+    atomic_init(&self.p.dequeue_position, 0);
+
+    // Cell at position i is ready for the producer of the first lap
+    for (size_t i = 0; i < nc_mpmc_queue_capacity(&self); ++i)
+        atomic_init(nc_p_mpmc_queue_sequence(nc_p_mpmc_queue_cell(&self, i)), i);
+
+    return self;
+}
+
+void nc_mpmc_queue_destroy(NC_MpmcQueue* self) {
+    NC_Allocator* const allocator = nc_raw_buffer_allocator(&self->p.raw_buffer);
+    nc_raw_buffer_free(&self->p.raw_buffer, self->p.cell_size);
+
+    self->p.raw_buffer = nc_raw_buffer_init_aligned_in(self->p.cell_size, NC_CACHE_LINE_SIZE, allocator);
+    atomic_store_explicit(&self->p.enqueue_position, 0, memory_order_relaxed);
+    atomic_store_explicit(&self->p.dequeue_position, 0, memory_order_relaxed);
+}
+
+size_t nc_mpmc_queue_capacity(const NC_MpmcQueue* self) {
+    return nc_raw_buffer_capacity(&self->p.raw_buffer);
+}
+
+size_t nc_mpmc_queue_size(NC_MpmcQueue* self) {
+    const size_t dequeue_position = atomic_load_explicit(&self->p.dequeue_position, memory_order_acquire);
+    const size_t enqueue_position = atomic_load_explicit(&self->p.enqueue_position, memory_order_acquire);
+
+    // Positions are loaded at different times, so the difference might be out of range
+    const intptr_t size = nc_p_mpmc_queue_distance(dequeue_position, enqueue_position);
+    if (size < 0)
+        return 0;
+    if ((size_t)size > nc_mpmc_queue_capacity(self))
+        return nc_mpmc_queue_capacity(self);
+
+    return (size_t)size;
+}
+
+bool nc_mpmc_queue_try_push(NC_MpmcQueue* self, const void* object) {
+    return nc_mpmc_queue_push_batch(self, object, 1) == 1;
+}
+
+size_t nc_mpmc_queue_push_batch(NC_MpmcQueue* self, const void* objects, size_t count) {
+    size_t position = 0;
+    const size_t claimed = nc_p_mpmc_queue_claim(self, &self->p.enqueue_position, 0, count, &position);
+
+    const uint8_t* const source = objects;
+    for (size_t i = 0; i < claimed; ++i) {
+        uint8_t* const cell = nc_p_mpmc_queue_cell(self, position + i);
+
+        memcpy(cell + NC_P_MPMC_QUEUE_DATA_OFFSET, source + i * self->p.object_size, self->p.object_size);
+        atomic_store_explicit(nc_p_mpmc_queue_sequence(cell), position + i + 1, memory_order_release);
+    }
+
+    return claimed;
+}
+
+bool nc_mpmc_queue_try_pop(NC_MpmcQueue* self, void* out_object) {
+    return nc_mpmc_queue_pop_batch(self, out_object, 1) == 1;
+}
+
+size_t nc_mpmc_queue_pop_batch(NC_MpmcQueue* self, void* out_objects, size_t max_count) {
+    size_t position = 0;
+    const size_t claimed = nc_p_mpmc_queue_claim(self, &self->p.dequeue_position, 1, max_count, &position);
+
+    const size_t capacity = nc_mpmc_queue_capacity(self);
+    uint8_t* const destination = out_objects;
+    for (size_t i = 0; i < claimed; ++i) {
+        uint8_t* const cell = nc_p_mpmc_queue_cell(self, position + i);
+
+        memcpy(destination + i * self->p.object_size, cell + NC_P_MPMC_QUEUE_DATA_OFFSET, self->p.object_size);
+        // Cell becomes ready for the producer of the next lap
+        atomic_store_explicit(nc_p_mpmc_queue_sequence(cell), position + i + capacity, memory_order_release);
+    }
+
+    return claimed;
+}
@@ -0,0 +1,181 @@
+#include "ncstd/containers/segmented_vec.h"
+
+#include <string.h>
+
+#include "ncstd/alloc_stats.h"
+
+
+static size_t nc_p_segmented_vec_segment_capacity(size_t segment_index) {
+    return (size_t)NC_SEGMENTED_VEC_FIRST_SEGMENT_CAPACITY << segment_index;
+}
+
+// Total capacity of the first segment_count segments
+static size_t nc_p_segmented_vec_capacity(size_t segment_count) {
+    if (segment_count == 0)
+        return 0;
+
+    return nc_p_segmented_vec_segment_capacity(segment_count) - NC_SEGMENTED_VEC_FIRST_SEGMENT_CAPACITY;
+}
+
+static size_t nc_p_segmented_vec_highest_bit(size_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+    return sizeof(unsigned long long) * 8 - 1 - (size_t)__builtin_clzll((unsigned long long)value);
+#else
+    size_t bit = 0;
+    while (value >>= 1)
+        bit += 1;
+
+    return bit;
+#endif
+}
+
+static void nc_p_segmented_vec_free_segment(NC_SegmentedVec* self, size_t segment_index) {
+    nc_allocator_free(
+        self->p.allocator,
+        self->p.segments[segment_index],
+        nc_p_segmented_vec_segment_capacity(segment_index) * self->p.object_size,
+        NC_DEFAULT_ALIGNMENT
+    );
+    self->p.segments[segment_index] = NULL;
+}
+
+
+NC_SegmentedVec nc_segmented_vec_init(size_t object_size) {
+    return nc_segmented_vec_init_in(object_size, nc_allocator_default());
+}
+
+NC_SegmentedVec nc_segmented_vec_init_in(size_t object_size, NC_Allocator* allocator) {
+    return (NC_SegmentedVec) {
+        .p = {
+            .segments = { NULL },
+            .segment_count = 0,
+            .size = 0,
+            .object_size = object_size,
+            .allocator = allocator
+        }
+    };
+}
+
+void nc_segmented_vec_destroy(NC_SegmentedVec* self) {
+    for (size_t i = 0; i < self->p.segment_count; ++i)
+        nc_p_segmented_vec_free_segment(self, i);
+
+    *self = nc_segmented_vec_init_in(self->p.object_size, self->p.allocator);
+}
+
+size_t nc_segmented_vec_size(const NC_SegmentedVec* self) {
+    return self->p.size;
+}
+
+size_t nc_segmented_vec_capacity(const NC_SegmentedVec* self) {
+    return nc_p_segmented_vec_capacity(self->p.segment_count);
+}
+
+bool nc_segmented_vec_is_empty(const NC_SegmentedVec* self) {
+    return self->p.size == 0;
+}
+
+void* nc_segmented_vec_get_unchecked(const NC_SegmentedVec* self, size_t index) {
+    // Segment k holds indices [16 * (2^k - 1), 16 * (2^(k + 1) - 1)), shifting by 16 aligns them to 16 * 2^k
+    const size_t shifted = index + NC_SEGMENTED_VEC_FIRST_SEGMENT_CAPACITY;
+    const size_t bit = nc_p_segmented_vec_highest_bit(shifted);
+    const size_t segment_index = bit - NC_INTERNAL_SEGMENTED_VEC_FIRST_SEGMENT_SHIFT;
+    const size_t offset = shifted ^ ((size_t)1 << bit);
+
+    return (uint8_t*)self->p.segments[segment_index] + offset * self->p.object_size;
+}
+
+void* nc_segmented_vec_get(const NC_SegmentedVec* self, size_t index) {
+    if (index >= self->p.size)
+        return NULL;
+
+    return nc_segmented_vec_get_unchecked(self, index);
+}
+
+void* nc_segmented_vec_back(const NC_SegmentedVec* self) {
+    if (self->p.size == 0)
+        return NULL;
+
+    return nc_segmented_vec_get_unchecked(self, self->p.size - 1);
+}
+
+size_t nc_segmented_vec_segment_count(const NC_SegmentedVec* self) {
+    if (self->p.size == 0)
+        return 0;
+
+    return nc_p_segmented_vec_highest_bit(self->p.size - 1 + NC_SEGMENTED_VEC_FIRST_SEGMENT_CAPACITY)
+        - NC_INTERNAL_SEGMENTED_VEC_FIRST_SEGMENT_SHIFT + 1;
+}
+
+void* nc_segmented_vec_segment(const NC_SegmentedVec* self, size_t segment_index, size_t* out_size) {
+    const size_t start = nc_p_segmented_vec_capacity(segment_index);
+    const size_t end = start + nc_p_segmented_vec_segment_capacity(segment_index);
+    *out_size = (end < self->p.size ? end : self->p.size) - start;
+
+    return self->p.segments[segment_index];
+}
+
+bool nc_segmented_vec_reserve(NC_SegmentedVec* self, size_t new_capacity) {
+    while (nc_segmented_vec_capacity(self) < new_capacity) {
+        const size_t segment_index = self->p.segment_count;
+        if (segment_index == NC_INTERNAL_SEGMENTED_VEC_MAX_SEGMENTS)
+            return false;
+
+        const size_t capacity = nc_p_segmented_vec_segment_capacity(segment_index);
+        if (capacity > SIZE_MAX / self->p.object_size)
+            return false;
+
+        NC_INTERNAL_ALLOC_STATS_SITE_ENTER();
+        void* const segment = nc_allocator_alloc(self->p.allocator, capacity * self->p.object_size, NC_DEFAULT_ALIGNMENT);
+        NC_INTERNAL_ALLOC_STATS_SITE_LEAVE();
+        if (segment == NULL)
+            return false;
+
+        self->p.segments[segment_index] = segment;
+        self->p.segment_count += 1;
+    }
+
+    return true;
+}
+
+bool nc_segmented_vec_push(NC_SegmentedVec* self, const void* object) {
+    void* const slot = nc_segmented_vec_push_uninit(self);
+    if (slot == NULL)
+        return false;
+
+    memcpy(slot, object, self->p.object_size);
+
+    return true;
+}
+
+void* nc_segmented_vec_push_uninit(NC_SegmentedVec* self) {
+    if (!nc_segmented_vec_reserve(self, self->p.size + 1))
+        return NULL;
+
+    self->p.size += 1;
+
+    return nc_segmented_vec_get_unchecked(self, self->p.size - 1);
+}
+
+bool nc_segmented_vec_pop(NC_SegmentedVec* self, void* out_object) {
+    if (self->p.size == 0)
+        return false;
+
+    self->p.size -= 1;
+    if (out_object != NULL)
+        memcpy(out_object, nc_segmented_vec_get_unchecked(self, self->p.size), self->p.object_size);
+
+    return true;
+}
+
+void nc_segmented_vec_clear(NC_SegmentedVec* self) {
+    self->p.size = 0;
+}
+
+void nc_segmented_vec_shrink_to_fit(NC_SegmentedVec* self) {
+    const size_t used = nc_segmented_vec_segment_count(self);
+    while (self->p.segment_count > used) {
+        self->p.segment_count -= 1;
+        nc_p_segmented_vec_free_segment(self, self->p.segment_count);
+    }
+}
@@ -0,0 +1,145 @@
+#include "ncstd/containers/spsc_queue.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "ncstd/alloc_stats.h"
+
+
+static size_t nc_p_spsc_queue_round_capacity(size_t capacity) {
+    size_t rounded = 1;
+    while (rounded < capacity)
+        rounded *= 2;
+
+    return rounded;
+}
+
+static uint8_t* nc_p_spsc_queue_slot(const NC_SpscQueue* self, size_t position) {
+    const size_t mask = nc_spsc_queue_capacity(self) - 1;
+
+    return (uint8_t*)nc_raw_buffer_data(&self->p.raw_buffer) + (position & mask) * self->p.object_size;
+}
+
+// Copies count objects into the ring starting at position, splitting the copy at the end of the buffer
+static void nc_p_spsc_queue_write(NC_SpscQueue* self, size_t position, const uint8_t* objects, size_t count) {
+    const size_t capacity = nc_spsc_queue_capacity(self);
+    const size_t until_end = capacity - (position & (capacity - 1));
+    const size_t first = count < until_end ? count : until_end;
+    const size_t object_size = self->p.object_size;
+
+    memcpy(nc_p_spsc_queue_slot(self, position), objects, first * object_size);
+    if (count > first)
+        memcpy(nc_p_spsc_queue_slot(self, 0), objects + first * object_size, (count - first) * object_size);
+}
+
+static void nc_p_spsc_queue_read(const NC_SpscQueue* self, size_t position, uint8_t* out_objects, size_t count) {
+    const size_t capacity = nc_spsc_queue_capacity(self);
+    const size_t until_end = capacity - (position & (capacity - 1));
+    const size_t first = count < until_end ? count : until_end;
+    const size_t object_size = self->p.object_size;
+
+    memcpy(out_objects, nc_p_spsc_queue_slot(self, position), first * object_size);
+    if (count > first)
+        memcpy(out_objects + first * object_size, nc_p_spsc_queue_slot(self, 0), (count - first) * object_size);
+}
+
+
+NC_SpscQueue nc_spsc_queue_init(size_t capacity, size_t object_size) {
+    return nc_spsc_queue_init_in(capacity, object_size, nc_allocator_default());
+}
+
+NC_SpscQueue nc_spsc_queue_init_in(size_t capacity, size_t object_size, NC_Allocator* allocator) {
+    NC_INTERNAL_ALLOC_STATS_SITE_ENTER();
+    NC_RawBuffer raw_buffer = nc_raw_buffer_init_with_capacity_aligned_in(
+        nc_p_spsc_queue_round_capacity(capacity),
+        object_size,
+        NC_CACHE_LINE_SIZE,
+        allocator
+    );
+    NC_INTERNAL_ALLOC_STATS_SITE_LEAVE();
+    if (nc_raw_buffer_data(&raw_buffer) == NULL)
+        raw_buffer = nc_raw_buffer_init_aligned_in(object_size, NC_CACHE_LINE_SIZE, allocator);
+
+    NC_SpscQueue self = {
+        .p = {
+            .raw_buffer = raw_buffer,
+            .object_size = object_size,
+            .cached_head = 0,
+            .cached_tail = 0
+        }
+    };
+    atomic_init(&self.p.tail, 0);
+    atomic_init(&self.p.head, 0);
+
+    return self;
+}
+
+void nc_spsc_queue_destroy(NC_SpscQueue* self) {
+    NC_Allocator* const allocator = nc_raw_buffer_allocator(&self->p.raw_buffer);
+    nc_raw_buffer_free(&self->p.raw_buffer, self->p.object_size);
+
+    self->p.raw_buffer = nc_raw_buffer_init_aligned_in(self->p.object_size, NC_CACHE_LINE_SIZE, allocator);
+    self->p.cached_head = 0;
+    self->p.cached_tail = 0;
+    atomic_store_explicit(&self->p.tail, 0, memory_order_relaxed);
+    atomic_store_explicit(&self->p.head, 0, memory_order_relaxed);
+}
+
+size_t nc_spsc_queue_capacity(const NC_SpscQueue* self) {
+    return nc_raw_buffer_capacity(&self->p.raw_buffer);
+}
+
+size_t nc_spsc_queue_size(NC_SpscQueue* self) {
+    const size_t head = atomic_load_explicit(&self->p.head, memory_order_acquire);
+    const size_t tail = atomic_load_explicit(&self->p.tail, memory_order_acquire);
+
+    return tail - head;
+}
+
+bool nc_spsc_queue_try_push(NC_SpscQueue* self, const void* object) {
+    return nc_spsc_queue_push_batch(self, object, 1) == 1;
+}
+
+size_t nc_spsc_queue_push_batch(NC_SpscQueue* self, const void* objects, size_t count) {
+    const size_t capacity = nc_spsc_queue_capacity(self);
+    const size_t tail = atomic_load_explicit(&self->p.tail, memory_order_relaxed);
+
+    size_t free_count = capacity - (tail - self->p.cached_head);
+    if (free_count < count) {
+        self->p.cached_head = atomic_load_explicit(&self->p.head, memory_order_acquire);
+        free_count = capacity - (tail - self->p.cached_head);
+    }
+
+    if (count > free_count)
+        count = free_count;
+    if (count == 0)
+        return 0;
+
+    nc_p_spsc_queue_write(self, tail, objects, count);
+    atomic_store_explicit(&self->p.tail, tail + count, memory_order_release);
+
+    return count;
+}
+
+bool nc_spsc_queue_try_pop(NC_SpscQueue* self, void* out_object) {
+    return nc_spsc_queue_pop_batch(self, out_object, 1) == 1;
+}
+
+size_t nc_spsc_queue_pop_batch(NC_SpscQueue* self, void* out_objects, size_t max_count) {
+    const size_t head = atomic_load_explicit(&self->p.head, memory_order_relaxed);
+
+    size_t available = self->p.cached_tail - head;
+    if (available < max_count) {
+        self->p.cached_tail = atomic_load_explicit(&self->p.tail, memory_order_acquire);
+        available = self->p.cached_tail - head;
+    }
+
+    const size_t count = max_count < available ? max_count : available;
+    if (count == 0)
+        return 0;
+
+    nc_p_spsc_queue_read(self, head, out_objects, count);
+    atomic_store_explicit(&self->p.head, head + count, memory_order_release);
+
+    return count;
+}
@@ -3,9 +3,28 @@
 #include <stdbool.h>
 #include <string.h>
 
-#include "ncstd/memory.h"
+#include "ncstd/alloc_stats.h"
+#include "ncstd/allocator.h"
+#include "ncstd/allocators/mapped.h"
 
 
+static struct {
+    NC_Allocator* allocator;
+    size_t threshold;
+} large_buffers = {
+    .allocator = NULL,
+    .threshold = NC_RAW_BUFFER_DEFAULT_LARGE_THRESHOLD
+};
+
+
+static NC_Allocator* nc_p_raw_buffer_large_allocator() {
+    return large_buffers.allocator ? large_buffers.allocator : nc_mapped_allocator_default();
+}
+
+static bool nc_p_raw_buffer_is_large(NC_Allocator* allocator, size_t size) {
+    return allocator == nc_allocator_default() && size >= large_buffers.threshold;
+}
+
 static bool nc_p_raw_buffer_contains_index(const NC_RawBuffer* self, size_t index) {
     return index < self->p.capacity;
 }
@@ -24,6 +43,14 @@ size_t nc_raw_buffer_capacity(const NC_RawBuffer* self) {
     return self->p.capacity;
 }
 
+NC_Allocator* nc_raw_buffer_allocator(const NC_RawBuffer* self) {
+    return self->p.allocator;
+}
+
+size_t nc_raw_buffer_alignment(const NC_RawBuffer* self) {
+    return self->p.alignment;
+}
+
 void* nc_raw_buffer_get(const NC_RawBuffer* self, size_t index, size_t object_size) {
     if (!nc_p_raw_buffer_contains_index(self, index))
         return NULL;
@@ -71,11 +98,50 @@ void nc_raw_buffer_set_multiple_unchecked(NC_RawBuffer* self, const void* object
     memcpy(buffer_data, objects, count * object_size);
 }
 
+static uint8_t* nc_p_raw_buffer_move_to_large(NC_RawBuffer* self, size_t new_size, size_t object_size) {
+    NC_Allocator* const large_allocator = nc_p_raw_buffer_large_allocator();
+
+    uint8_t* const new_data = nc_allocator_alloc(large_allocator, new_size, self->p.alignment);
+    if (new_data == NULL)
+        return NULL;
+
+    const size_t old_size = self->p.capacity * object_size;
+    if (self->p.data != NULL)
+        memcpy(new_data, self->p.data, old_size < new_size ? old_size : new_size);
+
+    nc_allocator_free(self->p.allocator, self->p.data, old_size, self->p.alignment);
+    self->p.allocator = large_allocator;
+
+    return new_data;
+}
+
 void nc_raw_buffer_resize_unchecked(NC_RawBuffer* self, size_t new_capacity, size_t object_size) {
-    self->p.data = nc_realloc(self->p.data, new_capacity * object_size);
+    const size_t new_size = new_capacity * object_size;
+
+    NC_INTERNAL_ALLOC_STATS_SITE_ENTER();
+    uint8_t* const new_data = nc_p_raw_buffer_is_large(self->p.allocator, new_size)
+        ? nc_p_raw_buffer_move_to_large(self, new_size, object_size)
+        : nc_allocator_realloc(
+            self->p.allocator,
+            self->p.data,
+            self->p.capacity * object_size,
+            new_size,
+            self->p.alignment
+        );
+    NC_INTERNAL_ALLOC_STATS_SITE_LEAVE();
+
+    if (new_data == NULL)
+        return;
+
+    self->p.data = new_data;
     self->p.capacity = new_capacity;
 }
 
+void nc_raw_buffer_set_large_allocator(NC_Allocator* large_allocator, size_t threshold) {
+    large_buffers.allocator = large_allocator;
+    large_buffers.threshold = threshold;
+}
+
 void nc_raw_buffer_grow_amorthized(NC_RawBuffer* self, size_t required_capacity, size_t growth_factor, size_t object_size) {
     //
     if (required_capacity < nc_raw_buffer_capacity(self))
@@ -94,35 +160,70 @@ void nc_raw_buffer_grow_amorthized(NC_RawBuffer* self, size_t required_capacity,
 
 
 NC_RawBuffer nc_raw_buffer_init(size_t object_size) {
+    return nc_raw_buffer_init_in(object_size, nc_allocator_default());
+}
+
+NC_RawBuffer nc_raw_buffer_init_in(size_t object_size, NC_Allocator* allocator) {
+    return nc_raw_buffer_init_aligned_in(object_size, NC_DEFAULT_ALIGNMENT, allocator);
+}
+
+NC_RawBuffer nc_raw_buffer_init_aligned_in(size_t object_size, size_t alignment, NC_Allocator* allocator) {
     (void)object_size;
 
     return (NC_RawBuffer) {
         .p = {
             .data = NULL,
-            .capacity = 0
+            .capacity = 0,
+            .allocator = allocator,
+            .alignment = alignment
         }
     };
 }
 
 NC_RawBuffer nc_raw_buffer_init_with_capacity(size_t capacity, size_t object_size) {
+    return nc_raw_buffer_init_with_capacity_in(capacity, object_size, nc_allocator_default());
+}
+
+NC_RawBuffer nc_raw_buffer_init_with_capacity_in(size_t capacity, size_t object_size, NC_Allocator* allocator) {
+    return nc_raw_buffer_init_with_capacity_aligned_in(capacity, object_size, NC_DEFAULT_ALIGNMENT, allocator);
+}
+
+NC_RawBuffer nc_raw_buffer_init_with_capacity_aligned(size_t capacity, size_t object_size, size_t alignment) {
+    return nc_raw_buffer_init_with_capacity_aligned_in(capacity, object_size, alignment, nc_allocator_default());
+}
+
+NC_RawBuffer nc_raw_buffer_init_with_capacity_aligned_in(size_t capacity, size_t object_size, size_t alignment, NC_Allocator* allocator) {
+    if (nc_p_raw_buffer_is_large(allocator, capacity * object_size))
+        allocator = nc_p_raw_buffer_large_allocator();
+
+    NC_INTERNAL_ALLOC_STATS_SITE_ENTER();
+    uint8_t* const data = nc_allocator_alloc(allocator, capacity * object_size, alignment);
+    NC_INTERNAL_ALLOC_STATS_SITE_LEAVE();
+
     return (NC_RawBuffer) {
         .p = {
-            .data = nc_malloc(capacity * object_size),
-            .capacity = capacity
+            .data = data,
+            .capacity = capacity,
+            .allocator = allocator,
+            .alignment = alignment
         }
     };
 }
 
 NC_RawBuffer nc_raw_buffer_init_with_objects(const void* objects, size_t count, size_t object_size) {
-    NC_RawBuffer raw_buffer = nc_raw_buffer_init_with_capacity(count, object_size);
+    return nc_raw_buffer_init_with_objects_in(objects, count, object_size, nc_allocator_default());
+}
+
+NC_RawBuffer nc_raw_buffer_init_with_objects_in(const void* objects, size_t count, size_t object_size, NC_Allocator* allocator) {
+    NC_RawBuffer raw_buffer = nc_raw_buffer_init_with_capacity_in(count, object_size, allocator);
     nc_raw_buffer_set_multiple_unchecked(&raw_buffer, objects, 0, count, object_size);
 
     return raw_buffer;
 }
 
-void nc_raw_buffer_free(NC_RawBuffer* self) {
+void nc_raw_buffer_free(NC_RawBuffer* self, size_t object_size) {
     if (!self)
         return;
         
-    nc_free(self->p.data);
+    nc_allocator_free(self->p.allocator, self->p.data, self->p.capacity * object_size, self->p.alignment);
 }
\ No newline at end of file
@@ -0,0 +1,5 @@
+#include "ncstd/containers/vec.h"
+
+
+extern inline size_t nc_vec_growth_double(size_t capacity, size_t required_capacity);
+extern inline size_t nc_vec_growth_half(size_t capacity, size_t required_capacity);
@@ -1,12 +1,105 @@
 #include "ncstd/memory.h"
 
+#include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "ncstd/util/panic_handlers.h"
 
+#ifdef NC_FEATURE_THREAD_CACHE
+#include "thread_cache.h"
+#endif
+
+
+static void* nc_p_system_malloc(size_t size) {
+#ifdef NC_FEATURE_THREAD_CACHE
+    return nc_p_thread_cache_malloc(size);
+#else
+    return malloc(size);
+#endif
+}
+
+static void* nc_p_system_calloc(size_t count, size_t object_size) {
+#ifdef NC_FEATURE_THREAD_CACHE
+    return nc_p_thread_cache_calloc(count, object_size);
+#else
+    return calloc(count, object_size);
+#endif
+}
+
+static void* nc_p_system_realloc(void* ptr, size_t new_size) {
+#ifdef NC_FEATURE_THREAD_CACHE
+    return nc_p_thread_cache_realloc(ptr, new_size);
+#else
+    return realloc(ptr, new_size);
+#endif
+}
+
+static void nc_p_system_free(void* ptr) {
+#ifdef NC_FEATURE_THREAD_CACHE
+    nc_p_thread_cache_free(ptr);
+#else
+    free(ptr);
+#endif
+}
+
+// Aligned allocations over-allocate from the system allocator, and store
+// the original pointer and the size right before the aligned pointer.
+typedef struct {
+    void* base;
+    size_t size;
+} NC_AlignedHeader;
+
+static NC_AlignedHeader* nc_p_aligned_header(void* ptr) {
+    return (NC_AlignedHeader*)ptr - 1;
+}
+
+static size_t nc_p_aligned_allocation_size(size_t size, size_t alignment) {
+    return size + sizeof(NC_AlignedHeader) + alignment - 1;
+}
+
+static void* nc_p_aligned_ptr(void* base, size_t alignment) {
+    const uintptr_t address = (uintptr_t)base + sizeof(NC_AlignedHeader);
+
+    return (void*)((address + alignment - 1) & ~(uintptr_t)(alignment - 1));
+}
+
+static void* nc_p_system_malloc_aligned(size_t size, size_t alignment) {
+    void* const base = nc_p_system_malloc(nc_p_aligned_allocation_size(size, alignment));
+    if (base == NULL)
+        return NULL;
+
+    void* const ptr = nc_p_aligned_ptr(base, alignment);
+    *nc_p_aligned_header(ptr) = (NC_AlignedHeader) { .base = base, .size = size };
+
+    return ptr;
+}
+
+static void* nc_p_system_realloc_aligned(void* ptr, size_t new_size, size_t alignment) {
+    if (ptr == NULL)
+        return nc_p_system_malloc_aligned(new_size, alignment);
+
+    const NC_AlignedHeader header = *nc_p_aligned_header(ptr);
+    const size_t offset = (size_t)((uint8_t*)ptr - (uint8_t*)header.base);
+
+    void* const new_base = nc_p_system_realloc(header.base, nc_p_aligned_allocation_size(new_size, alignment));
+    if (new_base == NULL)
+        return NULL;
+
+    // System realloc might have moved the block to an address with different alignment
+    void* const new_ptr = nc_p_aligned_ptr(new_base, alignment);
+    const size_t new_offset = (size_t)((uint8_t*)new_ptr - (uint8_t*)new_base);
+    if (new_offset != offset)
+        memmove(new_ptr, (uint8_t*)new_base + offset, header.size < new_size ? header.size : new_size);
+
+    *nc_p_aligned_header(new_ptr) = (NC_AlignedHeader) { .base = new_base, .size = new_size };
+
+    return new_ptr;
+}
+
 
 void* nc_malloc(size_t size) {
-    void* const ptr = malloc(size);
+    void* const ptr = nc_p_system_malloc(size);
     if (ptr == NULL)
         nc_handle_out_of_memory();
 
@@ -14,7 +107,7 @@ void* nc_malloc(size_t size) {
 }
 
 void* nc_calloc(size_t count, size_t object_size) {
-    void* const ptr = calloc(count, object_size);
+    void* const ptr = nc_p_system_calloc(count, object_size);
     if (ptr == NULL)
         nc_handle_out_of_memory();
 
@@ -22,7 +115,7 @@ void* nc_calloc(size_t count, size_t object_size) {
 }
 
 void* nc_realloc(void* ptr, size_t new_size) {
-    void* const new_ptr = realloc(ptr, new_size);
+    void* const new_ptr = nc_p_system_realloc(ptr, new_size);
     if (new_ptr == NULL) {
         nc_handle_out_of_memory();
 
@@ -33,7 +126,7 @@ void* nc_realloc(void* ptr, size_t new_size) {
 }
 
 bool nc_realloc_preserving(void** in_out_ptr, size_t new_size) {
-    void* const new_ptr = realloc(*in_out_ptr, new_size);
+    void* const new_ptr = nc_p_system_realloc(*in_out_ptr, new_size);
     if (new_ptr == NULL) {
         nc_handle_out_of_memory();
         
@@ -46,5 +139,44 @@ bool nc_realloc_preserving(void** in_out_ptr, size_t new_size) {
 }
 
 void nc_free(void* ptr) {
-    free(ptr);
-}
\ No newline at end of file
+    nc_p_system_free(ptr);
+}
+
+void* nc_malloc_aligned(size_t size, size_t alignment) {
+    void* const ptr = nc_p_system_malloc_aligned(size, alignment);
+    if (ptr == NULL)
+        nc_handle_out_of_memory();
+
+    return ptr;
+}
+
+void* nc_realloc_aligned(void* ptr, size_t new_size, size_t alignment) {
+    void* const new_ptr = nc_p_system_realloc_aligned(ptr, new_size, alignment);
+    if (new_ptr == NULL) {
+        nc_handle_out_of_memory();
+
+        nc_free_aligned(ptr);
+    }
+
+    return new_ptr;
+}
+
+bool nc_realloc_aligned_preserving(void** in_out_ptr, size_t new_size, size_t alignment) {
+    void* const new_ptr = nc_p_system_realloc_aligned(*in_out_ptr, new_size, alignment);
+    if (new_ptr == NULL) {
+        nc_handle_out_of_memory();
+
+        return false;
+    }
+
+    *in_out_ptr = new_ptr;
+
+    return true;
+}
+
+void nc_free_aligned(void* ptr) {
+    if (ptr == NULL)
+        return;
+
+    nc_p_system_free(nc_p_aligned_header(ptr)->base);
+}
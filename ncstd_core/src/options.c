@@ -0,0 +1,6 @@
+#include "ncstd/options.h"
+
+
+NC_INSTANTIATE_OPTION(char32_t, char32)
+NC_INSTANTIATE_OPTION(size_t, size)
+NC_INSTANTIATE_OPTION(uint32_t, u32)
@@ -0,0 +1,274 @@
+#include "thread_cache.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <threads.h>
+
+#include "ncstd/allocator.h"
+
+
+// Every block is prefixed with a header storing its usable capacity,
+// so that nc_free() can find the size class without being told the size.
+static const size_t HEADER_SIZE =
+    (sizeof(size_t) + NC_DEFAULT_ALIGNMENT - 1) / NC_DEFAULT_ALIGNMENT * NC_DEFAULT_ALIGNMENT;
+
+#define MIN_SIZE_CLASS_SHIFT 4
+#define SIZE_CLASS_COUNT 9
+#define MAX_SIZE_CLASS_SIZE ((size_t)1 << (MIN_SIZE_CLASS_SHIFT + SIZE_CLASS_COUNT - 1))
+
+// Blocks move between thread caches and the depot in batches of this size
+#define BATCH_SIZE ((size_t)32)
+#define MAX_CACHED_BLOCKS (2 * BATCH_SIZE)
+#define MAX_DEPOT_BATCHES ((size_t)64)
+
+
+typedef struct NC_ThreadCacheBlock NC_ThreadCacheBlock;
+
+struct NC_ThreadCacheBlock {
+    NC_ThreadCacheBlock* next;
+    NC_ThreadCacheBlock* next_batch;
+};
+
+typedef struct {
+    NC_ThreadCacheBlock* lists[SIZE_CLASS_COUNT];
+    size_t counts[SIZE_CLASS_COUNT];
+    bool registered;
+} NC_ThreadCache;
+
+static _Thread_local NC_ThreadCache thread_cache;
+
+static struct {
+    NC_ThreadCacheBlock* batches[SIZE_CLASS_COUNT];
+    size_t batch_counts[SIZE_CLASS_COUNT];
+    mtx_t mutex;
+} depot;
+
+static once_flag depot_once = ONCE_FLAG_INIT;
+static tss_t thread_cache_key;
+
+
+static size_t* nc_p_thread_cache_capacity(void* ptr) {
+    return (size_t*)((uint8_t*)ptr - HEADER_SIZE);
+}
+
+static size_t nc_p_thread_cache_size_class(size_t size) {
+    if (size <= ((size_t)1 << MIN_SIZE_CLASS_SHIFT))
+        return 0;
+
+#if defined(__GNUC__) || defined(__clang__)
+    // Index of the highest set bit of (size - 1), plus one, is the shift of the smallest fitting power of two
+    const size_t shift = sizeof(unsigned long long) * 8 - (size_t)__builtin_clzll((unsigned long long)(size - 1));
+
+    return shift - MIN_SIZE_CLASS_SHIFT;
+#else
+    size_t size_class = 0;
+    while (((size_t)1 << (MIN_SIZE_CLASS_SHIFT + size_class)) < size)
+        ++size_class;
+
+    return size_class;
+#endif
+}
+
+static size_t nc_p_thread_cache_size_class_size(size_t size_class) {
+    return (size_t)1 << (MIN_SIZE_CLASS_SHIFT + size_class);
+}
+
+static void* nc_p_thread_cache_system_alloc(size_t capacity) {
+    uint8_t* const base = malloc(HEADER_SIZE + capacity);
+    if (base == NULL)
+        return NULL;
+
+    void* const ptr = base + HEADER_SIZE;
+    *nc_p_thread_cache_capacity(ptr) = capacity;
+
+    return ptr;
+}
+
+static void nc_p_thread_cache_system_free(void* ptr) {
+    free((uint8_t*)ptr - HEADER_SIZE);
+}
+
+static void nc_p_thread_cache_release_batch(NC_ThreadCacheBlock* batch) {
+    while (batch != NULL) {
+        NC_ThreadCacheBlock* const next = batch->next;
+        nc_p_thread_cache_system_free(batch);
+
+        batch = next;
+    }
+}
+
+static void nc_p_depot_push(size_t size_class, NC_ThreadCacheBlock* batch) {
+    mtx_lock(&depot.mutex);
+
+    const bool is_full = depot.batch_counts[size_class] >= MAX_DEPOT_BATCHES;
+    if (!is_full) {
+        batch->next_batch = depot.batches[size_class];
+        depot.batches[size_class] = batch;
+        depot.batch_counts[size_class] += 1;
+    }
+
+    mtx_unlock(&depot.mutex);
+
+    if (is_full)
+        nc_p_thread_cache_release_batch(batch);
+}
+
+static NC_ThreadCacheBlock* nc_p_depot_pop(size_t size_class) {
+    mtx_lock(&depot.mutex);
+
+    NC_ThreadCacheBlock* const batch = depot.batches[size_class];
+    if (batch != NULL) {
+        depot.batches[size_class] = batch->next_batch;
+        depot.batch_counts[size_class] -= 1;
+    }
+
+    mtx_unlock(&depot.mutex);
+
+    return batch;
+}
+
+static void nc_p_thread_cache_flush(void* cache_ptr) {
+    NC_ThreadCache* const cache = cache_ptr;
+
+    for (size_t size_class = 0; size_class < SIZE_CLASS_COUNT; ++size_class) {
+        if (cache->lists[size_class] != NULL)
+            nc_p_depot_push(size_class, cache->lists[size_class]);
+
+        cache->lists[size_class] = NULL;
+        cache->counts[size_class] = 0;
+    }
+
+    cache->registered = false;
+}
+
+static void nc_p_depot_init() {
+    mtx_init(&depot.mutex, mtx_plain);
+    tss_create(&thread_cache_key, nc_p_thread_cache_flush);
+}
+
+static NC_ThreadCache* nc_p_thread_cache_get() {
+    NC_ThreadCache* const cache = &thread_cache;
+    if (!cache->registered) {
+        call_once(&depot_once, nc_p_depot_init);
+
+        // Registering the cache makes the destructor return its blocks to the depot on thread exit
+        tss_set(thread_cache_key, cache);
+        cache->registered = true;
+    }
+
+    return cache;
+}
+
+static bool nc_p_thread_cache_refill(NC_ThreadCache* cache, size_t size_class) {
+    NC_ThreadCacheBlock* const batch = nc_p_depot_pop(size_class);
+    if (batch == NULL)
+        return false;
+
+    size_t count = 0;
+    for (NC_ThreadCacheBlock* block = batch; block != NULL; block = block->next)
+        ++count;
+
+    cache->lists[size_class] = batch;
+    cache->counts[size_class] = count;
+
+    return true;
+}
+
+static void nc_p_thread_cache_drain(NC_ThreadCache* cache, size_t size_class) {
+    NC_ThreadCacheBlock* const batch = cache->lists[size_class];
+
+    NC_ThreadCacheBlock* last = batch;
+    for (size_t i = 1; i < BATCH_SIZE; ++i)
+        last = last->next;
+
+    cache->lists[size_class] = last->next;
+    cache->counts[size_class] -= BATCH_SIZE;
+    last->next = NULL;
+
+    nc_p_depot_push(size_class, batch);
+}
+
+
+void* nc_p_thread_cache_malloc(size_t size) {
+    if (size > MAX_SIZE_CLASS_SIZE)
+        return nc_p_thread_cache_system_alloc(size);
+
+    const size_t size_class = nc_p_thread_cache_size_class(size);
+    NC_ThreadCache* const cache = nc_p_thread_cache_get();
+
+    if (cache->lists[size_class] == NULL && !nc_p_thread_cache_refill(cache, size_class))
+        return nc_p_thread_cache_system_alloc(nc_p_thread_cache_size_class_size(size_class));
+
+    NC_ThreadCacheBlock* const block = cache->lists[size_class];
+    cache->lists[size_class] = block->next;
+    cache->counts[size_class] -= 1;
+
+    return block;
+}
+
+void* nc_p_thread_cache_calloc(size_t count, size_t object_size) {
+    if (object_size != 0 && count > SIZE_MAX / object_size)
+        return NULL;
+
+    void* const ptr = nc_p_thread_cache_malloc(count * object_size);
+    if (ptr != NULL)
+        memset(ptr, 0, count * object_size);
+
+    return ptr;
+}
+
+void* nc_p_thread_cache_realloc(void* ptr, size_t new_size) {
+    if (ptr == NULL)
+        return nc_p_thread_cache_malloc(new_size);
+
+    const size_t capacity = *nc_p_thread_cache_capacity(ptr);
+
+    if (capacity > MAX_SIZE_CLASS_SIZE && new_size > MAX_SIZE_CLASS_SIZE) {
+        uint8_t* const base = realloc((uint8_t*)ptr - HEADER_SIZE, HEADER_SIZE + new_size);
+        if (base == NULL)
+            return NULL;
+
+        void* const new_ptr = base + HEADER_SIZE;
+        *nc_p_thread_cache_capacity(new_ptr) = new_size;
+
+        return new_ptr;
+    }
+
+    if (capacity <= MAX_SIZE_CLASS_SIZE && new_size <= MAX_SIZE_CLASS_SIZE &&
+        nc_p_thread_cache_size_class(new_size) == nc_p_thread_cache_size_class(capacity))
+        return ptr;
+
+    void* const new_ptr = nc_p_thread_cache_malloc(new_size);
+    if (new_ptr == NULL)
+        return NULL;
+
+    memcpy(new_ptr, ptr, capacity < new_size ? capacity : new_size);
+    nc_p_thread_cache_free(ptr);
+
+    return new_ptr;
+}
+
+void nc_p_thread_cache_free(void* ptr) {
+    if (ptr == NULL)
+        return;
+
+    const size_t capacity = *nc_p_thread_cache_capacity(ptr);
+    if (capacity > MAX_SIZE_CLASS_SIZE) {
+        nc_p_thread_cache_system_free(ptr);
+
+        return;
+    }
+
+    const size_t size_class = nc_p_thread_cache_size_class(capacity);
+    NC_ThreadCache* const cache = nc_p_thread_cache_get();
+
+    NC_ThreadCacheBlock* const block = ptr;
+    block->next = cache->lists[size_class];
+    cache->lists[size_class] = block;
+    cache->counts[size_class] += 1;
+
+    if (cache->counts[size_class] > MAX_CACHED_BLOCKS)
+        nc_p_thread_cache_drain(cache, size_class);
+}
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <stddef.h>
+
+
+// Thread-local size class caches in front of the system allocator.
+// Memory returned by these functions must be released with nc_p_thread_cache_free().
+
+void* nc_p_thread_cache_malloc(size_t size);
+void* nc_p_thread_cache_calloc(size_t count, size_t object_size);
+void* nc_p_thread_cache_realloc(void* ptr, size_t new_size);
+void nc_p_thread_cache_free(void* ptr);
@@ -2,4 +2,6 @@
 
 
 extern inline void* nc_util_create_with(void* self_init, size_t size);
-extern inline void* nc_util_create_with_flexible(void* self_init, size_t size, void* flexible_init, size_t flexible_size);
\ No newline at end of file
+extern inline void* nc_util_create_with_in(void* self_init, size_t size, NC_Allocator* allocator);
+extern inline void* nc_util_create_with_flexible(void* self_init, size_t size, void* flexible_init, size_t flexible_size);
+extern inline void* nc_util_create_with_flexible_in(void* self_init, size_t size, void* flexible_init, size_t flexible_size, NC_Allocator* allocator);
\ No newline at end of file
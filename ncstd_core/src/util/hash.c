@@ -0,0 +1,223 @@
+#include "ncstd/util/hash.h"
+
+#include <stdbool.h>
+#include <string.h>
+
+
+static const uint64_t HASH_SECRET[4] = {
+    0x2D358DCCAA6C78A5ull,
+    0x8BB84B93962EACC9ull,
+    0x4B33A62ED433D4A3ull,
+    0x4D5A2DA51DE1AA47ull
+};
+
+#define HASH_BLOCK_SIZE 48
+#define HASH_TAIL_SIZE 16
+
+#if defined(__SIZEOF_INT128__)
+__extension__ typedef unsigned __int128 NC_UInt128;
+#endif
+
+
+static void nc_p_hash_multiply(uint64_t* a, uint64_t* b) {
+#if defined(__SIZEOF_INT128__)
+    const NC_UInt128 product = (NC_UInt128)*a * *b;
+    *a = (uint64_t)product;
+    *b = (uint64_t)(product >> 64);
+#else
+    const uint64_t a_high = *a >> 32, a_low = (uint32_t)*a;
+    const uint64_t b_high = *b >> 32, b_low = (uint32_t)*b;
+
+    const uint64_t high_high = a_high * b_high;
+    const uint64_t high_low = a_high * b_low;
+    const uint64_t low_high = a_low * b_high;
+    const uint64_t low_low = a_low * b_low;
+
+    const uint64_t middle = high_low + (low_low >> 32) + (uint32_t)low_high;
+    *a = (middle << 32) | (uint32_t)low_low;
+    *b = high_high + (middle >> 32) + (low_high >> 32);
+#endif
+}
+
+static uint64_t nc_p_hash_mix(uint64_t a, uint64_t b) {
+    nc_p_hash_multiply(&a, &b);
+
+    return a ^ b;
+}
+
+static uint64_t nc_p_hash_read_u64(const uint8_t* bytes) {
+    uint64_t value;
+    memcpy(&value, bytes, sizeof(value));
+
+    return value;
+}
+
+static uint64_t nc_p_hash_read_u32(const uint8_t* bytes) {
+    uint32_t value;
+    memcpy(&value, bytes, sizeof(value));
+
+    return value;
+}
+
+static uint64_t nc_p_hash_seed(uint64_t seed) {
+    return seed ^ nc_p_hash_mix(seed ^ HASH_SECRET[0], HASH_SECRET[1]);
+}
+
+static void nc_p_hash_block(uint64_t lanes[3], const uint8_t* block) {
+    lanes[0] = nc_p_hash_mix(nc_p_hash_read_u64(block) ^ HASH_SECRET[1], nc_p_hash_read_u64(block + 8) ^ lanes[0]);
+    lanes[1] = nc_p_hash_mix(nc_p_hash_read_u64(block + 16) ^ HASH_SECRET[2], nc_p_hash_read_u64(block + 24) ^ lanes[1]);
+    lanes[2] = nc_p_hash_mix(nc_p_hash_read_u64(block + 32) ^ HASH_SECRET[3], nc_p_hash_read_u64(block + 40) ^ lanes[2]);
+}
+
+// Reads inputs of up to 16 bytes with overlapping loads
+static void nc_p_hash_read_short(const uint8_t* bytes, size_t size, uint64_t* a, uint64_t* b) {
+    if (size >= 4) {
+        const size_t offset = (size >> 3) << 2;
+        *a = (nc_p_hash_read_u32(bytes) << 32) | nc_p_hash_read_u32(bytes + offset);
+        *b = (nc_p_hash_read_u32(bytes + size - 4) << 32) | nc_p_hash_read_u32(bytes + size - 4 - offset);
+    } else if (size > 0) {
+        *a = ((uint64_t)bytes[0] << 16) | ((uint64_t)bytes[size >> 1] << 8) | bytes[size - 1];
+        *b = 0;
+    } else {
+        *a = 0;
+        *b = 0;
+    }
+}
+
+// Consumes remaining (at most 48) bytes of a long input, `last` points to the last 16 bytes of the input
+static uint64_t nc_p_hash_finish_long(
+    uint64_t seed,
+    const uint8_t* bytes,
+    size_t size,
+    const uint8_t* last,
+    uint64_t* a,
+    uint64_t* b
+) {
+    for (; size > HASH_TAIL_SIZE; size -= HASH_TAIL_SIZE, bytes += HASH_TAIL_SIZE)
+        seed = nc_p_hash_mix(nc_p_hash_read_u64(bytes) ^ HASH_SECRET[1], nc_p_hash_read_u64(bytes + 8) ^ seed);
+
+    *a = nc_p_hash_read_u64(last);
+    *b = nc_p_hash_read_u64(last + 8);
+
+    return seed;
+}
+
+static uint64_t nc_p_hash_finalize(uint64_t seed, uint64_t a, uint64_t b, size_t size) {
+    a ^= HASH_SECRET[1];
+    b ^= seed;
+    nc_p_hash_multiply(&a, &b);
+
+    return nc_p_hash_mix(a ^ HASH_SECRET[0] ^ size, b ^ HASH_SECRET[1]);
+}
+
+uint64_t nc_hash_u64(uint64_t value) {
+    // Finalizer of MurmurHash3
+    value ^= value >> 33;
+    value *= 0xFF51AFD7ED558CCDull;
+    value ^= value >> 33;
+    value *= 0xC4CEB9FE1A85EC53ull;
+    value ^= value >> 33;
+
+    return value;
+}
+
+uint64_t nc_hash_bytes(const void* data, size_t size) {
+    return nc_hash_bytes_seeded(data, size, 0);
+}
+
+uint64_t nc_hash_bytes_seeded(const void* data, size_t size, uint64_t seed) {
+    const uint8_t* bytes = data;
+    seed = nc_p_hash_seed(seed);
+
+    uint64_t a, b;
+    if (size <= HASH_TAIL_SIZE) {
+        nc_p_hash_read_short(bytes, size, &a, &b);
+    } else {
+        size_t remaining = size;
+        if (remaining > HASH_BLOCK_SIZE) {
+            uint64_t lanes[3] = { seed, seed, seed };
+            do {
+                nc_p_hash_block(lanes, bytes);
+                bytes += HASH_BLOCK_SIZE;
+                remaining -= HASH_BLOCK_SIZE;
+            } while (remaining > HASH_BLOCK_SIZE);
+
+            seed = lanes[0] ^ lanes[1] ^ lanes[2];
+        }
+
+        seed = nc_p_hash_finish_long(seed, bytes, remaining, bytes + remaining - HASH_TAIL_SIZE, &a, &b);
+    }
+
+    return nc_p_hash_finalize(seed, a, b, size);
+}
+
+NC_Hasher nc_hasher_init() {
+    return nc_hasher_init_seeded(0);
+}
+
+NC_Hasher nc_hasher_init_seeded(uint64_t seed) {
+    seed = nc_p_hash_seed(seed);
+
+    return (NC_Hasher) {
+        .p = {
+            .lanes = { seed, seed, seed },
+            .buffer_size = 0,
+            .total_size = 0
+        }
+    };
+}
+
+void nc_hasher_update(NC_Hasher* self, const void* data, size_t size) {
+    const uint8_t* bytes = data;
+    self->p.total_size += size;
+
+    while (size > 0) {
+        // Full block is consumed only once more data arrives, since the last block is handled by finish
+        if (self->p.buffer_size == HASH_BLOCK_SIZE) {
+            nc_p_hash_block(self->p.lanes, self->p.buffer);
+            memcpy(self->p.tail, self->p.buffer + HASH_BLOCK_SIZE - HASH_TAIL_SIZE, HASH_TAIL_SIZE);
+            self->p.buffer_size = 0;
+        }
+
+        // Consume whole blocks directly, leaving at least one byte for the buffer
+        if (self->p.buffer_size == 0) {
+            for (; size > HASH_BLOCK_SIZE; size -= HASH_BLOCK_SIZE, bytes += HASH_BLOCK_SIZE) {
+                nc_p_hash_block(self->p.lanes, bytes);
+                memcpy(self->p.tail, bytes + HASH_BLOCK_SIZE - HASH_TAIL_SIZE, HASH_TAIL_SIZE);
+            }
+        }
+
+        const size_t free_space = HASH_BLOCK_SIZE - self->p.buffer_size;
+        const size_t count = size < free_space ? size : free_space;
+        memcpy(self->p.buffer + self->p.buffer_size, bytes, count);
+        self->p.buffer_size += count;
+        bytes += count;
+        size -= count;
+    }
+}
+
+uint64_t nc_hasher_finish(const NC_Hasher* self) {
+    const size_t size = self->p.total_size;
+    const size_t buffer_size = self->p.buffer_size;
+
+    uint64_t a, b;
+    if (size <= HASH_TAIL_SIZE) {
+        nc_p_hash_read_short(self->p.buffer, size, &a, &b);
+
+        return nc_p_hash_finalize(self->p.lanes[0], a, b, size);
+    }
+
+    uint64_t seed = self->p.lanes[0];
+    const bool has_blocks = size > HASH_BLOCK_SIZE;
+    if (has_blocks)
+        seed = self->p.lanes[0] ^ self->p.lanes[1] ^ self->p.lanes[2];
+
+    // Last 16 bytes may start in the already consumed data
+    uint8_t last[HASH_TAIL_SIZE + HASH_BLOCK_SIZE];
+    memcpy(last, self->p.tail, HASH_TAIL_SIZE);
+    memcpy(last + HASH_TAIL_SIZE, self->p.buffer, buffer_size);
+
+    seed = nc_p_hash_finish_long(seed, self->p.buffer, buffer_size, last + buffer_size, &a, &b);
+
+    return nc_p_hash_finalize(seed, a, b, size);
+}
@@ -0,0 +1,14 @@
+#include "ncstd/util/sort.h"
+
+
+extern inline uint64_t nc_radix_key_i64(int64_t value);
+extern inline uint64_t nc_radix_key_i32(int32_t value);
+extern inline uint64_t nc_radix_key_f64(double value);
+extern inline uint64_t nc_radix_key_f32(float value);
+
+NC_INSTANTIATE_RADIX_SORT(uint32_t, u32)
+NC_INSTANTIATE_RADIX_SORT(uint64_t, u64)
+NC_INSTANTIATE_RADIX_SORT(int32_t, i32)
+NC_INSTANTIATE_RADIX_SORT(int64_t, i64)
+NC_INSTANTIATE_RADIX_SORT(float, f32)
+NC_INSTANTIATE_RADIX_SORT(double, f64)
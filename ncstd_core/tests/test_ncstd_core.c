@@ -1,8 +1,52 @@
 #include "ncstd/test/test_common.h"
 
 #include "tests/test_smth.c"
+#include "tests/test_allocator.c"
+#include "tests/test_alloc_stats.c"
+#include "tests/test_arena.c"
+#include "tests/test_bit_set.c"
+#include "tests/test_bloom_filter.c"
+#include "tests/test_btree_map.c"
+#include "tests/test_deque.c"
+#include "tests/test_hash.c"
+#include "tests/test_hash_map.c"
+#include "tests/test_heap.c"
+#include "tests/test_mapped.c"
+#include "tests/test_memory.c"
+#include "tests/test_mpmc_queue.c"
+#include "tests/test_option.c"
+#include "tests/test_pool.c"
+#include "tests/test_segmented_vec.c"
+#include "tests/test_small_vec.c"
+#include "tests/test_sort.c"
+#include "tests/test_spsc_queue.c"
+#include "tests/test_vec.c"
 
 
 int main() {
-    return cmocka_run_group_tests(smth_tests, NULL, NULL); // +
+    int failed = 0;
+
+    failed += cmocka_run_group_tests(smth_tests, NULL, NULL); // +
+    failed += cmocka_run_group_tests(allocator_tests, NULL, NULL);
+    failed += cmocka_run_group_tests(alloc_stats_tests, NULL, NULL);
+    failed += cmocka_run_group_tests(arena_tests, NULL, NULL);
+    failed += cmocka_run_group_tests(bit_set_tests, NULL, NULL);
+    failed += cmocka_run_group_tests(bloom_filter_tests, NULL, NULL);
+    failed += cmocka_run_group_tests(btree_map_tests, NULL, NULL);
+    failed += cmocka_run_group_tests(deque_tests, NULL, NULL);
+    failed += cmocka_run_group_tests(hash_tests, NULL, NULL);
+    failed += cmocka_run_group_tests(hash_map_tests, NULL, NULL);
+    failed += cmocka_run_group_tests(heap_tests, NULL, NULL);
+    failed += cmocka_run_group_tests(mapped_tests, NULL, NULL);
+    failed += cmocka_run_group_tests(memory_tests, NULL, NULL);
+    failed += cmocka_run_group_tests(mpmc_queue_tests, NULL, NULL);
+    failed += cmocka_run_group_tests(option_tests, NULL, NULL);
+    failed += cmocka_run_group_tests(pool_tests, NULL, NULL);
+    failed += cmocka_run_group_tests(segmented_vec_tests, NULL, NULL);
+    failed += cmocka_run_group_tests(small_vec_tests, NULL, NULL);
+    failed += cmocka_run_group_tests(sort_tests, NULL, NULL);
+    failed += cmocka_run_group_tests(spsc_queue_tests, NULL, NULL);
+    failed += cmocka_run_group_tests(vec_tests, NULL, NULL);
+
+    return failed;
 }
@@ -0,0 +1,45 @@
+#include "ncstd/test/test_common.h"
+
+#include "ncstd/alloc_stats.h"
+#include "ncstd/containers/unsafe/raw_buffer.h"
+
+
+static void alloc_stats_dump_to_buffer(char* buffer, size_t size) {
+    FILE* const stream = tmpfile();
+    assert_non_null(stream);
+
+    nc_alloc_stats_dump(stream);
+
+    rewind(stream);
+    const size_t length = fread(buffer, 1, size - 1, stream);
+    buffer[length] = '\0';
+
+    fclose(stream);
+}
+
+void alloc_stats_records_call_sites_test(void** state) {
+    (void)state;
+
+    nc_alloc_stats_reset();
+
+    NC_RawBuffer buffer = nc_raw_buffer_init_with_capacity(4, sizeof(int));
+    nc_raw_buffer_resize_unchecked(&buffer, 64, sizeof(int));
+    nc_raw_buffer_free(&buffer, sizeof(int));
+
+    char report[8192];
+    alloc_stats_dump_to_buffer(report, sizeof report);
+
+#ifdef NC_ALLOC_STATS
+    assert_non_null(strstr(report, "\"enabled\":true"));
+    assert_non_null(strstr(report, "\"site\":\"nc_raw_buffer_init_with_capacity_aligned_in\""));
+    assert_non_null(strstr(report, "\"site\":\"nc_raw_buffer_resize_unchecked\""));
+    assert_non_null(strstr(report, "\"total\":{\"allocations\":1,\"allocated_bytes\":16,\"reallocations\":1,"
+        "\"realloc_copy_bytes\":16,\"deallocations\":1,\"freed_bytes\":256,\"live_bytes\":0,\"peak_live_bytes\":256}"));
+#else
+    assert_string_equal(report, "{\"enabled\":false}\n");
+#endif
+}
+
+static const struct CMUnitTest alloc_stats_tests[] = {
+    cmocka_unit_test(alloc_stats_records_call_sites_test)
+};
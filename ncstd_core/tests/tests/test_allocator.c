@@ -0,0 +1,172 @@
+#include "ncstd/test/test_common.h"
+
+#include "ncstd/allocator.h"
+#include "ncstd/containers/unsafe/raw_buffer.h"
+#include "ncstd/memory.h"
+#include "ncstd/util/create_util.h"
+
+#include <stdint.h>
+#include <string.h>
+
+
+typedef struct {
+    NC_Allocator allocator;
+    size_t live_bytes;
+    size_t allocation_count;
+} CountingAllocator;
+
+static void* counting_alloc(NC_Allocator* allocator, size_t size, size_t alignment) {
+    CountingAllocator* const self = (CountingAllocator*)allocator;
+    self->live_bytes += size;
+    self->allocation_count += 1;
+
+    return nc_allocator_alloc(nc_allocator_default(), size, alignment);
+}
+
+static void* counting_realloc(NC_Allocator* allocator, void* ptr, size_t old_size, size_t new_size, size_t alignment) {
+    CountingAllocator* const self = (CountingAllocator*)allocator;
+    self->live_bytes += new_size - old_size;
+
+    return nc_allocator_realloc(nc_allocator_default(), ptr, old_size, new_size, alignment);
+}
+
+static void counting_free(NC_Allocator* allocator, void* ptr, size_t size, size_t alignment) {
+    CountingAllocator* const self = (CountingAllocator*)allocator;
+    self->live_bytes -= size;
+
+    nc_allocator_free(nc_allocator_default(), ptr, size, alignment);
+}
+
+static const NC_AllocatorVtable COUNTING_ALLOCATOR_VTABLE = {
+    .alloc_fn = counting_alloc,
+    .realloc_fn = counting_realloc,
+    .free_fn = counting_free
+};
+
+
+void allocator_raw_buffer_uses_custom_allocator_test(void** state) {
+    (void)state;
+
+    CountingAllocator counting = { .allocator = { .vtable = &COUNTING_ALLOCATOR_VTABLE } };
+
+    NC_RawBuffer buffer = nc_raw_buffer_init_with_capacity_in(4, sizeof(int), &counting.allocator);
+    assert_ptr_equal(nc_raw_buffer_allocator(&buffer), &counting.allocator);
+    assert_int_equal(counting.live_bytes, 4 * sizeof(int));
+
+    nc_raw_buffer_grow_amorthized(&buffer, 10, 2, sizeof(int));
+    assert_int_equal(nc_raw_buffer_capacity(&buffer), 10);
+    assert_int_equal(counting.live_bytes, 10 * sizeof(int));
+
+    nc_raw_buffer_free(&buffer, sizeof(int));
+    assert_int_equal(counting.live_bytes, 0);
+    assert_int_equal(counting.allocation_count, 1);
+}
+
+void allocator_default_is_used_by_default_test(void** state) {
+    (void)state;
+
+    NC_RawBuffer buffer = nc_raw_buffer_init(sizeof(int));
+    assert_ptr_equal(nc_raw_buffer_allocator(&buffer), nc_allocator_default());
+
+    nc_raw_buffer_resize_unchecked(&buffer, 8, sizeof(int));
+    assert_non_null(nc_raw_buffer_data(&buffer));
+
+    nc_raw_buffer_free(&buffer, sizeof(int));
+}
+
+void allocator_malloc_aligned_test(void** state) {
+    (void)state;
+
+    uint8_t* ptr = nc_malloc_aligned(100, 64);
+    assert_non_null(ptr);
+    assert_int_equal((uintptr_t)ptr % 64, 0);
+    for (size_t i = 0; i < 100; ++i)
+        ptr[i] = (uint8_t)i;
+
+    ptr = nc_realloc_aligned(ptr, 100000, 64);
+    assert_non_null(ptr);
+    assert_int_equal((uintptr_t)ptr % 64, 0);
+    for (size_t i = 0; i < 100; ++i)
+        assert_int_equal(ptr[i], (uint8_t)i);
+
+    const uint8_t expected[] = { 0, 1, 2, 3 };
+    void* preserved = ptr;
+    assert_true(nc_realloc_aligned_preserving(&preserved, 32, 64));
+    assert_int_equal((uintptr_t)preserved % 64, 0);
+    assert_memory_equal(preserved, expected, sizeof(expected));
+
+    nc_free_aligned(preserved);
+    nc_free_aligned(NULL);
+}
+
+void allocator_default_overaligned_test(void** state) {
+    (void)state;
+
+    NC_Allocator* const allocator = nc_allocator_default();
+
+    uint8_t* ptr = nc_allocator_alloc(allocator, 24, 256);
+    assert_non_null(ptr);
+    assert_int_equal((uintptr_t)ptr % 256, 0);
+    memset(ptr, 0xAB, 24);
+
+    ptr = nc_allocator_realloc(allocator, ptr, 24, 4096, 256);
+    assert_non_null(ptr);
+    assert_int_equal((uintptr_t)ptr % 256, 0);
+    assert_int_equal(ptr[23], 0xAB);
+
+    nc_allocator_free(allocator, ptr, 4096, 256);
+}
+
+void allocator_raw_buffer_keeps_alignment_test(void** state) {
+    (void)state;
+
+    NC_RawBuffer buffer = nc_raw_buffer_init_with_capacity_aligned(3, sizeof(float), NC_CACHE_LINE_SIZE);
+    assert_int_equal(nc_raw_buffer_alignment(&buffer), NC_CACHE_LINE_SIZE);
+    assert_int_equal((uintptr_t)nc_raw_buffer_data(&buffer) % NC_CACHE_LINE_SIZE, 0);
+
+    for (size_t i = 0; i < 10; ++i) {
+        nc_raw_buffer_grow_amorthized(&buffer, nc_raw_buffer_capacity(&buffer) + 1, 2, sizeof(float));
+        assert_int_equal((uintptr_t)nc_raw_buffer_data(&buffer) % NC_CACHE_LINE_SIZE, 0);
+    }
+
+    nc_raw_buffer_free(&buffer, sizeof(float));
+}
+
+void allocator_create_util_test(void** state) {
+    (void)state;
+
+    typedef struct {
+        uint32_t a;
+        uint64_t b;
+        uint8_t flex[];
+    } Foo;
+
+    // Objects come from the default allocator, and are released through it
+    Foo* const foo = nc_util_create_with(&(Foo) { .a = 1, .b = 2 }, sizeof(Foo));
+    assert_non_null(foo);
+    assert_int_equal(foo->a, 1);
+    assert_int_equal(foo->b, 2);
+    nc_allocator_free(nc_allocator_default(), foo, sizeof(Foo), NC_DEFAULT_ALIGNMENT);
+
+    const uint8_t bytes[] = { 5, 6, 7 };
+    Foo* const flexible = nc_util_create_with_flexible(&(Foo) { .a = 3, .b = 4 }, sizeof(Foo), (void*)bytes, sizeof(bytes));
+    assert_non_null(flexible);
+    assert_int_equal(flexible->b, 4);
+    assert_memory_equal(flexible->flex, bytes, sizeof(bytes));
+    nc_allocator_free(nc_allocator_default(), flexible, sizeof(Foo) + sizeof(bytes), NC_DEFAULT_ALIGNMENT);
+
+    CountingAllocator counting = { .allocator = { .vtable = &COUNTING_ALLOCATOR_VTABLE } };
+    Foo* const counted = nc_util_create_with_in(&(Foo) { .a = 5 }, sizeof(Foo), &counting.allocator);
+    assert_int_equal(counting.live_bytes, sizeof(Foo));
+    nc_allocator_free(&counting.allocator, counted, sizeof(Foo), NC_DEFAULT_ALIGNMENT);
+    assert_int_equal(counting.live_bytes, 0);
+}
+
+static const struct CMUnitTest allocator_tests[] = {
+    cmocka_unit_test(allocator_raw_buffer_uses_custom_allocator_test),
+    cmocka_unit_test(allocator_default_is_used_by_default_test),
+    cmocka_unit_test(allocator_malloc_aligned_test),
+    cmocka_unit_test(allocator_default_overaligned_test),
+    cmocka_unit_test(allocator_raw_buffer_keeps_alignment_test),
+    cmocka_unit_test(allocator_create_util_test)
+};
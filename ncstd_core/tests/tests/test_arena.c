@@ -0,0 +1,71 @@
+#include "ncstd/test/test_common.h"
+
+#include "ncstd/allocators/arena.h"
+#include "ncstd/containers/unsafe/raw_buffer.h"
+
+
+void arena_alloc_respects_alignment_test(void** state) {
+    (void)state;
+
+    NC_Arena arena = nc_arena_init_with_chunk_size(256);
+
+    nc_arena_alloc(&arena, 1, 1);
+    void* const aligned = nc_arena_alloc(&arena, 8, 64);
+    assert_int_equal((uintptr_t)aligned % 64, 0);
+
+    void* const oversized = nc_arena_alloc(&arena, 1024, 16);
+    assert_non_null(oversized);
+    assert_int_equal((uintptr_t)oversized % 16, 0);
+
+    nc_arena_destroy(&arena);
+}
+
+void arena_reset_to_mark_reuses_memory_test(void** state) {
+    (void)state;
+
+    NC_Arena arena = nc_arena_init_with_chunk_size(128);
+
+    void* const before = nc_arena_alloc(&arena, 16, 8);
+    const NC_ArenaMark mark = nc_arena_mark(&arena);
+
+    void* const first = nc_arena_alloc(&arena, 16, 8);
+    for (size_t i = 0; i < 32; ++i)
+        nc_arena_alloc(&arena, 16, 8);
+
+    nc_arena_reset_to_mark(&arena, mark);
+    assert_ptr_equal(nc_arena_alloc(&arena, 16, 8), first);
+
+    nc_arena_reset(&arena);
+    assert_ptr_equal(nc_arena_alloc(&arena, 16, 8), before);
+
+    nc_arena_destroy(&arena);
+}
+
+void arena_backs_raw_buffer_test(void** state) {
+    (void)state;
+
+    NC_Arena arena = nc_arena_init();
+
+    NC_RawBuffer buffer = nc_raw_buffer_init_in(sizeof(int), nc_arena_allocator(&arena));
+    for (int i = 0; i < 100; ++i) {
+        nc_raw_buffer_grow_amorthized(&buffer, (size_t)i + 1, 2, sizeof(int));
+        nc_raw_buffer_set(&buffer, &i, (size_t)i, sizeof(int));
+    }
+
+    for (int i = 0; i < 100; ++i)
+        assert_int_equal(*(int*)nc_raw_buffer_get(&buffer, (size_t)i, sizeof(int)), i);
+
+    // Growing the most recent allocation happens in place
+    void* const data = nc_raw_buffer_data(&buffer);
+    nc_raw_buffer_resize_unchecked(&buffer, nc_raw_buffer_capacity(&buffer) * 2, sizeof(int));
+    assert_ptr_equal(nc_raw_buffer_data(&buffer), data);
+
+    nc_raw_buffer_free(&buffer, sizeof(int));
+    nc_arena_destroy(&arena);
+}
+
+static const struct CMUnitTest arena_tests[] = {
+    cmocka_unit_test(arena_alloc_respects_alignment_test),
+    cmocka_unit_test(arena_reset_to_mark_reuses_memory_test),
+    cmocka_unit_test(arena_backs_raw_buffer_test)
+};
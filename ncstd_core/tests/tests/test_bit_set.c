@@ -0,0 +1,122 @@
+#include "ncstd/test/test_common.h"
+
+#include "ncstd/containers/bit_set.h"
+
+
+void bit_set_set_clear_test_test(void** state) {
+    (void)state;
+
+    NC_BitSet bits = nc_bit_set_init_with_size(300);
+    assert_int_equal(nc_bit_set_size(&bits), 300);
+    assert_int_equal(nc_bit_set_count(&bits), 0);
+    assert_int_equal((uintptr_t)nc_bit_set_words(&bits) % 32, 0);
+
+    nc_bit_set_set(&bits, 0);
+    nc_bit_set_set(&bits, 63);
+    nc_bit_set_set(&bits, 64);
+    nc_bit_set_set(&bits, 299);
+    assert_true(nc_bit_set_test(&bits, 63));
+    assert_false(nc_bit_set_test(&bits, 62));
+    assert_int_equal(nc_bit_set_count(&bits), 4);
+
+    nc_bit_set_clear(&bits, 63);
+    assert_false(nc_bit_set_test(&bits, 63));
+    assert_int_equal(nc_bit_set_count(&bits), 3);
+
+    // Bits past the size stay cleared
+    nc_bit_set_set_all(&bits);
+    assert_int_equal(nc_bit_set_count(&bits), 300);
+    nc_bit_set_clear_all(&bits);
+    assert_int_equal(nc_bit_set_count(&bits), 0);
+
+    nc_bit_set_destroy(&bits);
+}
+
+void bit_set_resize_test(void** state) {
+    (void)state;
+
+    NC_BitSet bits = nc_bit_set_init();
+    assert_int_equal(nc_bit_set_find_first(&bits), 0);
+
+    assert_true(nc_bit_set_resize(&bits, 100));
+    nc_bit_set_set_all(&bits);
+
+    // Shrinking drops the bits, growing back brings cleared ones
+    assert_true(nc_bit_set_resize(&bits, 10));
+    assert_int_equal(nc_bit_set_count(&bits), 10);
+    assert_true(nc_bit_set_resize(&bits, 1000));
+    assert_int_equal(nc_bit_set_count(&bits), 10);
+    assert_false(nc_bit_set_test(&bits, 10));
+    assert_false(nc_bit_set_test(&bits, 99));
+
+    nc_bit_set_destroy(&bits);
+}
+
+void bit_set_bulk_operations_test(void** state) {
+    (void)state;
+
+    NC_BitSet a = nc_bit_set_init_with_size(1000);
+    NC_BitSet b = nc_bit_set_init_with_size(1000);
+    for (size_t i = 0; i < 1000; i += 2)
+        nc_bit_set_set(&a, i);
+    for (size_t i = 0; i < 1000; i += 3)
+        nc_bit_set_set(&b, i);
+
+    // Multiples of 2 and 3 below 1000: 500 and 334, multiples of 6: 167
+    NC_BitSet result = nc_bit_set_init_with_size(1000);
+    nc_bit_set_or(&result, &a);
+    nc_bit_set_and(&result, &b);
+    assert_int_equal(nc_bit_set_count(&result), 167);
+
+    nc_bit_set_clear_all(&result);
+    nc_bit_set_or(&result, &a);
+    nc_bit_set_or(&result, &b);
+    assert_int_equal(nc_bit_set_count(&result), 667);
+
+    nc_bit_set_xor(&result, &b);
+    assert_int_equal(nc_bit_set_count(&result), 333);
+
+    nc_bit_set_and_not(&a, &b);
+    assert_int_equal(nc_bit_set_count(&a), 333);
+    assert_true(nc_bit_set_test(&a, 2));
+    assert_false(nc_bit_set_test(&a, 6));
+
+    nc_bit_set_destroy(&a);
+    nc_bit_set_destroy(&b);
+    nc_bit_set_destroy(&result);
+}
+
+void bit_set_find_iterate_test(void** state) {
+    (void)state;
+
+    NC_BitSet bits = nc_bit_set_init_with_size(500);
+    const size_t expected[] = { 3, 64, 65, 200, 499 };
+    for (size_t i = 0; i < 5; ++i)
+        nc_bit_set_set(&bits, expected[i]);
+
+    assert_int_equal(nc_bit_set_find_first(&bits), 3);
+    assert_int_equal(nc_bit_set_find_next(&bits, 4), 64);
+    assert_int_equal(nc_bit_set_find_next(&bits, 66), 200);
+    assert_int_equal(nc_bit_set_find_next(&bits, 500), 500);
+
+    size_t found = 0;
+    for (size_t i = nc_bit_set_find_first(&bits); i < nc_bit_set_size(&bits); i = nc_bit_set_find_next(&bits, i + 1))
+        assert_int_equal(i, expected[found++]);
+    assert_int_equal(found, 5);
+
+    NC_BitSetIterator it = nc_bit_set_iter(&bits);
+    size_t index = 0;
+    found = 0;
+    while (nc_bit_set_iterator_next(&it, &index))
+        assert_int_equal(index, expected[found++]);
+    assert_int_equal(found, 5);
+
+    nc_bit_set_destroy(&bits);
+}
+
+static const struct CMUnitTest bit_set_tests[] = {
+    cmocka_unit_test(bit_set_set_clear_test_test),
+    cmocka_unit_test(bit_set_resize_test),
+    cmocka_unit_test(bit_set_bulk_operations_test),
+    cmocka_unit_test(bit_set_find_iterate_test)
+};
@@ -0,0 +1,101 @@
+#include "ncstd/test/test_common.h"
+
+#include <stdlib.h>
+
+#include "ncstd/containers/bloom_filter.h"
+#include "ncstd/util/hash.h"
+
+
+void bloom_filter_no_false_negatives_test(void** state) {
+    (void)state;
+
+    NC_BloomFilter filter = nc_bloom_filter_init(1000, 12);
+    assert_int_equal(nc_bloom_filter_block_count(&filter), 24);
+    assert_false(nc_bloom_filter_contains_hash(&filter, nc_hash_u64(1)));
+
+    for (uint64_t i = 0; i < 1000; ++i)
+        nc_bloom_filter_insert_hash(&filter, nc_hash_u64(i));
+    for (uint64_t i = 0; i < 1000; ++i)
+        assert_true(nc_bloom_filter_contains_hash(&filter, nc_hash_u64(i)));
+
+    nc_bloom_filter_clear(&filter);
+    assert_false(nc_bloom_filter_contains_hash(&filter, nc_hash_u64(1)));
+
+    nc_bloom_filter_destroy(&filter);
+}
+
+void bloom_filter_bulk_test(void** state) {
+    (void)state;
+
+    enum { COUNT = 1000 };
+    uint64_t* const hashes = malloc(2 * COUNT * sizeof(uint64_t));
+    bool* const results = malloc(2 * COUNT * sizeof(bool));
+    for (uint64_t i = 0; i < 2 * COUNT; ++i)
+        hashes[i] = nc_hash_u64(i);
+
+    NC_BloomFilter filter = nc_bloom_filter_init(COUNT, 16);
+    nc_bloom_filter_insert_hashes(&filter, hashes, COUNT);
+
+    // Bulk query agrees with single queries
+    const size_t found = nc_bloom_filter_contains_hashes(&filter, hashes, 2 * COUNT, results);
+    size_t expected_found = 0;
+    for (size_t i = 0; i < 2 * COUNT; ++i) {
+        assert_int_equal(results[i], nc_bloom_filter_contains_hash(&filter, hashes[i]));
+        if (i < COUNT)
+            assert_true(results[i]);
+        expected_found += results[i];
+    }
+    assert_int_equal(found, expected_found);
+
+    nc_bloom_filter_destroy(&filter);
+    free(hashes);
+    free(results);
+}
+
+void bloom_filter_false_positive_rate_test(void** state) {
+    (void)state;
+
+    enum { COUNT = 100000 };
+    const size_t bits_per_key[] = { 8, 12, 16 };
+    const size_t max_false_positives[] = { COUNT / 20, COUNT / 50, COUNT / 200 };
+
+    for (size_t i = 0; i < sizeof bits_per_key / sizeof bits_per_key[0]; ++i) {
+        NC_BloomFilter filter = nc_bloom_filter_init(COUNT, bits_per_key[i]);
+        for (uint64_t key = 0; key < COUNT; ++key)
+            nc_bloom_filter_insert_hash(&filter, nc_hash_u64(key));
+
+        size_t false_positives = 0;
+        for (uint64_t key = COUNT; key < 2 * COUNT; ++key)
+            false_positives += nc_bloom_filter_contains_hash(&filter, nc_hash_u64(key));
+        assert_true(false_positives < max_false_positives[i]);
+
+        nc_bloom_filter_destroy(&filter);
+    }
+}
+
+void bloom_filter_without_blocks_test(void** state) {
+    (void)state;
+
+    NC_BloomFilter filter = nc_bloom_filter_init(0, 12);
+    assert_int_equal(nc_bloom_filter_block_count(&filter), 1);
+
+    // Filter without memory can't rule anything out
+    nc_bloom_filter_destroy(&filter);
+    assert_int_equal(nc_bloom_filter_block_count(&filter), 0);
+    nc_bloom_filter_insert_hash(&filter, 1);
+    assert_true(nc_bloom_filter_contains_hash(&filter, 2));
+
+    const uint64_t hashes[] = { 1, 2, 3 };
+    bool results[3] = { false, false, false };
+    assert_int_equal(nc_bloom_filter_contains_hashes(&filter, hashes, 3, results), 3);
+    assert_true(results[2]);
+
+    nc_bloom_filter_destroy(&filter);
+}
+
+static const struct CMUnitTest bloom_filter_tests[] = {
+    cmocka_unit_test(bloom_filter_no_false_negatives_test),
+    cmocka_unit_test(bloom_filter_bulk_test),
+    cmocka_unit_test(bloom_filter_false_positive_rate_test),
+    cmocka_unit_test(bloom_filter_without_blocks_test)
+};
@@ -0,0 +1,240 @@
+#include "ncstd/test/test_common.h"
+
+#include <string.h>
+
+#include "ncstd/containers/btree_map.h"
+
+
+static int test_btree_u32_cmp(const void* a, const void* b, void* data) {
+    (void)data;
+    const uint32_t left = *(const uint32_t*)a;
+    const uint32_t right = *(const uint32_t*)b;
+
+    return (left > right) - (left < right);
+}
+
+static int test_btree_cstr_cmp(const void* a, const void* b, void* data) {
+    (void)data;
+
+    return strcmp(*(const char* const*)a, *(const char* const*)b);
+}
+
+NC_DEFINE_BTREE_MAP(uint32_t, uint32_t, u32, test_btree_u32_cmp)
+NC_INSTANTIATE_BTREE_MAP(uint32_t, uint32_t, u32)
+
+typedef const char* TestCstr;
+NC_DEFINE_BTREE_MAP(TestCstr, int, cstr, test_btree_cstr_cmp)
+NC_INSTANTIATE_BTREE_MAP(TestCstr, int, cstr)
+
+// Checks node sizes, parent links, key order and that all leaves are at the same depth, returns the depth
+static size_t test_btree_check_node(const NC_BTreeMapNode_u32* node, const uint32_t* lower, const uint32_t* upper, size_t* count) {
+    if (node->parent != NULL)
+        assert_true(node->size >= NC_INTERNAL_BTREE_MAP_MIN_SIZE(uint32_t));
+    assert_true(node->size <= NC_INTERNAL_BTREE_MAP_CAPACITY(uint32_t));
+
+    for (size_t i = 0; i < node->size; ++i) {
+        if (i > 0)
+            assert_true(node->keys[i - 1] < node->keys[i]);
+        if (lower != NULL)
+            assert_true(*lower < node->keys[i]);
+        if (upper != NULL)
+            assert_true(node->keys[i] < *upper);
+    }
+    *count += node->size;
+
+    if (node->is_leaf)
+        return 0;
+
+    const NC_BTreeMapInternalNode_u32* const internal = (const NC_BTreeMapInternalNode_u32*)node;
+    size_t depth = 0;
+    for (size_t i = 0; i <= node->size; ++i) {
+        const NC_BTreeMapNode_u32* const child = internal->children[i];
+        assert_ptr_equal(child->parent, internal);
+        assert_int_equal(child->parent_index, i);
+
+        const size_t child_depth = test_btree_check_node(
+            child,
+            i > 0 ? &node->keys[i - 1] : lower,
+            i < node->size ? &node->keys[i] : upper,
+            count
+        );
+        if (i > 0)
+            assert_int_equal(child_depth, depth);
+        depth = child_depth;
+    }
+
+    return depth + 1;
+}
+
+static void test_btree_check(const NC_BTREE_MAP(u32)* map) {
+    size_t count = 0;
+    if (map->p.root != NULL) {
+        assert_null(map->p.root->parent);
+        test_btree_check_node(map->p.root, NULL, NULL, &count);
+    }
+    assert_int_equal(count, nc_btree_map_u32_size(map));
+}
+
+void btree_map_insert_get_remove_test(void** state) {
+    (void)state;
+
+    NC_BTREE_MAP(u32) map = nc_btree_map_u32_init();
+    const uint32_t count = 20000;
+
+    // Multiplying by an odd constant permutes the keys
+    for (uint32_t i = 0; i < count; ++i) {
+        const uint32_t key = i * 2654435761u % 65536u;
+        assert_true(nc_btree_map_u32_insert(&map, key, key + 1));
+    }
+    test_btree_check(&map);
+
+    size_t expected = 0;
+    for (uint32_t key = 0; key < 65536u; ++key) {
+        const uint32_t* const value = nc_btree_map_u32_get(&map, &key);
+        if (value != NULL) {
+            assert_int_equal(*value, key + 1);
+            expected += 1;
+        }
+    }
+    assert_int_equal(expected, nc_btree_map_u32_size(&map));
+
+    // Overwriting keeps the size
+    const uint32_t first = 0;
+    assert_true(nc_btree_map_u32_insert(&map, first, 7));
+    assert_int_equal(*nc_btree_map_u32_get(&map, &first), 7);
+    assert_int_equal(nc_btree_map_u32_size(&map), expected);
+
+    for (uint32_t i = 0; i < count; i += 2) {
+        const uint32_t key = i * 2654435761u % 65536u;
+        uint32_t removed_key = 0;
+        assert_true(nc_btree_map_u32_remove(&map, &key, &removed_key, NULL));
+        assert_int_equal(removed_key, key);
+        assert_false(nc_btree_map_u32_contains(&map, &key));
+    }
+    test_btree_check(&map);
+
+    for (uint32_t i = 1; i < count; i += 2) {
+        const uint32_t key = i * 2654435761u % 65536u;
+        assert_true(nc_btree_map_u32_remove(&map, &key, NULL, NULL));
+    }
+    assert_true(nc_btree_map_u32_is_empty(&map));
+    assert_null(map.p.root);
+
+    nc_btree_map_u32_destroy(&map);
+}
+
+void btree_map_ordered_iteration_test(void** state) {
+    (void)state;
+
+    NC_BTREE_MAP(u32) map = nc_btree_map_u32_init();
+    for (uint32_t i = 0; i < 5000; ++i)
+        assert_true(nc_btree_map_u32_insert(&map, (i * 7919u) % 5000u * 10u, i));
+
+    NC_BTREE_MAP_CURSOR(u32) cursor = nc_btree_map_u32_iter(&map);
+    const uint32_t* key;
+    uint32_t expected = 0;
+    while (nc_btree_map_u32_cursor_next(&cursor, &key, NULL)) {
+        assert_int_equal(*key, expected);
+        expected += 10;
+    }
+    assert_int_equal(expected, 50000);
+
+    // Range [1234, 1300) covers keys 1240..1290
+    const uint32_t from = 1234;
+    const uint32_t to = 1300;
+    cursor = nc_btree_map_u32_lower_bound(&map, &from);
+    expected = 1240;
+    while (nc_btree_map_u32_cursor_next(&cursor, &key, NULL) && *key < to) {
+        assert_int_equal(*key, expected);
+        expected += 10;
+    }
+    assert_int_equal(expected, 1300);
+
+    const uint32_t exact = 2000;
+    cursor = nc_btree_map_u32_lower_bound(&map, &exact);
+    assert_true(nc_btree_map_u32_cursor_next(&cursor, &key, NULL));
+    assert_int_equal(*key, 2000);
+
+    cursor = nc_btree_map_u32_upper_bound(&map, &exact);
+    assert_true(nc_btree_map_u32_cursor_next(&cursor, &key, NULL));
+    assert_int_equal(*key, 2010);
+
+    const uint32_t last = 49990;
+    cursor = nc_btree_map_u32_upper_bound(&map, &last);
+    assert_false(nc_btree_map_u32_cursor_next(&cursor, &key, NULL));
+
+    nc_btree_map_u32_destroy(&map);
+}
+
+void btree_map_bulk_load_test(void** state) {
+    (void)state;
+
+    const size_t sizes[] = { 1, 64, 65, 100, 4161, 100000 };
+    uint32_t* const keys = malloc(100000 * sizeof(uint32_t));
+    assert_non_null(keys);
+    for (uint32_t i = 0; i < 100000; ++i)
+        keys[i] = i * 3;
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+        NC_BTREE_MAP(u32) map = nc_btree_map_u32_init();
+        assert_true(nc_btree_map_u32_bulk_load(&map, keys, keys, sizes[s]));
+        assert_int_equal(nc_btree_map_u32_size(&map), sizes[s]);
+        test_btree_check(&map);
+
+        NC_BTREE_MAP_CURSOR(u32) cursor = nc_btree_map_u32_iter(&map);
+        const uint32_t* key;
+        uint32_t* value;
+        size_t index = 0;
+        while (nc_btree_map_u32_cursor_next(&cursor, &key, &value)) {
+            assert_int_equal(*key, keys[index]);
+            assert_int_equal(*value, keys[index]);
+            index += 1;
+        }
+        assert_int_equal(index, sizes[s]);
+
+        // Bulk loaded tree stays valid under modifications
+        for (uint32_t i = 0; i < sizes[s]; i += 3)
+            assert_true(nc_btree_map_u32_remove(&map, &keys[i], NULL, NULL));
+        for (uint32_t i = 0; i < sizes[s]; i += 5)
+            assert_true(nc_btree_map_u32_insert(&map, keys[i] + 1, 0));
+        test_btree_check(&map);
+
+        nc_btree_map_u32_destroy(&map);
+    }
+
+    free(keys);
+}
+
+void btree_map_string_keys_test(void** state) {
+    (void)state;
+
+    NC_BTREE_MAP(cstr) map = nc_btree_map_cstr_init();
+    const char* const words[] = { "pear", "apple", "fig", "banana", "cherry", "date", "grape" };
+    for (int i = 0; i < 7; ++i)
+        assert_true(nc_btree_map_cstr_insert(&map, words[i], i));
+
+    const TestCstr from = "c";
+    const TestCstr to = "g";
+    NC_BTREE_MAP_CURSOR(cstr) cursor = nc_btree_map_cstr_lower_bound(&map, &from);
+    const TestCstr* key;
+    int* value;
+
+    assert_true(nc_btree_map_cstr_cursor_next(&cursor, &key, &value));
+    assert_string_equal(*key, "cherry");
+    assert_int_equal(*value, 4);
+    assert_true(nc_btree_map_cstr_cursor_next(&cursor, &key, &value));
+    assert_string_equal(*key, "date");
+    assert_true(nc_btree_map_cstr_cursor_next(&cursor, &key, &value));
+    assert_string_equal(*key, "fig");
+    assert_true(nc_btree_map_cstr_cursor_next(&cursor, &key, &value));
+    assert_true(strcmp(*key, to) >= 0);
+
+    nc_btree_map_cstr_destroy(&map);
+}
+
+static const struct CMUnitTest btree_map_tests[] = {
+    cmocka_unit_test(btree_map_insert_get_remove_test),
+    cmocka_unit_test(btree_map_ordered_iteration_test),
+    cmocka_unit_test(btree_map_bulk_load_test),
+    cmocka_unit_test(btree_map_string_keys_test)
+};
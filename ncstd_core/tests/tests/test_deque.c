@@ -0,0 +1,86 @@
+#include "ncstd/test/test_common.h"
+
+#include "ncstd/containers/deque.h"
+
+
+void deque_push_pop_both_ends_test(void** state) {
+    (void)state;
+
+    NC_Deque deque = nc_deque_init(sizeof(int));
+    assert_true(nc_deque_is_empty(&deque));
+    assert_null(nc_deque_front(&deque));
+
+    for (int i = 0; i < 50; ++i) {
+        const int back = i;
+        const int front = -i - 1;
+        assert_true(nc_deque_push_back(&deque, &back));
+        assert_true(nc_deque_push_front(&deque, &front));
+    }
+
+    assert_int_equal(nc_deque_size(&deque), 100);
+    assert_int_equal(nc_deque_capacity(&deque), 128);
+    for (int i = 0; i < 100; ++i)
+        assert_int_equal(*(const int*)nc_deque_get(&deque, (size_t)i), i - 50);
+    assert_null(nc_deque_get(&deque, 100));
+
+    int value = 0;
+    assert_true(nc_deque_pop_front(&deque, &value));
+    assert_int_equal(value, -50);
+    assert_true(nc_deque_pop_back(&deque, &value));
+    assert_int_equal(value, 49);
+    assert_int_equal(*(const int*)nc_deque_front(&deque), -49);
+    assert_int_equal(*(const int*)nc_deque_back(&deque), 48);
+
+    nc_deque_clear(&deque);
+    assert_false(nc_deque_pop_front(&deque, NULL));
+    assert_false(nc_deque_pop_back(&deque, NULL));
+
+    nc_deque_destroy(&deque);
+}
+
+void deque_slices_test(void** state) {
+    (void)state;
+
+    NC_Deque deque = nc_deque_init_with_capacity(8, sizeof(int));
+    assert_int_equal(nc_deque_capacity(&deque), 8);
+
+    NC_DequeSlices slices = nc_deque_as_slices(&deque);
+    assert_int_equal(slices.first_size + slices.second_size, 0);
+
+    // Fill, then advance the head, so that the contents wrap around
+    for (int i = 0; i < 8; ++i)
+        assert_true(nc_deque_push_back(&deque, &i));
+    nc_deque_consume_front(&deque, 5);
+    for (int i = 8; i < 12; ++i)
+        assert_true(nc_deque_push_back(&deque, &i));
+
+    slices = nc_deque_as_slices(&deque);
+    assert_int_equal(slices.first_size, 3);
+    assert_int_equal(slices.second_size, 4);
+    const int* const first = slices.first;
+    const int* const second = slices.second;
+    assert_int_equal(first[0], 5);
+    assert_int_equal(first[2], 7);
+    assert_int_equal(second[0], 8);
+    assert_int_equal(second[3], 11);
+
+    // Growth unwraps the contents
+    const int value = 12;
+    assert_true(nc_deque_push_back(&deque, &value));
+    assert_true(nc_deque_push_back(&deque, &value));
+    slices = nc_deque_as_slices(&deque);
+    assert_int_equal(nc_deque_capacity(&deque), 16);
+    assert_int_equal(slices.first_size, 9);
+    assert_int_equal(slices.second_size, 0);
+    assert_int_equal(((const int*)slices.first)[0], 5);
+
+    nc_deque_consume_front(&deque, 100);
+    assert_true(nc_deque_is_empty(&deque));
+
+    nc_deque_destroy(&deque);
+}
+
+static const struct CMUnitTest deque_tests[] = {
+    cmocka_unit_test(deque_push_pop_both_ends_test),
+    cmocka_unit_test(deque_slices_test)
+};
@@ -0,0 +1,63 @@
+#include "ncstd/test/test_common.h"
+
+#include "ncstd/util/hash.h"
+
+
+static void hash_fill_bytes(uint8_t* bytes, size_t size) {
+    uint32_t state = 2463534242u;
+    for (size_t i = 0; i < size; ++i) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        bytes[i] = (uint8_t)state;
+    }
+}
+
+void hash_hasher_matches_one_shot_test(void** state) {
+    (void)state;
+
+    uint8_t bytes[300];
+    hash_fill_bytes(bytes, sizeof(bytes));
+
+    const size_t chunk_sizes[] = { 1, 3, 16, 47, 48, 49, 100 };
+    for (size_t size = 0; size <= sizeof(bytes); ++size) {
+        const uint64_t expected = nc_hash_bytes_seeded(bytes, size, 42);
+
+        for (size_t c = 0; c < sizeof(chunk_sizes) / sizeof(chunk_sizes[0]); ++c) {
+            NC_Hasher hasher = nc_hasher_init_seeded(42);
+            for (size_t offset = 0; offset < size; offset += chunk_sizes[c]) {
+                const size_t remaining = size - offset;
+                nc_hasher_update(&hasher, bytes + offset, remaining < chunk_sizes[c] ? remaining : chunk_sizes[c]);
+            }
+
+            assert_int_equal(nc_hasher_finish(&hasher), expected);
+        }
+    }
+}
+
+void hash_depends_on_every_byte_test(void** state) {
+    (void)state;
+
+    uint8_t bytes[200];
+    hash_fill_bytes(bytes, sizeof(bytes));
+
+    const size_t sizes[] = { 1, 3, 4, 7, 8, 15, 16, 17, 48, 49, 97, 200 };
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+        const size_t size = sizes[s];
+        const uint64_t hash = nc_hash_bytes(bytes, size);
+
+        assert_int_not_equal(hash, nc_hash_bytes(bytes, size - 1));
+        assert_int_not_equal(hash, nc_hash_bytes_seeded(bytes, size, 1));
+
+        for (size_t i = 0; i < size; ++i) {
+            bytes[i] ^= 1;
+            assert_int_not_equal(hash, nc_hash_bytes(bytes, size));
+            bytes[i] ^= 1;
+        }
+    }
+}
+
+static const struct CMUnitTest hash_tests[] = {
+    cmocka_unit_test(hash_hasher_matches_one_shot_test),
+    cmocka_unit_test(hash_depends_on_every_byte_test)
+};
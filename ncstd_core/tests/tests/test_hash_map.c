@@ -0,0 +1,131 @@
+#include "ncstd/test/test_common.h"
+
+#include "ncstd/containers/hash_map.h"
+#include "ncstd/util/hash.h"
+
+
+uint64_t test_u64_hash(const void* key, void* data) {
+    (void)data;
+
+    return nc_hash_u64(*(const uint64_t*)key);
+}
+
+// Puts every key into one of 4 home slots, so that entries form long clusters
+uint64_t test_u64_colliding_hash(const void* key, void* data) {
+    (void)data;
+
+    const uint64_t value = *(const uint64_t*)key;
+
+    return ((value % 4) << 7) | (value & 0x7F);
+}
+
+bool test_u64_eq(const void* a, const void* b, void* data) {
+    (void)data;
+
+    return *(const uint64_t*)a == *(const uint64_t*)b;
+}
+
+typedef uint64_t CollidingKey;
+
+NC_DEFINE_HASH_MAP(uint64_t, uint64_t, u64_u64, test_u64_hash, test_u64_eq)
+NC_INSTANTIATE_HASH_MAP(uint64_t, uint64_t, u64_u64)
+
+NC_DEFINE_HASH_MAP(CollidingKey, uint64_t, colliding, test_u64_colliding_hash, test_u64_eq)
+NC_INSTANTIATE_HASH_MAP(CollidingKey, uint64_t, colliding)
+
+
+void hash_map_insert_get_test(void** state) {
+    (void)state;
+
+    NC_HASH_MAP(uint64_t, uint64_t) map = nc_hash_map_u64_u64_init();
+
+    const uint64_t missing = 7;
+    assert_null(nc_hash_map_u64_u64_get(&map, &missing));
+
+    for (uint64_t i = 0; i < 1000; ++i)
+        assert_true(nc_hash_map_u64_u64_insert(&map, i * 3, i));
+
+    assert_int_equal(nc_hash_map_u64_u64_size(&map), 1000);
+    for (uint64_t i = 0; i < 1000; ++i) {
+        const uint64_t key = i * 3;
+        const uint64_t* const value = nc_hash_map_u64_u64_get(&map, &key);
+        assert_non_null(value);
+        assert_int_equal(*value, i);
+
+        const uint64_t absent_key = i * 3 + 1;
+        assert_false(nc_hash_map_u64_u64_contains(&map, &absent_key));
+    }
+
+    assert_true(nc_hash_map_u64_u64_insert(&map, 3, 42));
+    assert_int_equal(nc_hash_map_u64_u64_size(&map), 1000);
+    const uint64_t key = 3;
+    assert_int_equal(*nc_hash_map_u64_u64_get(&map, &key), 42);
+
+    nc_hash_map_u64_u64_destroy(&map);
+}
+
+void hash_map_remove_shifts_clusters_test(void** state) {
+    (void)state;
+
+    NC_HASH_MAP(CollidingKey, uint64_t) map = nc_hash_map_colliding_init();
+
+    for (uint64_t i = 0; i < 200; ++i)
+        assert_true(nc_hash_map_colliding_insert(&map, i, i * 10));
+
+    for (uint64_t i = 0; i < 200; i += 3) {
+        uint64_t removed_key = 0;
+        uint64_t removed_value = 0;
+        assert_true(nc_hash_map_colliding_remove(&map, &i, &removed_key, &removed_value));
+        assert_int_equal(removed_key, i);
+        assert_int_equal(removed_value, i * 10);
+        assert_false(nc_hash_map_colliding_remove(&map, &i, NULL, NULL));
+    }
+
+    for (uint64_t i = 0; i < 200; ++i) {
+        const uint64_t* const value = nc_hash_map_colliding_get(&map, &i);
+        if (i % 3 == 0) {
+            assert_null(value);
+        } else {
+            assert_non_null(value);
+            assert_int_equal(*value, i * 10);
+        }
+    }
+
+    nc_hash_map_colliding_destroy(&map);
+}
+
+void hash_map_iterate_clear_test(void** state) {
+    (void)state;
+
+    NC_HASH_MAP(uint64_t, uint64_t) map = nc_hash_map_u64_u64_init();
+    assert_true(nc_hash_map_u64_u64_reserve(&map, 100));
+    const size_t capacity = nc_hash_map_u64_u64_capacity(&map);
+
+    for (uint64_t i = 1; i <= 100; ++i)
+        assert_true(nc_hash_map_u64_u64_insert(&map, i, i));
+    assert_int_equal(nc_hash_map_u64_u64_capacity(&map), capacity);
+
+    uint64_t sum = 0;
+    size_t count = 0;
+    size_t cursor = 0;
+    for (NC_HASH_MAP_ENTRY(uint64_t, uint64_t)* entry; (entry = nc_hash_map_u64_u64_next_entry(&map, &cursor)) != NULL;) {
+        assert_int_equal(entry->key, entry->value);
+        sum += entry->value;
+        count += 1;
+    }
+    assert_int_equal(count, 100);
+    assert_int_equal(sum, 5050);
+
+    nc_hash_map_u64_u64_clear(&map);
+    assert_true(nc_hash_map_u64_u64_is_empty(&map));
+    cursor = 0;
+    assert_null(nc_hash_map_u64_u64_next_entry(&map, &cursor));
+
+    nc_hash_map_u64_u64_destroy(&map);
+}
+
+static const struct CMUnitTest hash_map_tests[] = {
+    cmocka_unit_test(hash_map_insert_get_test),
+    cmocka_unit_test(hash_map_remove_shifts_clusters_test),
+    cmocka_unit_test(hash_map_iterate_clear_test)
+};
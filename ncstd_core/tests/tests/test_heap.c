@@ -0,0 +1,150 @@
+#include "ncstd/test/test_common.h"
+
+#include "ncstd/containers/heap.h"
+
+
+#define test_int_less(a, b) (*(a) < *(b))
+#define test_int_greater(a, b) (*(a) > *(b))
+
+NC_DEFINE_HEAP(int, int, test_int_less)
+NC_INSTANTIATE_HEAP(int, int)
+
+NC_DEFINE_HEAP_WITH_ARITY(int, max_int, test_int_greater, 2)
+NC_INSTANTIATE_HEAP(int, max_int)
+
+NC_DEFINE_INDEXED_HEAP(int, int, test_int_less)
+NC_INSTANTIATE_INDEXED_HEAP(int, int)
+
+void heap_push_pop_sorted_test(void** state) {
+    (void)state;
+
+    NC_HEAP(int) min_heap = nc_heap_int_init();
+    NC_HEAP(max_int) max_heap = nc_heap_max_int_init();
+    assert_null(nc_heap_int_peek(&min_heap));
+
+    uint32_t random = 12345;
+    for (int i = 0; i < 1000; ++i) {
+        random = random * 1103515245u + 12345u;
+        const int value = (int)(random >> 16) % 500;
+        assert_true(nc_heap_int_push(&min_heap, value));
+        assert_true(nc_heap_max_int_push(&max_heap, value));
+    }
+    assert_int_equal(nc_heap_int_size(&min_heap), 1000);
+
+    int previous_min = -1;
+    int previous_max = 500;
+    int value = 0;
+    for (int i = 0; i < 1000; ++i) {
+        assert_true(nc_heap_int_pop(&min_heap, &value));
+        assert_true(value >= previous_min);
+        previous_min = value;
+
+        assert_true(nc_heap_max_int_pop(&max_heap, &value));
+        assert_true(value <= previous_max);
+        previous_max = value;
+    }
+    assert_false(nc_heap_int_pop(&min_heap, &value));
+    assert_true(nc_heap_int_is_empty(&min_heap));
+
+    nc_heap_int_destroy(&min_heap);
+    nc_heap_max_int_destroy(&max_heap);
+}
+
+void heap_from_raw_buffer_test(void** state) {
+    (void)state;
+
+    const int values[] = { 9, 4, 7, 1, 8, 2, 6, 3, 5, 0, 11, 10 };
+    NC_RawBuffer raw_buffer = nc_raw_buffer_init_with_objects(values, 12, sizeof(int));
+
+    NC_HEAP(int) heap = nc_heap_int_from_raw_buffer(raw_buffer, 12);
+    assert_int_equal(*nc_heap_int_peek(&heap), 0);
+
+    // Every node is not greater than its children
+    const int* const data = nc_heap_int_data(&heap);
+    for (size_t i = 1; i < 12; ++i)
+        assert_true(data[(i - 1) / NC_HEAP_DEFAULT_ARITY] <= data[i]);
+
+    for (int expected = 0; expected < 12; ++expected) {
+        int value = -1;
+        assert_true(nc_heap_int_pop(&heap, &value));
+        assert_int_equal(value, expected);
+    }
+
+    nc_heap_int_destroy(&heap);
+}
+
+void heap_replace_top_keeps_largest_test(void** state) {
+    (void)state;
+
+    NC_HEAP(int) top_k = nc_heap_int_init();
+    for (int i = 0; i < 100; ++i) {
+        const int value = (i * 37) % 100;
+        if (nc_heap_int_size(&top_k) < 5)
+            nc_heap_int_push(&top_k, value);
+        else if (value > *nc_heap_int_peek(&top_k))
+            nc_heap_int_replace_top(&top_k, value, NULL);
+    }
+
+    for (int expected = 95; expected < 100; ++expected) {
+        int value = -1;
+        assert_true(nc_heap_int_pop(&top_k, &value));
+        assert_int_equal(value, expected);
+    }
+
+    nc_heap_int_destroy(&top_k);
+}
+
+void indexed_heap_decrease_key_test(void** state) {
+    (void)state;
+
+    NC_INDEXED_HEAP(int) heap = nc_indexed_heap_int_init();
+    for (size_t id = 0; id < 20; ++id)
+        assert_true(nc_indexed_heap_int_push(&heap, id, 100 + (int)id));
+    assert_false(nc_indexed_heap_int_push(&heap, 3, 0));
+    assert_int_equal(nc_indexed_heap_int_peek(&heap)->id, 0);
+
+    assert_true(nc_indexed_heap_int_decrease_key(&heap, 17, 5));
+    assert_int_equal(nc_indexed_heap_int_peek(&heap)->id, 17);
+    assert_int_equal(*nc_indexed_heap_int_get(&heap, 17), 5);
+
+    assert_true(nc_indexed_heap_int_update(&heap, 17, 1000));
+    assert_true(nc_indexed_heap_int_update(&heap, 10, 1));
+    assert_int_equal(nc_indexed_heap_int_peek(&heap)->id, 10);
+
+    int removed = 0;
+    assert_true(nc_indexed_heap_int_remove(&heap, 5, &removed));
+    assert_int_equal(removed, 105);
+    assert_false(nc_indexed_heap_int_contains(&heap, 5));
+    assert_null(nc_indexed_heap_int_get(&heap, 5));
+    assert_false(nc_indexed_heap_int_decrease_key(&heap, 5, 0));
+    assert_false(nc_indexed_heap_int_contains(&heap, 1000));
+
+    NC_INDEXED_HEAP_ENTRY(int) entry;
+    assert_true(nc_indexed_heap_int_pop(&heap, &entry));
+    assert_int_equal(entry.id, 10);
+    assert_int_equal(entry.value, 1);
+
+    int previous = 0;
+    size_t count = 0;
+    while (nc_indexed_heap_int_pop(&heap, &entry)) {
+        assert_true(entry.value >= previous);
+        previous = entry.value;
+        count += 1;
+    }
+    assert_int_equal(count, 18);
+    assert_int_equal(previous, 1000);
+
+    // Ids can be reused after removal
+    assert_true(nc_indexed_heap_int_push(&heap, 5, 7));
+    nc_indexed_heap_int_clear(&heap);
+    assert_false(nc_indexed_heap_int_contains(&heap, 5));
+
+    nc_indexed_heap_int_destroy(&heap);
+}
+
+static const struct CMUnitTest heap_tests[] = {
+    cmocka_unit_test(heap_push_pop_sorted_test),
+    cmocka_unit_test(heap_from_raw_buffer_test),
+    cmocka_unit_test(heap_replace_top_keeps_largest_test),
+    cmocka_unit_test(indexed_heap_decrease_key_test)
+};
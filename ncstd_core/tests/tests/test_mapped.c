@@ -0,0 +1,84 @@
+#include "ncstd/test/test_common.h"
+
+#include "ncstd/allocators/mapped.h"
+#include "ncstd/containers/unsafe/raw_buffer.h"
+
+
+void mapped_raw_buffer_moves_to_large_allocator_test(void** state) {
+    (void)state;
+
+    nc_raw_buffer_set_large_allocator(NULL, 64 * 1024);
+
+    NC_RawBuffer buffer = nc_raw_buffer_init(sizeof(uint32_t));
+    for (uint32_t i = 0; i < 100000; ++i) {
+        nc_raw_buffer_grow_amorthized(&buffer, (size_t)i + 1, 2, sizeof(uint32_t));
+        nc_raw_buffer_set(&buffer, &i, i, sizeof(uint32_t));
+    }
+
+    assert_ptr_equal(nc_raw_buffer_allocator(&buffer), nc_mapped_allocator_default());
+    for (uint32_t i = 0; i < 100000; ++i)
+        assert_int_equal(*(uint32_t*)nc_raw_buffer_get(&buffer, i, sizeof(uint32_t)), i);
+
+    nc_raw_buffer_resize_unchecked(&buffer, 10, sizeof(uint32_t));
+    assert_int_equal(*(uint32_t*)nc_raw_buffer_get(&buffer, 9, sizeof(uint32_t)), 9);
+
+    nc_raw_buffer_free(&buffer, sizeof(uint32_t));
+
+    nc_raw_buffer_set_large_allocator(NULL, NC_RAW_BUFFER_DEFAULT_LARGE_THRESHOLD);
+}
+
+void mapped_allocator_dontneed_on_shrink_test(void** state) {
+    (void)state;
+
+    NC_MappedAllocator mapped = nc_mapped_allocator_init(NC_MAPPED_ALLOCATOR_DONTNEED_ON_SHRINK | NC_MAPPED_ALLOCATOR_HUGE_PAGES);
+    NC_Allocator* const allocator = nc_mapped_allocator_allocator(&mapped);
+
+    const size_t large_size = 1024 * 1024;
+    uint8_t* data = nc_allocator_alloc(allocator, large_size, 64);
+    assert_int_equal((uintptr_t)data % 64, 0);
+    memset(data, 0xAB, large_size);
+
+    data = nc_allocator_realloc(allocator, data, large_size, 100, 64);
+    assert_int_equal(data[99], 0xAB);
+
+    data = nc_allocator_realloc(allocator, data, 100, 4 * large_size, 64);
+    assert_int_equal(data[0], 0xAB);
+    data[4 * large_size - 1] = 1;
+
+    nc_allocator_free(allocator, data, 4 * large_size, 64);
+}
+
+void mapped_allocator_large_alignment_test(void** state) {
+    (void)state;
+
+    NC_Allocator* const allocator = nc_mapped_allocator_default();
+    const size_t alignments[] = { 16, 8 * 1024, 128 * 1024, 2 * 1024 * 1024 };
+
+    for (size_t i = 0; i < sizeof alignments / sizeof alignments[0]; ++i) {
+        const size_t alignment = alignments[i];
+        for (size_t attempt = 0; attempt < 8; ++attempt) {
+            const size_t size = 100000 + attempt * 4096;
+            uint8_t* data = nc_allocator_alloc(allocator, size, alignment);
+            assert_int_equal((uintptr_t)data % alignment, 0);
+            memset(data, (int)attempt, size);
+
+            // Mapping can move when it grows, data has to stay aligned
+            data = nc_allocator_realloc(allocator, data, size, 16 * size, alignment);
+            assert_int_equal((uintptr_t)data % alignment, 0);
+            assert_int_equal(data[0], attempt);
+            assert_int_equal(data[size - 1], attempt);
+            data[16 * size - 1] = 1;
+
+            data = nc_allocator_realloc(allocator, data, 16 * size, size, alignment);
+            assert_int_equal(data[size - 1], attempt);
+
+            nc_allocator_free(allocator, data, size, alignment);
+        }
+    }
+}
+
+static const struct CMUnitTest mapped_tests[] = {
+    cmocka_unit_test(mapped_raw_buffer_moves_to_large_allocator_test),
+    cmocka_unit_test(mapped_allocator_dontneed_on_shrink_test),
+    cmocka_unit_test(mapped_allocator_large_alignment_test)
+};
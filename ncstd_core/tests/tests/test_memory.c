@@ -0,0 +1,155 @@
+#include "ncstd/test/test_common.h"
+
+#include <stdint.h>
+#include <string.h>
+#include <threads.h>
+
+#include "ncstd/memory.h"
+
+
+#define MEMORY_TEST_THREADS 4
+#define MEMORY_TEST_BLOCKS 3000
+
+typedef struct {
+    void** blocks;
+    size_t first;
+    size_t count;
+} MemoryTestRange;
+
+// Sizes cover every size class of the thread cache, and blocks that bypass it
+static size_t memory_test_block_size(size_t index) {
+    const size_t sizes[] = { 1, 16, 17, 24, 100, 256, 1000, 2048, 4096, 4097, 20000 };
+
+    return sizes[index % (sizeof(sizes) / sizeof(sizes[0]))];
+}
+
+static void memory_test_fill(void* block, size_t index) {
+    memset(block, (int)(index % 251), memory_test_block_size(index));
+}
+
+static bool memory_test_check(const void* block, size_t index) {
+    const uint8_t* const bytes = block;
+    for (size_t i = 0; i < memory_test_block_size(index); ++i) {
+        if (bytes[i] != index % 251)
+            return false;
+    }
+
+    return true;
+}
+
+static int memory_test_allocate(void* arg) {
+    const MemoryTestRange* const range = arg;
+    for (size_t i = range->first; i < range->first + range->count; ++i) {
+        range->blocks[i] = nc_malloc(memory_test_block_size(i));
+        if (range->blocks[i] == NULL)
+            return 1;
+        memory_test_fill(range->blocks[i], i);
+    }
+
+    return 0;
+}
+
+// Frees blocks allocated by another thread, while allocating and freeing blocks of its own
+static int memory_test_free(void* arg) {
+    const MemoryTestRange* const range = arg;
+    int failed = 0;
+    for (size_t i = range->first; i < range->first + range->count; ++i) {
+        failed |= !memory_test_check(range->blocks[i], i);
+        nc_free(range->blocks[i]);
+        range->blocks[i] = NULL;
+
+        void* const own = nc_malloc(memory_test_block_size(i + 1));
+        if (own == NULL)
+            return 1;
+        memory_test_fill(own, i + 1);
+        failed |= !memory_test_check(own, i + 1);
+        nc_free(own);
+    }
+
+    return failed;
+}
+
+void memory_reuse_test(void** state) {
+    (void)state;
+
+    for (size_t i = 0; i < 100; ++i) {
+        void* const block = nc_malloc(memory_test_block_size(i));
+        assert_non_null(block);
+        memory_test_fill(block, i);
+        nc_free(block);
+
+        // Reused blocks are zeroed by calloc
+        uint8_t* const zeroed = nc_calloc(memory_test_block_size(i), 1);
+        assert_non_null(zeroed);
+        for (size_t b = 0; b < memory_test_block_size(i); ++b)
+            assert_int_equal(zeroed[b], 0);
+        nc_free(zeroed);
+    }
+
+    // Reallocation preserves contents across size classes, in both directions
+    uint8_t* block = nc_malloc(20);
+    assert_non_null(block);
+    memset(block, 7, 20);
+    block = nc_realloc(block, 5000);
+    assert_non_null(block);
+    for (size_t i = 0; i < 20; ++i)
+        assert_int_equal(block[i], 7);
+    memset(block, 9, 5000);
+    block = nc_realloc(block, 30);
+    assert_non_null(block);
+    for (size_t i = 0; i < 30; ++i)
+        assert_int_equal(block[i], 9);
+    nc_free(block);
+
+#ifdef NC_FEATURE_THREAD_CACHE
+    // Freed block is served again from the cache of this thread
+    void* const first = nc_malloc(100);
+    nc_free(first);
+    void* const second = nc_malloc(120);
+    assert_ptr_equal(second, first);
+
+    // Growing within the size class keeps the block
+    assert_ptr_equal(nc_realloc(second, 128), first);
+    nc_free(first);
+#endif
+}
+
+void memory_cross_thread_test(void** state) {
+    (void)state;
+
+    void** const blocks = nc_malloc(MEMORY_TEST_THREADS * MEMORY_TEST_BLOCKS * sizeof(void*));
+    assert_non_null(blocks);
+    MemoryTestRange ranges[MEMORY_TEST_THREADS];
+    thrd_t threads[MEMORY_TEST_THREADS];
+
+    // Several rounds, so that blocks returned to the depot by exited threads are reused by new ones
+    for (size_t round = 0; round < 3; ++round) {
+        for (size_t t = 0; t < MEMORY_TEST_THREADS; ++t) {
+            ranges[t] = (MemoryTestRange) { .blocks = blocks, .first = t * MEMORY_TEST_BLOCKS, .count = MEMORY_TEST_BLOCKS };
+            assert_int_equal(thrd_create(&threads[t], memory_test_allocate, &ranges[t]), thrd_success);
+        }
+        for (size_t t = 0; t < MEMORY_TEST_THREADS; ++t) {
+            int result;
+            assert_int_equal(thrd_join(threads[t], &result), thrd_success);
+            assert_int_equal(result, 0);
+        }
+
+        // Every thread frees blocks of the next one, which overflows its caches into the depot
+        for (size_t t = 0; t < MEMORY_TEST_THREADS; ++t) {
+            ranges[t].first = (t + 1) % MEMORY_TEST_THREADS * MEMORY_TEST_BLOCKS;
+            assert_int_equal(thrd_create(&threads[t], memory_test_free, &ranges[t]), thrd_success);
+        }
+        for (size_t t = 0; t < MEMORY_TEST_THREADS; ++t) {
+            int result;
+            assert_int_equal(thrd_join(threads[t], &result), thrd_success);
+            assert_int_equal(result, 0);
+        }
+    }
+
+    nc_free(blocks);
+}
+
+static const struct CMUnitTest memory_tests[] = {
+    cmocka_unit_test(memory_reuse_test),
+    cmocka_unit_test(memory_cross_thread_test)
+};
@@ -0,0 +1,135 @@
+#include "ncstd/test/test_common.h"
+
+#include <stdatomic.h>
+#include <threads.h>
+
+#include "ncstd/containers/mpmc_queue.h"
+
+
+#define MPMC_QUEUE_TEST_THREADS 3
+#define MPMC_QUEUE_TEST_COUNT 30000
+
+typedef struct {
+    NC_MpmcQueue* queue;
+    size_t first_value;
+    atomic_size_t* consumed;
+    atomic_size_t* sum;
+} MpmcQueueTestArgs;
+
+static int mpmc_queue_test_producer(void* arg) {
+    const MpmcQueueTestArgs* const args = arg;
+
+    for (size_t i = 0; i < MPMC_QUEUE_TEST_COUNT;) {
+        size_t batch[5];
+        size_t batch_size = 0;
+        while (batch_size < 5 && i + batch_size < MPMC_QUEUE_TEST_COUNT) {
+            batch[batch_size] = args->first_value + i + batch_size;
+            batch_size += 1;
+        }
+
+        const size_t pushed = nc_mpmc_queue_push_batch(args->queue, batch, batch_size);
+        i += pushed;
+        if (pushed == 0)
+            thrd_yield();
+    }
+
+    return 0;
+}
+
+static int mpmc_queue_test_consumer(void* arg) {
+    const MpmcQueueTestArgs* const args = arg;
+    const size_t total = MPMC_QUEUE_TEST_THREADS * MPMC_QUEUE_TEST_COUNT;
+
+    size_t sum = 0;
+    while (atomic_load(args->consumed) < total) {
+        size_t batch[4];
+        const size_t popped = nc_mpmc_queue_pop_batch(args->queue, batch, 4);
+        for (size_t i = 0; i < popped; ++i)
+            sum += batch[i];
+        atomic_fetch_add(args->consumed, popped);
+        if (popped == 0)
+            thrd_yield();
+    }
+    atomic_fetch_add(args->sum, sum);
+
+    return 0;
+}
+
+void mpmc_queue_push_pop_test(void** state) {
+    (void)state;
+
+    NC_MpmcQueue queue = nc_mpmc_queue_init(4, 3);
+    assert_int_equal(nc_mpmc_queue_capacity(&queue), 4);
+
+    char value[3] = { 0 };
+    assert_false(nc_mpmc_queue_try_pop(&queue, value));
+
+    const char input[5][3] = { "ab", "cd", "ef", "gh", "ij" };
+    assert_true(nc_mpmc_queue_try_push(&queue, input[0]));
+    assert_int_equal(nc_mpmc_queue_push_batch(&queue, input[1], 4), 3);
+    assert_false(nc_mpmc_queue_try_push(&queue, input[4]));
+    assert_int_equal(nc_mpmc_queue_size(&queue), 4);
+
+    assert_true(nc_mpmc_queue_try_pop(&queue, value));
+    assert_string_equal(value, "ab");
+    assert_true(nc_mpmc_queue_try_push(&queue, input[4]));
+
+    char output[4][3];
+    assert_int_equal(nc_mpmc_queue_pop_batch(&queue, output, 4), 4);
+    assert_string_equal(output[0], "cd");
+    assert_string_equal(output[3], "ij");
+    assert_int_equal(nc_mpmc_queue_size(&queue), 0);
+
+    nc_mpmc_queue_destroy(&queue);
+    assert_int_equal(nc_mpmc_queue_capacity(&queue), 0);
+}
+
+void mpmc_queue_threaded_sum_test(void** state) {
+    (void)state;
+
+    NC_MpmcQueue queue = nc_mpmc_queue_init(32, sizeof(size_t));
+    atomic_size_t consumed = 0;
+    atomic_size_t sum = 0;
+
+    MpmcQueueTestArgs args[MPMC_QUEUE_TEST_THREADS];
+    thrd_t producers[MPMC_QUEUE_TEST_THREADS];
+    thrd_t consumers[MPMC_QUEUE_TEST_THREADS];
+    for (size_t i = 0; i < MPMC_QUEUE_TEST_THREADS; ++i) {
+        args[i] = (MpmcQueueTestArgs) {
+            .queue = &queue,
+            .first_value = i * MPMC_QUEUE_TEST_COUNT,
+            .consumed = &consumed,
+            .sum = &sum
+        };
+        assert_int_equal(thrd_create(&consumers[i], mpmc_queue_test_consumer, &args[i]), thrd_success);
+        assert_int_equal(thrd_create(&producers[i], mpmc_queue_test_producer, &args[i]), thrd_success);
+    }
+    for (size_t i = 0; i < MPMC_QUEUE_TEST_THREADS; ++i) {
+        thrd_join(producers[i], NULL);
+        thrd_join(consumers[i], NULL);
+    }
+
+    // Every value from 0 to total - 1 was pushed exactly once
+    const size_t total = MPMC_QUEUE_TEST_THREADS * MPMC_QUEUE_TEST_COUNT;
+    assert_int_equal(atomic_load(&consumed), total);
+    assert_int_equal(atomic_load(&sum), total * (total - 1) / 2);
+    assert_int_equal(nc_mpmc_queue_size(&queue), 0);
+
+    nc_mpmc_queue_destroy(&queue);
+}
+
+void mpmc_queue_layout_test(void** state) {
+    (void)state;
+
+    // Shared, producer and consumer members don't share cache lines, wherever the queue is placed
+    assert_int_equal(alignof(NC_MpmcQueue), NC_CACHE_LINE_SIZE);
+    assert_int_equal(offsetof(NC_MpmcQueue, p.enqueue_position) % NC_CACHE_LINE_SIZE, 0);
+    assert_int_equal(offsetof(NC_MpmcQueue, p.dequeue_position) - offsetof(NC_MpmcQueue, p.enqueue_position), NC_CACHE_LINE_SIZE);
+    assert_int_equal(sizeof(NC_MpmcQueue) - offsetof(NC_MpmcQueue, p.dequeue_position), NC_CACHE_LINE_SIZE);
+}
+
+static const struct CMUnitTest mpmc_queue_tests[] = {
+    cmocka_unit_test(mpmc_queue_push_pop_test),
+    cmocka_unit_test(mpmc_queue_threaded_sum_test),
+    cmocka_unit_test(mpmc_queue_layout_test)
+};
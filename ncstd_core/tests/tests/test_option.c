@@ -0,0 +1,86 @@
+#include "ncstd/test/test_common.h"
+
+#include "ncstd/macros/option_macros.h"
+#include "ncstd/options.h"
+
+
+typedef struct {
+    int32_t x;
+    int32_t y;
+} OptionTestPoint;
+
+typedef const OptionTestPoint* OptionTestPointPtr;
+typedef OptionTestPoint OptionTestNonzeroPoint;
+
+NC_DEFINE_OPTION(OptionTestPoint, option_test_point)
+NC_INSTANTIATE_OPTION(OptionTestPoint, option_test_point)
+
+NC_DEFINE_OPTION_NICHE(OptionTestPointPtr, option_test_point_ptr, NULL)
+NC_INSTANTIATE_OPTION(OptionTestPointPtr, option_test_point_ptr)
+
+bool option_test_point_is_origin(OptionTestNonzeroPoint point) {
+    return point.x == 0 && point.y == 0;
+}
+
+// Origin is used as none state
+NC_DEFINE_OPTION_NICHE_FN(OptionTestNonzeroPoint, option_test_nonzero_point, (OptionTestNonzeroPoint) { 0 }, option_test_point_is_origin)
+NC_INSTANTIATE_OPTION(OptionTestNonzeroPoint, option_test_nonzero_point)
+
+
+void option_flag_test(void** state) {
+    (void)state;
+
+    const OptionTestPoint point = { .x = 1, .y = 2 };
+    assert_true(nc_option_option_test_point_is_some(nc_option_option_test_point_init_some(point)));
+    assert_false(nc_option_option_test_point_is_some(nc_option_option_test_point_init_none()));
+    assert_int_equal(nc_option_option_test_point_value_or(nc_option_option_test_point_init_none(), point).y, 2);
+}
+
+void option_niche_size_test(void** state) {
+    (void)state;
+
+    // Niche options take no more memory than the wrapped type
+    assert_int_equal(sizeof(NC_OPTION(char32_t)), sizeof(char32_t));
+    assert_int_equal(sizeof(NC_OPTION(size_t)), sizeof(size_t));
+    assert_int_equal(sizeof(NC_OPTION(uint32_t)), sizeof(uint32_t));
+    assert_int_equal(sizeof(NC_OPTION(OptionTestPointPtr)), sizeof(OptionTestPointPtr));
+    assert_int_equal(sizeof(NC_OPTION(OptionTestNonzeroPoint)), sizeof(OptionTestNonzeroPoint));
+    assert_int_equal(sizeof(NC_OPTION(OptionTestPoint)), 3 * sizeof(int32_t));
+}
+
+void option_niche_builtin_test(void** state) {
+    (void)state;
+
+    assert_true(nc_option_char32_is_some(nc_option_char32_init_some(0x10FFFF)));
+    assert_true(nc_option_char32_is_some(nc_option_char32_init_some(0)));
+    assert_false(nc_option_char32_is_some(nc_option_char32_init_none()));
+    assert_int_equal(nc_option_char32_value_or(nc_option_char32_init_none(), 'x'), 'x');
+    assert_int_equal(nc_option_char32_value_or(nc_option_char32_init_some('a'), 'x'), 'a');
+
+    assert_true(nc_option_size_is_some(nc_option_size_init_some(0)));
+    assert_false(nc_option_size_is_some(nc_option_size_init_none()));
+    assert_int_equal(nc_option_size_value_or(nc_option_size_init_some(SIZE_MAX - 1), 0), SIZE_MAX - 1);
+
+    assert_false(nc_option_u32_is_some(nc_option_u32_init_none()));
+    assert_int_equal(nc_option_u32_value_or(nc_option_u32_init_none(), 7), 7);
+}
+
+void option_niche_user_defined_test(void** state) {
+    (void)state;
+
+    const OptionTestPoint point = { .x = 0, .y = 3 };
+    assert_true(nc_option_option_test_point_ptr_is_some(nc_option_option_test_point_ptr_init_some(&point)));
+    assert_false(nc_option_option_test_point_ptr_is_some(nc_option_option_test_point_ptr_init_none()));
+    assert_ptr_equal(nc_option_option_test_point_ptr_value_or(nc_option_option_test_point_ptr_init_some(&point), NULL), &point);
+
+    assert_true(nc_option_option_test_nonzero_point_is_some(nc_option_option_test_nonzero_point_init_some(point)));
+    assert_false(nc_option_option_test_nonzero_point_is_some(nc_option_option_test_nonzero_point_init_none()));
+    assert_int_equal(nc_option_option_test_nonzero_point_value_or(nc_option_option_test_nonzero_point_init_none(), point).y, 3);
+}
+
+static const struct CMUnitTest option_tests[] = {
+    cmocka_unit_test(option_flag_test),
+    cmocka_unit_test(option_niche_size_test),
+    cmocka_unit_test(option_niche_builtin_test),
+    cmocka_unit_test(option_niche_user_defined_test)
+};
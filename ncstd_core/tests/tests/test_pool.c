@@ -0,0 +1,64 @@
+#include "ncstd/test/test_common.h"
+
+#include "ncstd/allocators/pool.h"
+#include "ncstd/util/create_util.h"
+
+
+void pool_reuses_freed_objects_test(void** state) {
+    (void)state;
+
+    NC_Pool pool = nc_pool_init();
+
+    void* const first = nc_pool_alloc(&pool, 40);
+    void* const second = nc_pool_alloc(&pool, 40);
+    assert_ptr_not_equal(first, second);
+    assert_int_equal((uintptr_t)first % NC_DEFAULT_ALIGNMENT, 0);
+
+    nc_pool_free(&pool, first, 40);
+    // Sizes from the same size class share a freelist
+    assert_ptr_equal(nc_pool_alloc(&pool, 48), first);
+
+    nc_pool_free(&pool, second, 40);
+    assert_ptr_not_equal(nc_pool_alloc(&pool, 16), second);
+
+    nc_pool_destroy(&pool);
+}
+
+void pool_forwards_large_objects_test(void** state) {
+    (void)state;
+
+    NC_Pool pool = nc_pool_init();
+
+    void* const large = nc_pool_alloc(&pool, NC_POOL_MAX_OBJECT_SIZE + 1);
+    assert_non_null(large);
+    nc_pool_free(&pool, large, NC_POOL_MAX_OBJECT_SIZE + 1);
+
+    nc_pool_destroy(&pool);
+}
+
+void pool_backs_create_util_test(void** state) {
+    (void)state;
+
+    typedef struct {
+        int64_t a;
+        int64_t b;
+    } Foo;
+
+    NC_Pool pool = nc_pool_init();
+
+    Foo* const foo = nc_util_create_with_in(&(Foo) { .a = 1, .b = 2 }, sizeof(Foo), nc_pool_allocator(&pool));
+    assert_int_equal(foo->a, 1);
+    assert_int_equal(foo->b, 2);
+
+    nc_allocator_free(nc_pool_allocator(&pool), foo, sizeof(Foo), NC_DEFAULT_ALIGNMENT);
+    Foo* const other = nc_util_create_with_in(&(Foo) { .a = 3, .b = 4 }, sizeof(Foo), nc_pool_allocator(&pool));
+    assert_ptr_equal(other, foo);
+
+    nc_pool_destroy(&pool);
+}
+
+static const struct CMUnitTest pool_tests[] = {
+    cmocka_unit_test(pool_reuses_freed_objects_test),
+    cmocka_unit_test(pool_forwards_large_objects_test),
+    cmocka_unit_test(pool_backs_create_util_test)
+};
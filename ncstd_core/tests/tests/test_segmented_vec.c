@@ -0,0 +1,91 @@
+#include "ncstd/test/test_common.h"
+
+#include "ncstd/containers/segmented_vec.h"
+
+
+void segmented_vec_push_get_test(void** state) {
+    (void)state;
+
+    NC_SegmentedVec vec = nc_segmented_vec_init(sizeof(uint64_t));
+    assert_null(nc_segmented_vec_get(&vec, 0));
+    assert_null(nc_segmented_vec_back(&vec));
+
+    for (uint64_t i = 0; i < 10000; ++i)
+        assert_true(nc_segmented_vec_push(&vec, &i));
+    assert_int_equal(nc_segmented_vec_size(&vec), 10000);
+    assert_true(nc_segmented_vec_capacity(&vec) >= 10000);
+
+    for (uint64_t i = 0; i < 10000; ++i)
+        assert_int_equal(*(uint64_t*)nc_segmented_vec_get(&vec, i), i);
+    assert_null(nc_segmented_vec_get(&vec, 10000));
+    assert_int_equal(*(uint64_t*)nc_segmented_vec_back(&vec), 9999);
+
+    uint64_t value = 0;
+    assert_true(nc_segmented_vec_pop(&vec, &value));
+    assert_int_equal(value, 9999);
+    assert_int_equal(nc_segmented_vec_size(&vec), 9999);
+
+    nc_segmented_vec_destroy(&vec);
+    assert_int_equal(nc_segmented_vec_capacity(&vec), 0);
+}
+
+void segmented_vec_stable_addresses_test(void** state) {
+    (void)state;
+
+    NC_SegmentedVec vec = nc_segmented_vec_init(sizeof(uint32_t));
+    uint32_t* pointers[100];
+    for (uint32_t i = 0; i < 100; ++i) {
+        pointers[i] = nc_segmented_vec_push_uninit(&vec);
+        assert_non_null(pointers[i]);
+        *pointers[i] = i;
+    }
+
+    // Growing by many more segments doesn't move the first elements
+    for (uint32_t i = 100; i < 100000; ++i)
+        assert_true(nc_segmented_vec_push(&vec, &i));
+    for (uint32_t i = 0; i < 100; ++i) {
+        assert_ptr_equal(nc_segmented_vec_get(&vec, i), pointers[i]);
+        assert_int_equal(*pointers[i], i);
+    }
+
+    nc_segmented_vec_destroy(&vec);
+}
+
+void segmented_vec_segments_test(void** state) {
+    (void)state;
+
+    NC_SegmentedVec vec = nc_segmented_vec_init(sizeof(uint32_t));
+    assert_int_equal(nc_segmented_vec_segment_count(&vec), 0);
+
+    // Segments hold 16, 32 and 64 elements
+    for (uint32_t i = 0; i < 16 + 32 + 5; ++i)
+        assert_true(nc_segmented_vec_push(&vec, &i));
+    assert_int_equal(nc_segmented_vec_segment_count(&vec), 3);
+
+    const size_t expected_sizes[] = { 16, 32, 5 };
+    uint32_t expected = 0;
+    for (size_t segment = 0; segment < nc_segmented_vec_segment_count(&vec); ++segment) {
+        size_t size = 0;
+        const uint32_t* const data = nc_segmented_vec_segment(&vec, segment, &size);
+        assert_int_equal(size, expected_sizes[segment]);
+        for (size_t i = 0; i < size; ++i)
+            assert_int_equal(data[i], expected++);
+    }
+
+    assert_true(nc_segmented_vec_reserve(&vec, 1000));
+    assert_true(nc_segmented_vec_capacity(&vec) >= 1000);
+    nc_segmented_vec_clear(&vec);
+    assert_true(nc_segmented_vec_is_empty(&vec));
+    assert_true(nc_segmented_vec_capacity(&vec) >= 1000);
+
+    nc_segmented_vec_shrink_to_fit(&vec);
+    assert_int_equal(nc_segmented_vec_capacity(&vec), 0);
+
+    nc_segmented_vec_destroy(&vec);
+}
+
+static const struct CMUnitTest segmented_vec_tests[] = {
+    cmocka_unit_test(segmented_vec_push_get_test),
+    cmocka_unit_test(segmented_vec_stable_addresses_test),
+    cmocka_unit_test(segmented_vec_segments_test)
+};
@@ -0,0 +1,60 @@
+#include "ncstd/test/test_common.h"
+
+#include "ncstd/containers/small_vec.h"
+
+
+NC_DEFINE_SMALL_VEC(int, int, 4)
+NC_INSTANTIATE_SMALL_VEC(int, int, 4)
+
+
+void small_vec_stays_inline_test(void** state) {
+    (void)state;
+
+    NC_SMALL_VEC(int, 4) vec = nc_small_vec_int_4_init();
+    assert_true(nc_small_vec_int_4_is_empty(&vec));
+    assert_int_equal(nc_small_vec_int_4_capacity(&vec), 4);
+
+    for (int i = 0; i < 4; ++i)
+        assert_true(nc_small_vec_int_4_push(&vec, i));
+
+    assert_false(nc_small_vec_int_4_is_spilled(&vec));
+    assert_ptr_equal(nc_small_vec_int_4_data(&vec), vec.p.storage.inline_data);
+    assert_int_equal(*nc_small_vec_int_4_get(&vec, 3), 3);
+    assert_null(nc_small_vec_int_4_get(&vec, 4));
+
+    int value = 0;
+    assert_true(nc_small_vec_int_4_pop(&vec, &value));
+    assert_int_equal(value, 3);
+
+    nc_small_vec_int_4_destroy(&vec);
+}
+
+void small_vec_spills_to_heap_test(void** state) {
+    (void)state;
+
+    NC_SMALL_VEC(int, 4) vec = nc_small_vec_int_4_init();
+
+    const int values[] = { 0, 1, 2 };
+    assert_true(nc_small_vec_int_4_extend(&vec, values, 3));
+    assert_false(nc_small_vec_int_4_is_spilled(&vec));
+
+    for (int i = 3; i < 20; ++i)
+        assert_true(nc_small_vec_int_4_push(&vec, i));
+
+    assert_true(nc_small_vec_int_4_is_spilled(&vec));
+    assert_int_equal(nc_small_vec_int_4_size(&vec), 20);
+    assert_true(nc_small_vec_int_4_capacity(&vec) >= 20);
+    for (int i = 0; i < 20; ++i)
+        assert_int_equal(*nc_small_vec_int_4_get(&vec, (size_t)i), i);
+
+    nc_small_vec_int_4_clear(&vec);
+    assert_true(nc_small_vec_int_4_is_empty(&vec));
+    assert_true(nc_small_vec_int_4_is_spilled(&vec));
+
+    nc_small_vec_int_4_destroy(&vec);
+}
+
+static const struct CMUnitTest small_vec_tests[] = {
+    cmocka_unit_test(small_vec_stays_inline_test),
+    cmocka_unit_test(small_vec_spills_to_heap_test)
+};
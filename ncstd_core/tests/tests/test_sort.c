@@ -0,0 +1,178 @@
+#include "ncstd/test/test_common.h"
+
+#include <math.h>
+
+#include "ncstd/util/sort.h"
+
+
+typedef struct {
+    uint32_t key;
+    uint32_t order;
+} TestSortItem;
+
+#define test_sort_int_less(a, b) (*(a) < *(b))
+#define test_sort_item_less(a, b) ((a)->key < (b)->key)
+#define test_sort_item_key(item) ((uint64_t)(item)->key)
+
+NC_DEFINE_SORT(int, int, test_sort_int_less)
+NC_INSTANTIATE_SORT(int, int)
+
+NC_DEFINE_SORT(TestSortItem, item, test_sort_item_less)
+NC_INSTANTIATE_SORT(TestSortItem, item)
+
+NC_DEFINE_RADIX_SORT(TestSortItem, item, test_sort_item_key)
+NC_INSTANTIATE_RADIX_SORT(TestSortItem, item)
+
+#define TEST_SORT_PATTERNS 6
+
+static void test_sort_fill_pattern(int* data, size_t count, int pattern) {
+    uint32_t random = 12345;
+    for (size_t i = 0; i < count; ++i) {
+        random = random * 1103515245u + 12345u;
+        switch (pattern) {
+        case 0: data[i] = (int)(random >> 8); break;
+        case 1: data[i] = (int)i; break;
+        case 2: data[i] = (int)(count - i); break;
+        case 3: data[i] = (int)(random >> 8) % 4; break;
+        case 4: data[i] = (int)(i % 64); break;
+        default: data[i] = i == count / 2 ? -1 : (int)i; break;
+        }
+    }
+}
+
+void sort_unstable_patterns_test(void** state) {
+    (void)state;
+
+    const size_t sizes[] = { 0, 1, 2, 23, 24, 129, 1000, 20000 };
+    int* const data = malloc(20000 * sizeof(int));
+    assert_non_null(data);
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+        for (int pattern = 0; pattern < TEST_SORT_PATTERNS; ++pattern) {
+            test_sort_fill_pattern(data, sizes[s], pattern);
+
+            int64_t sum_before = 0;
+            for (size_t i = 0; i < sizes[s]; ++i)
+                sum_before += data[i];
+
+            nc_sort_int_unstable(data, sizes[s]);
+
+            int64_t sum_after = 0;
+            for (size_t i = 0; i < sizes[s]; ++i) {
+                sum_after += data[i];
+                if (i > 0)
+                    assert_true(data[i - 1] <= data[i]);
+            }
+            assert_true(sum_before == sum_after);
+        }
+    }
+
+    free(data);
+}
+
+void sort_stable_preserves_order_test(void** state) {
+    (void)state;
+
+    const size_t count = 5000;
+    TestSortItem* const items = malloc(count * sizeof(TestSortItem));
+    TestSortItem* const scratch = malloc(count / 2 * sizeof(TestSortItem));
+    assert_non_null(items);
+    assert_non_null(scratch);
+
+    uint32_t random = 777;
+    for (size_t i = 0; i < count; ++i) {
+        random = random * 1103515245u + 12345u;
+        items[i] = (TestSortItem){ .key = (random >> 16) % 50, .order = (uint32_t)i };
+    }
+
+    nc_sort_item_stable(items, count, scratch);
+    for (size_t i = 1; i < count; ++i) {
+        assert_true(items[i - 1].key <= items[i].key);
+        if (items[i - 1].key == items[i].key)
+            assert_true(items[i - 1].order < items[i].order);
+    }
+
+    free(items);
+    free(scratch);
+}
+
+void radix_sort_key_extractor_test(void** state) {
+    (void)state;
+
+    const size_t count = 3000;
+    TestSortItem* const items = malloc(count * sizeof(TestSortItem));
+    TestSortItem* const scratch = malloc(count * sizeof(TestSortItem));
+    assert_non_null(items);
+    assert_non_null(scratch);
+
+    uint32_t random = 99;
+    for (size_t i = 0; i < count; ++i) {
+        random = random * 1103515245u + 12345u;
+        items[i] = (TestSortItem){ .key = random % 1000 * 100003u, .order = (uint32_t)i };
+    }
+
+    nc_radix_sort_item(items, count, scratch);
+    for (size_t i = 1; i < count; ++i) {
+        assert_true(items[i - 1].key <= items[i].key);
+        if (items[i - 1].key == items[i].key)
+            assert_true(items[i - 1].order < items[i].order);
+    }
+
+    free(items);
+    free(scratch);
+}
+
+void radix_sort_arithmetic_test(void** state) {
+    (void)state;
+
+    int64_t signed_values[] = { 5, -3, INT64_MIN, 0, INT64_MAX, -1, 42, -42 };
+    int64_t signed_scratch[8];
+    nc_radix_sort_i64(signed_values, 8, signed_scratch);
+    for (size_t i = 1; i < 8; ++i)
+        assert_true(signed_values[i - 1] <= signed_values[i]);
+    assert_true(signed_values[0] == INT64_MIN);
+
+    int32_t small_values[] = { 7, -7, 0, INT32_MIN, INT32_MAX, 3 };
+    int32_t small_scratch[6];
+    nc_radix_sort_i32(small_values, 6, small_scratch);
+    for (size_t i = 1; i < 6; ++i)
+        assert_true(small_values[i - 1] <= small_values[i]);
+
+    double doubles[] = { 1.5, -0.0, -INFINITY, 0.0, -2.25, INFINITY, 1e-300, -1e300 };
+    double double_scratch[8];
+    nc_radix_sort_f64(doubles, 8, double_scratch);
+    for (size_t i = 1; i < 8; ++i)
+        assert_true(doubles[i - 1] <= doubles[i]);
+    assert_true(signbit(doubles[3]) && doubles[3] == 0.0);
+
+    float floats[] = { 3.0f, -1.0f, 0.5f, -0.5f, 100.0f, -100.0f };
+    float float_scratch[6];
+    nc_radix_sort_f32(floats, 6, float_scratch);
+    for (size_t i = 1; i < 6; ++i)
+        assert_true(floats[i - 1] <= floats[i]);
+
+    const size_t count = 10000;
+    uint32_t* const values = malloc(count * sizeof(uint32_t));
+    uint32_t* const scratch = malloc(count * sizeof(uint32_t));
+    assert_non_null(values);
+    assert_non_null(scratch);
+
+    uint32_t random = 4242;
+    for (size_t i = 0; i < count; ++i) {
+        random = random * 1103515245u + 12345u;
+        values[i] = random;
+    }
+    nc_radix_sort_u32(values, count, scratch);
+    for (size_t i = 1; i < count; ++i)
+        assert_true(values[i - 1] <= values[i]);
+
+    free(values);
+    free(scratch);
+}
+
+static const struct CMUnitTest sort_tests[] = {
+    cmocka_unit_test(sort_unstable_patterns_test),
+    cmocka_unit_test(sort_stable_preserves_order_test),
+    cmocka_unit_test(radix_sort_key_extractor_test),
+    cmocka_unit_test(radix_sort_arithmetic_test)
+};
@@ -0,0 +1,99 @@
+#include "ncstd/test/test_common.h"
+
+#include <threads.h>
+
+#include "ncstd/containers/spsc_queue.h"
+
+
+#define SPSC_QUEUE_TEST_COUNT 100000
+
+static int spsc_queue_test_producer(void* arg) {
+    NC_SpscQueue* const queue = arg;
+
+    for (size_t value = 0; value < SPSC_QUEUE_TEST_COUNT;) {
+        size_t batch[7];
+        size_t batch_size = 0;
+        while (batch_size < 7 && value + batch_size < SPSC_QUEUE_TEST_COUNT) {
+            batch[batch_size] = value + batch_size;
+            batch_size += 1;
+        }
+
+        const size_t pushed = nc_spsc_queue_push_batch(queue, batch, batch_size);
+        value += pushed;
+        if (pushed == 0)
+            thrd_yield();
+    }
+
+    return 0;
+}
+
+void spsc_queue_push_pop_test(void** state) {
+    (void)state;
+
+    NC_SpscQueue queue = nc_spsc_queue_init(5, sizeof(int));
+    assert_int_equal(nc_spsc_queue_capacity(&queue), 8);
+
+    int value = 0;
+    assert_false(nc_spsc_queue_try_pop(&queue, &value));
+
+    // Advance the positions, so that the batches wrap around the end of the ring
+    for (int i = 0; i < 6; ++i) {
+        assert_true(nc_spsc_queue_try_push(&queue, &i));
+        assert_true(nc_spsc_queue_try_pop(&queue, &value));
+        assert_int_equal(value, i);
+    }
+
+    const int input[10] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    assert_int_equal(nc_spsc_queue_push_batch(&queue, input, 10), 8);
+    assert_int_equal(nc_spsc_queue_size(&queue), 8);
+    assert_false(nc_spsc_queue_try_push(&queue, &input[8]));
+
+    int output[10] = { 0 };
+    assert_int_equal(nc_spsc_queue_pop_batch(&queue, output, 3), 3);
+    assert_int_equal(nc_spsc_queue_pop_batch(&queue, output + 3, 10), 5);
+    assert_memory_equal(output, input, 8 * sizeof(int));
+    assert_int_equal(nc_spsc_queue_pop_batch(&queue, output, 10), 0);
+
+    nc_spsc_queue_destroy(&queue);
+    assert_int_equal(nc_spsc_queue_capacity(&queue), 0);
+}
+
+void spsc_queue_threaded_order_test(void** state) {
+    (void)state;
+
+    NC_SpscQueue queue = nc_spsc_queue_init(64, sizeof(size_t));
+
+    thrd_t producer;
+    assert_int_equal(thrd_create(&producer, spsc_queue_test_producer, &queue), thrd_success);
+
+    size_t expected = 0;
+    while (expected < SPSC_QUEUE_TEST_COUNT) {
+        size_t batch[16];
+        const size_t popped = nc_spsc_queue_pop_batch(&queue, batch, 16);
+        for (size_t i = 0; i < popped; ++i)
+            assert_int_equal(batch[i], expected++);
+        if (popped == 0)
+            thrd_yield();
+    }
+
+    thrd_join(producer, NULL);
+    assert_int_equal(nc_spsc_queue_size(&queue), 0);
+
+    nc_spsc_queue_destroy(&queue);
+}
+
+void spsc_queue_layout_test(void** state) {
+    (void)state;
+
+    // Shared, producer and consumer members don't share cache lines, wherever the queue is placed
+    assert_int_equal(alignof(NC_SpscQueue), NC_CACHE_LINE_SIZE);
+    assert_int_equal(offsetof(NC_SpscQueue, p.tail) % NC_CACHE_LINE_SIZE, 0);
+    assert_int_equal(offsetof(NC_SpscQueue, p.head) - offsetof(NC_SpscQueue, p.tail), NC_CACHE_LINE_SIZE);
+    assert_int_equal(sizeof(NC_SpscQueue) - offsetof(NC_SpscQueue, p.head), NC_CACHE_LINE_SIZE);
+}
+
+static const struct CMUnitTest spsc_queue_tests[] = {
+    cmocka_unit_test(spsc_queue_push_pop_test),
+    cmocka_unit_test(spsc_queue_threaded_order_test),
+    cmocka_unit_test(spsc_queue_layout_test)
+};
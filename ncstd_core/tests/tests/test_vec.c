@@ -0,0 +1,95 @@
+#include "ncstd/test/test_common.h"
+
+#include "ncstd/containers/vec.h"
+
+
+NC_DEFINE_VEC(int, int)
+NC_INSTANTIATE_VEC(int, int)
+
+NC_DEFINE_VEC_WITH_GROWTH(double, double, nc_vec_growth_half)
+NC_INSTANTIATE_VEC(double, double)
+
+
+void vec_push_pop_test(void** state) {
+    (void)state;
+
+    NC_VEC(int) vec = nc_vec_int_init();
+    assert_true(nc_vec_int_is_empty(&vec));
+
+    for (int i = 0; i < 100; ++i)
+        assert_true(nc_vec_int_push(&vec, i));
+
+    assert_int_equal(nc_vec_int_size(&vec), 100);
+    assert_true(nc_vec_int_capacity(&vec) >= 100);
+    assert_int_equal(*nc_vec_int_get(&vec, 42), 42);
+    assert_null(nc_vec_int_get(&vec, 100));
+
+    int value = 0;
+    assert_true(nc_vec_int_pop(&vec, &value));
+    assert_int_equal(value, 99);
+    assert_int_equal(nc_vec_int_size(&vec), 99);
+
+    nc_vec_int_clear(&vec);
+    assert_false(nc_vec_int_pop(&vec, NULL));
+
+    nc_vec_int_destroy(&vec);
+}
+
+void vec_insert_erase_test(void** state) {
+    (void)state;
+
+    NC_VEC(int) vec = nc_vec_int_init();
+
+    const int values[] = { 1, 2, 4, 5 };
+    assert_true(nc_vec_int_extend(&vec, values, 4));
+    assert_true(nc_vec_int_insert(&vec, 2, 3));
+    assert_true(nc_vec_int_insert(&vec, 0, 0));
+    assert_true(nc_vec_int_insert(&vec, 6, 6));
+    assert_false(nc_vec_int_insert(&vec, 8, 8));
+
+    const int expected[] = { 0, 1, 2, 3, 4, 5, 6 };
+    assert_int_equal(nc_vec_int_size(&vec), 7);
+    assert_memory_equal(nc_vec_int_data(&vec), expected, sizeof(expected));
+
+    assert_true(nc_vec_int_erase(&vec, 0));
+    assert_true(nc_vec_int_erase(&vec, 2));
+    assert_false(nc_vec_int_erase(&vec, 5));
+
+    const int expected_erased[] = { 1, 2, 4, 5, 6 };
+    assert_int_equal(nc_vec_int_size(&vec), 5);
+    assert_memory_equal(nc_vec_int_data(&vec), expected_erased, sizeof(expected_erased));
+
+    nc_vec_int_destroy(&vec);
+}
+
+void vec_reserve_shrink_test(void** state) {
+    (void)state;
+
+    NC_VEC(double) vec = nc_vec_double_init_with_capacity(2);
+    assert_int_equal(nc_vec_double_capacity(&vec), 2);
+
+    assert_true(nc_vec_double_push(&vec, 1.0));
+    assert_true(nc_vec_double_push(&vec, 2.0));
+    assert_true(nc_vec_double_push(&vec, 3.0));
+    assert_int_equal(nc_vec_double_capacity(&vec), NC_VEC_MIN_CAPACITY);
+
+    assert_true(nc_vec_double_reserve(&vec, 5));
+    assert_int_equal(nc_vec_double_capacity(&vec), 6);
+
+    nc_vec_double_shrink_to_fit(&vec);
+    assert_int_equal(nc_vec_double_capacity(&vec), 3);
+    assert_true(*nc_vec_double_get(&vec, 2) == 3.0);
+
+    nc_vec_double_clear(&vec);
+    nc_vec_double_shrink_to_fit(&vec);
+    assert_int_equal(nc_vec_double_capacity(&vec), 0);
+    assert_null(nc_vec_double_data(&vec));
+
+    nc_vec_double_destroy(&vec);
+}
+
+static const struct CMUnitTest vec_tests[] = {
+    cmocka_unit_test(vec_push_pop_test),
+    cmocka_unit_test(vec_insert_erase_test),
+    cmocka_unit_test(vec_reserve_shrink_test)
+};
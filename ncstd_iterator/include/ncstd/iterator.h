@@ -1,7 +1,10 @@
 #pragma once
 
+#include <stddef.h>
 #include <stdint.h>
 
+#include "ncstd/allocator.h"
+
 
 typedef struct {
 	void* (* const next_fn)(void* iterator);
@@ -10,6 +13,8 @@ typedef struct {
 // NOTE: Make it as a template instead?
 typedef struct {
 	const NC_IteratorVtable* const vtable;
+	NC_Allocator* const allocator;
+	const size_t concrete_size;
 	uint8_t concrete[];
 } NC_Iterator;
 
@@ -17,4 +22,6 @@ void* nc_iterator_concrete(NC_Iterator* self);
 void* nc_iterator_next(NC_Iterator* self);
 // TODO: Implement peek
 
-NC_Iterator* nc_iterator_create(const NC_IteratorVtable* vtable, void* concrete, size_t concrete_size);
\ No newline at end of file
+NC_Iterator* nc_iterator_create(const NC_IteratorVtable* vtable, void* concrete, size_t concrete_size);
+NC_Iterator* nc_iterator_create_in(const NC_IteratorVtable* vtable, void* concrete, size_t concrete_size, NC_Allocator* allocator);
+void nc_iterator_destroy(NC_Iterator* self);
@@ -20,4 +20,5 @@ NC_PointerIterator nc_pointer_iterator_init(void* start_ptr, size_t length, size
 
 void* nc_pointer_iterator_next(NC_PointerIterator* self);
 
-NC_Iterator* nc_pointer_iterator_into_dyn(NC_PointerIterator self);
\ No newline at end of file
+NC_Iterator* nc_pointer_iterator_into_dyn(NC_PointerIterator self);
+NC_Iterator* nc_pointer_iterator_into_dyn_in(NC_PointerIterator self, NC_Allocator* allocator);
\ No newline at end of file
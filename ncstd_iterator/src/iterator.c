@@ -1,5 +1,6 @@
 #include "ncstd/iterator.h"
 
+#include "ncstd/alloc_stats.h"
 #include "ncstd/util/create_util.h"
 
 
@@ -13,10 +14,26 @@ void* nc_iterator_next(NC_Iterator* self) {
 
 
 NC_Iterator* nc_iterator_create(const NC_IteratorVtable* vtable, void* concrete, size_t concrete_size) {
-	return nc_util_create_with_flexible(
-		&(NC_Iterator) { .vtable = vtable },
+	return nc_iterator_create_in(vtable, concrete, concrete_size, nc_allocator_default());
+}
+
+NC_Iterator* nc_iterator_create_in(const NC_IteratorVtable* vtable, void* concrete, size_t concrete_size, NC_Allocator* allocator) {
+	NC_INTERNAL_ALLOC_STATS_SITE_ENTER();
+	NC_Iterator* const iterator = nc_util_create_with_flexible_in(
+		&(NC_Iterator) { .vtable = vtable, .allocator = allocator, .concrete_size = concrete_size },
 		sizeof(NC_Iterator),
 		concrete,
-		concrete_size
+		concrete_size,
+		allocator
 	);
-}
\ No newline at end of file
+	NC_INTERNAL_ALLOC_STATS_SITE_LEAVE();
+
+	return iterator;
+}
+
+void nc_iterator_destroy(NC_Iterator* self) {
+	if (!self)
+		return;
+
+	nc_allocator_free(self->allocator, self, sizeof(NC_Iterator) + self->concrete_size, NC_DEFAULT_ALIGNMENT);
+}
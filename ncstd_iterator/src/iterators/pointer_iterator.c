@@ -25,6 +25,10 @@ NC_Iterator* nc_pointer_iterator_into_dyn(NC_PointerIterator self) {
 	return nc_iterator_create(&ITERATOR_VTABLE, &self, sizeof self);
 }
 
+NC_Iterator* nc_pointer_iterator_into_dyn_in(NC_PointerIterator self, NC_Allocator* allocator) {
+	return nc_iterator_create_in(&ITERATOR_VTABLE, &self, sizeof self, allocator);
+}
+
 
 NC_PointerIterator nc_pointer_iterator_init(void* start_ptr, size_t length, size_t object_size) {
 	return (NC_PointerIterator) {
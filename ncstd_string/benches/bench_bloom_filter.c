@@ -0,0 +1,90 @@
+#include "ncstd/bench/bench_common.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "ncstd/containers/hash_map.h"
+#include "ncstd/string_bloom_filter.h"
+#include "ncstd/string_view.h"
+
+
+// Negative lookups of string keys: NC_HASH_MAP misses compared to rejecting the keys with a blocked
+// bloom filter (one key at a time and in bulk), and to a map lookup guarded by the filter.
+//
+// Usage: ncstd_string_bench_bloom_filter [max_size] [bits_per_key]
+
+NC_DEFINE_HASH_MAP(NC_StringView, uint32_t, string_view_u32, nc_string_view_ptr_hash, nc_string_view_ptr_eq)
+NC_INSTANTIATE_HASH_MAP(NC_StringView, uint32_t, string_view_u32)
+
+#define KEY_CAPACITY 48
+
+static NC_StringView make_key(char* buffer, size_t index, const char* prefix) {
+    const int length = snprintf(buffer, KEY_CAPACITY, "%s%zu", prefix, index);
+
+    return nc_string_view_init_unchecked(buffer, (size_t)length);
+}
+
+static void bench(size_t size, size_t bits_per_key) {
+    char* const hit_storage = malloc(size * KEY_CAPACITY);
+    char* const miss_storage = malloc(size * KEY_CAPACITY);
+    NC_StringView* const hits = malloc(size * sizeof(NC_StringView));
+    NC_StringView* const misses = malloc(size * sizeof(NC_StringView));
+    bool* const results = malloc(size * sizeof(bool));
+
+    for (size_t i = 0; i < size; ++i) {
+        hits[i] = make_key(hit_storage + i * KEY_CAPACITY, i, "key:");
+        misses[i] = make_key(miss_storage + i * KEY_CAPACITY, i, "absent:");
+    }
+
+    NC_HASH_MAP(NC_StringView, uint32_t) map = nc_hash_map_string_view_u32_init();
+    for (size_t i = 0; i < size; ++i)
+        nc_hash_map_string_view_u32_insert(&map, hits[i], (uint32_t)i);
+
+    NC_BloomFilter filter = nc_bloom_filter_init(size, bits_per_key);
+    double start = nc_bench_now();
+    nc_bloom_filter_insert_string_views(&filter, hits, size);
+    nc_bench_report("filter_insert_bulk", size, nc_bench_now() - start, (double)size, "keys");
+
+    size_t found = 0;
+    start = nc_bench_now();
+    for (size_t i = 0; i < size; ++i)
+        found += nc_hash_map_string_view_u32_get(&map, &misses[i]) != NULL;
+    nc_bench_report("map_miss", size, nc_bench_now() - start, (double)size, "keys");
+
+    start = nc_bench_now();
+    for (size_t i = 0; i < size; ++i)
+        found += nc_bloom_filter_contains_string_view(&filter, misses[i]);
+    nc_bench_report("filter_miss", size, nc_bench_now() - start, (double)size, "keys");
+
+    start = nc_bench_now();
+    const size_t false_positives = nc_bloom_filter_contains_string_views(&filter, misses, size, results);
+    nc_bench_report("filter_miss_bulk", size, nc_bench_now() - start, (double)size, "keys");
+
+    start = nc_bench_now();
+    for (size_t i = 0; i < size; ++i) {
+        if (results[i])
+            found += nc_hash_map_string_view_u32_get(&map, &misses[i]) != NULL;
+    }
+    nc_bench_report("filtered_map_miss", size, nc_bench_now() - start, (double)size, "keys");
+
+    nc_bench_do_not_optimize(&found);
+    printf("false positive rate at %zu bits per key: %.3f%%\n", bits_per_key, 100.0 * (double)false_positives / (double)size);
+
+    nc_bloom_filter_destroy(&filter);
+    nc_hash_map_string_view_u32_destroy(&map);
+    free(hit_storage);
+    free(miss_storage);
+    free(hits);
+    free(misses);
+    free(results);
+}
+
+int main(int argc, char* argv[]) {
+    const size_t max_size = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 10000000;
+    const size_t bits_per_key = argc > 2 ? (size_t)strtoull(argv[2], NULL, 10) : 10;
+
+    for (size_t size = 10000; size <= max_size; size *= 10)
+        bench(size, bits_per_key);
+
+    return 0;
+}
@@ -0,0 +1,87 @@
+#include "ncstd/bench/bench_common.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "ncstd/containers/hash_map.h"
+#include "ncstd/nc_string.h"
+#include "ncstd/string_view.h"
+
+
+// Insert, lookup (hits and misses) and remove throughput of a string-keyed NC_HASH_MAP.
+// Keys are 8 to 40 bytes long.
+//
+// Usage: ncstd_string_bench_hash_map [max_size] [total_lookups]
+
+NC_DEFINE_HASH_MAP(NC_StringView, uint32_t, string_view_u32, nc_string_view_ptr_hash, nc_string_view_ptr_eq)
+NC_INSTANTIATE_HASH_MAP(NC_StringView, uint32_t, string_view_u32)
+
+#define KEY_CAPACITY 48
+
+static NC_StringView make_key(char* buffer, size_t index, const char* prefix) {
+    const int length = snprintf(buffer, KEY_CAPACITY, "%s%zu", prefix, index);
+    const size_t padding = index % 32;
+    for (size_t i = 0; i < padding; ++i)
+        buffer[length + i] = (char)('a' + i);
+
+    return nc_string_view_init_unchecked(buffer, (size_t)length + padding);
+}
+
+static void bench(size_t size, size_t total_lookups) {
+    char* const hit_storage = malloc(size * KEY_CAPACITY);
+    char* const miss_storage = malloc(size * KEY_CAPACITY);
+    NC_StringView* const hits = malloc(size * sizeof(NC_StringView));
+    NC_StringView* const misses = malloc(size * sizeof(NC_StringView));
+
+    for (size_t i = 0; i < size; ++i) {
+        hits[i] = make_key(hit_storage + i * KEY_CAPACITY, i, "key:");
+        misses[i] = make_key(miss_storage + i * KEY_CAPACITY, i, "absent:");
+    }
+
+    NC_HASH_MAP(NC_StringView, uint32_t) map = nc_hash_map_string_view_u32_init();
+
+    double start = nc_bench_now();
+    for (size_t i = 0; i < size; ++i)
+        nc_hash_map_string_view_u32_insert(&map, hits[i], (uint32_t)i);
+    nc_bench_report("insert", size, nc_bench_now() - start, (double)size, "ops");
+
+    const size_t rounds = total_lookups / size > 0 ? total_lookups / size : 1;
+    uint64_t found = 0;
+
+    start = nc_bench_now();
+    for (size_t round = 0; round < rounds; ++round) {
+        for (size_t i = 0; i < size; ++i)
+            found += nc_hash_map_string_view_u32_get(&map, &hits[i]) != NULL;
+    }
+    nc_bench_report("lookup_hit", size, nc_bench_now() - start, (double)(rounds * size), "ops");
+
+    start = nc_bench_now();
+    for (size_t round = 0; round < rounds; ++round) {
+        for (size_t i = 0; i < size; ++i)
+            found += nc_hash_map_string_view_u32_get(&map, &misses[i]) != NULL;
+    }
+    nc_bench_report("lookup_miss", size, nc_bench_now() - start, (double)(rounds * size), "ops");
+
+    start = nc_bench_now();
+    for (size_t i = 0; i < size; ++i)
+        found += nc_hash_map_string_view_u32_remove(&map, &hits[i], NULL, NULL);
+    nc_bench_report("remove", size, nc_bench_now() - start, (double)size, "ops");
+
+    nc_bench_do_not_optimize(&found);
+
+    nc_hash_map_string_view_u32_destroy(&map);
+    free(misses);
+    free(hits);
+    free(miss_storage);
+    free(hit_storage);
+}
+
+int main(int argc, char* argv[]) {
+    const size_t max_size = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 1 << 20;
+    const size_t total_lookups = argc > 2 ? (size_t)strtoull(argv[2], NULL, 10) : 1 << 24;
+
+    for (size_t size = 1 << 10; size <= max_size; size *= 8)
+        bench(size, total_lookups);
+
+    return 0;
+}
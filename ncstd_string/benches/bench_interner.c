@@ -0,0 +1,84 @@
+#include "ncstd/bench/bench_common.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "ncstd/interner.h"
+#include "ncstd/nc_string.h"
+#include "ncstd/string_view.h"
+
+
+// Tokenizer-like workload: a stream of tokens drawn from a small vocabulary of field names.
+// Compares allocating an NC_String per token to interning it, and comparing tokens
+// with nc_string_view_eq to comparing symbols.
+//
+// Usage: ncstd_string_bench_interner [token_count] [vocabulary_size]
+
+#define NAME_CAPACITY 32
+
+static uint64_t xorshift(uint64_t* state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+
+    return *state;
+}
+
+int main(int argc, char* argv[]) {
+    const size_t token_count = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 1 << 22;
+    const size_t vocabulary_size = argc > 2 ? (size_t)strtoull(argv[2], NULL, 10) : 1000;
+
+    char* const names = malloc(vocabulary_size * NAME_CAPACITY);
+    NC_StringView* const tokens = malloc(token_count * sizeof(NC_StringView));
+    NC_String* const strings = malloc(token_count * sizeof(NC_String));
+    NC_Symbol* const symbols = malloc(token_count * sizeof(NC_Symbol));
+
+    for (size_t i = 0; i < vocabulary_size; ++i)
+        snprintf(names + i * NAME_CAPACITY, NAME_CAPACITY, "field_name_%zu", i);
+
+    uint64_t state = 88172645463325252ull;
+    for (size_t i = 0; i < token_count; ++i)
+        tokens[i] = nc_string_view_from_cstr(names + xorshift(&state) % vocabulary_size * NAME_CAPACITY);
+
+    double start = nc_bench_now();
+    for (size_t i = 0; i < token_count; ++i)
+        strings[i] = nc_string_from_string_view(tokens[i]);
+    nc_bench_report("string_copy", token_count, nc_bench_now() - start, (double)token_count, "tokens");
+
+    NC_Interner interner = nc_interner_init();
+    start = nc_bench_now();
+    for (size_t i = 0; i < token_count; ++i)
+        nc_interner_intern(&interner, tokens[i], &symbols[i]);
+    nc_bench_report("interner_intern", token_count, nc_bench_now() - start, (double)token_count, "tokens");
+
+    // Count tokens equal to their predecessor
+    size_t equal = 0;
+    start = nc_bench_now();
+    for (size_t i = 1; i < token_count; ++i)
+        equal += nc_string_view_eq(nc_string_as_string_view(&strings[i]), nc_string_as_string_view(&strings[i - 1]));
+    nc_bench_report("string_eq", token_count, nc_bench_now() - start, (double)token_count, "tokens");
+
+    start = nc_bench_now();
+    for (size_t i = 1; i < token_count; ++i)
+        equal += symbols[i] == symbols[i - 1];
+    nc_bench_report("symbol_eq", token_count, nc_bench_now() - start, (double)token_count, "tokens");
+
+    start = nc_bench_now();
+    size_t total_size = 0;
+    for (size_t i = 0; i < token_count; ++i)
+        total_size += nc_string_view_size(nc_interner_resolve(&interner, symbols[i]));
+    nc_bench_report("interner_resolve", token_count, nc_bench_now() - start, (double)token_count, "tokens");
+
+    nc_bench_do_not_optimize(&equal);
+    nc_bench_do_not_optimize(&total_size);
+
+    for (size_t i = 0; i < token_count; ++i)
+        nc_string_destroy(&strings[i]);
+    nc_interner_destroy(&interner);
+    free(names);
+    free(tokens);
+    free(strings);
+    free(symbols);
+
+    return 0;
+}
@@ -0,0 +1,92 @@
+#include "ncstd/bench/bench_common.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "ncstd/nc_string.h"
+#include "ncstd/rope.h"
+#include "ncstd/string_view.h"
+
+
+// Editor-like workload: small insertions and removals at random positions of a large document.
+// Compares NC_Rope to a contiguous buffer, that moves the tail of the text on every edit.
+//
+// Usage: ncstd_string_bench_rope [document_size] [edit_count]
+
+static uint64_t xorshift(uint64_t* state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+
+    return *state;
+}
+
+int main(int argc, char* argv[]) {
+    const size_t document_size = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 8 << 20;
+    const size_t edit_count = argc > 2 ? (size_t)strtoull(argv[2], NULL, 10) : 10000;
+
+    static const char TYPED[] = "typed";
+    const size_t typed_size = sizeof TYPED - 1;
+
+    char* const document = malloc(document_size + edit_count * typed_size);
+    for (size_t i = 0; i < document_size; ++i)
+        document[i] = (char)('a' + i % 26);
+
+    uint64_t state = 88172645463325252ull;
+    size_t size = document_size;
+    double start = nc_bench_now();
+    for (size_t i = 0; i < edit_count; ++i) {
+        const size_t index = xorshift(&state) % size;
+        memmove(document + index + typed_size, document + index, size - index);
+        memcpy(document + index, TYPED, typed_size);
+        size += typed_size;
+    }
+    nc_bench_report("buffer_insert", document_size, nc_bench_now() - start, (double)edit_count, "edits");
+
+    state = 88172645463325252ull;
+    NC_OPTION(NC_Rope) created = nc_rope_from_string_view(nc_string_view_init_unchecked(document, document_size));
+    if (!nc_option_rope_is_some(created))
+        return 1;
+    NC_Rope rope = created.value;
+    const NC_StringView typed = nc_string_view_init_unchecked(TYPED, typed_size);
+    start = nc_bench_now();
+    for (size_t i = 0; i < edit_count; ++i)
+        nc_rope_insert(&rope, xorshift(&state) % nc_rope_size(&rope), typed);
+    nc_bench_report("rope_insert", document_size, nc_bench_now() - start, (double)edit_count, "edits");
+
+    start = nc_bench_now();
+    for (size_t i = 0; i < edit_count; ++i) {
+        const size_t index = xorshift(&state) % (size - typed_size);
+        memmove(document + index, document + index + typed_size, size - index - typed_size);
+        size -= typed_size;
+    }
+    nc_bench_report("buffer_remove", document_size, nc_bench_now() - start, (double)edit_count, "edits");
+
+    start = nc_bench_now();
+    for (size_t i = 0; i < edit_count; ++i) {
+        const size_t index = xorshift(&state) % (nc_rope_size(&rope) - typed_size);
+        nc_rope_remove(&rope, index, index + typed_size);
+    }
+    nc_bench_report("rope_remove", document_size, nc_bench_now() - start, (double)edit_count, "edits");
+
+    // Slices share chunks with the rope
+    start = nc_bench_now();
+    for (size_t i = 0; i < edit_count; ++i) {
+        const size_t index = xorshift(&state) % (nc_rope_size(&rope) / 2);
+        NC_Rope slice;
+        if (nc_rope_slice(&rope, index, index + nc_rope_size(&rope) / 2, &slice))
+            nc_rope_destroy(&slice);
+    }
+    nc_bench_report("rope_slice", document_size, nc_bench_now() - start, (double)edit_count, "slices");
+
+    start = nc_bench_now();
+    NC_String string = nc_rope_to_string(&rope);
+    nc_bench_report("rope_to_string", document_size, nc_bench_now() - start, (double)document_size, "bytes");
+    nc_bench_do_not_optimize(&string);
+
+    nc_string_destroy(&string);
+    nc_rope_destroy(&rope);
+    free(document);
+
+    return 0;
+}
@@ -0,0 +1,184 @@
+#include "ncstd/bench/bench_common.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <uchar.h>
+
+#include "ncstd/transcode.h"
+#include "ncstd/utf8.h"
+
+
+// Throughput of bulk conversions between UTF-8, UTF-16 and UTF-32 in GB of input per second,
+// compared to converting one codepoint per call with nc_utf8_decode_char_unchecked and
+// nc_utf8_encode_char_unchecked. Corpora are ASCII, Latin (mostly ASCII with 2 byte letters),
+// CJK (3 byte) and emoji mixed with ASCII (4 byte, surrogate pairs in UTF-16).
+//
+// Usage: ncstd_string_bench_transcode [char_count] [repetitions]
+
+static uint64_t xorshift(uint64_t* state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+
+    return *state;
+}
+
+static char32_t ascii_char(uint64_t* state) {
+    const uint64_t value = xorshift(state) % 64;
+    if (value < 10)
+        return ' ';
+
+    return 'a' + (char32_t)(value % 26);
+}
+
+static char32_t latin_char(uint64_t* state) {
+    if (xorshift(state) % 6 == 0)
+        return 0xC0 + (char32_t)(xorshift(state) % 64);
+
+    return ascii_char(state);
+}
+
+static char32_t cjk_char(uint64_t* state) {
+    return 0x4E00 + (char32_t)(xorshift(state) % 0x5200);
+}
+
+static char32_t emoji_char(uint64_t* state) {
+    if (xorshift(state) % 4 == 0)
+        return 0x1F600 + (char32_t)(xorshift(state) % 80);
+
+    return ascii_char(state);
+}
+
+static size_t baseline_utf8_to_utf16(const uint8_t* data, size_t size, char16_t* out) {
+    size_t written = 0;
+    for (size_t i = 0; i < size;) {
+        size_t char_width;
+        char32_t ch = nc_utf8_decode_char_unchecked(data + i, &char_width);
+        i += char_width;
+
+        if (ch < 0x10000) {
+            out[written++] = (char16_t)ch;
+        } else {
+            ch -= 0x10000;
+            out[written++] = (char16_t)(0xD800 + (ch >> 10));
+            out[written++] = (char16_t)(0xDC00 + (ch & 0x3FF));
+        }
+    }
+
+    return written;
+}
+
+static size_t baseline_utf8_to_utf32(const uint8_t* data, size_t size, char32_t* out) {
+    size_t written = 0;
+    for (size_t i = 0; i < size;) {
+        size_t char_width;
+        out[written++] = nc_utf8_decode_char_unchecked(data + i, &char_width);
+        i += char_width;
+    }
+
+    return written;
+}
+
+static size_t baseline_utf16_to_utf8(const char16_t* data, size_t count, uint8_t* out) {
+    size_t written = 0;
+    for (size_t i = 0; i < count;) {
+        char32_t ch = data[i++];
+        if (ch >= 0xD800 && ch <= 0xDBFF)
+            ch = 0x10000 + ((ch - 0xD800) << 10) + (data[i++] - 0xDC00);
+
+        written += nc_utf8_encode_char_unchecked(out + written, ch);
+    }
+
+    return written;
+}
+
+static size_t baseline_utf32_to_utf8(const char32_t* data, size_t count, uint8_t* out) {
+    size_t written = 0;
+    for (size_t i = 0; i < count; ++i)
+        written += nc_utf8_encode_char_unchecked(out + written, data[i]);
+
+    return written;
+}
+
+static void report(const char* corpus, const char* name, double seconds, size_t input_size, size_t repetitions) {
+    char full_name[64];
+    snprintf(full_name, sizeof(full_name), "%s_%s", corpus, name);
+    nc_bench_report(full_name, input_size, seconds, (double)input_size * (double)repetitions / 1e9, "GB");
+}
+
+static void bench(const char* corpus, char32_t (*next_char)(uint64_t*), size_t char_count, size_t repetitions) {
+    char32_t* const utf32 = malloc(char_count * sizeof(char32_t));
+    uint64_t state = 88172645463325252ull;
+    for (size_t i = 0; i < char_count; ++i)
+        utf32[i] = next_char(&state);
+
+    const size_t utf8_size = nc_utf32_utf8_length(utf32, char_count);
+    uint8_t* const utf8 = malloc(utf8_size);
+    nc_utf32_to_utf8(utf32, char_count, utf8);
+
+    const size_t utf16_count = nc_utf8_utf16_length(utf8, utf8_size);
+    char16_t* const utf16 = malloc(utf16_count * sizeof(char16_t));
+    nc_utf8_to_utf16(utf8, utf8_size, utf16);
+
+    uint8_t* const out_utf8 = malloc(utf8_size);
+    char16_t* const out_utf16 = malloc(utf16_count * sizeof(char16_t));
+    char32_t* const out_utf32 = malloc(char_count * sizeof(char32_t));
+
+    size_t written = 0;
+    double start = nc_bench_now();
+    for (size_t i = 0; i < repetitions; ++i)
+        written += baseline_utf8_to_utf16(utf8, utf8_size, out_utf16);
+    report(corpus, "utf8_to_utf16_baseline", nc_bench_now() - start, utf8_size, repetitions);
+    start = nc_bench_now();
+    for (size_t i = 0; i < repetitions; ++i)
+        written += nc_utf8_to_utf16(utf8, utf8_size, out_utf16);
+    report(corpus, "utf8_to_utf16", nc_bench_now() - start, utf8_size, repetitions);
+
+    start = nc_bench_now();
+    for (size_t i = 0; i < repetitions; ++i)
+        written += baseline_utf8_to_utf32(utf8, utf8_size, out_utf32);
+    report(corpus, "utf8_to_utf32_baseline", nc_bench_now() - start, utf8_size, repetitions);
+    start = nc_bench_now();
+    for (size_t i = 0; i < repetitions; ++i)
+        written += nc_utf8_to_utf32(utf8, utf8_size, out_utf32);
+    report(corpus, "utf8_to_utf32", nc_bench_now() - start, utf8_size, repetitions);
+
+    start = nc_bench_now();
+    for (size_t i = 0; i < repetitions; ++i)
+        written += baseline_utf16_to_utf8(utf16, utf16_count, out_utf8);
+    report(corpus, "utf16_to_utf8_baseline", nc_bench_now() - start, utf16_count * sizeof(char16_t), repetitions);
+    start = nc_bench_now();
+    for (size_t i = 0; i < repetitions; ++i)
+        written += nc_utf16_to_utf8(utf16, utf16_count, out_utf8);
+    report(corpus, "utf16_to_utf8", nc_bench_now() - start, utf16_count * sizeof(char16_t), repetitions);
+
+    start = nc_bench_now();
+    for (size_t i = 0; i < repetitions; ++i)
+        written += baseline_utf32_to_utf8(utf32, char_count, out_utf8);
+    report(corpus, "utf32_to_utf8_baseline", nc_bench_now() - start, char_count * sizeof(char32_t), repetitions);
+    start = nc_bench_now();
+    for (size_t i = 0; i < repetitions; ++i)
+        written += nc_utf32_to_utf8(utf32, char_count, out_utf8);
+    report(corpus, "utf32_to_utf8", nc_bench_now() - start, char_count * sizeof(char32_t), repetitions);
+
+    nc_bench_do_not_optimize(&written);
+
+    free(utf32);
+    free(utf8);
+    free(utf16);
+    free(out_utf8);
+    free(out_utf16);
+    free(out_utf32);
+}
+
+int main(int argc, char* argv[]) {
+    const size_t char_count = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 1 << 18;
+    const size_t repetitions = argc > 2 ? (size_t)strtoull(argv[2], NULL, 10) : 500;
+
+    bench("ascii", ascii_char, char_count, repetitions);
+    bench("latin", latin_char, char_count, repetitions);
+    bench("cjk", cjk_char, char_count, repetitions);
+    bench("emoji", emoji_char, char_count, repetitions);
+
+    return 0;
+}
@@ -0,0 +1,151 @@
+#include "ncstd/bench/bench_common.h"
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "ncstd/char_index.h"
+#include "ncstd/string_view.h"
+#include "ncstd/utf8.h"
+
+
+// UTF-8 validation and codepoint counting throughput on ASCII, Latin (mostly ASCII with 2 byte letters)
+// and CJK (3 byte) text, comparing portable scalar functions to ones that dispatch to SSE or AVX2.
+// Also slices random codepoint ranges by scanning from the beginning and with NC_CharIndex.
+//
+// Usage: ncstd_string_bench_utf8 [corpus_size] [repetitions] [slice_count]
+
+typedef bool (*Validator)(const uint8_t* data, size_t size);
+typedef size_t (*Counter)(const uint8_t* data, size_t size);
+
+static uint64_t xorshift(uint64_t* state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+
+    return *state;
+}
+
+static char32_t ascii_char(uint64_t* state) {
+    const uint64_t value = xorshift(state) % 64;
+    if (value < 10)
+        return ' ';
+    if (value == 10)
+        return '\n';
+
+    return 'a' + (char32_t)(value % 26);
+}
+
+static char32_t latin_char(uint64_t* state) {
+    // Accented letters of Latin-1 Supplement
+    if (xorshift(state) % 6 == 0)
+        return 0xC0 + (char32_t)(xorshift(state) % 64);
+
+    return ascii_char(state);
+}
+
+static char32_t cjk_char(uint64_t* state) {
+    // CJK Unified Ideographs with occasional ASCII punctuation
+    if (xorshift(state) % 16 == 0)
+        return xorshift(state) % 2 == 0 ? ',' : '\n';
+
+    return 0x4E00 + (char32_t)(xorshift(state) % 0x5200);
+}
+
+static size_t fill(uint8_t* data, size_t size, char32_t (*next_char)(uint64_t*)) {
+    uint64_t state = 88172645463325252ull;
+    size_t length = 0;
+    while (size - length >= 4)
+        length += nc_utf8_encode_char(data + length, next_char(&state));
+
+    return length;
+}
+
+static void bench(const char* name, Validator validator, const uint8_t* data, size_t size, size_t repetitions) {
+    size_t valid = 0;
+    const double start = nc_bench_now();
+    for (size_t i = 0; i < repetitions; ++i) {
+        nc_bench_do_not_optimize(data);
+        valid += validator(data, size);
+    }
+    nc_bench_report(name, size, nc_bench_now() - start, (double)size * (double)repetitions, "bytes");
+
+    if (valid != repetitions)
+        fprintf(stderr, "%s: corpus reported as invalid\n", name);
+}
+
+static void bench_count(const char* name, Counter counter, const uint8_t* data, size_t size, size_t repetitions) {
+    size_t count = 0;
+    const double start = nc_bench_now();
+    for (size_t i = 0; i < repetitions; ++i) {
+        nc_bench_do_not_optimize(data);
+        count += counter(data, size);
+    }
+    nc_bench_report(name, size, nc_bench_now() - start, (double)size * (double)repetitions, "bytes");
+
+    nc_bench_do_not_optimize(&count);
+}
+
+static void bench_slice(const char* name, const uint8_t* data, size_t size, size_t slice_count, bool use_index) {
+    const NC_StringView text = nc_string_view_init_unchecked((const char*)data, size);
+    NC_CharIndex index = nc_char_index_init(text);
+    const size_t char_count = nc_string_view_char_count(text);
+
+    uint64_t state = 2463534242ull;
+    size_t total = 0;
+    const double start = nc_bench_now();
+    for (size_t i = 0; i < slice_count; ++i) {
+        const size_t begin = xorshift(&state) % char_count;
+        const size_t end = begin + xorshift(&state) % 64;
+        const NC_StringView slice = use_index
+            ? nc_char_index_slice(&index, begin, end)
+            : nc_string_view_char_slice(text, begin, end);
+        total += nc_string_view_size(slice);
+    }
+    nc_bench_report(name, size, nc_bench_now() - start, (double)slice_count, "slices");
+
+    nc_bench_do_not_optimize(&total);
+    nc_char_index_destroy(&index);
+}
+
+int main(int argc, char* argv[]) {
+    const size_t corpus_size = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 1 << 20;
+    const size_t repetitions = argc > 2 ? (size_t)strtoull(argv[2], NULL, 10) : 1000;
+    const size_t slice_count = argc > 3 ? (size_t)strtoull(argv[3], NULL, 10) : 10000;
+
+    uint8_t* const data = malloc(corpus_size);
+
+    const struct {
+        const char* names[6];
+        char32_t (*next_char)(uint64_t*);
+    } corpora[] = {
+        {
+            { "ascii_valid_scalar", "ascii_valid_simd", "ascii_count_scalar", "ascii_count_simd",
+              "ascii_slice_scan", "ascii_slice_index" },
+            ascii_char
+        },
+        {
+            { "latin_valid_scalar", "latin_valid_simd", "latin_count_scalar", "latin_count_simd",
+              "latin_slice_scan", "latin_slice_index" },
+            latin_char
+        },
+        {
+            { "cjk_valid_scalar", "cjk_valid_simd", "cjk_count_scalar", "cjk_count_simd",
+              "cjk_slice_scan", "cjk_slice_index" },
+            cjk_char
+        }
+    };
+    for (size_t i = 0; i < sizeof(corpora) / sizeof(corpora[0]); ++i) {
+        const size_t size = fill(data, corpus_size, corpora[i].next_char);
+        bench(corpora[i].names[0], nc_utf8_is_valid_scalar, data, size, repetitions);
+        bench(corpora[i].names[1], nc_utf8_is_valid, data, size, repetitions);
+        bench_count(corpora[i].names[2], nc_utf8_count_codepoints_scalar, data, size, repetitions);
+        bench_count(corpora[i].names[3], nc_utf8_count_codepoints, data, size, repetitions);
+        bench_slice(corpora[i].names[4], data, size, slice_count, false);
+        bench_slice(corpora[i].names[5], data, size, slice_count, true);
+    }
+
+    free(data);
+
+    return 0;
+}
@@ -0,0 +1,128 @@
+#pragma once
+
+/**
+ * @file
+*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ncstd/allocator.h"
+#include "ncstd/containers/unsafe/raw_buffer.h"
+#include "ncstd/string_view.h"
+
+
+/** \addtogroup char_index
+ *  @brief Sparse index of codepoint offsets for fast codepoint slicing
+ *  @{
+*/
+
+/**
+ * @brief Number of codepoints between offsets stored in the index
+*/
+#define NC_CHAR_INDEX_STRIDE 256
+
+/**
+ * @brief Sparse index over a UTF-8 string view, that stores byte offset of every
+ * @ref NC_CHAR_INDEX_STRIDE th codepoint
+ *
+ * Index is built on the first query, with a single vectorized pass over the text, and takes
+ * @p sizeof(size_t) bytes for every @ref NC_CHAR_INDEX_STRIDE codepoints. Afterwards converting
+ * codepoint offsets to byte offsets takes O(1) lookup and scanning of at most
+ * @ref NC_CHAR_INDEX_STRIDE codepoints, instead of walking the text from the beginning.
+ * If allocation of the index fails, queries still work by scanning the whole text.
+ *
+ * Indexed text must be valid UTF-8, and must not be modified or deallocated while the index is used.
+ *
+ * ## Example
+ * @code
+ *  NC_CharIndex index = nc_char_index_init(nc_string_as_string_view(&text));
+ *  for (size_t i = 0; i < line_count; ++i)
+ *      print_line(nc_char_index_slice(&index, lines[i].begin, lines[i].end));
+ *
+ *  nc_char_index_destroy(&index);
+ * @endcode
+*/
+typedef struct {
+    /**
+     * @protected
+     *
+     * @brief Members are not stable, and are displayed for educational purposes only
+    */
+    struct {
+        /** @protected Indexed text */
+        NC_StringView string_view;
+        /** @protected Byte offsets of codepoints 0, stride, 2 * stride and so on */
+        NC_RawBuffer offsets;
+        /** @protected Number of codepoints in the text, @p SIZE_MAX until the index is built */
+        size_t char_count;
+    } p;
+} NC_CharIndex;
+
+/**
+ * @memberof NC_CharIndex
+ *
+ * @brief Initializes index over @p string_view (performs no dynamic allocations)
+ *
+ * @return created index
+*/
+NC_CharIndex nc_char_index_init(NC_StringView string_view);
+/**
+ * @memberof NC_CharIndex
+ *
+ * @brief Initializes index over @p string_view, that will use @p allocator for all its allocations
+ * (performs no dynamic allocations)
+ *
+ * @param string_view indexed text
+ * @param allocator allocator, must outlive the index
+ *
+ * @return created index
+*/
+NC_CharIndex nc_char_index_init_in(NC_StringView string_view, NC_Allocator* allocator);
+/**
+ * @memberof NC_CharIndex
+ *
+ * @brief Deallocates the index memory
+*/
+void nc_char_index_destroy(NC_CharIndex* self);
+
+/**
+ * @memberof NC_CharIndex
+ *
+ * @brief Returns indexed text
+*/
+NC_StringView nc_char_index_string_view(const NC_CharIndex* self);
+/**
+ * @memberof NC_CharIndex
+ *
+ * @brief Returns number of codepoints in the text, building the index if needed
+*/
+size_t nc_char_index_char_count(NC_CharIndex* self);
+/**
+ * @memberof NC_CharIndex
+ *
+ * @brief Returns byte offset of the codepoint at @p char_index,
+ * or size of the text if @p char_index is past the end
+*/
+size_t nc_char_index_char_to_byte(NC_CharIndex* self, size_t char_index);
+/**
+ * @memberof NC_CharIndex
+ *
+ * @brief Returns number of codepoints before @p byte_index
+ *
+ * ## Safety
+ * Calling this function with @p byte_index greater than size of the text leads to undefined behaviour
+*/
+size_t nc_char_index_byte_to_char(NC_CharIndex* self, size_t byte_index);
+/**
+ * @memberof NC_CharIndex
+ *
+ * @brief Returns view of codepoints in range [@p begin, @p end), clamped to the end of the text,
+ * or empty view at @p begin if @p end isn't after it
+*/
+NC_StringView nc_char_index_slice(NC_CharIndex* self, size_t begin, size_t end);
+
+/**
+ * @}
+*/
@@ -21,4 +21,5 @@ NC_CharsIterator nc_chars_iterator_init(void* start_ptr, size_t length);
 
 void* nc_chars_iterator_next(NC_CharsIterator* self);
 
-NC_CharsIterator* nc_chars_iterator_into_dyn(NC_CharsIterator self);
+NC_Iterator* nc_chars_iterator_into_dyn(NC_CharsIterator self);
+NC_Iterator* nc_chars_iterator_into_dyn_in(NC_CharsIterator self, NC_Allocator* allocator);
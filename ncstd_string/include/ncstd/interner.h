@@ -0,0 +1,142 @@
+#pragma once
+
+/**
+ * @file
+*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ncstd/allocator.h"
+#include "ncstd/containers/unsafe/raw_buffer.h"
+#include "ncstd/string_view.h"
+
+
+/** \addtogroup interner
+ *  @brief String interning
+ *  @{
+*/
+
+/**
+ * @brief Identifier of an interned string
+ *
+ * Symbols of the same interner are equal if and only if their strings are equal,
+ * so they are compared with @p ==. Symbols are assigned consecutively starting from 0.
+*/
+typedef uint32_t NC_Symbol;
+
+/**
+ * @brief Smallest non-zero number of slots of an interner lookup table
+*/
+#define NC_INTERNER_MIN_CAPACITY 16
+
+/**
+ * @brief Table that deduplicates strings into @ref NC_Symbol identifiers
+ *
+ * Bytes of all interned strings are stored back to back (each followed by a null terminator)
+ * in a single growable buffer, with one small entry per symbol, that holds offset, size and hash
+ * of the string. Symbols are looked up through an open-addressing table of 32-bit symbol slots,
+ * that compares stored hashes before comparing bytes.
+ *
+ * ## Example
+ * @code
+ *  NC_Interner interner = nc_interner_init();
+ *
+ *  NC_Symbol name;
+ *  if (!nc_interner_intern(&interner, nc_string_view_from_cstr("name"), &name))
+ *      return false;
+ *  ...
+ *  if (field.symbol == name)
+ *      printf("%s\n", nc_string_view_bytes(nc_interner_resolve(&interner, field.symbol)));
+ *
+ *  nc_interner_destroy(&interner);
+ * @endcode
+*/
+typedef struct {
+    /**
+     * @protected
+     *
+     * @brief Members are not stable, and are displayed for educational purposes only
+    */
+    struct {
+        /** @protected Bytes of interned strings, each followed by a null terminator */
+        NC_RawBuffer bytes;
+        /** @protected Number of used bytes */
+        size_t bytes_size;
+        /** @protected Offset, size and hash of the string of every symbol */
+        NC_RawBuffer entries;
+        /** @protected Number of symbols */
+        size_t size;
+        /** @protected Lookup table, slots hold symbol + 1 or 0 if empty */
+        NC_RawBuffer slots;
+    } p;
+} NC_Interner;
+
+/**
+ * @memberof NC_Interner
+ *
+ * @brief Initializes empty interner (performs no dynamic allocations)
+ *
+ * @return created interner
+*/
+NC_Interner nc_interner_init();
+/**
+ * @memberof NC_Interner
+ *
+ * @brief Initializes empty interner that will use @p allocator for all its allocations
+ * (performs no dynamic allocations)
+ *
+ * @param allocator allocator, must outlive the interner
+ *
+ * @return created interner
+*/
+NC_Interner nc_interner_init_in(NC_Allocator* allocator);
+/**
+ * @memberof NC_Interner
+ *
+ * @brief Deallocates the interner memory
+*/
+void nc_interner_destroy(NC_Interner* self);
+
+/**
+ * @memberof NC_Interner
+ *
+ * @brief Returns number of distinct interned strings
+*/
+size_t nc_interner_size(const NC_Interner* self);
+
+/**
+ * @memberof NC_Interner
+ *
+ * @brief Writes symbol of @p string_view into @p out_symbol, interning a copy of it if it's new
+ *
+ * @p string_view may point into a string resolved from this interner.
+ *
+ * @return @p true on success, @p false if allocation has failed or symbols are exhausted
+*/
+bool nc_interner_intern(NC_Interner* self, NC_StringView string_view, NC_Symbol* out_symbol);
+/**
+ * @memberof NC_Interner
+ *
+ * @brief Writes symbol of @p string_view into @p out_symbol, if it was already interned
+ *
+ * @return @p true if the string was found, @p false otherwise
+*/
+bool nc_interner_find(const NC_Interner* self, NC_StringView string_view, NC_Symbol* out_symbol);
+/**
+ * @memberof NC_Interner
+ *
+ * @brief Returns view of the string of @p symbol in O(1)
+ *
+ * View is null terminated, and is valid until the next call of @ref nc_interner_intern()
+ * (which might move the bytes) or destruction of the interner.
+ *
+ * ## Safety
+ * Calling this function with symbol that wasn't returned by this interner leads to undefined behaviour
+*/
+NC_StringView nc_interner_resolve(const NC_Interner* self, NC_Symbol symbol);
+
+/**
+ * @}
+*/
@@ -3,6 +3,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "ncstd/allocator.h"
 #include "ncstd/string_view.h"
 #include "ncstd/macros/option_macros.h"
 #include "ncstd/containers/unsafe/raw_buffer.h"
@@ -28,12 +29,26 @@ NC_String nc_string_from_c_str_unchecked(const char* c_str);
 NC_String nc_string_from_string_view(NC_StringView string_view);
 NC_String nc_string_with_length_unchecked(const char* chars, size_t length);
 
+NC_String nc_string_empty_in(NC_Allocator* allocator);
+NC_String nc_string_with_capacity_in(size_t capacity, NC_Allocator* allocator);
+NC_OPTION(NC_String) nc_string_from_c_str_in(const char* c_str, NC_Allocator* allocator);
+NC_String nc_string_from_c_str_unchecked_in(const char* c_str, NC_Allocator* allocator);
+NC_String nc_string_from_string_view_in(NC_StringView string_view, NC_Allocator* allocator);
+NC_String nc_string_with_length_unchecked_in(const char* chars, size_t length, NC_Allocator* allocator);
+
 void nc_string_destroy(NC_String* self);
 
 
 bool nc_string_is_empty(const NC_String* self);
 size_t nc_string_size(const NC_String* self);
+size_t nc_string_char_count(const NC_String* self);
 size_t nc_string_capacity(const NC_String* self);
+NC_Allocator* nc_string_allocator(const NC_String* self);
+NC_StringView nc_string_as_string_view(const NC_String* self);
+
+uint64_t nc_string_hash(const NC_String* self);
+bool nc_string_ptr_eq(const void* a, const void* b, void* data);
+uint64_t nc_string_ptr_hash(const void* string, void* data);
 
 void nc_string_clear(NC_String* self);
 
@@ -48,8 +63,7 @@ void nc_string_push_string_view(NC_String* self, NC_StringView string_view);
 // join function,
 // repeat function,
 // shrink (to fit)
-// truncate (similar to slice),
-// add slicing with utf8 index?
+// truncate (similar to slice)
 
 
 #if NC_FEATURE_ITERATOR
@@ -0,0 +1,337 @@
+#pragma once
+
+/**
+ * @file
+*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <uchar.h>
+
+#include "ncstd/allocator.h"
+#include "ncstd/nc_string.h"
+#include "ncstd/string_view.h"
+#include "ncstd/macros/option_macros.h"
+
+#if NC_FEATURE_ITERATOR
+#include "ncstd/iterator.h"
+#endif
+
+
+/** \addtogroup rope
+ *  @brief UTF-8 string for large texts with logarithmic edits
+ *  @{
+*/
+
+/**
+ * @brief Maximum number of bytes in a single chunk of a rope
+*/
+#define NC_ROPE_CHUNK_CAPACITY 976
+
+/**
+ * @private
+ *
+ * @brief Node of a rope, defined in the implementation
+*/
+typedef struct NC_PRopeNode NC_PRopeNode;
+
+/**
+ * @brief UTF-8 string stored as a balanced tree of chunks
+ *
+ * Leaves hold up to @ref NC_ROPE_CHUNK_CAPACITY bytes of text, split only on character boundaries,
+ * and every node caches number of bytes and codepoints in its subtree. Tree is kept AVL balanced,
+ * so insertion, removal, slicing and concatenation take O(log n) time
+ * (plus the size of inserted text), instead of moving the whole text like @ref NC_String does.
+ *
+ * Nodes are immutable once shared and are reference counted, so @ref nc_rope_clone() and
+ * @ref nc_rope_slice() share structure with the original rope instead of copying it. Uniquely owned
+ * chunks are edited in place, so small edits without sharing perform no allocations.
+ * Reference counts are not atomic, ropes that share nodes must not be used from different threads
+ * at the same time.
+ *
+ * All positions are byte offsets, use @ref nc_rope_char_to_byte() to convert codepoint offsets.
+ *
+ * ## Example
+ * @code
+ *  NC_OPTION(NC_Rope) created = nc_rope_from_string_view(nc_string_view_from_cstr(document));
+ *  if (!nc_option_rope_is_some(created))
+ *      return false;
+ *
+ *  NC_Rope text = created.value;
+ *  if (!nc_rope_insert(&text, nc_rope_char_to_byte(&text, cursor), nc_string_view_from_cstr("typed")))
+ *      return false;
+ *
+ *  NC_RopeChunksIterator it = nc_rope_chunks(&text);
+ *  const NC_StringView* chunk;
+ *  while ((chunk = nc_rope_chunks_iterator_next(&it)) != NULL)
+ *      fwrite(nc_string_view_bytes(*chunk), 1, nc_string_view_size(*chunk), file);
+ *
+ *  nc_rope_destroy(&text);
+ * @endcode
+*/
+typedef struct {
+    /**
+     * @protected
+     *
+     * @brief Members are not stable, and are displayed for educational purposes only
+    */
+    struct {
+        /** @protected Root of the tree, @p NULL if the rope is empty */
+        NC_PRopeNode* root;
+        /** @protected Allocator of all nodes */
+        NC_Allocator* allocator;
+    } p;
+} NC_Rope;
+
+NC_DEFINE_OPTION(NC_Rope, rope)
+
+/**
+ * @brief Iterator over chunks of a rope, in order
+ *
+ * Rope must not be modified while it's iterated.
+*/
+typedef struct {
+    /**
+     * @protected
+     *
+     * @brief Members are not stable, and are displayed for educational purposes only
+    */
+    struct {
+        /** @protected Root of the iterated tree */
+        const NC_PRopeNode* root;
+        /** @protected Byte offset of the next chunk */
+        size_t offset;
+        /** @protected View of the current chunk */
+        NC_StringView current;
+    } p;
+} NC_RopeChunksIterator;
+
+/**
+ * @brief Iterator over codepoints of a rope, in order
+ *
+ * Rope must not be modified while it's iterated.
+*/
+typedef struct {
+    /**
+     * @protected
+     *
+     * @brief Members are not stable, and are displayed for educational purposes only
+    */
+    struct {
+        /** @protected Iterator over the remaining chunks */
+        NC_RopeChunksIterator chunks;
+        /** @protected Next byte of the current chunk */
+        const uint8_t* current;
+        /** @protected End of the current chunk */
+        const uint8_t* end;
+        /** @protected Last decoded codepoint */
+        char32_t current_char;
+    } p;
+} NC_RopeCharsIterator;
+
+/**
+ * @memberof NC_Rope
+ *
+ * @brief Initializes empty rope (performs no dynamic allocations)
+ *
+ * @return created rope
+*/
+NC_Rope nc_rope_init();
+/**
+ * @memberof NC_Rope
+ *
+ * @brief Initializes empty rope that will use @p allocator for all its allocations
+ * (performs no dynamic allocations)
+ *
+ * @param allocator allocator, must outlive the rope
+ *
+ * @return created rope
+*/
+NC_Rope nc_rope_init_in(NC_Allocator* allocator);
+/**
+ * @memberof NC_Rope
+ *
+ * @brief Initializes rope with a copy of @p string_view
+ *
+ * Text is expected to be valid UTF-8, invalid bytes are copied as is,
+ * but may end up split between chunks.
+ *
+ * @return created rope, none if allocation has failed
+*/
+NC_OPTION(NC_Rope) nc_rope_from_string_view(NC_StringView string_view);
+/**
+ * @memberof NC_Rope
+ *
+ * @brief Same as @ref nc_rope_from_string_view(), but uses @p allocator for all allocations
+ *
+ * @param string_view text to copy
+ * @param allocator allocator, must outlive the rope
+ *
+ * @return created rope, none if allocation has failed
+*/
+NC_OPTION(NC_Rope) nc_rope_from_string_view_in(NC_StringView string_view, NC_Allocator* allocator);
+/**
+ * @memberof NC_Rope
+ *
+ * @brief Initializes rope with a copy of @p string, that uses allocator of the string
+ *
+ * @return created rope, none if allocation has failed
+*/
+NC_OPTION(NC_Rope) nc_rope_from_string(const NC_String* string);
+/**
+ * @memberof NC_Rope
+ *
+ * @brief Creates rope that shares all chunks with @p self in O(1)
+ *
+ * @return created rope, that has to be destroyed independently
+*/
+NC_Rope nc_rope_clone(const NC_Rope* self);
+/**
+ * @memberof NC_Rope
+ *
+ * @brief Releases the rope, deallocating nodes that aren't shared with other ropes
+*/
+void nc_rope_destroy(NC_Rope* self);
+
+/**
+ * @memberof NC_Rope
+ *
+ * @brief Returns size of the rope in bytes
+*/
+size_t nc_rope_size(const NC_Rope* self);
+/**
+ * @memberof NC_Rope
+ *
+ * @brief Returns number of codepoints in the rope in O(1)
+*/
+size_t nc_rope_char_count(const NC_Rope* self);
+/**
+ * @memberof NC_Rope
+ *
+ * @brief Returns whether the rope is empty
+*/
+bool nc_rope_is_empty(const NC_Rope* self);
+/**
+ * @memberof NC_Rope
+ *
+ * @brief Returns allocator of the rope
+*/
+NC_Allocator* nc_rope_allocator(const NC_Rope* self);
+
+/**
+ * @memberof NC_Rope
+ *
+ * @brief Returns byte offset of the codepoint at @p char_index in O(log n),
+ * or size of the rope if @p char_index is past the end
+*/
+size_t nc_rope_char_to_byte(const NC_Rope* self, size_t char_index);
+/**
+ * @memberof NC_Rope
+ *
+ * @brief Returns number of codepoints before @p byte_index in O(log n)
+ *
+ * ## Safety
+ * Calling this function with @p byte_index greater than size of the rope leads to undefined behaviour
+*/
+size_t nc_rope_byte_to_char(const NC_Rope* self, size_t byte_index);
+
+/**
+ * @memberof NC_Rope
+ *
+ * @brief Inserts copy of @p string_view before byte at @p byte_index
+ *
+ * @return @p true on success, @p false if allocation has failed (rope is left unchanged)
+ *
+ * ## Safety
+ * Calling this function with @p byte_index greater than size of the rope,
+ * or not on a character boundary, leads to undefined behaviour
+*/
+bool nc_rope_insert(NC_Rope* self, size_t byte_index, NC_StringView string_view);
+/**
+ * @memberof NC_Rope
+ *
+ * @brief Removes bytes in range [@p begin, @p end)
+ *
+ * @return @p true on success, @p false if allocation has failed (rope is left unchanged)
+ *
+ * ## Safety
+ * Calling this function with range out of bounds, or not on character boundaries,
+ * leads to undefined behaviour
+*/
+bool nc_rope_remove(NC_Rope* self, size_t begin, size_t end);
+/**
+ * @memberof NC_Rope
+ *
+ * @brief Writes rope of bytes in range [@p begin, @p end), that shares chunks with @p self,
+ * into @p out_slice
+ *
+ * @return @p true on success, @p false if allocation has failed
+ *
+ * ## Safety
+ * Calling this function with range out of bounds, or not on character boundaries,
+ * leads to undefined behaviour
+*/
+bool nc_rope_slice(const NC_Rope* self, size_t begin, size_t end, NC_Rope* out_slice);
+/**
+ * @memberof NC_Rope
+ *
+ * @brief Moves contents of @p other to the end of the rope, leaving @p other empty
+ *
+ * @return @p true on success, @p false if allocation has failed (both ropes are left unchanged)
+ *
+ * ## Safety
+ * Calling this function with ropes that use different allocators leads to undefined behaviour
+*/
+bool nc_rope_append(NC_Rope* self, NC_Rope* other);
+
+/**
+ * @memberof NC_Rope
+ *
+ * @brief Copies the rope into a contiguous string, that uses allocator of the rope
+ *
+ * @return created string
+*/
+NC_String nc_rope_to_string(const NC_Rope* self);
+
+/**
+ * @memberof NC_Rope
+ *
+ * @brief Creates iterator over chunks of the rope
+*/
+NC_RopeChunksIterator nc_rope_chunks(const NC_Rope* self);
+/**
+ * @memberof NC_RopeChunksIterator
+ *
+ * @brief Advances the iterator
+ *
+ * @return pointer to view of the next chunk, or @p NULL if the iteration has finished
+*/
+void* nc_rope_chunks_iterator_next(NC_RopeChunksIterator* self);
+/**
+ * @memberof NC_Rope
+ *
+ * @brief Creates iterator over codepoints of the rope
+*/
+NC_RopeCharsIterator nc_rope_chars(const NC_Rope* self);
+/**
+ * @memberof NC_RopeCharsIterator
+ *
+ * @brief Advances the iterator
+ *
+ * @return pointer to the next codepoint (@p char32_t), or @p NULL if the iteration has finished
+*/
+void* nc_rope_chars_iterator_next(NC_RopeCharsIterator* self);
+
+#if NC_FEATURE_ITERATOR
+
+NC_Iterator* nc_rope_chunks_iterator_into_dyn(NC_RopeChunksIterator self);
+NC_Iterator* nc_rope_chunks_iterator_into_dyn_in(NC_RopeChunksIterator self, NC_Allocator* allocator);
+NC_Iterator* nc_rope_chars_iterator_into_dyn(NC_RopeCharsIterator self);
+NC_Iterator* nc_rope_chars_iterator_into_dyn_in(NC_RopeCharsIterator self, NC_Allocator* allocator);
+
+#endif
+
+/**
+ * @}
+*/
@@ -0,0 +1,57 @@
+#pragma once
+
+/**
+ * @file
+*/
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "ncstd/containers/bloom_filter.h"
+#include "ncstd/string_view.h"
+
+
+/** \addtogroup bloom_filter
+ *  @{
+*/
+
+/**
+ * @memberof NC_BloomFilter
+ *
+ * @brief Inserts @p string_view, hashed with @ref nc_string_view_hash()
+*/
+void nc_bloom_filter_insert_string_view(NC_BloomFilter* self, NC_StringView string_view);
+/**
+ * @memberof NC_BloomFilter
+ *
+ * @brief Returns @p false if @p string_view was definitely not inserted, and @p true if it might have been
+*/
+bool nc_bloom_filter_contains_string_view(const NC_BloomFilter* self, NC_StringView string_view);
+/**
+ * @memberof NC_BloomFilter
+ *
+ * @brief Inserts @p count @p string_views
+ *
+ * Views are hashed in batches, which are then inserted with @ref nc_bloom_filter_insert_hashes().
+*/
+void nc_bloom_filter_insert_string_views(NC_BloomFilter* self, const NC_StringView* string_views, size_t count);
+/**
+ * @memberof NC_BloomFilter
+ *
+ * @brief Writes result of @ref nc_bloom_filter_contains_string_view() for each of @p count @p string_views
+ * into @p out_results
+ *
+ * Views are hashed in batches, which are then queried with @ref nc_bloom_filter_contains_hashes().
+ *
+ * @return number of views that might be present
+*/
+size_t nc_bloom_filter_contains_string_views(
+    const NC_BloomFilter* self,
+    const NC_StringView* string_views,
+    size_t count,
+    bool* out_results
+);
+
+/**
+ * @}
+*/
@@ -6,18 +6,17 @@
 
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 #include <string.h>
 
 #include "ncstd/macros/option_macros.h"
+#include "ncstd/options.h"
 
 #if NC_FEATURE_ITERATOR
 #include "ncstd/chars_iterator.h"
 #endif
 
 
-// TODO: Move it into files with options for builtin types
-NC_DEFINE_OPTION(char32_t, char32)
-
 typedef struct {
     struct {
         const char* cstr;
@@ -25,27 +24,24 @@ typedef struct {
     } p;
 } NC_StringView;
 
-typedef struct {
-    NC_StringView value;
-} NC_OPTION(NC_StringView);
-
-NC_OPTION(NC_StringView) nc_option_string_view_init_some(NC_StringView string_view);
-NC_OPTION(NC_StringView) nc_option_string_view_init_none();
-bool nc_option_string_view_is_some(NC_OPTION(NC_StringView) self);
-
-
-// TODO: create UTF-8 codepoint iterator, length getter function, slicing functions
-/*
-StringView string_view_slice(StringView string_view, size_t begin, size_t end);
-StringView string_view_slice_begin(StringView string_view, size_t size);
-StringView string_view_slice_end(StringView string_view, size_t size);
-*/
 
 NC_StringView nc_string_view_init_unchecked(const char* cstr, size_t size);
 NC_StringView nc_string_view_from_cstr(const char* cstr); // TODO: add unchecked variant
+// Views created from a null pointer are used as none state of NC_OPTION(NC_StringView)
+bool nc_string_view_is_null(NC_StringView self);
+
+NC_DEFINE_OPTION_NICHE_FN(NC_StringView, string_view, nc_string_view_init_unchecked(NULL, 0), nc_string_view_is_null)
 
 const char* nc_string_view_bytes(NC_StringView self);
 size_t nc_string_view_size(NC_StringView self);
+// Number of UTF-8 codepoints, counted with SIMD when available
+size_t nc_string_view_char_count(NC_StringView self);
+
+// Bytes in range [begin, end), which must be on character boundaries
+NC_StringView nc_string_view_slice(NC_StringView self, size_t begin, size_t end);
+// Codepoints in range [begin, end), clamped to the end, empty if end isn't after begin.
+// Scans from the beginning, use NC_CharIndex to slice repeatedly
+NC_StringView nc_string_view_char_slice(NC_StringView self, size_t begin, size_t end);
 
 
 // TODO: create trim functions
@@ -59,7 +55,13 @@ NC_StringView nc_string_view_trim_end_matches(NC_StringView self, NC_StringView
 */
 
 bool nc_string_view_eq(NC_StringView a, NC_StringView b);
+uint64_t nc_string_view_hash(NC_StringView self);
+uint64_t nc_string_view_hash_seeded(NC_StringView self, uint64_t seed);
 bool nc_string_view_ptr_eq(const void* a, const void* b, void* data);
+uint64_t nc_string_view_ptr_hash(const void* string_view, void* data);
+// Compares bytes lexicographically, a prefix is ordered before longer strings
+int nc_string_view_cmp(NC_StringView a, NC_StringView b);
+int nc_string_view_ptr_cmp(const void* a, const void* b, void* data);
 
 
 #if NC_FEATURE_ITERATOR
@@ -0,0 +1,147 @@
+#pragma once
+
+/**
+ * @file
+*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <uchar.h>
+
+#include "ncstd/allocator.h"
+#include "ncstd/containers/unsafe/raw_buffer.h"
+#include "ncstd/nc_string.h"
+#include "ncstd/string_view.h"
+
+
+/** \addtogroup transcode
+ *  @brief Bulk conversion between UTF-8, UTF-16 and UTF-32
+ *  @{
+ *
+ * Conversions write into caller provided memory, sized exactly with the matching length function,
+ * and return number of written code units. They use AVX2 when the CPU supports it, regardless of
+ * compiler flags: ASCII runs are widened or narrowed 32 bytes at a time, UTF-8 is decoded at 16 byte
+ * positions at a time, and other text is encoded 8 code units at a time, with results compacted by
+ * shuffle tables. Surrogate pairs are split between the positions of the first two bytes of the UTF-8
+ * encoding, so text outside of the Basic Multilingual Plane stays on vector paths too.
+ *
+ * Input of conversions must be valid, UTF-8 is valid by construction in @ref NC_String and can
+ * be checked with @ref nc_utf8_is_valid(), while UTF-16 and UTF-32 coming from other systems
+ * should be checked with @ref nc_utf16_is_valid() and @ref nc_utf32_is_valid().
+ *
+ * ## Example
+ * @code
+ *  NC_OPTION(NC_String) name = nc_string_from_utf16(wide_name, wide_name_length);
+ *  if (!nc_option_string_is_some(name))
+ *      return false;
+ *
+ *  NC_RawBuffer wide = nc_raw_buffer_init(sizeof(char16_t));
+ *  size_t wide_length;
+ *  if (!nc_string_view_to_utf16(nc_string_as_string_view(&name.value), &wide, &wide_length))
+ *      return false;
+ * @endcode
+*/
+
+/**
+ * @brief Returns whether @p count code units of @p data are valid UTF-16 (surrogates are paired)
+*/
+bool nc_utf16_is_valid(const char16_t* data, size_t count);
+/**
+ * @brief Returns whether @p count codepoints of @p data are valid Unicode scalar values
+*/
+bool nc_utf32_is_valid(const char32_t* data, size_t count);
+
+/**
+ * @brief Returns number of UTF-16 code units needed to encode @p size bytes of valid UTF-8
+*/
+size_t nc_utf8_utf16_length(const uint8_t* data, size_t size);
+/**
+ * @brief Returns number of codepoints in @p size bytes of valid UTF-8
+*/
+size_t nc_utf8_utf32_length(const uint8_t* data, size_t size);
+/**
+ * @brief Returns number of UTF-8 bytes needed to encode @p count code units of valid UTF-16
+*/
+size_t nc_utf16_utf8_length(const char16_t* data, size_t count);
+/**
+ * @brief Returns number of UTF-8 bytes needed to encode @p count valid codepoints
+*/
+size_t nc_utf32_utf8_length(const char32_t* data, size_t count);
+
+/**
+ * @brief Converts @p size bytes of valid UTF-8 into UTF-16
+ *
+ * @param out memory for @ref nc_utf8_utf16_length() code units
+ *
+ * @return number of written code units
+*/
+size_t nc_utf8_to_utf16(const uint8_t* data, size_t size, char16_t* out);
+/**
+ * @brief Converts @p size bytes of valid UTF-8 into UTF-32
+ *
+ * @param out memory for @ref nc_utf8_utf32_length() codepoints
+ *
+ * @return number of written codepoints
+*/
+size_t nc_utf8_to_utf32(const uint8_t* data, size_t size, char32_t* out);
+/**
+ * @brief Converts @p count code units of valid UTF-16 into UTF-8
+ *
+ * @param out memory for @ref nc_utf16_utf8_length() bytes
+ *
+ * @return number of written bytes
+*/
+size_t nc_utf16_to_utf8(const char16_t* data, size_t count, uint8_t* out);
+/**
+ * @brief Converts @p count valid codepoints into UTF-8
+ *
+ * @param out memory for @ref nc_utf32_utf8_length() bytes
+ *
+ * @return number of written bytes
+*/
+size_t nc_utf32_to_utf8(const char32_t* data, size_t count, uint8_t* out);
+
+/**
+ * @brief Creates string from @p count code units of UTF-16 with a single allocation of exact size
+ *
+ * @return created string, none if @p data isn't valid UTF-16 or allocation has failed
+*/
+NC_OPTION(NC_String) nc_string_from_utf16(const char16_t* data, size_t count);
+/**
+ * @brief Same as @ref nc_string_from_utf16(), but uses @p allocator for all allocations
+*/
+NC_OPTION(NC_String) nc_string_from_utf16_in(const char16_t* data, size_t count, NC_Allocator* allocator);
+/**
+ * @brief Creates string from @p count UTF-32 codepoints with a single allocation of exact size
+ *
+ * @return created string, none if @p data contains invalid codepoints or allocation has failed
+*/
+NC_OPTION(NC_String) nc_string_from_utf32(const char32_t* data, size_t count);
+/**
+ * @brief Same as @ref nc_string_from_utf32(), but uses @p allocator for all allocations
+*/
+NC_OPTION(NC_String) nc_string_from_utf32_in(const char32_t* data, size_t count, NC_Allocator* allocator);
+
+/**
+ * @brief Writes UTF-16 encoding of @p string_view into @p buffer of @p char16_t,
+ * growing it to the exact size if it's too small
+ *
+ * @param out_count number of written code units
+ *
+ * @return @p true on success, @p false if allocation has failed (buffer is left unchanged)
+*/
+bool nc_string_view_to_utf16(NC_StringView string_view, NC_RawBuffer* buffer, size_t* out_count);
+/**
+ * @brief Writes UTF-32 encoding of @p string_view into @p buffer of @p char32_t,
+ * growing it to the exact size if it's too small
+ *
+ * @param out_count number of written codepoints
+ *
+ * @return @p true on success, @p false if allocation has failed (buffer is left unchanged)
+*/
+bool nc_string_view_to_utf32(NC_StringView string_view, NC_RawBuffer* buffer, size_t* out_count);
+
+/**
+ * @}
+*/
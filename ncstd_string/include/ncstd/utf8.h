@@ -16,4 +16,13 @@ size_t nc_utf8_encode_char(uint8_t* data, char32_t ch);
 size_t nc_utf8_encode_char_unchecked(uint8_t* data, char32_t ch);
 char32_t nc_utf8_decode_char_unchecked(const uint8_t* data, size_t* out_bytes_consumed); // NOTE: Add checked version?
 
+// Uses SSE4.1 or AVX2 when the CPU supports them, regardless of compiler flags
 bool nc_utf8_is_valid(const uint8_t* data, size_t size);
+// Portable validator used when vector instructions are unavailable
+bool nc_utf8_is_valid_scalar(const uint8_t* data, size_t size);
+
+// Counts bytes that aren't continuations, uses SSE2 or AVX2 when the CPU supports them. Input must be valid UTF-8
+size_t nc_utf8_count_codepoints(const uint8_t* data, size_t size);
+size_t nc_utf8_count_codepoints_scalar(const uint8_t* data, size_t size);
+// Returns byte offset of codepoint at char_index, or size if there are fewer codepoints. Input must be valid UTF-8
+size_t nc_utf8_char_to_byte(const uint8_t* data, size_t size, size_t char_index);
@@ -0,0 +1,125 @@
+#include "ncstd/char_index.h"
+
+#include "ncstd/alloc_stats.h"
+#include "ncstd/utf8.h"
+
+
+#define NC_P_CHAR_INDEX_UNBUILT SIZE_MAX
+
+
+static const uint8_t* nc_p_char_index_bytes(const NC_CharIndex* self) {
+    return (const uint8_t*)nc_string_view_bytes(self->p.string_view);
+}
+
+static size_t nc_p_char_index_size(const NC_CharIndex* self) {
+    return nc_string_view_size(self->p.string_view);
+}
+
+static const size_t* nc_p_char_index_offsets(const NC_CharIndex* self) {
+    return nc_raw_buffer_data(&self->p.offsets);
+}
+
+// Builds the index on first use, returns false if offsets couldn't be allocated
+static bool nc_p_char_index_build(NC_CharIndex* self) {
+    if (self->p.char_count != NC_P_CHAR_INDEX_UNBUILT)
+        return nc_p_char_index_offsets(self) != NULL;
+
+    const uint8_t* const bytes = nc_p_char_index_bytes(self);
+    const size_t size = nc_p_char_index_size(self);
+    self->p.char_count = nc_utf8_count_codepoints(bytes, size);
+
+    const size_t offset_count = self->p.char_count / NC_CHAR_INDEX_STRIDE + 1;
+    NC_INTERNAL_ALLOC_STATS_SITE_ENTER();
+    NC_RawBuffer offsets = nc_raw_buffer_init_with_capacity_in(
+        offset_count,
+        sizeof(size_t),
+        nc_raw_buffer_allocator(&self->p.offsets)
+    );
+    NC_INTERNAL_ALLOC_STATS_SITE_LEAVE();
+    if (nc_raw_buffer_data(&offsets) == NULL)
+        return false;
+
+    self->p.offsets = offsets;
+
+    size_t* const data = nc_raw_buffer_data(&offsets);
+    data[0] = 0;
+    for (size_t i = 1; i < offset_count; ++i)
+        data[i] = data[i - 1] + nc_utf8_char_to_byte(bytes + data[i - 1], size - data[i - 1], NC_CHAR_INDEX_STRIDE);
+
+    return true;
+}
+
+
+NC_CharIndex nc_char_index_init(NC_StringView string_view) {
+    return nc_char_index_init_in(string_view, nc_allocator_default());
+}
+
+NC_CharIndex nc_char_index_init_in(NC_StringView string_view, NC_Allocator* allocator) {
+    return (NC_CharIndex) {
+        .p = {
+            .string_view = string_view,
+            .offsets = nc_raw_buffer_init_in(sizeof(size_t), allocator),
+            .char_count = NC_P_CHAR_INDEX_UNBUILT
+        }
+    };
+}
+
+void nc_char_index_destroy(NC_CharIndex* self) {
+    NC_Allocator* const allocator = nc_raw_buffer_allocator(&self->p.offsets);
+    nc_raw_buffer_free(&self->p.offsets, sizeof(size_t));
+
+    self->p.offsets = nc_raw_buffer_init_in(sizeof(size_t), allocator);
+    self->p.char_count = NC_P_CHAR_INDEX_UNBUILT;
+}
+
+NC_StringView nc_char_index_string_view(const NC_CharIndex* self) {
+    return self->p.string_view;
+}
+
+size_t nc_char_index_char_count(NC_CharIndex* self) {
+    nc_p_char_index_build(self);
+
+    return self->p.char_count;
+}
+
+size_t nc_char_index_char_to_byte(NC_CharIndex* self, size_t char_index) {
+    const uint8_t* const bytes = nc_p_char_index_bytes(self);
+    const size_t size = nc_p_char_index_size(self);
+    if (!nc_p_char_index_build(self))
+        return nc_utf8_char_to_byte(bytes, size, char_index);
+    if (char_index >= self->p.char_count)
+        return size;
+
+    const size_t offset = nc_p_char_index_offsets(self)[char_index / NC_CHAR_INDEX_STRIDE];
+
+    return offset + nc_utf8_char_to_byte(bytes + offset, size - offset, char_index % NC_CHAR_INDEX_STRIDE);
+}
+
+size_t nc_char_index_byte_to_char(NC_CharIndex* self, size_t byte_index) {
+    const uint8_t* const bytes = nc_p_char_index_bytes(self);
+    if (!nc_p_char_index_build(self))
+        return nc_utf8_count_codepoints(bytes, byte_index);
+
+    // Finds the last indexed offset not past byte_index
+    const size_t* const offsets = nc_p_char_index_offsets(self);
+    size_t low = 0;
+    size_t high = self->p.char_count / NC_CHAR_INDEX_STRIDE + 1;
+    while (high - low > 1) {
+        const size_t middle = low + (high - low) / 2;
+        if (offsets[middle] <= byte_index)
+            low = middle;
+        else
+            high = middle;
+    }
+
+    return low * NC_CHAR_INDEX_STRIDE + nc_utf8_count_codepoints(bytes + offsets[low], byte_index - offsets[low]);
+}
+
+NC_StringView nc_char_index_slice(NC_CharIndex* self, size_t begin, size_t end) {
+    const size_t begin_byte = nc_char_index_char_to_byte(self, begin);
+    if (end <= begin)
+        return nc_string_view_slice(self->p.string_view, begin_byte, begin_byte);
+    const size_t end_byte = nc_char_index_char_to_byte(self, end);
+
+    return nc_string_view_init_unchecked(nc_string_view_bytes(self->p.string_view) + begin_byte, end_byte - begin_byte);
+}
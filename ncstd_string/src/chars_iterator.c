@@ -23,10 +23,14 @@ void* nc_chars_iterator_next(NC_CharsIterator* self) {
     return &self->p.current_char;
 }
 
-NC_CharsIterator* nc_chars_iterator_into_dyn(NC_CharsIterator self) {
+NC_Iterator* nc_chars_iterator_into_dyn(NC_CharsIterator self) {
     return nc_iterator_create(&ITERATOR_VTABLE, &self, sizeof self);
 }
 
+NC_Iterator* nc_chars_iterator_into_dyn_in(NC_CharsIterator self, NC_Allocator* allocator) {
+    return nc_iterator_create_in(&ITERATOR_VTABLE, &self, sizeof self, allocator);
+}
+
 NC_CharsIterator nc_chars_iterator_init(void* start_ptr, size_t length) {
     return (NC_CharsIterator) {
 		.p = {
@@ -0,0 +1,197 @@
+#include "ncstd/interner.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "ncstd/alloc_stats.h"
+
+
+typedef struct {
+    size_t offset;
+    size_t size;
+    uint64_t hash;
+} NC_PInternerEntry;
+
+#define NC_P_INTERNER_GROWTH_FACTOR 2
+#define NC_P_INTERNER_EMPTY_SLOT 0
+
+
+static size_t nc_p_interner_capacity(const NC_Interner* self) {
+    return nc_raw_buffer_capacity(&self->p.slots);
+}
+
+static const NC_PInternerEntry* nc_p_interner_entry(const NC_Interner* self, NC_Symbol symbol) {
+    return (const NC_PInternerEntry*)nc_raw_buffer_data(&self->p.entries) + symbol;
+}
+
+// Returns slot holding the string, or the empty slot where it belongs
+static size_t nc_p_interner_probe(const NC_Interner* self, NC_StringView string_view, uint64_t hash) {
+    const uint32_t* const slots = nc_raw_buffer_data(&self->p.slots);
+    const char* const bytes = nc_raw_buffer_data(&self->p.bytes);
+    const size_t mask = nc_p_interner_capacity(self) - 1;
+
+    for (size_t index = (size_t)hash & mask;; index = (index + 1) & mask) {
+        const uint32_t slot = slots[index];
+        if (slot == NC_P_INTERNER_EMPTY_SLOT)
+            return index;
+
+        const NC_PInternerEntry* const entry = nc_p_interner_entry(self, slot - 1);
+        if (entry->hash == hash
+            && entry->size == nc_string_view_size(string_view)
+            && memcmp(bytes + entry->offset, nc_string_view_bytes(string_view), entry->size) == 0) {
+            return index;
+        }
+    }
+}
+
+// Grows a buffer to hold at least required_capacity objects, returns false if allocation has failed
+static bool nc_p_interner_grow(NC_RawBuffer* buffer, size_t required_capacity, size_t minimum_capacity, size_t object_size) {
+    const size_t capacity = nc_raw_buffer_capacity(buffer);
+    if (required_capacity <= capacity)
+        return true;
+
+    size_t new_capacity = capacity < minimum_capacity ? minimum_capacity : capacity * NC_P_INTERNER_GROWTH_FACTOR;
+    while (new_capacity < required_capacity)
+        new_capacity *= NC_P_INTERNER_GROWTH_FACTOR;
+
+    NC_INTERNAL_ALLOC_STATS_SITE_ENTER();
+    nc_raw_buffer_resize_unchecked(buffer, new_capacity, object_size);
+    NC_INTERNAL_ALLOC_STATS_SITE_LEAVE();
+
+    return nc_raw_buffer_capacity(buffer) >= required_capacity;
+}
+
+static bool nc_p_interner_rehash(NC_Interner* self, size_t new_capacity) {
+    NC_INTERNAL_ALLOC_STATS_SITE_ENTER();
+    NC_RawBuffer slots = nc_raw_buffer_init_with_capacity_in(
+        new_capacity,
+        sizeof(uint32_t),
+        nc_raw_buffer_allocator(&self->p.slots)
+    );
+    NC_INTERNAL_ALLOC_STATS_SITE_LEAVE();
+    if (nc_raw_buffer_data(&slots) == NULL)
+        return false;
+
+    uint32_t* const data = nc_raw_buffer_data(&slots);
+    memset(data, NC_P_INTERNER_EMPTY_SLOT, new_capacity * sizeof(uint32_t));
+
+    // Symbols are unique, so they are placed without comparing strings
+    const size_t mask = new_capacity - 1;
+    for (size_t symbol = 0; symbol < self->p.size; ++symbol) {
+        size_t index = (size_t)nc_p_interner_entry(self, (NC_Symbol)symbol)->hash & mask;
+        while (data[index] != NC_P_INTERNER_EMPTY_SLOT)
+            index = (index + 1) & mask;
+        data[index] = (uint32_t)symbol + 1;
+    }
+
+    nc_raw_buffer_free(&self->p.slots, sizeof(uint32_t));
+    self->p.slots = slots;
+
+    return true;
+}
+
+
+NC_Interner nc_interner_init() {
+    return nc_interner_init_in(nc_allocator_default());
+}
+
+NC_Interner nc_interner_init_in(NC_Allocator* allocator) {
+    return (NC_Interner) {
+        .p = {
+            .bytes = nc_raw_buffer_init_in(sizeof(char), allocator),
+            .bytes_size = 0,
+            .entries = nc_raw_buffer_init_in(sizeof(NC_PInternerEntry), allocator),
+            .size = 0,
+            .slots = nc_raw_buffer_init_in(sizeof(uint32_t), allocator)
+        }
+    };
+}
+
+void nc_interner_destroy(NC_Interner* self) {
+    NC_Allocator* const allocator = nc_raw_buffer_allocator(&self->p.bytes);
+    nc_raw_buffer_free(&self->p.bytes, sizeof(char));
+    nc_raw_buffer_free(&self->p.entries, sizeof(NC_PInternerEntry));
+    nc_raw_buffer_free(&self->p.slots, sizeof(uint32_t));
+
+    *self = nc_interner_init_in(allocator);
+}
+
+size_t nc_interner_size(const NC_Interner* self) {
+    return self->p.size;
+}
+
+bool nc_interner_intern(NC_Interner* self, NC_StringView string_view, NC_Symbol* out_symbol) {
+    const uint64_t hash = nc_string_view_hash(string_view);
+    size_t index = 0;
+    if (self->p.size > 0) {
+        index = nc_p_interner_probe(self, string_view, hash);
+        const uint32_t slot = ((const uint32_t*)nc_raw_buffer_data(&self->p.slots))[index];
+        if (slot != NC_P_INTERNER_EMPTY_SLOT) {
+            *out_symbol = slot - 1;
+            return true;
+        }
+    }
+
+    // Last slot value is reserved, so that symbol + 1 fits
+    if (self->p.size >= UINT32_MAX - 1)
+        return false;
+
+    // View might point into the bytes, for example a part of resolved string, which growth moves
+    const size_t size = nc_string_view_size(string_view);
+    const uintptr_t source = (uintptr_t)nc_string_view_bytes(string_view);
+    const uintptr_t bytes_begin = (uintptr_t)nc_raw_buffer_data(&self->p.bytes);
+    const bool is_own_bytes = size > 0 && source >= bytes_begin && source < bytes_begin + self->p.bytes_size;
+    if (!nc_p_interner_grow(&self->p.bytes, self->p.bytes_size + size + 1, NC_INTERNER_MIN_CAPACITY * 16, sizeof(char)))
+        return false;
+    if (is_own_bytes)
+        string_view = nc_string_view_init_unchecked((const char*)nc_raw_buffer_data(&self->p.bytes) + (source - bytes_begin), size);
+    if (!nc_p_interner_grow(&self->p.entries, self->p.size + 1, NC_INTERNER_MIN_CAPACITY, sizeof(NC_PInternerEntry)))
+        return false;
+
+    // Keep load factor at most 1/2, slots are small and short probes avoid comparing strings
+    if ((self->p.size + 1) * 2 > nc_p_interner_capacity(self)) {
+        const size_t capacity = nc_p_interner_capacity(self);
+        if (!nc_p_interner_rehash(self, capacity < NC_INTERNER_MIN_CAPACITY ? NC_INTERNER_MIN_CAPACITY : capacity * 2))
+            return false;
+        index = nc_p_interner_probe(self, string_view, hash);
+    }
+
+    char* const bytes = (char*)nc_raw_buffer_data(&self->p.bytes) + self->p.bytes_size;
+    if (size > 0)
+        memcpy(bytes, nc_string_view_bytes(string_view), size);
+    bytes[size] = '\0';
+
+    const NC_Symbol symbol = (NC_Symbol)self->p.size;
+    ((NC_PInternerEntry*)nc_raw_buffer_data(&self->p.entries))[symbol] = (NC_PInternerEntry) {
+        .offset = self->p.bytes_size,
+        .size = size,
+        .hash = hash
+    };
+    ((uint32_t*)nc_raw_buffer_data(&self->p.slots))[index] = symbol + 1;
+
+    self->p.bytes_size += size + 1;
+    self->p.size += 1;
+    *out_symbol = symbol;
+
+    return true;
+}
+
+bool nc_interner_find(const NC_Interner* self, NC_StringView string_view, NC_Symbol* out_symbol) {
+    if (self->p.size == 0)
+        return false;
+
+    const size_t index = nc_p_interner_probe(self, string_view, nc_string_view_hash(string_view));
+    const uint32_t slot = ((const uint32_t*)nc_raw_buffer_data(&self->p.slots))[index];
+    if (slot == NC_P_INTERNER_EMPTY_SLOT)
+        return false;
+
+    *out_symbol = slot - 1;
+
+    return true;
+}
+
+NC_StringView nc_interner_resolve(const NC_Interner* self, NC_Symbol symbol) {
+    const NC_PInternerEntry* const entry = nc_p_interner_entry(self, symbol);
+
+    return nc_string_view_init_unchecked((const char*)nc_raw_buffer_data(&self->p.bytes) + entry->offset, entry->size);
+}
@@ -0,0 +1,767 @@
+#include "ncstd/rope.h"
+
+#include <string.h>
+
+#include "ncstd/alloc_stats.h"
+#include "ncstd/utf8.h"
+
+
+NC_INSTANTIATE_OPTION(NC_Rope, rope)
+
+struct NC_PRopeNode {
+    size_t ref_count;
+    size_t size;
+    size_t char_count;
+    // Leaves have height 0
+    size_t height;
+    NC_PRopeNode* left;
+    NC_PRopeNode* right;
+    // Leaves are followed by NC_ROPE_CHUNK_CAPACITY bytes of text
+};
+
+// Leaf with its text takes 1024 bytes on 64-bit platforms
+#define NC_P_ROPE_LEAF_ALLOCATION_SIZE (sizeof(NC_PRopeNode) + NC_ROPE_CHUNK_CAPACITY)
+// Chunks of new text are cut at this size and moved back by at most 3 bytes to a character boundary,
+// so that they fit in NC_ROPE_CHUNK_CAPACITY bytes
+#define NC_P_ROPE_FILL_SIZE (NC_ROPE_CHUNK_CAPACITY - 3)
+
+
+static char* nc_p_rope_leaf_bytes(const NC_PRopeNode* leaf) {
+    return (char*)(leaf + 1);
+}
+
+static size_t nc_p_rope_count_chars(const char* bytes, size_t size) {
+    size_t count = 0;
+    for (size_t i = 0; i < size; ++i)
+        count += !nc_utf8_is_continuation_byte((uint8_t)bytes[i]);
+
+    return count;
+}
+
+static size_t nc_p_rope_node_size(const NC_PRopeNode* node) {
+    return node == NULL ? 0 : node->size;
+}
+
+static NC_PRopeNode* nc_p_rope_retain(NC_PRopeNode* node) {
+    if (node != NULL)
+        node->ref_count += 1;
+
+    return node;
+}
+
+static void nc_p_rope_release(NC_Allocator* allocator, NC_PRopeNode* node) {
+    if (node == NULL || --node->ref_count > 0)
+        return;
+
+    if (node->height == 0) {
+        nc_allocator_free(allocator, node, NC_P_ROPE_LEAF_ALLOCATION_SIZE, NC_DEFAULT_ALIGNMENT);
+        return;
+    }
+
+    nc_p_rope_release(allocator, node->left);
+    nc_p_rope_release(allocator, node->right);
+    nc_allocator_free(allocator, node, sizeof(NC_PRopeNode), NC_DEFAULT_ALIGNMENT);
+}
+
+// Takes references to children of a branch and releases the branch
+static void nc_p_rope_unpack(NC_Allocator* allocator, NC_PRopeNode* node, NC_PRopeNode** out_left, NC_PRopeNode** out_right) {
+    *out_left = nc_p_rope_retain(node->left);
+    *out_right = nc_p_rope_retain(node->right);
+    nc_p_rope_release(allocator, node);
+}
+
+static NC_PRopeNode* nc_p_rope_leaf(NC_Allocator* allocator, const char* bytes, size_t size) {
+    NC_INTERNAL_ALLOC_STATS_SITE_ENTER();
+    NC_PRopeNode* const leaf = nc_allocator_alloc(allocator, NC_P_ROPE_LEAF_ALLOCATION_SIZE, NC_DEFAULT_ALIGNMENT);
+    NC_INTERNAL_ALLOC_STATS_SITE_LEAVE();
+    if (leaf == NULL)
+        return NULL;
+
+    *leaf = (NC_PRopeNode) {
+        .ref_count = 1,
+        .size = size,
+        .char_count = nc_p_rope_count_chars(bytes, size),
+        .height = 0,
+        .left = NULL,
+        .right = NULL
+    };
+    memcpy(nc_p_rope_leaf_bytes(leaf), bytes, size);
+
+    return leaf;
+}
+
+// Consumes left and right, even if allocation fails
+static NC_PRopeNode* nc_p_rope_branch(NC_Allocator* allocator, NC_PRopeNode* left, NC_PRopeNode* right) {
+    NC_INTERNAL_ALLOC_STATS_SITE_ENTER();
+    NC_PRopeNode* const branch = nc_allocator_alloc(allocator, sizeof(NC_PRopeNode), NC_DEFAULT_ALIGNMENT);
+    NC_INTERNAL_ALLOC_STATS_SITE_LEAVE();
+    if (branch == NULL) {
+        nc_p_rope_release(allocator, left);
+        nc_p_rope_release(allocator, right);
+        return NULL;
+    }
+
+    *branch = (NC_PRopeNode) {
+        .ref_count = 1,
+        .size = left->size + right->size,
+        .char_count = left->char_count + right->char_count,
+        .height = (left->height > right->height ? left->height : right->height) + 1,
+        .left = left,
+        .right = right
+    };
+
+    return branch;
+}
+
+// Same as nc_p_rope_branch(), but heights may differ by 2, which is fixed with a single or double rotation
+static NC_PRopeNode* nc_p_rope_balanced(NC_Allocator* allocator, NC_PRopeNode* left, NC_PRopeNode* right) {
+    if (left->height > right->height + 1) {
+        NC_PRopeNode* outer;
+        NC_PRopeNode* inner;
+        nc_p_rope_unpack(allocator, left, &outer, &inner);
+
+        if (outer->height >= inner->height) {
+            NC_PRopeNode* const lowered = nc_p_rope_branch(allocator, inner, right);
+            if (lowered == NULL) {
+                nc_p_rope_release(allocator, outer);
+                return NULL;
+            }
+
+            return nc_p_rope_branch(allocator, outer, lowered);
+        }
+
+        NC_PRopeNode* inner_left;
+        NC_PRopeNode* inner_right;
+        nc_p_rope_unpack(allocator, inner, &inner_left, &inner_right);
+
+        NC_PRopeNode* const new_left = nc_p_rope_branch(allocator, outer, inner_left);
+        if (new_left == NULL) {
+            nc_p_rope_release(allocator, inner_right);
+            nc_p_rope_release(allocator, right);
+            return NULL;
+        }
+        NC_PRopeNode* const new_right = nc_p_rope_branch(allocator, inner_right, right);
+        if (new_right == NULL) {
+            nc_p_rope_release(allocator, new_left);
+            return NULL;
+        }
+
+        return nc_p_rope_branch(allocator, new_left, new_right);
+    }
+
+    if (right->height > left->height + 1) {
+        NC_PRopeNode* inner;
+        NC_PRopeNode* outer;
+        nc_p_rope_unpack(allocator, right, &inner, &outer);
+
+        if (outer->height >= inner->height) {
+            NC_PRopeNode* const lowered = nc_p_rope_branch(allocator, left, inner);
+            if (lowered == NULL) {
+                nc_p_rope_release(allocator, outer);
+                return NULL;
+            }
+
+            return nc_p_rope_branch(allocator, lowered, outer);
+        }
+
+        NC_PRopeNode* inner_left;
+        NC_PRopeNode* inner_right;
+        nc_p_rope_unpack(allocator, inner, &inner_left, &inner_right);
+
+        NC_PRopeNode* const new_left = nc_p_rope_branch(allocator, left, inner_left);
+        if (new_left == NULL) {
+            nc_p_rope_release(allocator, inner_right);
+            nc_p_rope_release(allocator, outer);
+            return NULL;
+        }
+        NC_PRopeNode* const new_right = nc_p_rope_branch(allocator, inner_right, outer);
+        if (new_right == NULL) {
+            nc_p_rope_release(allocator, new_left);
+            return NULL;
+        }
+
+        return nc_p_rope_branch(allocator, new_left, new_right);
+    }
+
+    return nc_p_rope_branch(allocator, left, right);
+}
+
+// Concatenates two trees (either can be empty), consumes both even if allocation fails.
+// Descends along the spine of the taller tree, so it takes O(difference of heights).
+static bool nc_p_rope_join(NC_Allocator* allocator, NC_PRopeNode* left, NC_PRopeNode* right, NC_PRopeNode** out_node) {
+    if (left == NULL || right == NULL) {
+        *out_node = left == NULL ? right : left;
+        return true;
+    }
+
+    // Merge small neighbouring chunks, so that edits don't fragment the text
+    if (left->height == 0 && right->height == 0 && left->size + right->size <= NC_ROPE_CHUNK_CAPACITY) {
+        NC_PRopeNode* const leaf = nc_p_rope_leaf(allocator, nc_p_rope_leaf_bytes(left), left->size);
+        if (leaf != NULL) {
+            memcpy(nc_p_rope_leaf_bytes(leaf) + leaf->size, nc_p_rope_leaf_bytes(right), right->size);
+            leaf->size += right->size;
+            leaf->char_count += right->char_count;
+        }
+
+        nc_p_rope_release(allocator, left);
+        nc_p_rope_release(allocator, right);
+        *out_node = leaf;
+
+        return leaf != NULL;
+    }
+
+    if (left->height > right->height + 1) {
+        NC_PRopeNode* outer;
+        NC_PRopeNode* inner;
+        nc_p_rope_unpack(allocator, left, &outer, &inner);
+
+        NC_PRopeNode* joined;
+        if (!nc_p_rope_join(allocator, inner, right, &joined)) {
+            nc_p_rope_release(allocator, outer);
+            return false;
+        }
+
+        *out_node = nc_p_rope_balanced(allocator, outer, joined);
+        return *out_node != NULL;
+    }
+
+    if (right->height > left->height + 1) {
+        NC_PRopeNode* inner;
+        NC_PRopeNode* outer;
+        nc_p_rope_unpack(allocator, right, &inner, &outer);
+
+        NC_PRopeNode* joined;
+        if (!nc_p_rope_join(allocator, left, inner, &joined)) {
+            nc_p_rope_release(allocator, outer);
+            return false;
+        }
+
+        *out_node = nc_p_rope_balanced(allocator, joined, outer);
+        return *out_node != NULL;
+    }
+
+    *out_node = nc_p_rope_branch(allocator, left, right);
+    return *out_node != NULL;
+}
+
+// Splits tree before byte at index, consumes the tree even if allocation fails
+static bool nc_p_rope_split(
+    NC_Allocator* allocator,
+    NC_PRopeNode* node,
+    size_t index,
+    NC_PRopeNode** out_left,
+    NC_PRopeNode** out_right
+) {
+    if (index == 0 || index >= nc_p_rope_node_size(node)) {
+        *out_left = index == 0 ? NULL : node;
+        *out_right = index == 0 ? node : NULL;
+        return true;
+    }
+
+    if (node->height == 0) {
+        const char* const bytes = nc_p_rope_leaf_bytes(node);
+        NC_PRopeNode* const left = nc_p_rope_leaf(allocator, bytes, index);
+        NC_PRopeNode* const right = left == NULL ? NULL : nc_p_rope_leaf(allocator, bytes + index, node->size - index);
+        nc_p_rope_release(allocator, node);
+        if (right == NULL) {
+            nc_p_rope_release(allocator, left);
+            return false;
+        }
+
+        *out_left = left;
+        *out_right = right;
+        return true;
+    }
+
+    NC_PRopeNode* left;
+    NC_PRopeNode* right;
+    nc_p_rope_unpack(allocator, node, &left, &right);
+
+    const size_t left_size = left->size;
+    if (index <= left_size) {
+        NC_PRopeNode* tail;
+        if (!nc_p_rope_split(allocator, left, index, out_left, &tail)) {
+            nc_p_rope_release(allocator, right);
+            return false;
+        }
+        if (!nc_p_rope_join(allocator, tail, right, out_right)) {
+            nc_p_rope_release(allocator, *out_left);
+            return false;
+        }
+
+        return true;
+    }
+
+    NC_PRopeNode* head;
+    if (!nc_p_rope_split(allocator, right, index - left_size, &head, out_right)) {
+        nc_p_rope_release(allocator, left);
+        return false;
+    }
+    if (!nc_p_rope_join(allocator, left, head, out_left)) {
+        nc_p_rope_release(allocator, *out_right);
+        return false;
+    }
+
+    return true;
+}
+
+static size_t nc_p_rope_chunk_boundary(const char* bytes, size_t size, size_t chunk_count, size_t chunk) {
+    if (chunk == 0)
+        return 0;
+    if (chunk >= chunk_count)
+        return size;
+
+    const size_t nominal = chunk * NC_P_ROPE_FILL_SIZE;
+    for (size_t boundary = nominal; boundary + 3 >= nominal; --boundary) {
+        if (!nc_utf8_is_continuation_byte((uint8_t)bytes[boundary]))
+            return boundary;
+    }
+
+    // Invalid UTF-8, there is no character boundary within the reach
+    return nominal;
+}
+
+// Builds perfectly balanced tree of chunks in range [first, first + count)
+static NC_PRopeNode* nc_p_rope_build(
+    NC_Allocator* allocator,
+    const char* bytes,
+    size_t size,
+    size_t chunk_count,
+    size_t first,
+    size_t count
+) {
+    if (count == 1) {
+        const size_t begin = nc_p_rope_chunk_boundary(bytes, size, chunk_count, first);
+        const size_t end = nc_p_rope_chunk_boundary(bytes, size, chunk_count, first + 1);
+
+        return nc_p_rope_leaf(allocator, bytes + begin, end - begin);
+    }
+
+    NC_PRopeNode* const left = nc_p_rope_build(allocator, bytes, size, chunk_count, first, count / 2);
+    if (left == NULL)
+        return NULL;
+    NC_PRopeNode* const right = nc_p_rope_build(allocator, bytes, size, chunk_count, first + count / 2, count - count / 2);
+    if (right == NULL) {
+        nc_p_rope_release(allocator, left);
+        return NULL;
+    }
+
+    return nc_p_rope_branch(allocator, left, right);
+}
+
+// Returns NULL for empty text, and sets out_failed if allocation has failed
+static NC_PRopeNode* nc_p_rope_build_string_view(NC_Allocator* allocator, NC_StringView string_view, bool* out_failed) {
+    const size_t size = nc_string_view_size(string_view);
+    *out_failed = false;
+    if (size == 0)
+        return NULL;
+
+    const size_t chunk_count = (size + NC_P_ROPE_FILL_SIZE - 1) / NC_P_ROPE_FILL_SIZE;
+    NC_PRopeNode* const node = nc_p_rope_build(allocator, nc_string_view_bytes(string_view), size, chunk_count, 0, chunk_count);
+    *out_failed = node == NULL;
+
+    return node;
+}
+
+// Inserts text into a chunk, if the whole path to it is uniquely owned and the chunk has enough space
+static bool nc_p_rope_insert_in_place(NC_Rope* self, size_t byte_index, NC_StringView string_view) {
+    const size_t size = nc_string_view_size(string_view);
+
+    size_t index = byte_index;
+    NC_PRopeNode* node = self->p.root;
+    while (node->ref_count == 1 && node->height > 0) {
+        if (index <= node->left->size) {
+            node = node->left;
+        } else {
+            index -= node->left->size;
+            node = node->right;
+        }
+    }
+    if (node->ref_count != 1 || node->size + size > NC_ROPE_CHUNK_CAPACITY)
+        return false;
+
+    const size_t char_count = nc_p_rope_count_chars(nc_string_view_bytes(string_view), size);
+
+    index = byte_index;
+    node = self->p.root;
+    while (node->height > 0) {
+        node->size += size;
+        node->char_count += char_count;
+        if (index <= node->left->size) {
+            node = node->left;
+        } else {
+            index -= node->left->size;
+            node = node->right;
+        }
+    }
+
+    char* const bytes = nc_p_rope_leaf_bytes(node);
+    memmove(bytes + index + size, bytes + index, node->size - index);
+    memcpy(bytes + index, nc_string_view_bytes(string_view), size);
+    node->size += size;
+    node->char_count += char_count;
+
+    return true;
+}
+
+// Removes range from a chunk, if the whole path to it is uniquely owned and the chunk doesn't become empty
+static bool nc_p_rope_remove_in_place(NC_Rope* self, size_t begin, size_t end) {
+    size_t offset = 0;
+    NC_PRopeNode* node = self->p.root;
+    while (node->ref_count == 1 && node->height > 0) {
+        if (end - offset <= node->left->size) {
+            node = node->left;
+        } else if (begin - offset >= node->left->size) {
+            offset += node->left->size;
+            node = node->right;
+        } else {
+            return false;
+        }
+    }
+    if (node->ref_count != 1 || node->size == end - begin)
+        return false;
+
+    char* const bytes = nc_p_rope_leaf_bytes(node);
+    const size_t size = end - begin;
+    const size_t char_count = nc_p_rope_count_chars(bytes + (begin - offset), size);
+
+    offset = 0;
+    node = self->p.root;
+    while (node->height > 0) {
+        node->size -= size;
+        node->char_count -= char_count;
+        if (end - offset <= node->left->size) {
+            node = node->left;
+        } else {
+            offset += node->left->size;
+            node = node->right;
+        }
+    }
+
+    memmove(bytes + (begin - offset), bytes + (end - offset), node->size - (end - offset));
+    node->size -= size;
+    node->char_count -= char_count;
+
+    return true;
+}
+
+
+NC_Rope nc_rope_init() {
+    return nc_rope_init_in(nc_allocator_default());
+}
+
+NC_Rope nc_rope_init_in(NC_Allocator* allocator) {
+    return (NC_Rope) {
+        .p = {
+            .root = NULL,
+            .allocator = allocator
+        }
+    };
+}
+
+NC_OPTION(NC_Rope) nc_rope_from_string_view(NC_StringView string_view) {
+    return nc_rope_from_string_view_in(string_view, nc_allocator_default());
+}
+
+NC_OPTION(NC_Rope) nc_rope_from_string_view_in(NC_StringView string_view, NC_Allocator* allocator) {
+    NC_Rope self = nc_rope_init_in(allocator);
+
+    bool failed;
+    self.p.root = nc_p_rope_build_string_view(allocator, string_view, &failed);
+    if (failed)
+        return nc_option_rope_init_none();
+
+    return nc_option_rope_init_some(self);
+}
+
+NC_OPTION(NC_Rope) nc_rope_from_string(const NC_String* string) {
+    return nc_rope_from_string_view_in(nc_string_as_string_view(string), nc_string_allocator(string));
+}
+
+NC_Rope nc_rope_clone(const NC_Rope* self) {
+    return (NC_Rope) {
+        .p = {
+            .root = nc_p_rope_retain(self->p.root),
+            .allocator = self->p.allocator
+        }
+    };
+}
+
+void nc_rope_destroy(NC_Rope* self) {
+    nc_p_rope_release(self->p.allocator, self->p.root);
+    self->p.root = NULL;
+}
+
+size_t nc_rope_size(const NC_Rope* self) {
+    return nc_p_rope_node_size(self->p.root);
+}
+
+size_t nc_rope_char_count(const NC_Rope* self) {
+    return self->p.root == NULL ? 0 : self->p.root->char_count;
+}
+
+bool nc_rope_is_empty(const NC_Rope* self) {
+    return self->p.root == NULL;
+}
+
+NC_Allocator* nc_rope_allocator(const NC_Rope* self) {
+    return self->p.allocator;
+}
+
+size_t nc_rope_char_to_byte(const NC_Rope* self, size_t char_index) {
+    const NC_PRopeNode* node = self->p.root;
+    if (char_index >= nc_rope_char_count(self))
+        return nc_rope_size(self);
+
+    size_t byte_index = 0;
+    while (node->height > 0) {
+        if (char_index < node->left->char_count) {
+            node = node->left;
+        } else {
+            char_index -= node->left->char_count;
+            byte_index += node->left->size;
+            node = node->right;
+        }
+    }
+
+    const char* const bytes = nc_p_rope_leaf_bytes(node);
+    size_t index = 0;
+    for (;; ++index) {
+        if (nc_utf8_is_continuation_byte((uint8_t)bytes[index]))
+            continue;
+        if (char_index == 0)
+            break;
+        char_index -= 1;
+    }
+
+    return byte_index + index;
+}
+
+size_t nc_rope_byte_to_char(const NC_Rope* self, size_t byte_index) {
+    const NC_PRopeNode* node = self->p.root;
+    if (node == NULL)
+        return 0;
+
+    size_t char_index = 0;
+    while (node->height > 0) {
+        if (byte_index < node->left->size) {
+            node = node->left;
+        } else {
+            byte_index -= node->left->size;
+            char_index += node->left->char_count;
+            node = node->right;
+        }
+    }
+
+    return char_index + nc_p_rope_count_chars(nc_p_rope_leaf_bytes(node), byte_index);
+}
+
+bool nc_rope_insert(NC_Rope* self, size_t byte_index, NC_StringView string_view) {
+    if (nc_string_view_size(string_view) == 0)
+        return true;
+    if (self->p.root != NULL && nc_p_rope_insert_in_place(self, byte_index, string_view))
+        return true;
+
+    // Original tree stays referenced by the rope, so it's left untouched if any step fails
+    NC_Allocator* const allocator = self->p.allocator;
+    bool failed;
+    NC_PRopeNode* const inserted = nc_p_rope_build_string_view(allocator, string_view, &failed);
+    if (failed)
+        return false;
+
+    NC_PRopeNode* head;
+    NC_PRopeNode* tail;
+    if (!nc_p_rope_split(allocator, nc_p_rope_retain(self->p.root), byte_index, &head, &tail)) {
+        nc_p_rope_release(allocator, inserted);
+        return false;
+    }
+
+    NC_PRopeNode* joined;
+    if (!nc_p_rope_join(allocator, head, inserted, &joined)) {
+        nc_p_rope_release(allocator, tail);
+        return false;
+    }
+    NC_PRopeNode* root;
+    if (!nc_p_rope_join(allocator, joined, tail, &root))
+        return false;
+
+    nc_p_rope_release(allocator, self->p.root);
+    self->p.root = root;
+
+    return true;
+}
+
+bool nc_rope_remove(NC_Rope* self, size_t begin, size_t end) {
+    if (begin == end)
+        return true;
+    if (begin == 0 && end == nc_rope_size(self)) {
+        nc_rope_destroy(self);
+        return true;
+    }
+    if (nc_p_rope_remove_in_place(self, begin, end))
+        return true;
+
+    NC_Allocator* const allocator = self->p.allocator;
+    NC_PRopeNode* head;
+    NC_PRopeNode* tail;
+    if (!nc_p_rope_split(allocator, nc_p_rope_retain(self->p.root), end, &head, &tail))
+        return false;
+
+    NC_PRopeNode* kept;
+    NC_PRopeNode* removed;
+    if (!nc_p_rope_split(allocator, head, begin, &kept, &removed)) {
+        nc_p_rope_release(allocator, tail);
+        return false;
+    }
+    nc_p_rope_release(allocator, removed);
+
+    NC_PRopeNode* root;
+    if (!nc_p_rope_join(allocator, kept, tail, &root))
+        return false;
+
+    nc_p_rope_release(allocator, self->p.root);
+    self->p.root = root;
+
+    return true;
+}
+
+bool nc_rope_slice(const NC_Rope* self, size_t begin, size_t end, NC_Rope* out_slice) {
+    NC_Allocator* const allocator = self->p.allocator;
+    NC_PRopeNode* head;
+    NC_PRopeNode* tail;
+    if (!nc_p_rope_split(allocator, nc_p_rope_retain(self->p.root), end, &head, &tail))
+        return false;
+    nc_p_rope_release(allocator, tail);
+
+    NC_PRopeNode* prefix;
+    NC_PRopeNode* slice;
+    if (!nc_p_rope_split(allocator, head, begin, &prefix, &slice))
+        return false;
+    nc_p_rope_release(allocator, prefix);
+
+    *out_slice = nc_rope_init_in(allocator);
+    out_slice->p.root = slice;
+
+    return true;
+}
+
+bool nc_rope_append(NC_Rope* self, NC_Rope* other) {
+    NC_PRopeNode* root;
+    if (!nc_p_rope_join(self->p.allocator, nc_p_rope_retain(self->p.root), nc_p_rope_retain(other->p.root), &root))
+        return false;
+
+    nc_rope_destroy(self);
+    nc_rope_destroy(other);
+    self->p.root = root;
+
+    return true;
+}
+
+NC_String nc_rope_to_string(const NC_Rope* self) {
+    NC_String string = nc_string_with_capacity_in(nc_rope_size(self) + 1, self->p.allocator);
+
+    NC_RopeChunksIterator it = nc_rope_chunks(self);
+    const NC_StringView* chunk;
+    while ((chunk = nc_rope_chunks_iterator_next(&it)) != NULL)
+        nc_string_push_string_view(&string, *chunk);
+
+    return string;
+}
+
+NC_RopeChunksIterator nc_rope_chunks(const NC_Rope* self) {
+    return (NC_RopeChunksIterator) {
+        .p = {
+            .root = self->p.root,
+            .offset = 0,
+            .current = nc_string_view_init_unchecked("", 0)
+        }
+    };
+}
+
+void* nc_rope_chunks_iterator_next(NC_RopeChunksIterator* self) {
+    const NC_PRopeNode* node = self->p.root;
+    if (self->p.offset >= nc_p_rope_node_size(node))
+        return NULL;
+
+    // Offset is always at the start of a chunk
+    size_t index = self->p.offset;
+    while (node->height > 0) {
+        if (index < node->left->size) {
+            node = node->left;
+        } else {
+            index -= node->left->size;
+            node = node->right;
+        }
+    }
+
+    self->p.current = nc_string_view_init_unchecked(nc_p_rope_leaf_bytes(node), node->size);
+    self->p.offset += node->size;
+
+    return &self->p.current;
+}
+
+NC_RopeCharsIterator nc_rope_chars(const NC_Rope* self) {
+    return (NC_RopeCharsIterator) {
+        .p = {
+            .chunks = nc_rope_chunks(self),
+            .current = NULL,
+            .end = NULL,
+            .current_char = '\0'
+        }
+    };
+}
+
+void* nc_rope_chars_iterator_next(NC_RopeCharsIterator* self) {
+    while (self->p.current >= self->p.end) {
+        const NC_StringView* const chunk = nc_rope_chunks_iterator_next(&self->p.chunks);
+        if (chunk == NULL)
+            return NULL;
+
+        self->p.current = (const uint8_t*)nc_string_view_bytes(*chunk);
+        self->p.end = self->p.current + nc_string_view_size(*chunk);
+    }
+
+    size_t char_width = 0;
+    self->p.current_char = nc_utf8_decode_char_unchecked(self->p.current, &char_width);
+    self->p.current += char_width;
+
+    return &self->p.current_char;
+}
+
+
+#if NC_FEATURE_ITERATOR
+
+static void* nc_p_rope_chunks_iterator_next_untyped(void* iterator) {
+    return nc_rope_chunks_iterator_next(iterator);
+}
+
+static void* nc_p_rope_chars_iterator_next_untyped(void* iterator) {
+    return nc_rope_chars_iterator_next(iterator);
+}
+
+static const NC_IteratorVtable CHUNKS_ITERATOR_VTABLE = {
+    .next_fn = nc_p_rope_chunks_iterator_next_untyped
+};
+
+static const NC_IteratorVtable CHARS_ITERATOR_VTABLE = {
+    .next_fn = nc_p_rope_chars_iterator_next_untyped
+};
+
+
+NC_Iterator* nc_rope_chunks_iterator_into_dyn(NC_RopeChunksIterator self) {
+    return nc_iterator_create(&CHUNKS_ITERATOR_VTABLE, &self, sizeof self);
+}
+
+NC_Iterator* nc_rope_chunks_iterator_into_dyn_in(NC_RopeChunksIterator self, NC_Allocator* allocator) {
+    return nc_iterator_create_in(&CHUNKS_ITERATOR_VTABLE, &self, sizeof self, allocator);
+}
+
+NC_Iterator* nc_rope_chars_iterator_into_dyn(NC_RopeCharsIterator self) {
+    return nc_iterator_create(&CHARS_ITERATOR_VTABLE, &self, sizeof self);
+}
+
+NC_Iterator* nc_rope_chars_iterator_into_dyn_in(NC_RopeCharsIterator self, NC_Allocator* allocator) {
+    return nc_iterator_create_in(&CHARS_ITERATOR_VTABLE, &self, sizeof self, allocator);
+}
+
+#endif
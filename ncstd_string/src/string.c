@@ -1,8 +1,12 @@
 #include "ncstd/nc_string.h"
 
+#include "ncstd/alloc_stats.h"
 #include "ncstd/utf8.h"
 
 
+NC_INSTANTIATE_OPTION(NC_String, string)
+
+
 static const size_t STRING_GROWTH_FACTOR = 2;
 static const char NULL_TERMINATOR = '\0';
 
@@ -19,10 +23,38 @@ size_t nc_string_size(const NC_String* self) {
     return self->p.size;
 }
 
+size_t nc_string_char_count(const NC_String* self) {
+    return nc_string_view_char_count(nc_string_as_string_view(self));
+}
+
 size_t nc_string_capacity(const NC_String* self) {
     return nc_raw_buffer_capacity(&self->p.raw_buffer);
 }
 
+NC_Allocator* nc_string_allocator(const NC_String* self) {
+    return nc_raw_buffer_allocator(&self->p.raw_buffer);
+}
+
+NC_StringView nc_string_as_string_view(const NC_String* self) {
+    return nc_string_view_init_unchecked(nc_raw_buffer_data(&self->p.raw_buffer), self->p.size);
+}
+
+uint64_t nc_string_hash(const NC_String* self) {
+    return nc_string_view_hash(nc_string_as_string_view(self));
+}
+
+bool nc_string_ptr_eq(const void* a, const void* b, void* data) {
+    (void)data;
+
+    return nc_string_view_eq(nc_string_as_string_view(a), nc_string_as_string_view(b));
+}
+
+uint64_t nc_string_ptr_hash(const void* string, void* data) {
+    (void)data;
+
+    return nc_string_hash(string);
+}
+
 
 void nc_string_clear(NC_String* self) {
     if (self->p.size == 0)
@@ -33,7 +65,9 @@ void nc_string_clear(NC_String* self) {
 }
 
 void nc_string_reserve(NC_String* self, size_t new_capacity) {
+    NC_INTERNAL_ALLOC_STATS_SITE_ENTER();
     nc_raw_buffer_grow_amorthized(&self->p.raw_buffer, new_capacity + 1, STRING_GROWTH_FACTOR, sizeof(char));
+    NC_INTERNAL_ALLOC_STATS_SITE_LEAVE();
 }
 
 NC_OPTION(char32_t) nc_string_pop(NC_String* self) {
@@ -79,7 +113,13 @@ void nc_string_push_string_view(NC_String* self, NC_StringView string_view) {
 
 
 NC_String nc_string_empty() {
-    NC_RawBuffer raw_buffer = nc_raw_buffer_init_with_objects(&NULL_TERMINATOR, 1, sizeof(char));
+    return nc_string_empty_in(nc_allocator_default());
+}
+
+NC_String nc_string_empty_in(NC_Allocator* allocator) {
+    NC_INTERNAL_ALLOC_STATS_SITE_ENTER();
+    NC_RawBuffer raw_buffer = nc_raw_buffer_init_with_objects_in(&NULL_TERMINATOR, 1, sizeof(char), allocator);
+    NC_INTERNAL_ALLOC_STATS_SITE_LEAVE();
 
     return (NC_String) { .p = { .raw_buffer = raw_buffer, .size = 0 } };
 }
@@ -87,34 +127,60 @@ NC_String nc_string_empty() {
 
 // TODO: Check for 0 capacity
 NC_String nc_string_with_capacity(size_t capacity) {
-    NC_RawBuffer raw_buffer = nc_raw_buffer_init_with_capacity(capacity, sizeof(char));
+    return nc_string_with_capacity_in(capacity, nc_allocator_default());
+}
+
+NC_String nc_string_with_capacity_in(size_t capacity, NC_Allocator* allocator) {
+    NC_INTERNAL_ALLOC_STATS_SITE_ENTER();
+    NC_RawBuffer raw_buffer = nc_raw_buffer_init_with_capacity_in(capacity, sizeof(char), allocator);
+    NC_INTERNAL_ALLOC_STATS_SITE_LEAVE();
     nc_raw_buffer_set_unchecked(&raw_buffer, &NULL_TERMINATOR, 0, sizeof(char));
 
     return (NC_String) { .p = { .raw_buffer = raw_buffer, .size = 0 } };
 }
 
 NC_OPTION(NC_String) nc_string_from_c_str(const char* c_str) {
+    return nc_string_from_c_str_in(c_str, nc_allocator_default());
+}
+
+NC_OPTION(NC_String) nc_string_from_c_str_in(const char* c_str, NC_Allocator* allocator) {
     const size_t length = strlen(c_str);
 
     if (!nc_utf8_is_valid((const uint8_t*)c_str, length))
         return nc_option_string_init_none();
 
-    return nc_option_string_init_some(nc_string_from_c_str_unchecked(c_str));
+    return nc_option_string_init_some(nc_string_from_c_str_unchecked_in(c_str, allocator));
 }
 
 NC_String nc_string_from_c_str_unchecked(const char* c_str) {
+    return nc_string_from_c_str_unchecked_in(c_str, nc_allocator_default());
+}
+
+NC_String nc_string_from_c_str_unchecked_in(const char* c_str, NC_Allocator* allocator) {
     const size_t length = strlen(c_str);
-    NC_RawBuffer raw_buffer = nc_raw_buffer_init_with_objects(c_str, length + 1, sizeof(char));
+    NC_INTERNAL_ALLOC_STATS_SITE_ENTER();
+    NC_RawBuffer raw_buffer = nc_raw_buffer_init_with_objects_in(c_str, length + 1, sizeof(char), allocator);
+    NC_INTERNAL_ALLOC_STATS_SITE_LEAVE();
 
     return (NC_String) { .p = { .raw_buffer = raw_buffer, .size = length } };
 }
 
 NC_String nc_string_from_string_view(NC_StringView string_view) {
-    return nc_string_with_length_unchecked(nc_string_view_bytes(string_view), nc_string_view_size(string_view));
+    return nc_string_from_string_view_in(string_view, nc_allocator_default());
+}
+
+NC_String nc_string_from_string_view_in(NC_StringView string_view, NC_Allocator* allocator) {
+    return nc_string_with_length_unchecked_in(nc_string_view_bytes(string_view), nc_string_view_size(string_view), allocator);
 }
 
 NC_String nc_string_with_length_unchecked(const char* chars, size_t length) {
-    NC_RawBuffer raw_buffer = nc_raw_buffer_init_with_capacity(length + 1, sizeof(char));
+    return nc_string_with_length_unchecked_in(chars, length, nc_allocator_default());
+}
+
+NC_String nc_string_with_length_unchecked_in(const char* chars, size_t length, NC_Allocator* allocator) {
+    NC_INTERNAL_ALLOC_STATS_SITE_ENTER();
+    NC_RawBuffer raw_buffer = nc_raw_buffer_init_with_capacity_in(length + 1, sizeof(char), allocator);
+    NC_INTERNAL_ALLOC_STATS_SITE_LEAVE();
     nc_raw_buffer_set_multiple_unchecked(&raw_buffer, chars, 0, length, sizeof(char));
     nc_raw_buffer_set_unchecked(&raw_buffer, &NULL_TERMINATOR, length, sizeof(char));
 
@@ -125,7 +191,7 @@ void nc_string_destroy(NC_String* self) {
     if (!self)
         return;
 
-    nc_raw_buffer_free(&self->p.raw_buffer);
+    nc_raw_buffer_free(&self->p.raw_buffer, sizeof(char));
 }
 
 
@@ -0,0 +1,52 @@
+#include "ncstd/string_bloom_filter.h"
+
+#include <stdint.h>
+
+
+// Number of views hashed before their blocks are accessed, keeps hashes on the stack
+#define NC_P_STRING_BLOOM_FILTER_BATCH_SIZE 64
+
+
+void nc_bloom_filter_insert_string_view(NC_BloomFilter* self, NC_StringView string_view) {
+    nc_bloom_filter_insert_hash(self, nc_string_view_hash(string_view));
+}
+
+bool nc_bloom_filter_contains_string_view(const NC_BloomFilter* self, NC_StringView string_view) {
+    return nc_bloom_filter_contains_hash(self, nc_string_view_hash(string_view));
+}
+
+void nc_bloom_filter_insert_string_views(NC_BloomFilter* self, const NC_StringView* string_views, size_t count) {
+    uint64_t hashes[NC_P_STRING_BLOOM_FILTER_BATCH_SIZE];
+
+    for (size_t start = 0; start < count; start += NC_P_STRING_BLOOM_FILTER_BATCH_SIZE) {
+        const size_t batch_size = count - start < NC_P_STRING_BLOOM_FILTER_BATCH_SIZE
+            ? count - start
+            : NC_P_STRING_BLOOM_FILTER_BATCH_SIZE;
+
+        for (size_t i = 0; i < batch_size; ++i)
+            hashes[i] = nc_string_view_hash(string_views[start + i]);
+        nc_bloom_filter_insert_hashes(self, hashes, batch_size);
+    }
+}
+
+size_t nc_bloom_filter_contains_string_views(
+    const NC_BloomFilter* self,
+    const NC_StringView* string_views,
+    size_t count,
+    bool* out_results
+) {
+    uint64_t hashes[NC_P_STRING_BLOOM_FILTER_BATCH_SIZE];
+
+    size_t found = 0;
+    for (size_t start = 0; start < count; start += NC_P_STRING_BLOOM_FILTER_BATCH_SIZE) {
+        const size_t batch_size = count - start < NC_P_STRING_BLOOM_FILTER_BATCH_SIZE
+            ? count - start
+            : NC_P_STRING_BLOOM_FILTER_BATCH_SIZE;
+
+        for (size_t i = 0; i < batch_size; ++i)
+            hashes[i] = nc_string_view_hash(string_views[start + i]);
+        found += nc_bloom_filter_contains_hashes(self, hashes, batch_size, out_results + start);
+    }
+
+    return found;
+}
@@ -2,18 +2,11 @@
 
 #include <string.h>
 
+#include "ncstd/utf8.h"
+#include "ncstd/util/hash.h"
 
-bool nc_option_string_view_is_some(NC_OPTION(NC_StringView) self) {
-    return self.value.p.cstr;
-}
-
-NC_OPTION(NC_StringView) nc_option_string_view_init_some(NC_StringView string_view) {
-    return (NC_OPTION(NC_StringView)) { .value = string_view };
-}
 
-NC_OPTION(NC_StringView) nc_option_string_view_init_none() {
-    return (NC_OPTION(NC_StringView)) { .value = nc_string_view_init_unchecked(NULL, 0) };
-}
+NC_INSTANTIATE_OPTION(NC_StringView, string_view)
 
 
 const char* nc_string_view_bytes(NC_StringView self) {
@@ -24,12 +17,35 @@ size_t nc_string_view_size(NC_StringView self) {
     return self.p.size;
 }
 
+bool nc_string_view_is_null(NC_StringView self) {
+    return self.p.cstr == NULL;
+}
+
+size_t nc_string_view_char_count(NC_StringView self) {
+    return nc_utf8_count_codepoints((const uint8_t*)self.p.cstr, self.p.size);
+}
+
+NC_StringView nc_string_view_slice(NC_StringView self, size_t begin, size_t end) {
+    return nc_string_view_init_unchecked(self.p.cstr + begin, end - begin);
+}
+
+NC_StringView nc_string_view_char_slice(NC_StringView self, size_t begin, size_t end) {
+    const uint8_t* const bytes = (const uint8_t*)self.p.cstr;
+    const size_t begin_byte = nc_utf8_char_to_byte(bytes, self.p.size, begin);
+    if (end <= begin)
+        return nc_string_view_slice(self, begin_byte, begin_byte);
+
+    const size_t end_byte = begin_byte + nc_utf8_char_to_byte(bytes + begin_byte, self.p.size - begin_byte, end - begin);
+
+    return nc_string_view_slice(self, begin_byte, end_byte);
+}
+
 
 bool nc_string_view_eq(NC_StringView a, NC_StringView b) {
     if (nc_string_view_size(a) != nc_string_view_size(b))
         return false;
 
-    return strncmp(nc_string_view_bytes(a), nc_string_view_bytes(b), nc_string_view_size(a));
+    return memcmp(nc_string_view_bytes(a), nc_string_view_bytes(b), nc_string_view_size(a)) == 0;
 }
 
 bool nc_string_view_ptr_eq(const void* a, const void* b, void* data) {
@@ -38,6 +54,37 @@ bool nc_string_view_ptr_eq(const void* a, const void* b, void* data) {
     return nc_string_view_eq(*(const NC_StringView*)a, *(const NC_StringView*)b);
 }
 
+uint64_t nc_string_view_hash(NC_StringView self) {
+    return nc_hash_bytes(nc_string_view_bytes(self), nc_string_view_size(self));
+}
+
+uint64_t nc_string_view_hash_seeded(NC_StringView self, uint64_t seed) {
+    return nc_hash_bytes_seeded(nc_string_view_bytes(self), nc_string_view_size(self), seed);
+}
+
+uint64_t nc_string_view_ptr_hash(const void* string_view, void* data) {
+    (void)data;
+
+    return nc_string_view_hash(*(const NC_StringView*)string_view);
+}
+
+int nc_string_view_cmp(NC_StringView a, NC_StringView b) {
+    const size_t a_size = nc_string_view_size(a);
+    const size_t b_size = nc_string_view_size(b);
+
+    const int result = memcmp(nc_string_view_bytes(a), nc_string_view_bytes(b), a_size < b_size ? a_size : b_size);
+    if (result != 0)
+        return result;
+
+    return (a_size > b_size) - (a_size < b_size);
+}
+
+int nc_string_view_ptr_cmp(const void* a, const void* b, void* data) {
+    (void)data;
+
+    return nc_string_view_cmp(*(const NC_StringView*)a, *(const NC_StringView*)b);
+}
+
 // TODO: Use UTF-8 validation
 NC_StringView nc_string_view_init_unchecked(const char* cstr, size_t size) {
     return (NC_StringView) { 
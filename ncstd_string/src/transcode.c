@@ -0,0 +1,916 @@
+#include "ncstd/transcode.h"
+
+#include <string.h>
+
+#include "ncstd/alloc_stats.h"
+#include "ncstd/utf8.h"
+
+// Vector conversions are compiled for AVX2 regardless of compiler flags, and selected at runtime
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define NC_P_TRANSCODE_X86
+#define NC_P_TRANSCODE_TARGET(features) __attribute__((target(features)))
+#include <immintrin.h>
+#endif
+
+
+static bool nc_p_is_surrogate(char32_t unit) {
+    return unit >= 0xD800 && unit <= 0xDFFF;
+}
+
+static bool nc_p_is_high_surrogate(char32_t unit) {
+    return unit >= 0xD800 && unit <= 0xDBFF;
+}
+
+static bool nc_p_is_low_surrogate(char32_t unit) {
+    return unit >= 0xDC00 && unit <= 0xDFFF;
+}
+
+// Writes one or two code units, returns their number
+static size_t nc_p_utf16_encode_char(char16_t* out, char32_t ch) {
+    if (ch < 0x10000) {
+        out[0] = (char16_t)ch;
+
+        return 1;
+    }
+
+    ch -= 0x10000;
+    out[0] = (char16_t)(0xD800 + (ch >> 10));
+    out[1] = (char16_t)(0xDC00 + (ch & 0x3FF));
+
+    return 2;
+}
+
+// Reads one or two code units of valid UTF-16, returns their number
+static size_t nc_p_utf16_decode_char(const char16_t* data, char32_t* out_char) {
+    if (!nc_p_is_high_surrogate(data[0])) {
+        *out_char = data[0];
+
+        return 1;
+    }
+
+    *out_char = 0x10000 + (((char32_t)data[0] - 0xD800) << 10) + ((char32_t)data[1] - 0xDC00);
+
+    return 2;
+}
+
+static bool nc_p_utf16_is_valid_scalar(const char16_t* data, size_t count, size_t i) {
+    while (i < count) {
+        if (nc_p_is_high_surrogate(data[i])) {
+            if (count - i < 2 || !nc_p_is_low_surrogate(data[i + 1]))
+                return false;
+            i += 2;
+        } else if (nc_p_is_low_surrogate(data[i])) {
+            return false;
+        } else {
+            ++i;
+        }
+    }
+
+    return true;
+}
+
+static size_t nc_p_utf8_utf16_length_scalar(const uint8_t* data, size_t size) {
+    size_t length = 0;
+    for (size_t i = 0; i < size; ++i)
+        length += !nc_utf8_is_continuation_byte(data[i]) + (data[i] >= 0xF0);
+
+    return length;
+}
+
+static size_t nc_p_utf16_utf8_length_scalar(const char16_t* data, size_t count) {
+    size_t length = 0;
+    for (size_t i = 0; i < count; ++i) {
+        // Each surrogate of a pair takes half of the 4 byte encoding
+        const char16_t unit = data[i];
+        length += 1 + (unit >= 0x80) + (unit >= 0x800) - nc_p_is_surrogate(unit);
+    }
+
+    return length;
+}
+
+static size_t nc_p_utf32_utf8_length_scalar(const char32_t* data, size_t count) {
+    size_t length = 0;
+    for (size_t i = 0; i < count; ++i)
+        length += 1 + (data[i] >= 0x80) + (data[i] >= 0x800) + (data[i] >= 0x10000);
+
+    return length;
+}
+
+// Scalar conversions continue from given positions, after vector loops
+static size_t nc_p_utf8_to_utf16_scalar(const uint8_t* data, size_t size, size_t i, char16_t* out) {
+    // Vector loops stop in the middle of a codepoint, whose leading byte was already converted
+    while (i < size && nc_utf8_is_continuation_byte(data[i]))
+        ++i;
+
+    size_t written = 0;
+    while (i < size) {
+        size_t char_width;
+        const char32_t ch = nc_utf8_decode_char_unchecked(data + i, &char_width);
+        written += nc_p_utf16_encode_char(out + written, ch);
+        i += char_width;
+    }
+
+    return written;
+}
+
+static size_t nc_p_utf8_to_utf32_scalar(const uint8_t* data, size_t size, size_t i, char32_t* out) {
+    while (i < size && nc_utf8_is_continuation_byte(data[i]))
+        ++i;
+
+    size_t written = 0;
+    while (i < size) {
+        size_t char_width;
+        out[written++] = nc_utf8_decode_char_unchecked(data + i, &char_width);
+        i += char_width;
+    }
+
+    return written;
+}
+
+static size_t nc_p_utf16_to_utf8_scalar(const char16_t* data, size_t count, size_t i, uint8_t* out) {
+    size_t written = 0;
+    while (i < count) {
+        char32_t ch;
+        i += nc_p_utf16_decode_char(data + i, &ch);
+        written += nc_utf8_encode_char_unchecked(out + written, ch);
+    }
+
+    return written;
+}
+
+static size_t nc_p_utf32_to_utf8_scalar(const char32_t* data, size_t count, size_t i, uint8_t* out) {
+    size_t written = 0;
+    for (; i < count; ++i)
+        written += nc_utf8_encode_char_unchecked(out + written, data[i]);
+
+    return written;
+}
+
+#ifdef NC_P_TRANSCODE_X86
+// Shuffle tables are generated by the preprocessor, entry of every table is a constant expression of its index
+#define NC_P_BIT(value, bit) (((value) >> (bit)) & 1)
+#define NC_P_POPCOUNT8(value)                                                                                           \
+    (NC_P_BIT(value, 0) + NC_P_BIT(value, 1) + NC_P_BIT(value, 2) + NC_P_BIT(value, 3) +                                \
+     NC_P_BIT(value, 4) + NC_P_BIT(value, 5) + NC_P_BIT(value, 6) + NC_P_BIT(value, 7))
+#define NC_P_REPEAT_16(f, high)                                                                                         \
+    f(0x##high##0) f(0x##high##1) f(0x##high##2) f(0x##high##3) f(0x##high##4) f(0x##high##5) f(0x##high##6)            \
+    f(0x##high##7) f(0x##high##8) f(0x##high##9) f(0x##high##A) f(0x##high##B) f(0x##high##C) f(0x##high##D)            \
+    f(0x##high##E) f(0x##high##F)
+#define NC_P_REPEAT_256(f)                                                                                              \
+    NC_P_REPEAT_16(f, 0) NC_P_REPEAT_16(f, 1) NC_P_REPEAT_16(f, 2) NC_P_REPEAT_16(f, 3)                                 \
+    NC_P_REPEAT_16(f, 4) NC_P_REPEAT_16(f, 5) NC_P_REPEAT_16(f, 6) NC_P_REPEAT_16(f, 7)                                 \
+    NC_P_REPEAT_16(f, 8) NC_P_REPEAT_16(f, 9) NC_P_REPEAT_16(f, A) NC_P_REPEAT_16(f, B)                                 \
+    NC_P_REPEAT_16(f, C) NC_P_REPEAT_16(f, D) NC_P_REPEAT_16(f, E) NC_P_REPEAT_16(f, F)
+
+// Lane of the left packing permutation, index of the bit of the mask that is set and has lane bits set below it
+#define NC_P_LEFT_PACK_TERM(mask, lane, bit) ((bit) * (NC_P_BIT(mask, bit) && NC_P_POPCOUNT8((mask) & ((1 << (bit)) - 1)) == (lane)))
+#define NC_P_LEFT_PACK_LANE(mask, lane)                                                                                 \
+    (NC_P_LEFT_PACK_TERM(mask, lane, 0) + NC_P_LEFT_PACK_TERM(mask, lane, 1) + NC_P_LEFT_PACK_TERM(mask, lane, 2) +     \
+     NC_P_LEFT_PACK_TERM(mask, lane, 3) + NC_P_LEFT_PACK_TERM(mask, lane, 4) + NC_P_LEFT_PACK_TERM(mask, lane, 5) +     \
+     NC_P_LEFT_PACK_TERM(mask, lane, 6) + NC_P_LEFT_PACK_TERM(mask, lane, 7))
+#define NC_P_LEFT_PACK_ENTRY(mask)                                                                                      \
+    {                                                                                                                   \
+        NC_P_LEFT_PACK_LANE(mask, 0), NC_P_LEFT_PACK_LANE(mask, 1), NC_P_LEFT_PACK_LANE(mask, 2),                       \
+        NC_P_LEFT_PACK_LANE(mask, 3), NC_P_LEFT_PACK_LANE(mask, 4), NC_P_LEFT_PACK_LANE(mask, 5),                       \
+        NC_P_LEFT_PACK_LANE(mask, 6), NC_P_LEFT_PACK_LANE(mask, 7)                                                      \
+    },
+
+// Moves 32-bit lanes selected by the mask to the front
+static const uint8_t NC_P_LEFT_PACK[256][8] = { NC_P_REPEAT_256(NC_P_LEFT_PACK_ENTRY) };
+
+// Key of four encodings has bit i set if encoding i takes 2 or 4 bytes, and bit i + 4 if it takes 3 or 4
+#define NC_P_UTF8_PACK_LENGTH(key, i) (1 + NC_P_BIT(key, i) + 2 * NC_P_BIT(key, (i) + 4))
+#define NC_P_UTF8_PACK_OFFSET(key, i)                                                                                   \
+    (((i) > 0) * NC_P_UTF8_PACK_LENGTH(key, 0) + ((i) > 1) * NC_P_UTF8_PACK_LENGTH(key, 1) +                            \
+     ((i) > 2) * NC_P_UTF8_PACK_LENGTH(key, 2))
+#define NC_P_UTF8_PACK_TOTAL(key) (NC_P_UTF8_PACK_OFFSET(key, 3) + NC_P_UTF8_PACK_LENGTH(key, 3))
+// Source of an output byte, which is in the 32-bit lane of its encoding
+#define NC_P_UTF8_PACK_TERM(key, byte, i)                                                                               \
+    ((NC_P_UTF8_PACK_OFFSET(key, i) <= (byte) && (byte) < NC_P_UTF8_PACK_OFFSET(key, i) + NC_P_UTF8_PACK_LENGTH(key, i)) \
+        ? 4 * (i) + (byte) - NC_P_UTF8_PACK_OFFSET(key, i) : 0)
+#define NC_P_UTF8_PACK_BYTE(key, byte)                                                                                  \
+    ((byte) < NC_P_UTF8_PACK_TOTAL(key)                                                                                 \
+        ? NC_P_UTF8_PACK_TERM(key, byte, 0) + NC_P_UTF8_PACK_TERM(key, byte, 1) +                                       \
+          NC_P_UTF8_PACK_TERM(key, byte, 2) + NC_P_UTF8_PACK_TERM(key, byte, 3)                                         \
+        : 0x80)
+#define NC_P_UTF8_PACK_ENTRY(key)                                                                                       \
+    {                                                                                                                   \
+        NC_P_UTF8_PACK_BYTE(key, 0), NC_P_UTF8_PACK_BYTE(key, 1), NC_P_UTF8_PACK_BYTE(key, 2),                          \
+        NC_P_UTF8_PACK_BYTE(key, 3), NC_P_UTF8_PACK_BYTE(key, 4), NC_P_UTF8_PACK_BYTE(key, 5),                          \
+        NC_P_UTF8_PACK_BYTE(key, 6), NC_P_UTF8_PACK_BYTE(key, 7), NC_P_UTF8_PACK_BYTE(key, 8),                          \
+        NC_P_UTF8_PACK_BYTE(key, 9), NC_P_UTF8_PACK_BYTE(key, 10), NC_P_UTF8_PACK_BYTE(key, 11),                        \
+        NC_P_UTF8_PACK_BYTE(key, 12), NC_P_UTF8_PACK_BYTE(key, 13), NC_P_UTF8_PACK_BYTE(key, 14),                       \
+        NC_P_UTF8_PACK_BYTE(key, 15)                                                                                    \
+    },
+#define NC_P_UTF8_PACK_TOTAL_ENTRY(key) NC_P_UTF8_PACK_TOTAL(key),
+
+// Removes unused bytes from four UTF-8 encodings of up to 4 bytes each, placed in 32-bit lanes
+static const uint8_t NC_P_UTF8_PACK[256][16] = { NC_P_REPEAT_256(NC_P_UTF8_PACK_ENTRY) };
+static const uint8_t NC_P_UTF8_PACK_TOTALS[256] = { NC_P_REPEAT_256(NC_P_UTF8_PACK_TOTAL_ENTRY) };
+
+// Vector loops stop while stores of a whole register can't write past exact output
+#define NC_P_UTF8_DECODE_MIN_REMAINING 52
+#define NC_P_UTF8_ENCODE_MIN_REMAINING 24
+// Counts accumulated in 8-bit lanes are summed before they can overflow
+#define NC_P_MAX_BYTE_SUM_BLOCKS 127
+
+static size_t nc_p_popcount8(unsigned value) {
+    value = value - ((value >> 1) & 0x55);
+    value = (value & 0x33) + ((value >> 2) & 0x33);
+
+    return (value + (value >> 4)) & 0x0F;
+}
+
+NC_P_TRANSCODE_TARGET("avx2")
+static size_t nc_p_sum_epu8_avx2(__m256i sums) {
+    const __m256i totals = _mm256_sad_epu8(sums, _mm256_setzero_si256());
+    const __m128i halves = _mm_add_epi64(_mm256_castsi256_si128(totals), _mm256_extracti128_si256(totals, 1));
+
+    return (size_t)_mm_cvtsi128_si32(halves) + (size_t)_mm_cvtsi128_si32(_mm_unpackhi_epi64(halves, halves));
+}
+
+NC_P_TRANSCODE_TARGET("avx2")
+static size_t nc_p_sum_epi32_avx2(__m256i sums) {
+    const __m128i halves = _mm_add_epi32(_mm256_castsi256_si128(sums), _mm256_extracti128_si256(sums, 1));
+    const __m128i pairs = _mm_add_epi32(halves, _mm_unpackhi_epi64(halves, halves));
+
+    return (size_t)(uint32_t)_mm_cvtsi128_si32(_mm_add_epi32(pairs, _mm_srli_epi64(pairs, 32)));
+}
+
+NC_P_TRANSCODE_TARGET("avx2")
+static __m256i nc_p_ge_epu16_avx2(__m256i value, __m256i threshold) {
+    return _mm256_cmpeq_epi16(_mm256_max_epu16(value, threshold), value);
+}
+
+NC_P_TRANSCODE_TARGET("avx2")
+static bool nc_p_utf16_is_valid_avx2(const char16_t* data, size_t count) {
+    const __m256i surrogate_mask = _mm256_set1_epi16((short)0xF800);
+    const __m256i surrogate = _mm256_set1_epi16((short)0xD800);
+
+    size_t i = 0;
+    while (count - i >= 16) {
+        const __m256i units = _mm256_loadu_si256((const __m256i*)(data + i));
+        if (_mm256_testz_si256(_mm256_cmpeq_epi16(_mm256_and_si256(units, surrogate_mask), surrogate), _mm256_set1_epi8(-1))) {
+            i += 16;
+            continue;
+        }
+
+        // Checks units of the block one by one, a pair can extend past its end
+        const size_t end = i + 16;
+        while (i < end) {
+            if (nc_p_is_high_surrogate(data[i])) {
+                if (count - i < 2 || !nc_p_is_low_surrogate(data[i + 1]))
+                    return false;
+                i += 2;
+            } else if (nc_p_is_low_surrogate(data[i])) {
+                return false;
+            } else {
+                ++i;
+            }
+        }
+    }
+
+    return nc_p_utf16_is_valid_scalar(data, count, i);
+}
+
+NC_P_TRANSCODE_TARGET("avx2")
+static bool nc_p_utf32_is_valid_avx2(const char32_t* data, size_t count) {
+    const __m256i max_codepoint = _mm256_set1_epi32(0x10FFFF);
+    const __m256i surrogate_mask = _mm256_set1_epi32((int)0xFFFFF800);
+    const __m256i surrogate = _mm256_set1_epi32(0xD800);
+
+    __m256i invalid = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; count - i >= 8; i += 8) {
+        const __m256i chars = _mm256_loadu_si256((const __m256i*)(data + i));
+        const __m256i too_large = _mm256_xor_si256(
+            _mm256_cmpeq_epi32(_mm256_min_epu32(chars, max_codepoint), chars),
+            _mm256_set1_epi8(-1)
+        );
+        const __m256i surrogates = _mm256_cmpeq_epi32(_mm256_and_si256(chars, surrogate_mask), surrogate);
+        invalid = _mm256_or_si256(invalid, _mm256_or_si256(too_large, surrogates));
+    }
+    if (!_mm256_testz_si256(invalid, invalid))
+        return false;
+
+    for (; i < count; ++i) {
+        if (!nc_is_valid_unicode_codepoint(data[i]))
+            return false;
+    }
+
+    return true;
+}
+
+NC_P_TRANSCODE_TARGET("avx2")
+static size_t nc_p_utf8_utf16_length_avx2(const uint8_t* data, size_t size) {
+    // Bytes greater than -65 as signed start a codepoint, and bytes from 0xF0 start a surrogate pair
+    const __m256i leading_threshold = _mm256_set1_epi8(-65);
+    const __m256i pair_threshold = _mm256_set1_epi8((char)0xF0);
+
+    size_t length = 0;
+    size_t i = 0;
+    while (size - i >= 32) {
+        __m256i sums = _mm256_setzero_si256();
+        for (size_t block = 0; block < NC_P_MAX_BYTE_SUM_BLOCKS && size - i >= 32; ++block, i += 32) {
+            const __m256i bytes = _mm256_loadu_si256((const __m256i*)(data + i));
+            sums = _mm256_sub_epi8(sums, _mm256_cmpgt_epi8(bytes, leading_threshold));
+            sums = _mm256_sub_epi8(sums, _mm256_cmpeq_epi8(_mm256_max_epu8(bytes, pair_threshold), bytes));
+        }
+
+        length += nc_p_sum_epu8_avx2(sums);
+    }
+
+    return length + nc_p_utf8_utf16_length_scalar(data + i, size - i);
+}
+
+NC_P_TRANSCODE_TARGET("avx2")
+static size_t nc_p_utf16_utf8_length_avx2(const char16_t* data, size_t count) {
+    const __m256i two_bytes = _mm256_set1_epi16(0x80);
+    const __m256i three_bytes = _mm256_set1_epi16(0x800);
+    const __m256i surrogate_mask = _mm256_set1_epi16((short)0xF800);
+    const __m256i surrogate = _mm256_set1_epi16((short)0xD800);
+
+    size_t length = 0;
+    size_t i = 0;
+    while (count - i >= 16) {
+        // Lanes grow by at most 2 per block, and are summed long before 16 bits overflow
+        __m256i sums = _mm256_setzero_si256();
+        for (size_t block = 0; block < 8192 && count - i >= 16; ++block, i += 16) {
+            const __m256i units = _mm256_loadu_si256((const __m256i*)(data + i));
+            sums = _mm256_sub_epi16(sums, nc_p_ge_epu16_avx2(units, two_bytes));
+            sums = _mm256_sub_epi16(sums, nc_p_ge_epu16_avx2(units, three_bytes));
+            sums = _mm256_add_epi16(sums, _mm256_cmpeq_epi16(_mm256_and_si256(units, surrogate_mask), surrogate));
+        }
+
+        length += nc_p_sum_epi32_avx2(_mm256_madd_epi16(sums, _mm256_set1_epi16(1)));
+    }
+
+    return length + i + nc_p_utf16_utf8_length_scalar(data + i, count - i);
+}
+
+NC_P_TRANSCODE_TARGET("avx2")
+static size_t nc_p_utf32_utf8_length_avx2(const char32_t* data, size_t count) {
+    size_t length = 0;
+    size_t i = 0;
+    while (count - i >= 8) {
+        __m256i sums = _mm256_setzero_si256();
+        for (size_t block = 0; block < 65536 && count - i >= 8; ++block, i += 8) {
+            const __m256i chars = _mm256_loadu_si256((const __m256i*)(data + i));
+            sums = _mm256_sub_epi32(sums, _mm256_cmpgt_epi32(chars, _mm256_set1_epi32(0x7F)));
+            sums = _mm256_sub_epi32(sums, _mm256_cmpgt_epi32(chars, _mm256_set1_epi32(0x7FF)));
+            sums = _mm256_sub_epi32(sums, _mm256_cmpgt_epi32(chars, _mm256_set1_epi32(0xFFFF)));
+        }
+
+        length += nc_p_sum_epi32_avx2(sums);
+    }
+
+    return length + i + nc_p_utf32_utf8_length_scalar(data + i, count - i);
+}
+
+// Decodes UTF-16 code units starting at each of 16 positions into 16-bit lanes, reading 18 bytes.
+// Codepoint outside of the Basic Multilingual Plane is split into high surrogate at its leading byte,
+// and low surrogate at the following byte, which is recognized by the byte before it in the lane of previous.
+NC_P_TRANSCODE_TARGET("avx2")
+static inline __m256i nc_p_utf8_decode_units_avx2(const uint8_t* data, __m256i previous, unsigned* out_low_kept, unsigned* out_high_kept) {
+    const __m256i continuation_mask = _mm256_set1_epi16(0x3F);
+    const __m256i first = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)data));
+    const __m256i second = _mm256_and_si256(_mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)(data + 1))), continuation_mask);
+    const __m256i third = _mm256_and_si256(_mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)(data + 2))), continuation_mask);
+
+    const __m256i is_two_bytes = _mm256_cmpgt_epi16(first, _mm256_set1_epi16(0xBF));
+    const __m256i is_three_bytes = _mm256_cmpgt_epi16(first, _mm256_set1_epi16(0xDF));
+    const __m256i is_four_bytes = _mm256_cmpgt_epi16(first, _mm256_set1_epi16(0xEF));
+    const __m256i is_low_surrogate = _mm256_cmpgt_epi16(previous, _mm256_set1_epi16(0xEF));
+    const __m256i is_continuation = _mm256_cmpeq_epi16(
+        _mm256_and_si256(first, _mm256_set1_epi16(0xC0)),
+        _mm256_set1_epi16(0x80)
+    );
+
+    // Shifts of 16-bit lanes drop high bits of the leading byte
+    const __m256i two = _mm256_or_si256(_mm256_slli_epi16(_mm256_and_si256(first, _mm256_set1_epi16(0x1F)), 6), second);
+    const __m256i three = _mm256_or_si256(_mm256_slli_epi16(first, 12), _mm256_or_si256(_mm256_slli_epi16(second, 6), third));
+    // Bits from 10 of the codepoint, and bits below 10 taken from the second and third bytes after the leading one
+    const __m256i high = _mm256_add_epi16(
+        _mm256_or_si256(
+            _mm256_slli_epi16(_mm256_and_si256(first, _mm256_set1_epi16(0x07)), 8),
+            _mm256_or_si256(_mm256_slli_epi16(second, 2), _mm256_srli_epi16(third, 4))
+        ),
+        _mm256_set1_epi16((short)(0xD800 - 0x40))
+    );
+    const __m256i low = _mm256_or_si256(
+        _mm256_or_si256(_mm256_slli_epi16(_mm256_and_si256(second, _mm256_set1_epi16(0x0F)), 6), third),
+        _mm256_set1_epi16((short)0xDC00)
+    );
+
+    __m256i units = _mm256_blendv_epi8(first, two, is_two_bytes);
+    units = _mm256_blendv_epi8(units, three, is_three_bytes);
+    units = _mm256_blendv_epi8(units, high, is_four_bytes);
+    units = _mm256_blendv_epi8(units, low, is_low_surrogate);
+
+    // Packing puts masks of lanes 0-7 into bits 0-7 and of lanes 8-15 into bits 16-23
+    const __m256i dropped = _mm256_andnot_si256(is_low_surrogate, is_continuation);
+    const unsigned dropped_mask = (unsigned)_mm256_movemask_epi8(_mm256_packs_epi16(dropped, _mm256_setzero_si256()));
+    *out_low_kept = ~dropped_mask & 0xFF;
+    *out_high_kept = ~(dropped_mask >> 16) & 0xFF;
+
+    return units;
+}
+
+// Decodes codepoints starting at each of 8 positions into 32-bit lanes, reading 16 bytes. Lanes of continuation bytes hold garbage.
+NC_P_TRANSCODE_TARGET("avx2")
+static inline __m256i nc_p_utf8_decode_chars_avx2(const uint8_t* data, unsigned* out_leading) {
+    const __m256i bytes = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)data));
+    // Each lane holds four bytes starting at its position
+    const __m256i words = _mm256_shuffle_epi8(bytes, _mm256_setr_epi8(
+        0, 1, 2, 3, 1, 2, 3, 4, 2, 3, 4, 5, 3, 4, 5, 6,
+        4, 5, 6, 7, 5, 6, 7, 8, 6, 7, 8, 9, 7, 8, 9, 10
+    ));
+    const __m256i continuation_mask = _mm256_set1_epi32(0x3F);
+
+    const __m256i lead = _mm256_and_si256(words, _mm256_set1_epi32(0xFF));
+    const __m256i is_non_ascii = _mm256_cmpgt_epi32(lead, _mm256_set1_epi32(0x7F));
+    const __m256i is_two_bytes = _mm256_cmpgt_epi32(lead, _mm256_set1_epi32(0xBF));
+    const __m256i is_three_bytes = _mm256_cmpgt_epi32(lead, _mm256_set1_epi32(0xDF));
+    const __m256i is_four_bytes = _mm256_cmpgt_epi32(lead, _mm256_set1_epi32(0xEF));
+
+    // Payload of the leading byte is 0xFF >> (width + 1), except for ASCII
+    const __m256i continuation_count = _mm256_sub_epi32(
+        _mm256_setzero_si256(),
+        _mm256_add_epi32(_mm256_add_epi32(is_two_bytes, is_three_bytes), is_four_bytes)
+    );
+    const __m256i lead_shift = _mm256_sub_epi32(
+        _mm256_add_epi32(continuation_count, _mm256_set1_epi32(1)),
+        is_two_bytes
+    );
+    const __m256i lead_payload = _mm256_and_si256(lead, _mm256_srlv_epi32(_mm256_set1_epi32(0xFF), lead_shift));
+
+    // Assembles all four bytes, and shifts out bytes past the end of the codepoint
+    const __m256i full = _mm256_or_si256(
+        _mm256_or_si256(
+            _mm256_slli_epi32(lead_payload, 18),
+            _mm256_slli_epi32(_mm256_and_si256(_mm256_srli_epi32(words, 8), continuation_mask), 12)
+        ),
+        _mm256_or_si256(
+            _mm256_slli_epi32(_mm256_and_si256(_mm256_srli_epi32(words, 16), continuation_mask), 6),
+            _mm256_and_si256(_mm256_srli_epi32(words, 24), continuation_mask)
+        )
+    );
+    const __m256i trailing_shift = _mm256_mullo_epi32(
+        _mm256_sub_epi32(_mm256_set1_epi32(3), continuation_count),
+        _mm256_set1_epi32(6)
+    );
+
+    const unsigned continuations = (unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_andnot_si256(is_two_bytes, is_non_ascii)));
+    *out_leading = ~continuations & 0xFF;
+
+    return _mm256_srlv_epi32(full, trailing_shift);
+}
+
+// Moves 32-bit lanes selected by the mask to the front
+NC_P_TRANSCODE_TARGET("avx2")
+static inline __m256i nc_p_left_pack_epi32_avx2(__m256i lanes, unsigned mask) {
+    const __m256i permutation = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)NC_P_LEFT_PACK[mask]));
+
+    return _mm256_permutevar8x32_epi32(lanes, permutation);
+}
+
+// Moves 16-bit lanes selected by the mask to the front, using lane indices of the same table as byte pairs
+NC_P_TRANSCODE_TARGET("avx2")
+static inline __m128i nc_p_left_pack_epi16_avx2(__m128i lanes, unsigned mask) {
+    const __m128i indices = _mm_slli_epi16(_mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*)NC_P_LEFT_PACK[mask])), 1);
+    const __m128i shuffle = _mm_or_si128(indices, _mm_slli_epi16(_mm_add_epi16(indices, _mm_set1_epi16(1)), 8));
+
+    return _mm_shuffle_epi8(lanes, shuffle);
+}
+
+NC_P_TRANSCODE_TARGET("avx2")
+static size_t nc_p_utf8_to_utf16_avx2(const uint8_t* data, size_t size, char16_t* out) {
+    size_t written = 0;
+    size_t i = 0;
+    while (size - i >= NC_P_UTF8_DECODE_MIN_REMAINING) {
+        const __m256i bytes = _mm256_loadu_si256((const __m256i*)(data + i));
+        if (_mm256_movemask_epi8(bytes) == 0) {
+            _mm256_storeu_si256((__m256i*)(out + written), _mm256_cvtepu8_epi16(_mm256_castsi256_si128(bytes)));
+            _mm256_storeu_si256((__m256i*)(out + written + 16), _mm256_cvtepu8_epi16(_mm256_extracti128_si256(bytes, 1)));
+            written += 32;
+            i += 32;
+            continue;
+        }
+
+        const __m128i previous_bytes = i == 0
+            ? _mm_slli_si128(_mm256_castsi256_si128(bytes), 1)
+            : _mm_loadu_si128((const __m128i*)(data + i - 1));
+        unsigned low_kept, high_kept;
+        const __m256i units = nc_p_utf8_decode_units_avx2(data + i, _mm256_cvtepu8_epi16(previous_bytes), &low_kept, &high_kept);
+
+        _mm_storeu_si128((__m128i*)(out + written), nc_p_left_pack_epi16_avx2(_mm256_castsi256_si128(units), low_kept));
+        written += nc_p_popcount8(low_kept);
+        _mm_storeu_si128((__m128i*)(out + written), nc_p_left_pack_epi16_avx2(_mm256_extracti128_si256(units, 1), high_kept));
+        written += nc_p_popcount8(high_kept);
+        i += 16;
+    }
+
+    // Low surrogate of a pair is written by the next block, which might not be vectorized
+    if (i > 0 && i < size && data[i - 1] >= 0xF0) {
+        size_t char_width;
+        const char32_t ch = nc_utf8_decode_char_unchecked(data + i - 1, &char_width);
+        out[written++] = (char16_t)(0xDC00 + (ch & 0x3FF));
+    }
+
+    return written + nc_p_utf8_to_utf16_scalar(data, size, i, out + written);
+}
+
+NC_P_TRANSCODE_TARGET("avx2")
+static size_t nc_p_utf8_to_utf32_avx2(const uint8_t* data, size_t size, char32_t* out) {
+    const __m128i four_bytes_threshold = _mm_set1_epi8((char)0xF0);
+
+    size_t written = 0;
+    size_t i = 0;
+    while (size - i >= NC_P_UTF8_DECODE_MIN_REMAINING) {
+        const __m256i bytes = _mm256_loadu_si256((const __m256i*)(data + i));
+        if (_mm256_movemask_epi8(bytes) == 0) {
+            const __m128i low = _mm256_castsi256_si128(bytes);
+            const __m128i high = _mm256_extracti128_si256(bytes, 1);
+            _mm256_storeu_si256((__m256i*)(out + written), _mm256_cvtepu8_epi32(low));
+            _mm256_storeu_si256((__m256i*)(out + written + 8), _mm256_cvtepu8_epi32(_mm_srli_si128(low, 8)));
+            _mm256_storeu_si256((__m256i*)(out + written + 16), _mm256_cvtepu8_epi32(high));
+            _mm256_storeu_si256((__m256i*)(out + written + 24), _mm256_cvtepu8_epi32(_mm_srli_si128(high, 8)));
+            written += 32;
+            i += 32;
+            continue;
+        }
+
+        // Codepoints of up to 3 bytes fit 16-bit lanes, which decode twice as many positions at once
+        const __m128i block = _mm256_castsi256_si128(bytes);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(block, four_bytes_threshold), block)) == 0) {
+            unsigned low_kept, high_kept;
+            const __m256i units = nc_p_utf8_decode_units_avx2(data + i, _mm256_setzero_si256(), &low_kept, &high_kept);
+
+            _mm256_storeu_si256(
+                (__m256i*)(out + written),
+                _mm256_cvtepu16_epi32(nc_p_left_pack_epi16_avx2(_mm256_castsi256_si128(units), low_kept))
+            );
+            written += nc_p_popcount8(low_kept);
+            _mm256_storeu_si256(
+                (__m256i*)(out + written),
+                _mm256_cvtepu16_epi32(nc_p_left_pack_epi16_avx2(_mm256_extracti128_si256(units, 1), high_kept))
+            );
+            written += nc_p_popcount8(high_kept);
+        } else {
+            for (size_t offset = 0; offset < 16; offset += 8) {
+                unsigned leading;
+                const __m256i chars = nc_p_utf8_decode_chars_avx2(data + i + offset, &leading);
+                _mm256_storeu_si256((__m256i*)(out + written), nc_p_left_pack_epi32_avx2(chars, leading));
+                written += nc_p_popcount8(leading);
+            }
+        }
+        i += 16;
+    }
+
+    return written + nc_p_utf8_to_utf32_scalar(data, size, i, out + written);
+}
+
+// Writes UTF-8 encodings placed in order from the lowest byte of their 32-bit lanes, encoding i takes
+// 1 + bit i of one_more + 2 * bit i of two_more bytes, and returns pointer past the written bytes
+NC_P_TRANSCODE_TARGET("avx2")
+static inline uint8_t* nc_p_utf8_store_avx2(__m256i encoded, unsigned one_more, unsigned two_more, uint8_t* out) {
+    const unsigned low_key = (one_more & 0x0F) | ((two_more & 0x0F) << 4);
+    const unsigned high_key = ((one_more >> 4) & 0x0F) | (two_more & 0xF0);
+
+    _mm_storeu_si128((__m128i*)out, _mm_shuffle_epi8(
+        _mm256_castsi256_si128(encoded),
+        _mm_loadu_si128((const __m128i*)NC_P_UTF8_PACK[low_key])
+    ));
+    out += NC_P_UTF8_PACK_TOTALS[low_key];
+    _mm_storeu_si128((__m128i*)out, _mm_shuffle_epi8(
+        _mm256_extracti128_si256(encoded, 1),
+        _mm_loadu_si128((const __m128i*)NC_P_UTF8_PACK[high_key])
+    ));
+
+    return out + NC_P_UTF8_PACK_TOTALS[high_key];
+}
+
+// Continuation byte with bits from shift of a codepoint in each 32-bit lane
+NC_P_TRANSCODE_TARGET("avx2")
+static inline __m256i nc_p_utf8_continuation_avx2(__m256i chars, int shift) {
+    return _mm256_or_si256(
+        _mm256_and_si256(_mm256_srl_epi32(chars, _mm_cvtsi32_si128(shift)), _mm256_set1_epi32(0x3F)),
+        _mm256_set1_epi32(0x80)
+    );
+}
+
+// Encodes 8 valid codepoints, and returns pointer past the written bytes
+NC_P_TRANSCODE_TARGET("avx2")
+static inline uint8_t* nc_p_utf32_encode_utf8_avx2(__m256i chars, uint8_t* out) {
+    const __m256i is_two_bytes = _mm256_cmpgt_epi32(chars, _mm256_set1_epi32(0x7F));
+    const __m256i is_three_bytes = _mm256_cmpgt_epi32(chars, _mm256_set1_epi32(0x7FF));
+    const __m256i is_four_bytes = _mm256_cmpgt_epi32(chars, _mm256_set1_epi32(0xFFFF));
+
+    const __m256i last = nc_p_utf8_continuation_avx2(chars, 0);
+    const __m256i middle = nc_p_utf8_continuation_avx2(chars, 6);
+    const __m256i upper = nc_p_utf8_continuation_avx2(chars, 12);
+    const __m256i two = _mm256_or_si256(
+        _mm256_or_si256(_mm256_srli_epi32(chars, 6), _mm256_set1_epi32(0xC0)),
+        _mm256_slli_epi32(last, 8)
+    );
+    const __m256i three = _mm256_or_si256(
+        _mm256_or_si256(_mm256_srli_epi32(chars, 12), _mm256_set1_epi32(0xE0)),
+        _mm256_or_si256(_mm256_slli_epi32(middle, 8), _mm256_slli_epi32(last, 16))
+    );
+    const __m256i four = _mm256_or_si256(
+        _mm256_or_si256(_mm256_srli_epi32(chars, 18), _mm256_set1_epi32(0xF0)),
+        _mm256_or_si256(
+            _mm256_slli_epi32(upper, 8),
+            _mm256_or_si256(_mm256_slli_epi32(middle, 16), _mm256_slli_epi32(last, 24))
+        )
+    );
+
+    __m256i encoded = _mm256_blendv_epi8(chars, two, is_two_bytes);
+    encoded = _mm256_blendv_epi8(encoded, three, is_three_bytes);
+    encoded = _mm256_blendv_epi8(encoded, four, is_four_bytes);
+
+    const unsigned two_mask = (unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(is_two_bytes));
+    const unsigned three_mask = (unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(is_three_bytes));
+    const unsigned four_mask = (unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(is_four_bytes));
+
+    return nc_p_utf8_store_avx2(encoded, two_mask ^ three_mask ^ four_mask, three_mask, out);
+}
+
+// Encodes 8 code units of valid UTF-16, where previous holds code unit before each of them,
+// and returns pointer past the written bytes. Each surrogate of a pair writes half of the 4 byte encoding.
+NC_P_TRANSCODE_TARGET("avx2")
+static inline uint8_t* nc_p_utf16_encode_utf8_avx2(__m256i units, __m256i previous, uint8_t* out) {
+    const __m256i surrogate_kind_mask = _mm256_set1_epi32(0xFC00);
+    const __m256i is_two_bytes = _mm256_cmpgt_epi32(units, _mm256_set1_epi32(0x7F));
+    const __m256i is_three_bytes = _mm256_cmpgt_epi32(units, _mm256_set1_epi32(0x7FF));
+    const __m256i is_high_surrogate = _mm256_cmpeq_epi32(_mm256_and_si256(units, surrogate_kind_mask), _mm256_set1_epi32(0xD800));
+    const __m256i is_low_surrogate = _mm256_cmpeq_epi32(_mm256_and_si256(units, surrogate_kind_mask), _mm256_set1_epi32(0xDC00));
+
+    const __m256i last = nc_p_utf8_continuation_avx2(units, 0);
+    const __m256i middle = nc_p_utf8_continuation_avx2(units, 6);
+    const __m256i two = _mm256_or_si256(
+        _mm256_or_si256(_mm256_srli_epi32(units, 6), _mm256_set1_epi32(0xC0)),
+        _mm256_slli_epi32(last, 8)
+    );
+    const __m256i three = _mm256_or_si256(
+        _mm256_or_si256(_mm256_srli_epi32(units, 12), _mm256_set1_epi32(0xE0)),
+        _mm256_or_si256(_mm256_slli_epi32(middle, 8), _mm256_slli_epi32(last, 16))
+    );
+    // Bits of the codepoint from 12, adding 0x10000 doesn't carry into them
+    const __m256i plane = _mm256_add_epi32(
+        _mm256_srli_epi32(_mm256_and_si256(units, _mm256_set1_epi32(0x3FF)), 2),
+        _mm256_set1_epi32(0x10)
+    );
+    const __m256i high = _mm256_or_si256(
+        _mm256_or_si256(_mm256_srli_epi32(plane, 6), _mm256_set1_epi32(0xF0)),
+        _mm256_slli_epi32(nc_p_utf8_continuation_avx2(plane, 0), 8)
+    );
+    // Bits 10 and 11 of the codepoint are the lowest bits of the high surrogate
+    const __m256i low = _mm256_or_si256(
+        _mm256_or_si256(
+            _mm256_slli_epi32(_mm256_and_si256(previous, _mm256_set1_epi32(0x03)), 4),
+            _mm256_and_si256(_mm256_srli_epi32(units, 6), _mm256_set1_epi32(0x0F))
+        ),
+        _mm256_or_si256(_mm256_set1_epi32(0x80), _mm256_slli_epi32(last, 8))
+    );
+
+    __m256i encoded = _mm256_blendv_epi8(units, two, is_two_bytes);
+    encoded = _mm256_blendv_epi8(encoded, three, is_three_bytes);
+    encoded = _mm256_blendv_epi8(encoded, high, is_high_surrogate);
+    encoded = _mm256_blendv_epi8(encoded, low, is_low_surrogate);
+
+    const unsigned two_mask = (unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(is_two_bytes));
+    const unsigned surrogate_mask = (unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_or_si256(is_high_surrogate, is_low_surrogate)));
+    const unsigned three_mask = (unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(is_three_bytes)) & ~surrogate_mask;
+
+    return nc_p_utf8_store_avx2(encoded, two_mask ^ three_mask, three_mask, out);
+}
+
+NC_P_TRANSCODE_TARGET("avx2")
+static size_t nc_p_utf16_to_utf8_avx2(const char16_t* data, size_t count, uint8_t* out) {
+    uint8_t* current = out;
+    size_t i = 0;
+    while (count - i >= NC_P_UTF8_ENCODE_MIN_REMAINING) {
+        const __m256i units = _mm256_loadu_si256((const __m256i*)(data + i));
+        if (_mm256_testz_si256(units, _mm256_set1_epi16((short)0xFF80))) {
+            _mm_storeu_si128((__m128i*)current, _mm_packus_epi16(_mm256_castsi256_si128(units), _mm256_extracti128_si256(units, 1)));
+            current += 16;
+            i += 16;
+            continue;
+        }
+
+        const __m128i block = _mm256_castsi256_si128(units);
+        const __m128i previous = i == 0 ? _mm_slli_si128(block, 2) : _mm_loadu_si128((const __m128i*)(data + i - 1));
+        current = nc_p_utf16_encode_utf8_avx2(_mm256_cvtepu16_epi32(block), _mm256_cvtepu16_epi32(previous), current);
+        i += 8;
+    }
+
+    // Second half of a pair is written by the next block, which might not be vectorized
+    if (i > 0 && i < count && nc_p_is_high_surrogate(data[i - 1])) {
+        *current++ = (uint8_t)(0x80 | ((data[i - 1] & 0x03) << 4) | ((data[i] >> 6) & 0x0F));
+        *current++ = (uint8_t)(0x80 | (data[i] & 0x3F));
+        ++i;
+    }
+
+    return (size_t)(current - out) + nc_p_utf16_to_utf8_scalar(data, count, i, current);
+}
+
+NC_P_TRANSCODE_TARGET("avx2")
+static size_t nc_p_utf32_to_utf8_avx2(const char32_t* data, size_t count, uint8_t* out) {
+    uint8_t* current = out;
+    size_t i = 0;
+    while (count - i >= NC_P_UTF8_ENCODE_MIN_REMAINING) {
+        const __m256i low = _mm256_loadu_si256((const __m256i*)(data + i));
+        const __m256i high = _mm256_loadu_si256((const __m256i*)(data + i + 8));
+        if (_mm256_testz_si256(_mm256_or_si256(low, high), _mm256_set1_epi32(~0x7F))) {
+            const __m128i low_units = _mm_packus_epi32(_mm256_castsi256_si128(low), _mm256_extracti128_si256(low, 1));
+            const __m128i high_units = _mm_packus_epi32(_mm256_castsi256_si128(high), _mm256_extracti128_si256(high, 1));
+            _mm_storeu_si128((__m128i*)current, _mm_packus_epi16(low_units, high_units));
+            current += 16;
+            i += 16;
+            continue;
+        }
+
+        current = nc_p_utf32_encode_utf8_avx2(low, current);
+        i += 8;
+    }
+
+    return (size_t)(current - out) + nc_p_utf32_to_utf8_scalar(data, count, i, current);
+}
+
+static bool nc_p_has_avx2() {
+    return __builtin_cpu_supports("avx2");
+}
+#endif
+
+
+bool nc_utf16_is_valid(const char16_t* data, size_t count) {
+#ifdef NC_P_TRANSCODE_X86
+    if (nc_p_has_avx2())
+        return nc_p_utf16_is_valid_avx2(data, count);
+#endif
+
+    return nc_p_utf16_is_valid_scalar(data, count, 0);
+}
+
+bool nc_utf32_is_valid(const char32_t* data, size_t count) {
+#ifdef NC_P_TRANSCODE_X86
+    if (nc_p_has_avx2())
+        return nc_p_utf32_is_valid_avx2(data, count);
+#endif
+
+    for (size_t i = 0; i < count; ++i) {
+        if (!nc_is_valid_unicode_codepoint(data[i]))
+            return false;
+    }
+
+    return true;
+}
+
+size_t nc_utf8_utf16_length(const uint8_t* data, size_t size) {
+#ifdef NC_P_TRANSCODE_X86
+    if (nc_p_has_avx2())
+        return nc_p_utf8_utf16_length_avx2(data, size);
+#endif
+
+    return nc_p_utf8_utf16_length_scalar(data, size);
+}
+
+size_t nc_utf8_utf32_length(const uint8_t* data, size_t size) {
+    return nc_utf8_count_codepoints(data, size);
+}
+
+size_t nc_utf16_utf8_length(const char16_t* data, size_t count) {
+#ifdef NC_P_TRANSCODE_X86
+    if (nc_p_has_avx2())
+        return nc_p_utf16_utf8_length_avx2(data, count);
+#endif
+
+    return nc_p_utf16_utf8_length_scalar(data, count);
+}
+
+size_t nc_utf32_utf8_length(const char32_t* data, size_t count) {
+#ifdef NC_P_TRANSCODE_X86
+    if (nc_p_has_avx2())
+        return nc_p_utf32_utf8_length_avx2(data, count);
+#endif
+
+    return nc_p_utf32_utf8_length_scalar(data, count);
+}
+
+size_t nc_utf8_to_utf16(const uint8_t* data, size_t size, char16_t* out) {
+#ifdef NC_P_TRANSCODE_X86
+    if (nc_p_has_avx2())
+        return nc_p_utf8_to_utf16_avx2(data, size, out);
+#endif
+
+    return nc_p_utf8_to_utf16_scalar(data, size, 0, out);
+}
+
+size_t nc_utf8_to_utf32(const uint8_t* data, size_t size, char32_t* out) {
+#ifdef NC_P_TRANSCODE_X86
+    if (nc_p_has_avx2())
+        return nc_p_utf8_to_utf32_avx2(data, size, out);
+#endif
+
+    return nc_p_utf8_to_utf32_scalar(data, size, 0, out);
+}
+
+size_t nc_utf16_to_utf8(const char16_t* data, size_t count, uint8_t* out) {
+#ifdef NC_P_TRANSCODE_X86
+    if (nc_p_has_avx2())
+        return nc_p_utf16_to_utf8_avx2(data, count, out);
+#endif
+
+    return nc_p_utf16_to_utf8_scalar(data, count, 0, out);
+}
+
+size_t nc_utf32_to_utf8(const char32_t* data, size_t count, uint8_t* out) {
+#ifdef NC_P_TRANSCODE_X86
+    if (nc_p_has_avx2())
+        return nc_p_utf32_to_utf8_avx2(data, count, out);
+#endif
+
+    return nc_p_utf32_to_utf8_scalar(data, count, 0, out);
+}
+
+
+// Allocates string of exact size, returns false if allocation has failed
+static bool nc_p_string_with_size(size_t size, NC_Allocator* allocator, NC_String* out_string) {
+    NC_INTERNAL_ALLOC_STATS_SITE_ENTER();
+    NC_RawBuffer raw_buffer = nc_raw_buffer_init_with_capacity_in(size + 1, sizeof(char), allocator);
+    NC_INTERNAL_ALLOC_STATS_SITE_LEAVE();
+    if (nc_raw_buffer_data(&raw_buffer) == NULL)
+        return false;
+
+    ((char*)nc_raw_buffer_data(&raw_buffer))[size] = '\0';
+    *out_string = (NC_String) { .p = { .raw_buffer = raw_buffer, .size = size } };
+
+    return true;
+}
+
+NC_OPTION(NC_String) nc_string_from_utf16(const char16_t* data, size_t count) {
+    return nc_string_from_utf16_in(data, count, nc_allocator_default());
+}
+
+NC_OPTION(NC_String) nc_string_from_utf16_in(const char16_t* data, size_t count, NC_Allocator* allocator) {
+    if (!nc_utf16_is_valid(data, count))
+        return nc_option_string_init_none();
+
+    NC_String string;
+    if (!nc_p_string_with_size(nc_utf16_utf8_length(data, count), allocator, &string))
+        return nc_option_string_init_none();
+    nc_utf16_to_utf8(data, count, nc_raw_buffer_data(&string.p.raw_buffer));
+
+    return nc_option_string_init_some(string);
+}
+
+NC_OPTION(NC_String) nc_string_from_utf32(const char32_t* data, size_t count) {
+    return nc_string_from_utf32_in(data, count, nc_allocator_default());
+}
+
+NC_OPTION(NC_String) nc_string_from_utf32_in(const char32_t* data, size_t count, NC_Allocator* allocator) {
+    if (!nc_utf32_is_valid(data, count))
+        return nc_option_string_init_none();
+
+    NC_String string;
+    if (!nc_p_string_with_size(nc_utf32_utf8_length(data, count), allocator, &string))
+        return nc_option_string_init_none();
+    nc_utf32_to_utf8(data, count, nc_raw_buffer_data(&string.p.raw_buffer));
+
+    return nc_option_string_init_some(string);
+}
+
+// Grows buffer to hold exactly required_capacity objects if it's smaller, returns false if allocation has failed
+static bool nc_p_transcode_reserve(NC_RawBuffer* buffer, size_t required_capacity, size_t object_size) {
+    if (nc_raw_buffer_capacity(buffer) >= required_capacity)
+        return true;
+
+    NC_INTERNAL_ALLOC_STATS_SITE_ENTER();
+    nc_raw_buffer_resize_unchecked(buffer, required_capacity, object_size);
+    NC_INTERNAL_ALLOC_STATS_SITE_LEAVE();
+
+    return nc_raw_buffer_capacity(buffer) >= required_capacity;
+}
+
+bool nc_string_view_to_utf16(NC_StringView string_view, NC_RawBuffer* buffer, size_t* out_count) {
+    const uint8_t* const bytes = (const uint8_t*)nc_string_view_bytes(string_view);
+    const size_t size = nc_string_view_size(string_view);
+    if (!nc_p_transcode_reserve(buffer, nc_utf8_utf16_length(bytes, size), sizeof(char16_t)))
+        return false;
+
+    *out_count = nc_utf8_to_utf16(bytes, size, nc_raw_buffer_data(buffer));
+
+    return true;
+}
+
+bool nc_string_view_to_utf32(NC_StringView string_view, NC_RawBuffer* buffer, size_t* out_count) {
+    const uint8_t* const bytes = (const uint8_t*)nc_string_view_bytes(string_view);
+    const size_t size = nc_string_view_size(string_view);
+    if (!nc_p_transcode_reserve(buffer, nc_utf8_utf32_length(bytes, size), sizeof(char32_t)))
+        return false;
+
+    *out_count = nc_utf8_to_utf32(bytes, size, nc_raw_buffer_data(buffer));
+
+    return true;
+}
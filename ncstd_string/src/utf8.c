@@ -1,5 +1,13 @@
 #include "ncstd/utf8.h"
 
+#include <string.h>
+
+// Vector validators are compiled for their target regardless of compiler flags, and selected at runtime
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define NC_P_UTF8_X86
+#define NC_P_UTF8_TARGET(features) __attribute__((target(features)))
+#include <immintrin.h>
+#endif
 
 static const uint8_t CONTINUATION_BYTE_MARKER = 0b10000000;
 static const uint8_t CONTINUATION_BYTE_MASK = 0b00111111;
@@ -59,56 +67,446 @@ bool nc_is_valid_unicode_codepoint(char32_t ch) {
     return true;
 }
 
-bool nc_utf8_is_valid(const uint8_t* data, size_t size) {
+bool nc_utf8_is_valid_scalar(const uint8_t* data, size_t size) {
     size_t i = 0;
     while (i < size) {
-        const uint8_t leading_byte = data[i++];
-
-        const size_t char_width = nc_utf8_character_width(leading_byte);
-        if (char_width == 1)
+        const uint8_t leading_byte = data[i];
+        if (leading_byte < 0x80) {
+            // Skip ASCII a word at a time
+            uint64_t word;
+            while (size - i >= sizeof(word)) {
+                memcpy(&word, data + i, sizeof(word));
+                if ((word & UINT64_C(0x8080808080808080)) != 0)
+                    break;
+                i += sizeof(word);
+            }
+            if (i < size && data[i] < 0x80)
+                ++i;
             continue;
+        }
 
-        if (i + char_width - 1 >= size)
+        // Ranges of the second byte exclude overlong encodings, surrogates and codepoints above U+10FFFF
+        size_t char_width;
+        uint8_t byte2_min = 0x80;
+        uint8_t byte2_max = 0xBF;
+        if (leading_byte >= 0xC2 && leading_byte <= 0xDF) {
+            char_width = 2;
+        } else if (leading_byte >= 0xE0 && leading_byte <= 0xEF) {
+            char_width = 3;
+            if (leading_byte == 0xE0)
+                byte2_min = 0xA0;
+            else if (leading_byte == 0xED)
+                byte2_max = 0x9F;
+        } else if (leading_byte >= 0xF0 && leading_byte <= 0xF4) {
+            char_width = 4;
+            if (leading_byte == 0xF0)
+                byte2_min = 0x90;
+            else if (leading_byte == 0xF4)
+                byte2_max = 0x8F;
+        } else {
             return false;
+        }
 
-        const uint8_t byte2 = data[i++];
-        switch (char_width) {
-            case 2:
-                if (!nc_utf8_is_continuation_byte(byte2))
-                    return false;
+        if (size - i < char_width)
+            return false;
 
-                break;
-            
-            case 3:
-                if (leading_byte == 0xE0 && (byte2 < 0xA0 || byte2 > 0xBF) ||
-                    leading_byte == 0xED && (byte2 < 0x80 || byte2 > 0x9F) ||
-                    !nc_utf8_is_continuation_byte(byte2))
-                    return false;
+        if (data[i + 1] < byte2_min || data[i + 1] > byte2_max)
+            return false;
+        if (char_width >= 3 && !nc_utf8_is_continuation_byte(data[i + 2]))
+            return false;
+        if (char_width == 4 && !nc_utf8_is_continuation_byte(data[i + 3]))
+            return false;
 
-                if (!nc_utf8_is_continuation_byte(data[i++]))
-                    return false;
+        i += char_width;
+    }
 
-                break;
+    return true;
+}
 
-            case 4:
-                if (leading_byte == 0xF0 && (byte2 < 0x90 || byte2 > 0xBF) ||
-                    leading_byte == 0xF3 && (byte2 < 0x80 || byte2 > 0x8F) ||
-                    !nc_utf8_is_continuation_byte(byte2))
-                    return false;
+#ifdef NC_P_UTF8_X86
+// Vectorized validation from "Validating UTF-8 In Less Than One Instruction Per Byte" (Keiser, Lemire).
+// High and low nibbles of each byte and high nibble of the byte before it index three tables,
+// whose AND has a bit set for every error that pair of bytes can form.
+// Continuations required by 3 and 4 byte sequences are checked separately.
+
+// Second byte is not a continuation when it should be
+#define NC_P_UTF8_TOO_SHORT (1 << 0)
+// Continuation without a leading byte
+#define NC_P_UTF8_TOO_LONG (1 << 1)
+#define NC_P_UTF8_OVERLONG_3 (1 << 2)
+#define NC_P_UTF8_TOO_LARGE (1 << 3)
+#define NC_P_UTF8_SURROGATE (1 << 4)
+#define NC_P_UTF8_OVERLONG_2 (1 << 5)
+#define NC_P_UTF8_TOO_LARGE_1000 (1 << 6)
+#define NC_P_UTF8_OVERLONG_4 (1 << 6)
+// Two continuations in a row, valid only inside 3 and 4 byte sequences
+#define NC_P_UTF8_TWO_CONTINUATIONS (1 << 7)
+#define NC_P_UTF8_CARRY (NC_P_UTF8_TOO_SHORT | NC_P_UTF8_TOO_LONG | NC_P_UTF8_TWO_CONTINUATIONS)
+
+// Indexed by high nibble of the first byte
+static const uint8_t NC_P_UTF8_BYTE1_HIGH[16] = {
+    // 0xxx ASCII
+    NC_P_UTF8_TOO_LONG, NC_P_UTF8_TOO_LONG, NC_P_UTF8_TOO_LONG, NC_P_UTF8_TOO_LONG,
+    NC_P_UTF8_TOO_LONG, NC_P_UTF8_TOO_LONG, NC_P_UTF8_TOO_LONG, NC_P_UTF8_TOO_LONG,
+    // 10xx continuation
+    NC_P_UTF8_TWO_CONTINUATIONS, NC_P_UTF8_TWO_CONTINUATIONS, NC_P_UTF8_TWO_CONTINUATIONS, NC_P_UTF8_TWO_CONTINUATIONS,
+    // 1100 two byte leading byte
+    NC_P_UTF8_TOO_SHORT | NC_P_UTF8_OVERLONG_2,
+    // 1101 two byte leading byte
+    NC_P_UTF8_TOO_SHORT,
+    // 1110 three byte leading byte
+    NC_P_UTF8_TOO_SHORT | NC_P_UTF8_OVERLONG_3 | NC_P_UTF8_SURROGATE,
+    // 1111 four byte leading byte
+    NC_P_UTF8_TOO_SHORT | NC_P_UTF8_TOO_LARGE | NC_P_UTF8_TOO_LARGE_1000 | NC_P_UTF8_OVERLONG_4
+};
+
+// Indexed by low nibble of the first byte
+static const uint8_t NC_P_UTF8_BYTE1_LOW[16] = {
+    // xxxx0000
+    NC_P_UTF8_CARRY | NC_P_UTF8_OVERLONG_3 | NC_P_UTF8_OVERLONG_2 | NC_P_UTF8_OVERLONG_4,
+    // xxxx0001
+    NC_P_UTF8_CARRY | NC_P_UTF8_OVERLONG_2,
+    // xxxx001x
+    NC_P_UTF8_CARRY,
+    NC_P_UTF8_CARRY,
+    // xxxx0100
+    NC_P_UTF8_CARRY | NC_P_UTF8_TOO_LARGE,
+    // xxxx0101 - xxxx1100
+    NC_P_UTF8_CARRY | NC_P_UTF8_TOO_LARGE | NC_P_UTF8_TOO_LARGE_1000,
+    NC_P_UTF8_CARRY | NC_P_UTF8_TOO_LARGE | NC_P_UTF8_TOO_LARGE_1000,
+    NC_P_UTF8_CARRY | NC_P_UTF8_TOO_LARGE | NC_P_UTF8_TOO_LARGE_1000,
+    NC_P_UTF8_CARRY | NC_P_UTF8_TOO_LARGE | NC_P_UTF8_TOO_LARGE_1000,
+    NC_P_UTF8_CARRY | NC_P_UTF8_TOO_LARGE | NC_P_UTF8_TOO_LARGE_1000,
+    NC_P_UTF8_CARRY | NC_P_UTF8_TOO_LARGE | NC_P_UTF8_TOO_LARGE_1000,
+    NC_P_UTF8_CARRY | NC_P_UTF8_TOO_LARGE | NC_P_UTF8_TOO_LARGE_1000,
+    NC_P_UTF8_CARRY | NC_P_UTF8_TOO_LARGE | NC_P_UTF8_TOO_LARGE_1000,
+    // xxxx1101
+    NC_P_UTF8_CARRY | NC_P_UTF8_TOO_LARGE | NC_P_UTF8_TOO_LARGE_1000 | NC_P_UTF8_SURROGATE,
+    // xxxx111x
+    NC_P_UTF8_CARRY | NC_P_UTF8_TOO_LARGE | NC_P_UTF8_TOO_LARGE_1000,
+    NC_P_UTF8_CARRY | NC_P_UTF8_TOO_LARGE | NC_P_UTF8_TOO_LARGE_1000
+};
+
+// Indexed by high nibble of the second byte
+static const uint8_t NC_P_UTF8_BYTE2_HIGH[16] = {
+    // 0xxx ASCII
+    NC_P_UTF8_TOO_SHORT, NC_P_UTF8_TOO_SHORT, NC_P_UTF8_TOO_SHORT, NC_P_UTF8_TOO_SHORT,
+    NC_P_UTF8_TOO_SHORT, NC_P_UTF8_TOO_SHORT, NC_P_UTF8_TOO_SHORT, NC_P_UTF8_TOO_SHORT,
+    // 1000 continuation
+    NC_P_UTF8_TOO_LONG | NC_P_UTF8_OVERLONG_2 | NC_P_UTF8_TWO_CONTINUATIONS | NC_P_UTF8_OVERLONG_3 |
+        NC_P_UTF8_TOO_LARGE_1000 | NC_P_UTF8_OVERLONG_4,
+    // 1001 continuation
+    NC_P_UTF8_TOO_LONG | NC_P_UTF8_OVERLONG_2 | NC_P_UTF8_TWO_CONTINUATIONS | NC_P_UTF8_OVERLONG_3 | NC_P_UTF8_TOO_LARGE,
+    // 101x continuation
+    NC_P_UTF8_TOO_LONG | NC_P_UTF8_OVERLONG_2 | NC_P_UTF8_TWO_CONTINUATIONS | NC_P_UTF8_SURROGATE | NC_P_UTF8_TOO_LARGE,
+    NC_P_UTF8_TOO_LONG | NC_P_UTF8_OVERLONG_2 | NC_P_UTF8_TWO_CONTINUATIONS | NC_P_UTF8_SURROGATE | NC_P_UTF8_TOO_LARGE,
+    // 11xx leading byte
+    NC_P_UTF8_TOO_SHORT, NC_P_UTF8_TOO_SHORT, NC_P_UTF8_TOO_SHORT, NC_P_UTF8_TOO_SHORT
+};
+
+// Last bytes of a block above these values start a sequence that continues in the next block
+static const uint8_t NC_P_UTF8_INCOMPLETE_MAX[32] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0 - 1, 0xE0 - 1, 0xC0 - 1
+};
+
+NC_P_UTF8_TARGET("sse4.1")
+static __m128i nc_p_utf8_check_block_sse(__m128i input, __m128i prev_input) {
+    const __m128i nibble_mask = _mm_set1_epi8(0x0F);
+    const __m128i prev1 = _mm_alignr_epi8(input, prev_input, 16 - 1);
+
+    const __m128i byte1_high = _mm_shuffle_epi8(
+        _mm_loadu_si128((const __m128i*)NC_P_UTF8_BYTE1_HIGH),
+        _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble_mask)
+    );
+    const __m128i byte1_low = _mm_shuffle_epi8(
+        _mm_loadu_si128((const __m128i*)NC_P_UTF8_BYTE1_LOW),
+        _mm_and_si128(prev1, nibble_mask)
+    );
+    const __m128i byte2_high = _mm_shuffle_epi8(
+        _mm_loadu_si128((const __m128i*)NC_P_UTF8_BYTE2_HIGH),
+        _mm_and_si128(_mm_srli_epi16(input, 4), nibble_mask)
+    );
+    const __m128i special_cases = _mm_and_si128(_mm_and_si128(byte1_high, byte1_low), byte2_high);
+
+    // Bytes two after 3 byte and three after 4 byte leading bytes must be continuations (high bit set after subtraction)
+    const __m128i prev2 = _mm_alignr_epi8(input, prev_input, 16 - 2);
+    const __m128i prev3 = _mm_alignr_epi8(input, prev_input, 16 - 3);
+    const __m128i is_third_byte = _mm_subs_epu8(prev2, _mm_set1_epi8((char)(0xE0 - 0x80)));
+    const __m128i is_fourth_byte = _mm_subs_epu8(prev3, _mm_set1_epi8((char)(0xF0 - 0x80)));
+    const __m128i must_be_continuation = _mm_and_si128(_mm_or_si128(is_third_byte, is_fourth_byte), _mm_set1_epi8((char)0x80));
+
+    return _mm_xor_si128(must_be_continuation, special_cases);
+}
 
-                if (!nc_utf8_is_continuation_byte(data[i++]))
-                    return false;
-                if (!nc_utf8_is_continuation_byte(data[i++]))
-                    return false;
+NC_P_UTF8_TARGET("sse4.1")
+static bool nc_p_utf8_is_valid_sse(const uint8_t* data, size_t size) {
+    __m128i error = _mm_setzero_si128();
+    __m128i prev_input = _mm_setzero_si128();
+    __m128i prev_incomplete = _mm_setzero_si128();
+    const __m128i incomplete_max = _mm_loadu_si128((const __m128i*)(NC_P_UTF8_INCOMPLETE_MAX + 16));
 
-                break;
+    size_t i = 0;
+    for (; i < size; i += 16) {
+        __m128i input;
+        if (size - i >= 16) {
+            input = _mm_loadu_si128((const __m128i*)(data + i));
+        } else {
+            // Padding with zeros (ASCII) reports sequences cut at the end as too short
+            uint8_t tail[16] = { 0 };
+            memcpy(tail, data + i, size - i);
+            input = _mm_loadu_si128((const __m128i*)tail);
+        }
 
-            default:
-                return false;
+        if (_mm_movemask_epi8(input) == 0) {
+            error = _mm_or_si128(error, prev_incomplete);
+        } else {
+            error = _mm_or_si128(error, nc_p_utf8_check_block_sse(input, prev_input));
+            prev_incomplete = _mm_subs_epu8(input, incomplete_max);
         }
+        prev_input = input;
     }
-    
-    return true;
+    error = _mm_or_si128(error, prev_incomplete);
+
+    return _mm_testz_si128(error, error);
+}
+
+NC_P_UTF8_TARGET("avx2")
+static __m256i nc_p_utf8_check_block_avx2(__m256i input, __m256i prev_input) {
+    const __m256i nibble_mask = _mm256_set1_epi8(0x0F);
+    // Shifts across 128-bit lanes need the upper lane of the previous block next to the lower lane of the input
+    const __m256i prev_shifted = _mm256_permute2x128_si256(prev_input, input, 0x21);
+    const __m256i prev1 = _mm256_alignr_epi8(input, prev_shifted, 16 - 1);
+
+    const __m256i byte1_high = _mm256_shuffle_epi8(
+        _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)NC_P_UTF8_BYTE1_HIGH)),
+        _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble_mask)
+    );
+    const __m256i byte1_low = _mm256_shuffle_epi8(
+        _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)NC_P_UTF8_BYTE1_LOW)),
+        _mm256_and_si256(prev1, nibble_mask)
+    );
+    const __m256i byte2_high = _mm256_shuffle_epi8(
+        _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)NC_P_UTF8_BYTE2_HIGH)),
+        _mm256_and_si256(_mm256_srli_epi16(input, 4), nibble_mask)
+    );
+    const __m256i special_cases = _mm256_and_si256(_mm256_and_si256(byte1_high, byte1_low), byte2_high);
+
+    const __m256i prev2 = _mm256_alignr_epi8(input, prev_shifted, 16 - 2);
+    const __m256i prev3 = _mm256_alignr_epi8(input, prev_shifted, 16 - 3);
+    const __m256i is_third_byte = _mm256_subs_epu8(prev2, _mm256_set1_epi8((char)(0xE0 - 0x80)));
+    const __m256i is_fourth_byte = _mm256_subs_epu8(prev3, _mm256_set1_epi8((char)(0xF0 - 0x80)));
+    const __m256i must_be_continuation = _mm256_and_si256(
+        _mm256_or_si256(is_third_byte, is_fourth_byte),
+        _mm256_set1_epi8((char)0x80)
+    );
+
+    return _mm256_xor_si256(must_be_continuation, special_cases);
+}
+
+NC_P_UTF8_TARGET("avx2")
+static bool nc_p_utf8_is_valid_avx2(const uint8_t* data, size_t size) {
+    __m256i error = _mm256_setzero_si256();
+    __m256i prev_input = _mm256_setzero_si256();
+    __m256i prev_incomplete = _mm256_setzero_si256();
+    const __m256i incomplete_max = _mm256_loadu_si256((const __m256i*)NC_P_UTF8_INCOMPLETE_MAX);
+
+    size_t i = 0;
+    for (; i < size; i += 32) {
+        __m256i input;
+        if (size - i >= 32) {
+            input = _mm256_loadu_si256((const __m256i*)(data + i));
+        } else {
+            uint8_t tail[32] = { 0 };
+            memcpy(tail, data + i, size - i);
+            input = _mm256_loadu_si256((const __m256i*)tail);
+        }
+
+        if (_mm256_movemask_epi8(input) == 0) {
+            error = _mm256_or_si256(error, prev_incomplete);
+        } else {
+            error = _mm256_or_si256(error, nc_p_utf8_check_block_avx2(input, prev_input));
+            prev_incomplete = _mm256_subs_epu8(input, incomplete_max);
+        }
+        prev_input = input;
+    }
+    error = _mm256_or_si256(error, prev_incomplete);
+
+    return _mm256_testz_si256(error, error);
+}
+#endif
+
+bool nc_utf8_is_valid(const uint8_t* data, size_t size) {
+#ifdef NC_P_UTF8_X86
+    // Short inputs aren't worth a vector pass over the padded tail
+    if (size >= 16) {
+        if (__builtin_cpu_supports("avx2"))
+            return nc_p_utf8_is_valid_avx2(data, size);
+        if (__builtin_cpu_supports("sse4.1"))
+            return nc_p_utf8_is_valid_sse(data, size);
+    }
+#endif
+
+    return nc_utf8_is_valid_scalar(data, size);
+}
+
+// Returns number of bytes that aren't continuations in a word, high bit is set in continuations only (10xxxxxx)
+static size_t nc_p_utf8_count_word(uint64_t word) {
+    const uint64_t continuations = (word & ~(word << 1)) & UINT64_C(0x8080808080808080);
+
+    // Sums high bits of all bytes into the top byte
+    return sizeof(word) - (size_t)(((continuations >> 7) * UINT64_C(0x0101010101010101)) >> 56);
+}
+
+size_t nc_utf8_count_codepoints_scalar(const uint8_t* data, size_t size) {
+    size_t count = 0;
+    size_t i = 0;
+    for (; size - i >= sizeof(uint64_t); i += sizeof(uint64_t)) {
+        uint64_t word;
+        memcpy(&word, data + i, sizeof(word));
+        count += nc_p_utf8_count_word(word);
+    }
+    for (; i < size; ++i)
+        count += !nc_utf8_is_continuation_byte(data[i]);
+
+    return count;
+}
+
+// Finishes search started by vectorized versions at block granularity
+static size_t nc_p_utf8_char_to_byte_scalar(const uint8_t* data, size_t size, size_t i, size_t char_index) {
+    for (; size - i >= sizeof(uint64_t); i += sizeof(uint64_t)) {
+        uint64_t word;
+        memcpy(&word, data + i, sizeof(word));
+        const size_t count = nc_p_utf8_count_word(word);
+        if (count > char_index)
+            break;
+
+        char_index -= count;
+    }
+
+    for (; i < size; ++i) {
+        if (nc_utf8_is_continuation_byte(data[i]))
+            continue;
+        if (char_index == 0)
+            return i;
+
+        --char_index;
+    }
+
+    return size;
+}
+
+#ifdef NC_P_UTF8_X86
+// Bytes of continuations are -128 to -65 when treated as signed, so everything greater than -65 starts a codepoint.
+// Counts are accumulated as bytes, and summed before they can overflow.
+#define NC_P_UTF8_MAX_BYTE_SUM_BLOCKS 255
+
+NC_P_UTF8_TARGET("sse2")
+static size_t nc_p_utf8_count_codepoints_sse(const uint8_t* data, size_t size) {
+    const __m128i threshold = _mm_set1_epi8(-65);
+    size_t count = 0;
+    size_t i = 0;
+    while (size - i >= 16) {
+        __m128i sums = _mm_setzero_si128();
+        for (size_t block = 0; block < NC_P_UTF8_MAX_BYTE_SUM_BLOCKS && size - i >= 16; ++block, i += 16) {
+            // Comparison results are -1 for every starting byte
+            const __m128i input = _mm_loadu_si128((const __m128i*)(data + i));
+            sums = _mm_sub_epi8(sums, _mm_cmpgt_epi8(input, threshold));
+        }
+
+        const __m128i totals = _mm_sad_epu8(sums, _mm_setzero_si128());
+        count += (size_t)_mm_cvtsi128_si32(totals) + (size_t)_mm_cvtsi128_si32(_mm_unpackhi_epi64(totals, totals));
+    }
+
+    return count + nc_utf8_count_codepoints_scalar(data + i, size - i);
+}
+
+NC_P_UTF8_TARGET("sse2")
+static size_t nc_p_utf8_char_to_byte_sse(const uint8_t* data, size_t size, size_t char_index) {
+    const __m128i threshold = _mm_set1_epi8(-65);
+    size_t i = 0;
+    for (; size - i >= 16; i += 16) {
+        const __m128i input = _mm_loadu_si128((const __m128i*)(data + i));
+        const __m128i starts = _mm_sub_epi8(_mm_setzero_si128(), _mm_cmpgt_epi8(input, threshold));
+        const __m128i totals = _mm_sad_epu8(starts, _mm_setzero_si128());
+        const size_t count = (size_t)_mm_cvtsi128_si32(totals) + (size_t)_mm_cvtsi128_si32(_mm_unpackhi_epi64(totals, totals));
+        if (count > char_index)
+            break;
+
+        char_index -= count;
+    }
+
+    return nc_p_utf8_char_to_byte_scalar(data, size, i, char_index);
+}
+
+NC_P_UTF8_TARGET("avx2")
+static size_t nc_p_utf8_sum_avx2(__m256i sums) {
+    const __m256i totals = _mm256_sad_epu8(sums, _mm256_setzero_si256());
+    const __m128i halves = _mm_add_epi64(_mm256_castsi256_si128(totals), _mm256_extracti128_si256(totals, 1));
+
+    return (size_t)_mm_cvtsi128_si32(halves) + (size_t)_mm_cvtsi128_si32(_mm_unpackhi_epi64(halves, halves));
+}
+
+NC_P_UTF8_TARGET("avx2")
+static size_t nc_p_utf8_count_codepoints_avx2(const uint8_t* data, size_t size) {
+    const __m256i threshold = _mm256_set1_epi8(-65);
+    size_t count = 0;
+    size_t i = 0;
+    while (size - i >= 32) {
+        __m256i sums = _mm256_setzero_si256();
+        for (size_t block = 0; block < NC_P_UTF8_MAX_BYTE_SUM_BLOCKS && size - i >= 32; ++block, i += 32) {
+            const __m256i input = _mm256_loadu_si256((const __m256i*)(data + i));
+            sums = _mm256_sub_epi8(sums, _mm256_cmpgt_epi8(input, threshold));
+        }
+
+        count += nc_p_utf8_sum_avx2(sums);
+    }
+
+    return count + nc_utf8_count_codepoints_scalar(data + i, size - i);
+}
+
+NC_P_UTF8_TARGET("avx2")
+static size_t nc_p_utf8_char_to_byte_avx2(const uint8_t* data, size_t size, size_t char_index) {
+    const __m256i threshold = _mm256_set1_epi8(-65);
+    size_t i = 0;
+    for (; size - i >= 32; i += 32) {
+        const __m256i input = _mm256_loadu_si256((const __m256i*)(data + i));
+        const size_t count = nc_p_utf8_sum_avx2(_mm256_sub_epi8(_mm256_setzero_si256(), _mm256_cmpgt_epi8(input, threshold)));
+        if (count > char_index)
+            break;
+
+        char_index -= count;
+    }
+
+    return nc_p_utf8_char_to_byte_scalar(data, size, i, char_index);
+}
+#endif
+
+size_t nc_utf8_count_codepoints(const uint8_t* data, size_t size) {
+#ifdef NC_P_UTF8_X86
+    if (size >= 32) {
+        if (__builtin_cpu_supports("avx2"))
+            return nc_p_utf8_count_codepoints_avx2(data, size);
+        if (__builtin_cpu_supports("sse2"))
+            return nc_p_utf8_count_codepoints_sse(data, size);
+    }
+#endif
+
+    return nc_utf8_count_codepoints_scalar(data, size);
+}
+
+size_t nc_utf8_char_to_byte(const uint8_t* data, size_t size, size_t char_index) {
+#ifdef NC_P_UTF8_X86
+    // Codepoints are at least one byte, so short distances are never worth a vector pass
+    if (size >= 32 && char_index >= 32) {
+        if (__builtin_cpu_supports("avx2"))
+            return nc_p_utf8_char_to_byte_avx2(data, size, char_index);
+        if (__builtin_cpu_supports("sse2"))
+            return nc_p_utf8_char_to_byte_sse(data, size, char_index);
+    }
+#endif
+
+    return nc_p_utf8_char_to_byte_scalar(data, size, 0, char_index);
 }
 
 size_t nc_utf8_encode_char_unchecked(uint8_t* data, char32_t ch) {
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <string.h>
+
+#include "ncstd/allocator.h"
+
+
+// Allocator that moves every reallocation, so stale pointers into the old block are detected
+typedef struct {
+    NC_Allocator allocator;
+    size_t move_count;
+} TestMovingAllocator;
+
+static void* test_moving_alloc(NC_Allocator* allocator, size_t size, size_t alignment) {
+    (void)allocator;
+
+    return nc_allocator_alloc(nc_allocator_default(), size, alignment);
+}
+
+static void* test_moving_realloc(NC_Allocator* allocator, void* ptr, size_t old_size, size_t new_size, size_t alignment) {
+    TestMovingAllocator* const self = (TestMovingAllocator*)allocator;
+
+    void* const new_ptr = nc_allocator_alloc(nc_allocator_default(), new_size, alignment);
+    if (new_ptr == NULL)
+        return NULL;
+
+    memcpy(new_ptr, ptr, old_size < new_size ? old_size : new_size);
+    nc_allocator_free(nc_allocator_default(), ptr, old_size, alignment);
+    self->move_count += 1;
+
+    return new_ptr;
+}
+
+static void test_moving_free(NC_Allocator* allocator, void* ptr, size_t size, size_t alignment) {
+    (void)allocator;
+
+    nc_allocator_free(nc_allocator_default(), ptr, size, alignment);
+}
+
+static const NC_AllocatorVtable TEST_MOVING_ALLOCATOR_VTABLE = {
+    .alloc_fn = test_moving_alloc,
+    .realloc_fn = test_moving_realloc,
+    .free_fn = test_moving_free
+};
+
+static TestMovingAllocator test_moving_allocator_init() {
+    return (TestMovingAllocator) { .allocator = { .vtable = &TEST_MOVING_ALLOCATOR_VTABLE } };
+}
+
+// Allocator that fails once the budget of allocations is spent, and counts live allocations to detect leaks
+typedef struct {
+    NC_Allocator allocator;
+    size_t remaining;
+    size_t live_count;
+} TestFailingAllocator;
+
+static void* test_failing_alloc(NC_Allocator* allocator, size_t size, size_t alignment) {
+    TestFailingAllocator* const self = (TestFailingAllocator*)allocator;
+    if (self->remaining == 0)
+        return NULL;
+
+    void* const ptr = nc_allocator_alloc(nc_allocator_default(), size, alignment);
+    if (ptr != NULL) {
+        self->remaining -= 1;
+        self->live_count += 1;
+    }
+
+    return ptr;
+}
+
+static void* test_failing_realloc(NC_Allocator* allocator, void* ptr, size_t old_size, size_t new_size, size_t alignment) {
+    TestFailingAllocator* const self = (TestFailingAllocator*)allocator;
+    if (self->remaining == 0)
+        return NULL;
+
+    void* const new_ptr = nc_allocator_realloc(nc_allocator_default(), ptr, old_size, new_size, alignment);
+    if (new_ptr != NULL)
+        self->remaining -= 1;
+
+    return new_ptr;
+}
+
+static void test_failing_free(NC_Allocator* allocator, void* ptr, size_t size, size_t alignment) {
+    TestFailingAllocator* const self = (TestFailingAllocator*)allocator;
+    self->live_count -= 1;
+
+    nc_allocator_free(nc_allocator_default(), ptr, size, alignment);
+}
+
+static const NC_AllocatorVtable TEST_FAILING_ALLOCATOR_VTABLE = {
+    .alloc_fn = test_failing_alloc,
+    .realloc_fn = test_failing_realloc,
+    .free_fn = test_failing_free
+};
+
+static TestFailingAllocator test_failing_allocator_init(size_t budget) {
+    return (TestFailingAllocator) { .allocator = { .vtable = &TEST_FAILING_ALLOCATOR_VTABLE }, .remaining = budget };
+}
@@ -0,0 +1,28 @@
+#include "ncstd/test/test_common.h"
+
+#include "test_allocators.h"
+
+#include "tests/test_char_index.c"
+#include "tests/test_interner.c"
+#include "tests/test_rope.c"
+#include "tests/test_string_bloom_filter.c"
+#include "tests/test_string_hash_map.c"
+#include "tests/test_string_view.c"
+#include "tests/test_transcode.c"
+#include "tests/test_utf8.c"
+
+
+int main() {
+    int failed = 0;
+
+    failed += cmocka_run_group_tests(char_index_tests, NULL, NULL);
+    failed += cmocka_run_group_tests(interner_tests, NULL, NULL);
+    failed += cmocka_run_group_tests(rope_tests, NULL, NULL);
+    failed += cmocka_run_group_tests(string_bloom_filter_tests, NULL, NULL);
+    failed += cmocka_run_group_tests(string_hash_map_tests, NULL, NULL);
+    failed += cmocka_run_group_tests(string_view_tests, NULL, NULL);
+    failed += cmocka_run_group_tests(transcode_tests, NULL, NULL);
+    failed += cmocka_run_group_tests(utf8_tests, NULL, NULL);
+
+    return failed;
+}
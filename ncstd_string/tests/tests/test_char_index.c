@@ -0,0 +1,128 @@
+#include "ncstd/test/test_common.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "ncstd/char_index.h"
+#include "ncstd/utf8.h"
+
+
+// Fills text with characters of every encoded length, writes byte offset of every codepoint
+// and of the end into char_offsets, returns number of codepoints
+static size_t test_char_index_fill(uint8_t* text, size_t size, size_t* char_offsets) {
+    const char* const pieces[] = { "a", "\xC3\xA9", "\xE2\x82\xAC", "\xF0\x9F\x98\x80", "b", "c" };
+    size_t count = 0;
+    size_t i = 0;
+    for (size_t p = 0;; ++p) {
+        const char* const piece = pieces[p * 5 % 6];
+        const size_t length = strlen(piece);
+        if (i + length > size)
+            break;
+
+        memcpy(text + i, piece, length);
+        char_offsets[count++] = i;
+        i += length;
+    }
+    memset(text + i, 'x', size - i);
+    for (; i < size; ++i)
+        char_offsets[count++] = i;
+    char_offsets[count] = size;
+
+    return count;
+}
+
+// Compares all queries of the index with offsets of every codepoint
+static void test_char_index_check(NC_CharIndex* index, const size_t* char_offsets, size_t char_count) {
+    const size_t size = nc_string_view_size(nc_char_index_string_view(index));
+    assert_int_equal(nc_char_index_char_count(index), char_count);
+
+    for (size_t i = 0; i <= char_count; ++i) {
+        assert_int_equal(nc_char_index_char_to_byte(index, i), char_offsets[i]);
+        assert_int_equal(nc_char_index_byte_to_char(index, char_offsets[i]), i);
+    }
+    assert_int_equal(nc_char_index_char_to_byte(index, char_count + 1000), size);
+
+    // Offsets inside of a codepoint count the codepoint as before them
+    for (size_t i = 0; i < char_count; ++i) {
+        for (size_t byte = char_offsets[i] + 1; byte < char_offsets[i + 1]; ++byte)
+            assert_int_equal(nc_char_index_byte_to_char(index, byte), i + 1);
+    }
+
+    const NC_StringView slice = nc_char_index_slice(index, char_count / 3, char_count + 10);
+    assert_ptr_equal(nc_string_view_bytes(slice), nc_string_view_bytes(nc_char_index_string_view(index)) + char_offsets[char_count / 3]);
+    assert_int_equal(nc_string_view_size(slice), size - char_offsets[char_count / 3]);
+
+    // Reversed and empty ranges give empty view at begin, like nc_string_view_char_slice
+    const NC_StringView reversed = nc_char_index_slice(index, char_count / 2, char_count / 3);
+    assert_ptr_equal(nc_string_view_bytes(reversed), nc_string_view_bytes(nc_char_index_string_view(index)) + char_offsets[char_count / 2]);
+    assert_int_equal(nc_string_view_size(reversed), 0);
+    const NC_StringView empty = nc_char_index_slice(index, char_count / 3, char_count / 3);
+    assert_ptr_equal(nc_string_view_bytes(empty), nc_string_view_bytes(slice));
+    assert_int_equal(nc_string_view_size(empty), 0);
+    assert_int_equal(nc_string_view_size(nc_char_index_slice(index, char_count + 10, 0)), 0);
+}
+
+void char_index_stride_boundaries_test(void** state) {
+    (void)state;
+
+    // Sizes give codepoint counts below, at and above multiples of the stride
+    const size_t sizes[] = { 0, 1, 255, 256, 257, 600, 640, 641, 5000 };
+    uint8_t* const text = malloc(5000);
+    size_t* const char_offsets = malloc(5001 * sizeof(size_t));
+    assert_non_null(text);
+    assert_non_null(char_offsets);
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+        const size_t char_count = test_char_index_fill(text, sizes[s], char_offsets);
+        NC_CharIndex index = nc_char_index_init(nc_string_view_init_unchecked((const char*)text, sizes[s]));
+        test_char_index_check(&index, char_offsets, char_count);
+        nc_char_index_destroy(&index);
+    }
+
+    // Codepoint counts that are exact multiples of the stride
+    for (size_t multiple = 1; multiple <= 3; ++multiple) {
+        const size_t size = multiple * NC_CHAR_INDEX_STRIDE;
+        memset(text, 'a', size);
+        for (size_t i = 0; i <= size; ++i)
+            char_offsets[i] = i;
+
+        NC_CharIndex index = nc_char_index_init(nc_string_view_init_unchecked((const char*)text, size));
+        test_char_index_check(&index, char_offsets, size);
+        nc_char_index_destroy(&index);
+    }
+
+    free(text);
+    free(char_offsets);
+}
+
+void char_index_allocation_failure_test(void** state) {
+    (void)state;
+
+    uint8_t* const text = malloc(3000);
+    size_t* const char_offsets = malloc(3001 * sizeof(size_t));
+    assert_non_null(text);
+    assert_non_null(char_offsets);
+    const size_t char_count = test_char_index_fill(text, 3000, char_offsets);
+
+    // Queries fall back to scanning the whole text
+    TestFailingAllocator allocator = test_failing_allocator_init(0);
+    NC_CharIndex index = nc_char_index_init_in(nc_string_view_init_unchecked((const char*)text, 3000), &allocator.allocator);
+    test_char_index_check(&index, char_offsets, char_count);
+    assert_int_equal(allocator.live_count, 0);
+    nc_char_index_destroy(&index);
+
+    allocator.remaining = 1;
+    index = nc_char_index_init_in(nc_string_view_init_unchecked((const char*)text, 3000), &allocator.allocator);
+    test_char_index_check(&index, char_offsets, char_count);
+    assert_int_equal(allocator.live_count, 1);
+    nc_char_index_destroy(&index);
+    assert_int_equal(allocator.live_count, 0);
+
+    free(text);
+    free(char_offsets);
+}
+
+static const struct CMUnitTest char_index_tests[] = {
+    cmocka_unit_test(char_index_stride_boundaries_test),
+    cmocka_unit_test(char_index_allocation_failure_test)
+};
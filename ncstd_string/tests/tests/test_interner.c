@@ -0,0 +1,150 @@
+#include "ncstd/test/test_common.h"
+
+#include <stdio.h>
+
+#include "ncstd/interner.h"
+
+
+void interner_same_symbol_test(void** state) {
+    (void)state;
+
+    NC_Interner interner = nc_interner_init();
+    NC_Symbol apple, pear, again;
+    assert_true(nc_interner_intern(&interner, nc_string_view_from_cstr("apple"), &apple));
+    assert_true(nc_interner_intern(&interner, nc_string_view_from_cstr("pear"), &pear));
+    assert_int_equal(apple, 0);
+    assert_int_equal(pear, 1);
+
+    // Equal bytes from a different buffer map to the same symbol
+    const char text[] = "pineapple";
+    assert_true(nc_interner_intern(&interner, nc_string_view_init_unchecked(text + 4, 5), &again));
+    assert_int_equal(again, apple);
+    assert_int_equal(nc_interner_size(&interner), 2);
+
+    // Prefix and empty string are distinct symbols
+    NC_Symbol prefix, empty;
+    assert_true(nc_interner_intern(&interner, nc_string_view_init_unchecked(text + 4, 4), &prefix));
+    assert_true(nc_interner_intern(&interner, nc_string_view_init_unchecked(text, 0), &empty));
+    assert_int_not_equal(prefix, apple);
+    assert_int_not_equal(empty, apple);
+    assert_int_equal(nc_interner_size(&interner), 4);
+
+    assert_true(nc_interner_find(&interner, nc_string_view_from_cstr("pear"), &again));
+    assert_int_equal(again, pear);
+    assert_false(nc_interner_find(&interner, nc_string_view_from_cstr("plum"), &again));
+
+    nc_interner_destroy(&interner);
+}
+
+void interner_growth_test(void** state) {
+    (void)state;
+
+    enum { COUNT = 20000 };
+    NC_Interner interner = nc_interner_init();
+    char name[32];
+
+    // Lookup table and byte buffer grow many times, earlier symbols keep their strings
+    for (int i = 0; i < COUNT; ++i) {
+        snprintf(name, sizeof name, "symbol_%d", i);
+        NC_Symbol symbol;
+        assert_true(nc_interner_intern(&interner, nc_string_view_from_cstr(name), &symbol));
+        assert_int_equal(symbol, i);
+    }
+    assert_int_equal(nc_interner_size(&interner), COUNT);
+
+    for (int i = 0; i < COUNT; ++i) {
+        snprintf(name, sizeof name, "symbol_%d", i);
+        NC_Symbol symbol;
+        assert_true(nc_interner_find(&interner, nc_string_view_from_cstr(name), &symbol));
+        assert_int_equal(symbol, i);
+        assert_true(nc_interner_intern(&interner, nc_string_view_from_cstr(name), &symbol));
+        assert_int_equal(symbol, i);
+    }
+    assert_int_equal(nc_interner_size(&interner), COUNT);
+
+    nc_interner_destroy(&interner);
+}
+
+void interner_resolve_test(void** state) {
+    (void)state;
+
+    NC_Interner interner = nc_interner_init();
+    NC_Symbol first;
+    assert_true(nc_interner_intern(&interner, nc_string_view_from_cstr("first"), &first));
+
+    // Resolved view is a null terminated copy, not the interned view itself
+    char source[] = "héllo";
+    NC_Symbol hello;
+    assert_true(nc_interner_intern(&interner, nc_string_view_from_cstr(source), &hello));
+    source[0] = 'j';
+    const NC_StringView resolved = nc_interner_resolve(&interner, hello);
+    assert_int_equal(nc_string_view_size(resolved), strlen("héllo"));
+    assert_string_equal(nc_string_view_bytes(resolved), "héllo");
+
+    assert_string_equal(nc_string_view_bytes(nc_interner_resolve(&interner, first)), "first");
+
+    nc_interner_destroy(&interner);
+}
+
+void interner_resolve_invalidated_by_intern_test(void** state) {
+    (void)state;
+
+    // Moving allocator relocates the bytes on every growth, as any allocator is allowed to
+    TestMovingAllocator moving = test_moving_allocator_init();
+    NC_Interner interner = nc_interner_init_in(&moving.allocator);
+    NC_Symbol first;
+    assert_true(nc_interner_intern(&interner, nc_string_view_from_cstr("first"), &first));
+    const NC_StringView view = nc_interner_resolve(&interner, first);
+
+    char name[32];
+    NC_Symbol last = first;
+    for (int i = 0; i < 1000; ++i) {
+        snprintf(name, sizeof name, "filler_%d", i);
+        assert_true(nc_interner_intern(&interner, nc_string_view_from_cstr(name), &last));
+    }
+    assert_true(moving.move_count > 0);
+
+    // Old view points into released memory, resolving again gives a valid one
+    const NC_StringView resolved = nc_interner_resolve(&interner, first);
+    assert_ptr_not_equal(nc_string_view_bytes(resolved), nc_string_view_bytes(view));
+    assert_string_equal(nc_string_view_bytes(resolved), "first");
+    assert_string_equal(nc_string_view_bytes(nc_interner_resolve(&interner, last)), "filler_999");
+
+    nc_interner_destroy(&interner);
+}
+
+void interner_intern_own_bytes_test(void** state) {
+    (void)state;
+
+    enum { SIZE = 300 };
+    char text[SIZE + 1];
+    memset(text, 'x', SIZE);
+    text[SIZE] = '\0';
+
+    TestMovingAllocator moving = test_moving_allocator_init();
+    NC_Interner interner = nc_interner_init_in(&moving.allocator);
+    NC_Symbol whole;
+    assert_true(nc_interner_intern(&interner, nc_string_view_from_cstr(text), &whole));
+
+    // Every prefix of the resolved string is new, so the bytes it points to are moved while interning it
+    for (size_t size = SIZE - 1; size > 0; --size) {
+        const NC_StringView resolved = nc_interner_resolve(&interner, whole);
+        NC_Symbol prefix;
+        assert_true(nc_interner_intern(&interner, nc_string_view_init_unchecked(nc_string_view_bytes(resolved), size), &prefix));
+        assert_int_equal(nc_string_view_size(nc_interner_resolve(&interner, prefix)), size);
+        assert_memory_equal(nc_string_view_bytes(nc_interner_resolve(&interner, prefix)), text, size);
+    }
+    assert_true(moving.move_count > 0);
+    assert_int_equal(nc_interner_size(&interner), SIZE);
+    assert_string_equal(nc_string_view_bytes(nc_interner_resolve(&interner, whole)), text);
+
+    nc_interner_destroy(&interner);
+}
+
+static const struct CMUnitTest interner_tests[] = {
+    cmocka_unit_test(interner_same_symbol_test),
+    cmocka_unit_test(interner_growth_test),
+    cmocka_unit_test(interner_resolve_test),
+    cmocka_unit_test(interner_resolve_invalidated_by_intern_test),
+    cmocka_unit_test(interner_intern_own_bytes_test)
+};
@@ -0,0 +1,229 @@
+#include "ncstd/test/test_common.h"
+
+#include <string.h>
+
+#include "ncstd/rope.h"
+#include "ncstd/utf8.h"
+
+
+static const char* const TEST_ROPE_PIECES[] = { "a", "\xC3\xA9", "\xE2\x82\xAC", "\xF0\x9F\x98\x80", " " };
+
+static uint32_t test_rope_next_random(uint32_t* state) {
+    *state = *state * 1103515245u + 12345u;
+
+    return *state >> 8;
+}
+
+// Fills text with random characters of every encoded length, returns number of written bytes
+static size_t test_rope_fill(char* text, size_t capacity, uint32_t* random) {
+    size_t size = 0;
+    for (;;) {
+        const char* const piece = TEST_ROPE_PIECES[test_rope_next_random(random) % 5];
+        const size_t piece_size = strlen(piece);
+        if (size + piece_size > capacity)
+            return size;
+
+        memcpy(text + size, piece, piece_size);
+        size += piece_size;
+    }
+}
+
+static size_t test_rope_count_chars(const char* text, size_t size) {
+    size_t count = 0;
+    for (size_t i = 0; i < size; ++i)
+        count += !nc_utf8_is_continuation_byte((uint8_t)text[i]);
+
+    return count;
+}
+
+// Checks rope against the flat reference text, chunk by chunk
+static void test_rope_check(const NC_Rope* rope, const char* expected, size_t expected_size) {
+    assert_int_equal(nc_rope_size(rope), expected_size);
+    assert_int_equal(nc_rope_char_count(rope), test_rope_count_chars(expected, expected_size));
+    assert_int_equal(nc_rope_is_empty(rope), expected_size == 0);
+
+    NC_RopeChunksIterator it = nc_rope_chunks(rope);
+    const NC_StringView* chunk;
+    size_t offset = 0;
+    while ((chunk = nc_rope_chunks_iterator_next(&it)) != NULL) {
+        const size_t chunk_size = nc_string_view_size(*chunk);
+        assert_true(chunk_size > 0);
+        assert_true(chunk_size <= NC_ROPE_CHUNK_CAPACITY);
+        assert_true(offset + chunk_size <= expected_size);
+        assert_memory_equal(nc_string_view_bytes(*chunk), expected + offset, chunk_size);
+        offset += chunk_size;
+    }
+    assert_int_equal(offset, expected_size);
+
+    NC_String string = nc_rope_to_string(rope);
+    assert_int_equal(nc_string_size(&string), expected_size);
+    if (expected_size > 0)
+        assert_memory_equal(nc_string_view_bytes(nc_string_as_string_view(&string)), expected, expected_size);
+    nc_string_destroy(&string);
+}
+
+void rope_edits_match_reference_test(void** state) {
+    (void)state;
+
+    const size_t capacity = 64 * 1024;
+    char* const text = malloc(capacity);
+    char* const reference = malloc(capacity);
+    assert_non_null(text);
+    assert_non_null(reference);
+
+    uint32_t random = 2024;
+    size_t size = test_rope_fill(reference, 20000, &random);
+
+    NC_OPTION(NC_Rope) created = nc_rope_from_string_view(nc_string_view_init_unchecked(reference, size));
+    assert_true(nc_option_rope_is_some(created));
+    NC_Rope rope = created.value;
+    test_rope_check(&rope, reference, size);
+
+    // Clone shares chunks, but isn't affected by the edits below
+    NC_Rope clone = nc_rope_clone(&rope);
+    char* const clone_reference = malloc(size);
+    assert_non_null(clone_reference);
+    memcpy(clone_reference, reference, size);
+    const size_t clone_size = size;
+
+    for (size_t i = 0; i < 500; ++i) {
+        const size_t char_count = test_rope_count_chars(reference, size);
+        const size_t begin = nc_rope_char_to_byte(&rope, test_rope_next_random(&random) % (char_count + 1));
+        assert_int_equal(nc_rope_byte_to_char(&rope, begin), test_rope_count_chars(reference, begin));
+
+        if (test_rope_next_random(&random) % 2 == 0) {
+            const size_t inserted_size = test_rope_fill(text, test_rope_next_random(&random) % 2000, &random);
+            assert_true(nc_rope_insert(&rope, begin, nc_string_view_init_unchecked(text, inserted_size)));
+
+            memmove(reference + begin + inserted_size, reference + begin, size - begin);
+            memcpy(reference + begin, text, inserted_size);
+            size += inserted_size;
+        } else {
+            const size_t end = nc_rope_char_to_byte(&rope, nc_rope_byte_to_char(&rope, begin) + test_rope_next_random(&random) % 1500);
+            assert_true(nc_rope_remove(&rope, begin, end));
+
+            memmove(reference + begin, reference + end, size - end);
+            size -= end - begin;
+        }
+
+        if (i % 50 == 0)
+            test_rope_check(&rope, reference, size);
+    }
+    test_rope_check(&rope, reference, size);
+    test_rope_check(&clone, clone_reference, clone_size);
+
+    // Slicing and appending the slices back restores the text
+    const size_t middle = nc_rope_char_to_byte(&rope, nc_rope_char_count(&rope) / 3);
+    NC_Rope head, tail;
+    assert_true(nc_rope_slice(&rope, 0, middle, &head));
+    assert_true(nc_rope_slice(&rope, middle, nc_rope_size(&rope), &tail));
+    test_rope_check(&head, reference, middle);
+    test_rope_check(&tail, reference + middle, size - middle);
+
+    assert_true(nc_rope_append(&head, &tail));
+    assert_true(nc_rope_is_empty(&tail));
+    test_rope_check(&head, reference, size);
+
+    nc_rope_destroy(&head);
+    nc_rope_destroy(&tail);
+    nc_rope_destroy(&clone);
+    nc_rope_destroy(&rope);
+    free(clone_reference);
+    free(reference);
+    free(text);
+}
+
+void rope_char_to_byte_test(void** state) {
+    (void)state;
+
+    const char text[] = "a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80z";
+    NC_OPTION(NC_Rope) created = nc_rope_from_string_view(nc_string_view_from_cstr(text));
+    assert_true(nc_option_rope_is_some(created));
+    NC_Rope rope = created.value;
+
+    const size_t expected[] = { 0, 1, 3, 6, 10, 11, 11 };
+    for (size_t i = 0; i < sizeof(expected) / sizeof(expected[0]); ++i)
+        assert_int_equal(nc_rope_char_to_byte(&rope, i), expected[i]);
+    for (size_t i = 0; i < 5; ++i)
+        assert_int_equal(nc_rope_byte_to_char(&rope, expected[i]), i);
+
+    NC_RopeCharsIterator it = nc_rope_chars(&rope);
+    const char32_t* ch;
+    const char32_t expected_chars[] = { 'a', 0xE9, 0x20AC, 0x1F600, 'z' };
+    size_t index = 0;
+    while ((ch = nc_rope_chars_iterator_next(&it)) != NULL)
+        assert_int_equal(*ch, expected_chars[index++]);
+    assert_int_equal(index, 5);
+
+    nc_rope_destroy(&rope);
+
+    NC_OPTION(NC_Rope) empty = nc_rope_from_string_view(nc_string_view_init_unchecked(text, 0));
+    assert_true(nc_option_rope_is_some(empty));
+    assert_true(nc_rope_is_empty(&empty.value));
+    assert_int_equal(nc_rope_char_to_byte(&empty.value, 3), 0);
+    nc_rope_destroy(&empty.value);
+}
+
+void rope_invalid_utf8_test(void** state) {
+    (void)state;
+
+    // Continuation bytes only, no character boundary to split chunks at
+    char text[3000];
+    memset(text, 0x80, sizeof(text));
+
+    NC_OPTION(NC_Rope) created = nc_rope_from_string_view(nc_string_view_init_unchecked(text, sizeof(text)));
+    assert_true(nc_option_rope_is_some(created));
+    test_rope_check(&created.value, text, sizeof(text));
+    nc_rope_destroy(&created.value);
+
+    // Lead bytes just before the nominal cut, with too many continuation bytes after them
+    for (size_t i = 0; i < sizeof(text); i += 7)
+        text[i] = (char)0xF0;
+
+    created = nc_rope_from_string_view(nc_string_view_init_unchecked(text, sizeof(text)));
+    assert_true(nc_option_rope_is_some(created));
+    test_rope_check(&created.value, text, sizeof(text));
+    nc_rope_destroy(&created.value);
+}
+
+void rope_allocation_failure_test(void** state) {
+    (void)state;
+
+    char text[10000];
+    uint32_t random = 7;
+    const size_t size = test_rope_fill(text, sizeof(text), &random);
+
+    bool succeeded = false;
+    for (size_t budget = 0; !succeeded; ++budget) {
+        TestFailingAllocator allocator = test_failing_allocator_init(budget);
+
+        NC_OPTION(NC_Rope) created = nc_rope_from_string_view_in(nc_string_view_init_unchecked(text, size), &allocator.allocator);
+        succeeded = nc_option_rope_is_some(created);
+        if (succeeded) {
+            allocator.remaining = SIZE_MAX;
+            test_rope_check(&created.value, text, size);
+
+            // Failed edits leave the rope unchanged, shared chunks can't be edited in place
+            NC_Rope clone = nc_rope_clone(&created.value);
+            const size_t middle = nc_rope_char_to_byte(&created.value, nc_rope_char_count(&created.value) / 2);
+            allocator.remaining = 0;
+            assert_false(nc_rope_insert(&created.value, middle, nc_string_view_init_unchecked(text, 2000)));
+            assert_false(nc_rope_remove(&created.value, middle, nc_rope_size(&created.value)));
+            allocator.remaining = SIZE_MAX;
+            test_rope_check(&created.value, text, size);
+
+            nc_rope_destroy(&clone);
+            nc_rope_destroy(&created.value);
+        }
+
+        // Partially built tree is released on failure
+        assert_int_equal(allocator.live_count, 0);
+    }
+}
+
+static const struct CMUnitTest rope_tests[] = {
+    cmocka_unit_test(rope_edits_match_reference_test),
+    cmocka_unit_test(rope_char_to_byte_test),
+    cmocka_unit_test(rope_invalid_utf8_test),
+    cmocka_unit_test(rope_allocation_failure_test)
+};
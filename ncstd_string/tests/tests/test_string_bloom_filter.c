@@ -0,0 +1,76 @@
+#include "ncstd/test/test_common.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "ncstd/string_bloom_filter.h"
+
+
+void string_bloom_filter_single_test(void** state) {
+    (void)state;
+
+    NC_BloomFilter filter = nc_bloom_filter_init(100, 12);
+    assert_false(nc_bloom_filter_contains_string_view(&filter, nc_string_view_from_cstr("apple")));
+
+    nc_bloom_filter_insert_string_view(&filter, nc_string_view_from_cstr("apple"));
+    nc_bloom_filter_insert_string_view(&filter, nc_string_view_from_cstr(""));
+
+    // Views are hashed by their bytes, not by their pointers
+    const char text[] = "pineapple";
+    assert_true(nc_bloom_filter_contains_string_view(&filter, nc_string_view_init_unchecked(text + 4, 5)));
+    assert_true(nc_bloom_filter_contains_string_view(&filter, nc_string_view_init_unchecked(text, 0)));
+
+    nc_bloom_filter_destroy(&filter);
+}
+
+void string_bloom_filter_bulk_test(void** state) {
+    (void)state;
+
+    // Counts around the batch size of 64, to cover partial batches
+    const size_t counts[] = { 0, 1, 63, 64, 65, 1037 };
+    enum { MAX_COUNT = 1037, WORD_CAPACITY = 16 };
+    char* const words = malloc(2 * MAX_COUNT * WORD_CAPACITY);
+    NC_StringView* const views = malloc(2 * MAX_COUNT * sizeof(NC_StringView));
+    bool* const results = malloc(2 * MAX_COUNT * sizeof(bool));
+    assert_non_null(words);
+    assert_non_null(views);
+    assert_non_null(results);
+
+    for (size_t i = 0; i < 2 * MAX_COUNT; ++i) {
+        char* const word = words + i * WORD_CAPACITY;
+        const int length = snprintf(word, WORD_CAPACITY, "word-%zu", i);
+        views[i] = nc_string_view_init_unchecked(word, (size_t)length);
+    }
+
+    for (size_t c = 0; c < sizeof(counts) / sizeof(counts[0]); ++c) {
+        const size_t count = counts[c];
+        NC_BloomFilter filter = nc_bloom_filter_init(MAX_COUNT, 16);
+        nc_bloom_filter_insert_string_views(&filter, views, count);
+
+        for (size_t i = 0; i < count; ++i)
+            assert_true(nc_bloom_filter_contains_string_view(&filter, views[i]));
+
+        // Bulk query agrees with single queries, including views that weren't inserted
+        const size_t found = nc_bloom_filter_contains_string_views(&filter, views, 2 * count, results);
+        size_t expected_found = 0;
+        for (size_t i = 0; i < 2 * count; ++i) {
+            assert_int_equal(results[i], nc_bloom_filter_contains_string_view(&filter, views[i]));
+            if (i < count)
+                assert_true(results[i]);
+            expected_found += results[i];
+        }
+        assert_int_equal(found, expected_found);
+        assert_true(found < 2 * count || count == 0);
+
+        nc_bloom_filter_destroy(&filter);
+    }
+
+    free(words);
+    free(views);
+    free(results);
+}
+
+static const struct CMUnitTest string_bloom_filter_tests[] = {
+    cmocka_unit_test(string_bloom_filter_single_test),
+    cmocka_unit_test(string_bloom_filter_bulk_test)
+};
@@ -0,0 +1,113 @@
+#include "ncstd/test/test_common.h"
+
+#include <stdio.h>
+
+#include "ncstd/containers/hash_map.h"
+#include "ncstd/nc_string.h"
+#include "ncstd/string_view.h"
+
+
+NC_DEFINE_HASH_MAP(NC_StringView, int, string_view_int, nc_string_view_ptr_hash, nc_string_view_ptr_eq)
+NC_INSTANTIATE_HASH_MAP(NC_StringView, int, string_view_int)
+
+NC_DEFINE_HASH_MAP(NC_String, int, string_int, nc_string_ptr_hash, nc_string_ptr_eq)
+NC_INSTANTIATE_HASH_MAP(NC_String, int, string_int)
+
+void string_hash_map_view_keys_test(void** state) {
+    (void)state;
+
+    // Keys aren't null terminated, and are looked up with views of a different buffer
+    const char text[] = "pearapplefigapp";
+    const char other[] = "apple, pear, fig, app";
+    NC_HASH_MAP(NC_StringView, int) map = nc_hash_map_string_view_int_init();
+    assert_true(nc_hash_map_string_view_int_insert(&map, nc_string_view_init_unchecked(text, 4), 1));
+    assert_true(nc_hash_map_string_view_int_insert(&map, nc_string_view_init_unchecked(text + 4, 5), 2));
+    assert_true(nc_hash_map_string_view_int_insert(&map, nc_string_view_init_unchecked(text + 9, 3), 3));
+    assert_true(nc_hash_map_string_view_int_insert(&map, nc_string_view_init_unchecked(text + 12, 3), 4));
+    assert_true(nc_hash_map_string_view_int_insert(&map, nc_string_view_init_unchecked(text, 0), 5));
+    assert_int_equal(nc_hash_map_string_view_int_size(&map), 5);
+
+    const NC_StringView apple = nc_string_view_init_unchecked(other, 5);
+    const NC_StringView pear = nc_string_view_init_unchecked(other + 7, 4);
+    const NC_StringView app = nc_string_view_init_unchecked(other + 18, 3);
+    const NC_StringView empty = nc_string_view_init_unchecked(other + 5, 0);
+    assert_int_equal(*nc_hash_map_string_view_int_get(&map, &apple), 2);
+    assert_int_equal(*nc_hash_map_string_view_int_get(&map, &pear), 1);
+    assert_int_equal(*nc_hash_map_string_view_int_get(&map, &app), 4);
+    assert_int_equal(*nc_hash_map_string_view_int_get(&map, &empty), 5);
+
+    const NC_StringView prefix = nc_string_view_init_unchecked(other, 4);
+    assert_false(nc_hash_map_string_view_int_contains(&map, &prefix));
+
+    // Equal key overwrites the value and keeps the stored view
+    assert_true(nc_hash_map_string_view_int_insert(&map, apple, 20));
+    assert_int_equal(nc_hash_map_string_view_int_size(&map), 5);
+
+    NC_StringView removed_key;
+    int removed_value;
+    assert_true(nc_hash_map_string_view_int_remove(&map, &apple, &removed_key, &removed_value));
+    assert_ptr_equal(nc_string_view_bytes(removed_key), text + 4);
+    assert_int_equal(removed_value, 20);
+    assert_false(nc_hash_map_string_view_int_contains(&map, &apple));
+
+    assert_true(nc_hash_map_string_view_int_remove(&map, &empty, NULL, NULL));
+    assert_false(nc_hash_map_string_view_int_remove(&map, &empty, NULL, NULL));
+    assert_int_equal(nc_hash_map_string_view_int_size(&map), 3);
+    assert_int_equal(*nc_hash_map_string_view_int_get(&map, &app), 4);
+
+    nc_hash_map_string_view_int_destroy(&map);
+}
+
+void string_hash_map_string_keys_test(void** state) {
+    (void)state;
+
+    NC_HASH_MAP(NC_String, int) map = nc_hash_map_string_int_init();
+
+    // Enough keys to rehash several times
+    char buffer[32];
+    for (int i = 0; i < 1000; ++i) {
+        const int length = snprintf(buffer, sizeof(buffer), "key-%d", i);
+        NC_String key = nc_string_from_string_view(nc_string_view_init_unchecked(buffer, (size_t)length));
+        assert_true(nc_hash_map_string_int_insert(&map, key, i));
+    }
+    assert_true(nc_hash_map_string_int_insert(&map, nc_string_empty(), -1));
+    assert_int_equal(nc_hash_map_string_int_size(&map), 1001);
+
+    for (int i = 0; i < 1000; ++i) {
+        const int length = snprintf(buffer, sizeof(buffer), "key-%d", i);
+        NC_String key = nc_string_from_string_view(nc_string_view_init_unchecked(buffer, (size_t)length));
+        const int* const value = nc_hash_map_string_int_get(&map, &key);
+        assert_non_null(value);
+        assert_int_equal(*value, i);
+
+        // Stored key is moved out and destroyed by the caller
+        if (i % 2 == 0) {
+            NC_String removed_key;
+            assert_true(nc_hash_map_string_int_remove(&map, &key, &removed_key, NULL));
+            assert_true(nc_string_ptr_eq(&removed_key, &key, NULL));
+            assert_ptr_not_equal(nc_string_view_bytes(nc_string_as_string_view(&removed_key)), nc_string_view_bytes(nc_string_as_string_view(&key)));
+            nc_string_destroy(&removed_key);
+            assert_false(nc_hash_map_string_int_contains(&map, &key));
+        }
+        nc_string_destroy(&key);
+    }
+    assert_int_equal(nc_hash_map_string_int_size(&map), 501);
+
+    NC_String empty = nc_string_empty();
+    assert_int_equal(*nc_hash_map_string_int_get(&map, &empty), -1);
+    nc_string_destroy(&empty);
+
+    size_t cursor = 0;
+    size_t count = 0;
+    for (NC_HASH_MAP_ENTRY(NC_String, int)* entry; (entry = nc_hash_map_string_int_next_entry(&map, &cursor)) != NULL;) {
+        nc_string_destroy(&entry->key);
+        count += 1;
+    }
+    assert_int_equal(count, 501);
+    nc_hash_map_string_int_destroy(&map);
+}
+
+static const struct CMUnitTest string_hash_map_tests[] = {
+    cmocka_unit_test(string_hash_map_view_keys_test),
+    cmocka_unit_test(string_hash_map_string_keys_test)
+};
@@ -0,0 +1,111 @@
+#include "ncstd/test/test_common.h"
+
+#include "ncstd/containers/btree_map.h"
+#include "ncstd/nc_string.h"
+#include "ncstd/string_view.h"
+#include "ncstd/util/hash.h"
+
+
+NC_DEFINE_BTREE_MAP(NC_StringView, int, string_view_int, nc_string_view_ptr_cmp)
+NC_INSTANTIATE_BTREE_MAP(NC_StringView, int, string_view_int)
+
+void string_view_btree_map_keys_test(void** state) {
+    (void)state;
+
+    // Keys aren't null terminated, "app" is a prefix of "apple" and is ordered before it
+    const char text[] = "pearapplefigbananaappdate";
+    const NC_StringView words[] = {
+        nc_string_view_init_unchecked(text, 4),
+        nc_string_view_init_unchecked(text + 4, 5),
+        nc_string_view_init_unchecked(text + 9, 3),
+        nc_string_view_init_unchecked(text + 12, 6),
+        nc_string_view_init_unchecked(text + 18, 3),
+        nc_string_view_init_unchecked(text + 21, 4)
+    };
+    const char* const sorted[] = { "app", "apple", "banana", "date", "fig", "pear" };
+
+    NC_BTREE_MAP(string_view_int) map = nc_btree_map_string_view_int_init();
+    for (int i = 0; i < 6; ++i)
+        assert_true(nc_btree_map_string_view_int_insert(&map, words[i], i));
+    assert_int_equal(nc_btree_map_string_view_int_size(&map), 6);
+
+    const NC_StringView fig = nc_string_view_from_cstr("fig");
+    assert_int_equal(*nc_btree_map_string_view_int_get(&map, &fig), 2);
+    const NC_StringView missing = nc_string_view_from_cstr("ap");
+    assert_false(nc_btree_map_string_view_int_contains(&map, &missing));
+
+    NC_BTREE_MAP_CURSOR(string_view_int) cursor = nc_btree_map_string_view_int_iter(&map);
+    const NC_StringView* key;
+    for (size_t i = 0; i < 6; ++i) {
+        assert_true(nc_btree_map_string_view_int_cursor_next(&cursor, &key, NULL));
+        assert_true(nc_string_view_eq(*key, nc_string_view_from_cstr(sorted[i])));
+    }
+    assert_false(nc_btree_map_string_view_int_cursor_next(&cursor, &key, NULL));
+
+    // Lower bound of a missing key stops at the next one in byte order
+    const NC_StringView from = nc_string_view_from_cstr("b");
+    cursor = nc_btree_map_string_view_int_lower_bound(&map, &from);
+    assert_true(nc_btree_map_string_view_int_cursor_next(&cursor, &key, NULL));
+    assert_true(nc_string_view_eq(*key, nc_string_view_from_cstr("banana")));
+
+    nc_btree_map_string_view_int_destroy(&map);
+}
+
+void string_view_char_slice_test(void** state) {
+    (void)state;
+
+    // Codepoints are 1, 2, 3, 4 and 1 bytes long
+    const NC_StringView text = nc_string_view_from_cstr("a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80z");
+
+    NC_StringView slice = nc_string_view_char_slice(text, 1, 4);
+    assert_ptr_equal(nc_string_view_bytes(slice), nc_string_view_bytes(text) + 1);
+    assert_int_equal(nc_string_view_size(slice), 9);
+
+    // End past the end is clamped
+    slice = nc_string_view_char_slice(text, 3, 100);
+    assert_ptr_equal(nc_string_view_bytes(slice), nc_string_view_bytes(text) + 6);
+    assert_int_equal(nc_string_view_size(slice), 5);
+
+    // Begin past the end gives empty view at the end
+    slice = nc_string_view_char_slice(text, 7, 100);
+    assert_ptr_equal(nc_string_view_bytes(slice), nc_string_view_bytes(text) + 11);
+    assert_int_equal(nc_string_view_size(slice), 0);
+
+    // Reversed and empty ranges are empty
+    slice = nc_string_view_char_slice(text, 4, 2);
+    assert_ptr_equal(nc_string_view_bytes(slice), nc_string_view_bytes(text) + 10);
+    assert_int_equal(nc_string_view_size(slice), 0);
+    slice = nc_string_view_char_slice(text, 2, 2);
+    assert_int_equal(nc_string_view_size(slice), 0);
+}
+
+void string_view_hash_test(void** state) {
+    (void)state;
+
+    // Sizes around the 8 and 16 byte steps of the hash, and a view in the middle of a buffer
+    const char text[] = "The quick brown fox jumps over the lazy dog, twice over.";
+    const size_t sizes[] = { 0, 1, 7, 8, 9, 16, 17, 33, sizeof(text) - 4 };
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i) {
+        const NC_StringView view = nc_string_view_init_unchecked(text + 3, sizes[i]);
+        assert_true(nc_string_view_hash(view) == nc_hash_bytes(text + 3, sizes[i]));
+        assert_true(nc_string_view_hash_seeded(view, 0) == nc_hash_bytes(text + 3, sizes[i]));
+        assert_true(nc_string_view_hash_seeded(view, 12345) == nc_hash_bytes_seeded(text + 3, sizes[i], 12345));
+        assert_true(nc_string_view_ptr_hash(&view, NULL) == nc_string_view_hash(view));
+
+        // String hashes as its view, regardless of where its bytes are stored
+        NC_String string = nc_string_from_string_view(view);
+        assert_true(nc_string_hash(&string) == nc_string_view_hash(view));
+        assert_true(nc_string_hash(&string) == nc_string_view_hash(nc_string_as_string_view(&string)));
+        assert_true(nc_string_ptr_hash(&string, NULL) == nc_string_hash(&string));
+        nc_string_destroy(&string);
+    }
+
+    const NC_StringView view = nc_string_view_from_cstr("seeded");
+    assert_true(nc_string_view_hash_seeded(view, 1) != nc_string_view_hash_seeded(view, 2));
+}
+
+static const struct CMUnitTest string_view_tests[] = {
+    cmocka_unit_test(string_view_btree_map_keys_test),
+    cmocka_unit_test(string_view_char_slice_test),
+    cmocka_unit_test(string_view_hash_test)
+};
@@ -0,0 +1,251 @@
+#include "ncstd/test/test_common.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "ncstd/transcode.h"
+#include "ncstd/utf8.h"
+
+
+typedef struct {
+    char32_t* utf32;
+    size_t utf32_count;
+    char16_t* utf16;
+    size_t utf16_count;
+    uint8_t* utf8;
+    size_t utf8_size;
+} TestTranscodeText;
+
+static uint32_t test_transcode_next_random(uint32_t* state) {
+    *state = *state * 1103515245u + 12345u;
+
+    return *state >> 8;
+}
+
+// Returns codepoint of the given encoded UTF-8 width, 0 picks a random width
+static char32_t test_transcode_random_char(uint32_t* random, size_t width) {
+    if (width == 0)
+        width = 1 + test_transcode_next_random(random) % 4;
+
+    const uint32_t value = test_transcode_next_random(random);
+    switch (width) {
+    case 1: return value % 0x80;
+    case 2: return 0x80 + value % (0x800 - 0x80);
+    case 3: {
+        // Surrogates are skipped
+        const char32_t ch = 0x800 + value % (0x10000 - 0x800 - 0x800);
+        return ch < 0xD800 ? ch : ch + 0x800;
+    }
+    default: return 0x10000 + value % (0x110000 - 0x10000);
+    }
+}
+
+// Encodes codepoints one by one, to compare with the bulk conversions
+static TestTranscodeText test_transcode_text_init(const char32_t* chars, size_t count) {
+    TestTranscodeText text = {
+        .utf32 = malloc(count * sizeof(char32_t) + 1),
+        .utf32_count = count,
+        .utf16 = malloc(2 * count * sizeof(char16_t) + 1),
+        .utf8 = malloc(4 * count + 1)
+    };
+    assert_non_null(text.utf32);
+    assert_non_null(text.utf16);
+    assert_non_null(text.utf8);
+
+    memcpy(text.utf32, chars, count * sizeof(char32_t));
+    for (size_t i = 0; i < count; ++i) {
+        if (chars[i] >= 0x10000) {
+            text.utf16[text.utf16_count++] = (char16_t)(0xD800 + ((chars[i] - 0x10000) >> 10));
+            text.utf16[text.utf16_count++] = (char16_t)(0xDC00 + (chars[i] & 0x3FF));
+        } else {
+            text.utf16[text.utf16_count++] = (char16_t)chars[i];
+        }
+        text.utf8_size += nc_utf8_encode_char_unchecked(text.utf8 + text.utf8_size, chars[i]);
+    }
+
+    return text;
+}
+
+static void test_transcode_text_destroy(TestTranscodeText* text) {
+    free(text->utf32);
+    free(text->utf16);
+    free(text->utf8);
+}
+
+// Converts between all encodings into buffers of exact size
+static void test_transcode_check(const TestTranscodeText* text) {
+    assert_true(nc_utf8_is_valid(text->utf8, text->utf8_size));
+    assert_true(nc_utf16_is_valid(text->utf16, text->utf16_count));
+    assert_true(nc_utf32_is_valid(text->utf32, text->utf32_count));
+
+    assert_int_equal(nc_utf8_utf16_length(text->utf8, text->utf8_size), text->utf16_count);
+    assert_int_equal(nc_utf8_utf32_length(text->utf8, text->utf8_size), text->utf32_count);
+    assert_int_equal(nc_utf16_utf8_length(text->utf16, text->utf16_count), text->utf8_size);
+    assert_int_equal(nc_utf32_utf8_length(text->utf32, text->utf32_count), text->utf8_size);
+
+    // Exact sizes, so that writes past the end are caught by sanitizers
+    char16_t* const utf16 = malloc(text->utf16_count * sizeof(char16_t));
+    char32_t* const utf32 = malloc(text->utf32_count * sizeof(char32_t));
+    uint8_t* const utf8 = malloc(text->utf8_size);
+    assert_true(utf16 != NULL || text->utf16_count == 0);
+    assert_true(utf32 != NULL || text->utf32_count == 0);
+    assert_true(utf8 != NULL || text->utf8_size == 0);
+
+    assert_int_equal(nc_utf8_to_utf16(text->utf8, text->utf8_size, utf16), text->utf16_count);
+    assert_memory_equal(utf16, text->utf16, text->utf16_count * sizeof(char16_t));
+    assert_int_equal(nc_utf8_to_utf32(text->utf8, text->utf8_size, utf32), text->utf32_count);
+    assert_memory_equal(utf32, text->utf32, text->utf32_count * sizeof(char32_t));
+
+    assert_int_equal(nc_utf16_to_utf8(text->utf16, text->utf16_count, utf8), text->utf8_size);
+    assert_memory_equal(utf8, text->utf8, text->utf8_size);
+    memset(utf8, 0, text->utf8_size);
+    assert_int_equal(nc_utf32_to_utf8(text->utf32, text->utf32_count, utf8), text->utf8_size);
+    assert_memory_equal(utf8, text->utf8, text->utf8_size);
+
+    free(utf16);
+    free(utf32);
+    free(utf8);
+}
+
+void transcode_block_edges_test(void** state) {
+    (void)state;
+
+    char32_t chars[160];
+    uint32_t random = 555;
+
+    // Character of every width after an ASCII prefix of every length, so it straddles 16 byte
+    // and 8 code unit blocks at every position, followed by enough text to stay on vector paths
+    for (size_t width = 1; width <= 4; ++width) {
+        for (size_t prefix = 0; prefix < 40; ++prefix) {
+            const size_t tails[] = { 0, 1, 7, 8, 9, 24, 52, 100 };
+            for (size_t t = 0; t < sizeof(tails) / sizeof(tails[0]); ++t) {
+                size_t count = 0;
+                for (size_t i = 0; i < prefix; ++i)
+                    chars[count++] = 'a' + i % 26;
+                chars[count++] = test_transcode_random_char(&random, width);
+                for (size_t i = 0; i < tails[t]; ++i)
+                    chars[count++] = test_transcode_random_char(&random, i % 3 == 0 ? width : 0);
+
+                TestTranscodeText text = test_transcode_text_init(chars, count);
+                test_transcode_check(&text);
+                test_transcode_text_destroy(&text);
+            }
+        }
+    }
+
+    // Runs of pairs only, with every alignment of the first one
+    for (size_t prefix = 0; prefix < 16; ++prefix) {
+        size_t count = 0;
+        for (size_t i = 0; i < prefix; ++i)
+            chars[count++] = 0xE9;
+        while (count < 100)
+            chars[count++] = test_transcode_random_char(&random, 4);
+
+        TestTranscodeText text = test_transcode_text_init(chars, count);
+        test_transcode_check(&text);
+        test_transcode_text_destroy(&text);
+    }
+}
+
+void transcode_random_text_test(void** state) {
+    (void)state;
+
+    char32_t* const chars = malloc(1000 * sizeof(char32_t));
+    assert_non_null(chars);
+    uint32_t random = 8086;
+
+    // Mixes from pure ASCII to pure supplementary characters
+    for (size_t i = 0; i < 2000; ++i) {
+        const size_t count = test_transcode_next_random(&random) % 1000;
+        const size_t mix = i % 6;
+        for (size_t c = 0; c < count; ++c) {
+            size_t width = 0;
+            if (mix < 4)
+                width = mix + 1;
+            else if (mix == 4)
+                width = test_transcode_next_random(&random) % 8 == 0 ? 0 : 1;
+            chars[c] = test_transcode_random_char(&random, width);
+        }
+
+        TestTranscodeText text = test_transcode_text_init(chars, count);
+        test_transcode_check(&text);
+        test_transcode_text_destroy(&text);
+    }
+
+    free(chars);
+}
+
+void transcode_utf16_invalid_test(void** state) {
+    (void)state;
+
+    char16_t data[64];
+    const char16_t high = 0xD83D;
+    const char16_t low = 0xDE00;
+
+    for (size_t position = 0; position < 48; ++position) {
+        for (size_t count = position + 1; count <= 64; count += 7) {
+            for (size_t i = 0; i < count; ++i)
+                data[i] = i % 3 == 0 ? 'a' : 0x4E16;
+
+            // Lone high surrogate, followed by something other than a low surrogate or by the end
+            data[position] = high;
+            assert_false(nc_utf16_is_valid(data, count));
+
+            // Complete pair is valid, unless it's truncated by the end
+            if (position + 1 < count) {
+                data[position + 1] = low;
+                assert_true(nc_utf16_is_valid(data, count));
+                assert_false(nc_utf16_is_valid(data, position + 1));
+
+                // Reversed pair
+                data[position] = low;
+                data[position + 1] = high;
+                assert_false(nc_utf16_is_valid(data, count));
+                data[position + 1] = 'a';
+            }
+
+            // Lone low surrogate
+            data[position] = low;
+            assert_false(nc_utf16_is_valid(data, count));
+        }
+    }
+
+    const char16_t truncated[] = { 'a', 'b', high };
+    assert_false(nc_utf16_is_valid(truncated, 3));
+    assert_false(nc_option_string_is_some(nc_string_from_utf16(truncated, 3)));
+    assert_true(nc_utf16_is_valid(truncated, 0));
+}
+
+void transcode_utf32_invalid_test(void** state) {
+    (void)state;
+
+    char32_t data[64];
+    const char32_t invalid[] = { 0xD800, 0xDBFF, 0xDC00, 0xDFFF, 0x110000, 0x7FFFFFFF, 0xFFFFFFFF };
+    const char32_t valid[] = { 0, 0xD7FF, 0xE000, 0xFFFF, 0x10000, 0x10FFFF };
+
+    for (size_t position = 0; position < 48; ++position) {
+        for (size_t count = position + 1; count <= 64; count += 7) {
+            for (size_t i = 0; i < count; ++i)
+                data[i] = 'a' + (char32_t)i;
+
+            for (size_t v = 0; v < sizeof(invalid) / sizeof(invalid[0]); ++v) {
+                data[position] = invalid[v];
+                assert_false(nc_utf32_is_valid(data, count));
+            }
+            for (size_t v = 0; v < sizeof(valid) / sizeof(valid[0]); ++v) {
+                data[position] = valid[v];
+                assert_true(nc_utf32_is_valid(data, count));
+            }
+        }
+    }
+
+    const char32_t above_max[] = { 'a', 0x110000 };
+    assert_false(nc_option_string_is_some(nc_string_from_utf32(above_max, 2)));
+}
+
+static const struct CMUnitTest transcode_tests[] = {
+    cmocka_unit_test(transcode_block_edges_test),
+    cmocka_unit_test(transcode_random_text_test),
+    cmocka_unit_test(transcode_utf16_invalid_test),
+    cmocka_unit_test(transcode_utf32_invalid_test)
+};
@@ -0,0 +1,209 @@
+#include "ncstd/test/test_common.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "ncstd/utf8.h"
+
+
+typedef struct {
+    const char* bytes;
+    bool is_valid;
+} TestUtf8Sequence;
+
+static const TestUtf8Sequence TEST_UTF8_SEQUENCES[] = {
+    { "\xC2\x80", true },
+    { "\xDF\xBF", true },
+    { "\xE0\xA0\x80", true },
+    { "\xED\x9F\xBF", true },
+    { "\xEE\x80\x80", true },
+    { "\xEF\xBF\xBF", true },
+    { "\xF0\x90\x80\x80", true },
+    { "\xF4\x8F\xBF\xBF", true },
+    // Overlong forms
+    { "\xC0\x80", false },
+    { "\xC1\xBF", false },
+    { "\xE0\x80\x80", false },
+    { "\xE0\x9F\xBF", false },
+    { "\xF0\x80\x80\x80", false },
+    { "\xF0\x8F\xBF\xBF", false },
+    // Surrogates
+    { "\xED\xA0\x80", false },
+    { "\xED\xBF\xBF", false },
+    // Above U+10FFFF
+    { "\xF4\x90\x80\x80", false },
+    { "\xF5\x80\x80\x80", false },
+    { "\xFF", false },
+    // Stray continuation and missing continuation
+    { "\x80", false },
+    { "\xC2\x41", false },
+    { "\xE2\x82\x41", false },
+    { "\xF0\x9F\x98\x41", false },
+    // Too many continuations
+    { "\xC2\x80\x80", false }
+};
+
+static void test_utf8_check(const uint8_t* data, size_t size, bool expected) {
+    assert_int_equal(nc_utf8_is_valid_scalar(data, size), expected);
+    assert_int_equal(nc_utf8_is_valid(data, size), expected);
+}
+
+void utf8_is_valid_sequences_test(void** state) {
+    (void)state;
+
+    uint8_t buffer[160];
+    const size_t sequence_count = sizeof(TEST_UTF8_SEQUENCES) / sizeof(TEST_UTF8_SEQUENCES[0]);
+
+    // Every sequence at every offset around 16 and 32 byte blocks, in short and long inputs,
+    // followed by ASCII or by the end of the input
+    for (size_t s = 0; s < sequence_count; ++s) {
+        const uint8_t* const bytes = (const uint8_t*)TEST_UTF8_SEQUENCES[s].bytes;
+        const size_t length = strlen(TEST_UTF8_SEQUENCES[s].bytes);
+
+        for (size_t offset = 0; offset < 70; ++offset) {
+            const size_t tails[] = { 0, 1, 15, 16, 17, 40 };
+            for (size_t t = 0; t < sizeof(tails) / sizeof(tails[0]); ++t) {
+                const size_t size = offset + length + tails[t];
+                memset(buffer, 'a', size);
+                memcpy(buffer + offset, bytes, length);
+                test_utf8_check(buffer, size, TEST_UTF8_SEQUENCES[s].is_valid);
+            }
+        }
+    }
+}
+
+void utf8_is_valid_truncated_test(void** state) {
+    (void)state;
+
+    uint8_t buffer[160];
+    const char* const sequences[] = { "\xC2\x80", "\xE2\x82\xAC", "\xF0\x9F\x98\x80" };
+
+    // Sequences cut off by the end of the input, at and around block boundaries
+    for (size_t s = 0; s < sizeof(sequences) / sizeof(sequences[0]); ++s) {
+        const size_t length = strlen(sequences[s]);
+        for (size_t offset = 0; offset < 100; ++offset) {
+            memset(buffer, 'a', offset);
+            memcpy(buffer + offset, sequences[s], length);
+            for (size_t cut = 1; cut < length; ++cut)
+                test_utf8_check(buffer, offset + cut, false);
+            test_utf8_check(buffer, offset + length, true);
+        }
+    }
+
+    test_utf8_check(buffer, 0, true);
+}
+
+void utf8_is_valid_random_test(void** state) {
+    (void)state;
+
+    const char* const pieces[] = { "a", "\xC3\xA9", "\xE2\x82\xAC", "\xF0\x9F\x98\x80", "\xED\x9F\xBF" };
+    uint8_t buffer[300];
+    uint32_t random = 31337;
+
+    // Valid text of random lengths, with a single random byte replaced in half of the inputs
+    for (size_t i = 0; i < 20000; ++i) {
+        random = random * 1103515245u + 12345u;
+        const size_t target = (random >> 8) % 280;
+
+        size_t size = 0;
+        while (size < target) {
+            random = random * 1103515245u + 12345u;
+            const char* const piece = pieces[(random >> 8) % 5];
+            memcpy(buffer + size, piece, strlen(piece));
+            size += strlen(piece);
+        }
+        if (size > 0 && i % 2 == 1) {
+            random = random * 1103515245u + 12345u;
+            buffer[(random >> 8) % size] = (uint8_t)(random >> 20);
+        }
+
+        assert_int_equal(nc_utf8_is_valid(buffer, size), nc_utf8_is_valid_scalar(buffer, size));
+    }
+}
+
+// Fills data with ASCII and multibyte characters, returns number of codepoints
+static size_t test_utf8_fill_mixed(uint8_t* data, size_t size) {
+    const char* const pieces[] = { "ab", "\xC3\xA9", "\xE2\x82\xAC", "\xF0\x9F\x98\x80" };
+    size_t count = 0;
+    size_t i = 0;
+    for (size_t p = 0; i < size; ++p) {
+        const char* const piece = pieces[p * 7 % 4];
+        const size_t length = strlen(piece);
+        if (i + length > size) {
+            memset(data + i, 'x', size - i);
+            return count + (size - i);
+        }
+
+        memcpy(data + i, piece, length);
+        count += piece[0] == 'a' ? 2 : 1;
+        i += length;
+    }
+
+    return count;
+}
+
+static size_t test_utf8_char_to_byte_reference(const uint8_t* data, size_t size, size_t char_index) {
+    for (size_t i = 0; i < size; ++i) {
+        if (nc_utf8_is_continuation_byte(data[i]))
+            continue;
+        if (char_index == 0)
+            return i;
+
+        --char_index;
+    }
+
+    return size;
+}
+
+void utf8_count_codepoints_test(void** state) {
+    (void)state;
+
+    // Byte sums are flushed every 255 blocks of 16 or 32 bytes, sizes go around multiples of that
+    enum { MAX_SIZE = 255 * 32 * 3 + 100 };
+    const size_t sizes[] = {
+        0, 1, 15, 16, 31, 32, 33, 255 * 16 - 1, 255 * 16, 255 * 16 + 1,
+        255 * 32 - 1, 255 * 32, 255 * 32 + 1, 255 * 32 * 2 + 31, 255 * 32 * 3 + 100
+    };
+    uint8_t* const data = malloc(MAX_SIZE);
+    assert_non_null(data);
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+        // Only codepoint starts, so every byte lane reaches its maximum sum before the flush
+        memset(data, 'a', sizes[s]);
+        assert_int_equal(nc_utf8_count_codepoints(data, sizes[s]), sizes[s]);
+
+        const size_t expected = test_utf8_fill_mixed(data, sizes[s]);
+        assert_int_equal(nc_utf8_count_codepoints(data, sizes[s]), expected);
+        assert_int_equal(nc_utf8_count_codepoints_scalar(data, sizes[s]), expected);
+    }
+
+    free(data);
+}
+
+void utf8_char_to_byte_test(void** state) {
+    (void)state;
+
+    enum { SIZE = 3000 };
+    uint8_t* const data = malloc(SIZE);
+    assert_non_null(data);
+    const size_t char_count = test_utf8_fill_mixed(data, SIZE);
+
+    for (size_t char_index = 0; char_index <= char_count + 40; ++char_index)
+        assert_int_equal(nc_utf8_char_to_byte(data, SIZE, char_index), test_utf8_char_to_byte_reference(data, SIZE, char_index));
+
+    // Short inputs and distances take the scalar path
+    for (size_t size = 0; size < 40; ++size) {
+        for (size_t char_index = 0; char_index < 45; ++char_index)
+            assert_int_equal(nc_utf8_char_to_byte(data, size, char_index), test_utf8_char_to_byte_reference(data, size, char_index));
+    }
+
+    free(data);
+}
+
+static const struct CMUnitTest utf8_tests[] = {
+    cmocka_unit_test(utf8_is_valid_sequences_test),
+    cmocka_unit_test(utf8_is_valid_truncated_test),
+    cmocka_unit_test(utf8_is_valid_random_test),
+    cmocka_unit_test(utf8_count_codepoints_test),
+    cmocka_unit_test(utf8_char_to_byte_test)
+};